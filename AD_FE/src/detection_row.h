@@ -0,0 +1,144 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// ================= DETECTION ROW =================
+// The CSV line onMqtt publishes, written field by field into one static
+// buffer in a single pass, instead of a String grown by a dozen
+// concatenations and String(float, n) temporaries: no heap, no printf. Each
+// field after Time is preceded by a comma.
+//
+// row_fixed prints a float the way String(v, d) does on the ESP32 (the core's
+// dtostrf): d decimals, rounded half away from zero, "nan" and "inf" (either
+// sign), "-0.00" for a small negative. It rounds on the float's exact value in
+// integer arithmetic, where dtostrf adds 0.5e-d in double; the two can only
+// differ when that addition itself rounds. |v| >= 2^49 prints "ovf".
+//
+// -DDETECTION_COMPACT=1 leaves out the four raw channels the sender already
+// has, so a row is Time,Label,FeatTime,TestTime,Score (multi builds: Time,
+// FeatTime, then the heads). get.py --compact writes the matching header.
+
+#ifndef DETECTION_COMPACT
+#define DETECTION_COMPACT 0
+#endif
+
+#ifndef DETECTION_ROW_MAX
+#define DETECTION_ROW_MAX 160
+#endif
+
+#define ROW_MAX_DECIMALS 4
+
+struct DetectionRow {
+    char buf[DETECTION_ROW_MAX];
+    size_t len;
+    int fields;
+};
+
+DetectionRow detection_row;
+
+static const uint32_t ROW_POW10[ROW_MAX_DECIMALS + 1] = { 1, 10, 100, 1000, 10000 };
+
+// n chars, or as many as fit.
+static void row_put(DetectionRow& r, const char* s, size_t n) {
+    size_t room = sizeof(r.buf) - 1 - r.len;
+    if(n > room) n = room;
+    memcpy(r.buf + r.len, s, n);
+    r.len += n;
+}
+
+static void row_sep(DetectionRow& r) {
+    if(r.fields++ > 0) row_put(r, ",", 1);
+}
+
+// Starts a row with its Time field.
+void row_begin(DetectionRow& r, const char* time, size_t n) {
+    r.len = 0;
+    r.fields = 1;
+    row_put(r, time, n);
+}
+
+// An empty field (a label-only head's score).
+void row_empty(DetectionRow& r) {
+    row_sep(r);
+}
+
+void row_int(DetectionRow& r, int v) {
+    row_sep(r);
+    char tmp[12];
+    char* p = tmp + sizeof(tmp);
+    uint32_t u = (v < 0) ? 0u - (uint32_t)v : (uint32_t)v;
+    do { *--p = (char)('0' + u % 10); u /= 10; } while(u);
+    if(v < 0) *--p = '-';
+    row_put(r, p, (size_t)(tmp + sizeof(tmp) - p));
+}
+
+void row_fixed(DetectionRow& r, float v, int decimals) {
+    row_sep(r);
+    if(decimals < 0) decimals = 0;
+    if(decimals > ROW_MAX_DECIMALS) decimals = ROW_MAX_DECIMALS;
+
+    uint32_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    int exp = (int)((bits >> 23) & 0xFF);
+    uint32_t mant = bits & 0x7FFFFF;
+    if(exp == 0xFF) { row_put(r, mant ? "nan" : "inf", 3); return; }
+    if(exp) mant |= 0x800000;
+    int e = (exp ? exp : 1) - 150;                          // |v| = mant * 2^e
+    uint64_t m = (uint64_t)mant * ROW_POW10[decimals];     // < 2^38
+    uint64_t q;
+    if(e >= 0) {
+        if(e > 25) { row_put(r, "ovf", 3); return; }
+        q = m << e;
+    } else if(e > -40) {
+        int sh = -e;
+        q = m >> sh;
+        if((m >> (sh - 1)) & 1) q++;                        // the half bit: round half away from zero
+    } else {
+        q = 0;                                              // below 2^-2 units of the last place
+    }
+
+    // Digits from the right, the point after `decimals` of them.
+    char tmp[24];
+    char* p = tmp + sizeof(tmp);
+    int n = 0;
+    if(q <= 0xFFFFFFFFu) {
+        uint32_t q32 = (uint32_t)q;                         // 32-bit division on the ESP32
+        do {
+            if(n++ == decimals && decimals > 0) *--p = '.';
+            *--p = (char)('0' + q32 % 10);
+            q32 /= 10;
+        } while(q32 || n <= decimals);
+    } else {
+        do {
+            if(n++ == decimals && decimals > 0) *--p = '.';
+            *--p = (char)('0' + q % 10);
+            q /= 10;
+        } while(q || n <= decimals);
+    }
+    if(v < 0.0f) *--p = '-';
+    row_put(r, p, (size_t)(tmp + sizeof(tmp) - p));
+}
+
+// A head's score, or an empty field when the head has none.
+void row_score(DetectionRow& r, float score, bool with_score) {
+    if(with_score) row_fixed(r, score, 4);
+    else row_empty(r);
+}
+
+// Temperature, Humidity, Humidity_WeatherStation, Temperature_WeatherStation,
+// two decimals; nothing in compact mode.
+void row_raw(DetectionRow& r, const float* raw) {
+#if !DETECTION_COMPACT
+    row_fixed(r, raw[IDX_TEMPERATURE], 2);
+    row_fixed(r, raw[IDX_HUMIDITY], 2);
+    row_fixed(r, raw[IDX_HUMIDITY_WEATHERSTATION], 2);
+    row_fixed(r, raw[IDX_TEMPERATURE_WEATHERSTATION], 2);
+#endif
+}
+
+// Terminates the row; the text to publish.
+const char* row_end(DetectionRow& r) {
+    r.buf[r.len] = '\0';
+    return r.buf;
+}
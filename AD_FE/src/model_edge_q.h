@@ -0,0 +1,15 @@
+#pragma once
+#include <stdint.h>
+// Generated by host/quantise_linear.cpp; parameters for linear_q.h.
+
+// ===== LR: inputs have room for 2^20 std =====
+static const int8_t LR_Q_SHIFT[] = { 9, 9, 8, 6, 11, 11, 9, 9, 7, 6, 10, 11, 9, 9, 8, 7, 13, 11, 9, 9, 8, 6, 13, 11 };
+static const int32_t LR_Q_MEAN[] = { -177, -131, 1451, 1122, 111, 1444, -56, -64, 675, 1006, 39, 1536, -113, -109, 1752, 2527, -80, 1103, -102, -67, 1665, 1168, 142, 1247 };
+#define LR_Q_POLARITY 1
+#define LR_Q_SCORE_MUL 65536
+#define LR_Q16_ACC_FRAC 22
+static const int16_t LR_Q16_COEF[] = { 2655, -12295, 2638, -4803, -4528, -9059, -11374, 25814, -3698, 5316, -4138, 4304, 297, 4656, -3994, 2494, 536, 9813, -2187, 738, -1473, -6817, 2886, -19870 };
+static const int64_t LR_Q16_THRESHOLD = -535013LL;
+#define LR_Q8_ACC_FRAC 14
+static const int8_t LR_Q8_COEF[] = { 10, -48, 10, -19, -18, -35, -44, 101, -14, 21, -16, 17, 1, 18, -16, 10, 2, 38, -9, 3, -6, -27, 11, -78 };
+static const int64_t LR_Q8_THRESHOLD = -2090LL;
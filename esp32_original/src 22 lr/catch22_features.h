@@ -0,0 +1,186 @@
+#pragma once
+#include <vector>
+#include <cmath>
+#include "catch22_settings.h"
+#include "checkpoint.h"
+
+float history_buffer[NUM_RAW_INPUTS][C22_WINDOW_SIZE];
+int buffer_idx = 0;
+bool buffer_full = false;
+
+// ================= CATCH22 ALGORITHMS =================
+float c22_histogram_mode(const std::vector<float>& x, int bins) {
+    if(x.empty()) return 0.0f;
+    float min_v = x[0], max_v = x[0];
+    for(float v : x) {
+        if(v < min_v) min_v = v;
+        if(v > max_v) max_v = v;
+    }
+    if (abs(max_v - min_v) < 1e-9) return 0.0f;
+
+    std::vector<int> counts(bins, 0);
+    float step = (max_v - min_v) / bins;
+    
+    for(float v : x) {
+        int idx = (int)((v - min_v) / step);
+        if(idx >= bins) idx = bins - 1;
+        counts[idx]++;
+    }
+    
+    int max_count = -1;
+    int max_idx = 0;
+    for(int i=0; i<bins; i++) {
+        if(counts[i] > max_count) {
+            max_count = counts[i];
+            max_idx = i;
+        }
+    }
+    return min_v + (max_idx + 0.5f) * step;
+}
+
+float c22_co_f1ecac(const std::vector<float>& x) {
+    size_t N = x.size();
+    if(N < 2) return 0.0f;
+    float mean = 0.0f;
+    for(float v : x) mean += v;
+    mean /= N;
+    float var = 0.0f;
+    for(float v : x) var += (v - mean) * (v - mean);
+    if(var < 1e-9) return (float)N;
+    float thresh = 0.367879f; 
+    for(size_t tau=1; tau < N; tau++) {
+        float cov = 0.0f;
+        for(size_t i=0; i < N - tau; i++) cov += (x[i] - mean) * (x[i+tau] - mean);
+        if(cov / var < thresh) return (float)tau;
+    }
+    return (float)N;
+}
+
+float c22_co_first_min_ac(const std::vector<float>& x) {
+    size_t N = x.size();
+    if(N < 2) return 0.0f;
+    float mean = 0.0f;
+    for(float v : x) mean += v;
+    mean /= N;
+    float var = 0.0f;
+    for(float v : x) var += (v - mean) * (v - mean);
+    if(var < 1e-9) return 0.0f;
+    float prev_ac = 1.0f;
+    for(size_t tau=1; tau < N; tau++) {
+        float cov = 0.0f;
+        for(size_t i=0; i < N - tau; i++) cov += (x[i] - mean) * (x[i+tau] - mean);
+        float ac = cov / var;
+        if (ac > prev_ac) return (float)(tau - 1);
+        prev_ac = ac;
+    }
+    return (float)N;
+}
+
+float c22_co_trev_1_num(const std::vector<float>& x) {
+    size_t N = x.size();
+    if(N < 2) return 0.0f;
+    float sum_val = 0.0f;
+    for(size_t i=0; i < N - 1; i++) {
+        float diff = x[i+1] - x[i];
+        sum_val += (diff * diff * diff);
+    }
+    return sum_val / (N - 1);
+}
+
+float c22_md_hrv_pnn40(const std::vector<float>& x) {
+    size_t N = x.size();
+    if(N < 2) return 0.0f;
+    int count = 0;
+    for(size_t i=0; i < N - 1; i++) {
+        if(abs(x[i+1] - x[i]) > 0.04f) count++;
+    }
+    return (float)count / (N - 1);
+}
+
+// Hop scheduling: consecutive windows share all but one sample, so
+// extract_catch22_features_hop recomputes the features only every catch22_hop
+// samples (C22_HOP by default) and the caller reuses its last decision in
+// between (hop.h). Every sample still enters the window.
+int catch22_hop = C22_HOP;
+int catch22_pending = 0;         // samples pushed since the features were last computed
+int catch22_gap = 0;             // samples between the last two computations (hop.h's slope)
+bool catch22_computed = false;
+
+// What a checkpoint saves (checkpoint.h): the window. The hop counters are
+// left to restart, so the first sample after a restore computes.
+int catch22_checkpoint_regions(CheckpointRegion* out) {
+    out[0] = { history_buffer, sizeof(history_buffer) };
+    out[1] = { &buffer_idx, sizeof(buffer_idx) };
+    out[2] = { &buffer_full, sizeof(buffer_full) };
+    return 3;
+}
+
+// Empties the window as a reboot would, for the reset command.
+void reset_catch22_state() {
+    for(int i=0; i<NUM_RAW_INPUTS; i++) {
+        for(int j=0; j<C22_WINDOW_SIZE; j++) history_buffer[i][j] = 0.0f;
+    }
+    buffer_idx = 0;
+    buffer_full = false;
+    catch22_pending = 0;
+    catch22_gap = 0;
+    catch22_computed = false;
+}
+
+// Appends one reading to the window without computing features (the
+// pre-filter uses it for readings it decides on its own).
+void push_catch22_sample(const float* raw) {
+    for(int i=0; i<NUM_RAW_INPUTS; i++) {
+        history_buffer[i][buffer_idx] = raw[i];
+    }
+    buffer_idx = (buffer_idx + 1) % C22_WINDOW_SIZE;
+    if (buffer_idx == 0) buffer_full = true;
+    catch22_pending++;
+}
+
+// Window features of the samples pushed so far.
+void compute_catch22_features(float* out) {
+    int f_idx = 0;
+    int count = buffer_full ? C22_WINDOW_SIZE : buffer_idx;
+
+    for (int s = 0; s < NUM_RAW_INPUTS; s++) {
+        std::vector<float> x;
+        x.reserve(count);
+        if (buffer_full) {
+            for(int i=buffer_idx; i<C22_WINDOW_SIZE; i++) x.push_back(history_buffer[s][i]);
+            for(int i=0; i<buffer_idx; i++) x.push_back(history_buffer[s][i]);
+        } else {
+            for(int i=0; i<buffer_idx; i++) x.push_back(history_buffer[s][i]);
+        }
+        
+        if (x.size() < 5) {
+            for(int k=0; k<6; k++) out[f_idx++] = 0.0f;
+            continue;
+        }
+
+        out[f_idx++] = c22_histogram_mode(x, 5);
+        out[f_idx++] = c22_histogram_mode(x, 10);
+        out[f_idx++] = c22_co_f1ecac(x);
+        out[f_idx++] = c22_co_first_min_ac(x);
+        out[f_idx++] = c22_co_trev_1_num(x);
+        out[f_idx++] = c22_md_hrv_pnn40(x);
+    }
+    catch22_gap = catch22_pending;   // more than catch22_hop when the pre-filter pushed some
+    catch22_pending = 0;
+    catch22_computed = true;
+}
+
+void extract_catch22_features(float* raw, float* out) {
+    push_catch22_sample(raw);
+    compute_catch22_features(out);
+}
+
+// Pushes raw; computes the features into out only on the first sample and
+// once catch22_hop samples have been pushed since the last computation.
+// Returns whether out was written.
+bool extract_catch22_features_hop(float* raw, float* out) {
+    push_catch22_sample(raw);
+    if(catch22_computed && catch22_pending < catch22_hop) return false;
+    compute_catch22_features(out);
+    return true;
+}
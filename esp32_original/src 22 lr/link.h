@@ -0,0 +1,140 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include "outbox.h"
+
+// ================= CONNECTION STATE MACHINE =================
+// Wi-Fi and MQTT used to be brought up by loops that sat in delay(500) /
+// delay(2000) until they succeeded, at boot and whenever the broker went
+// away, and nothing was processed meanwhile. link_poll, called from every
+// loop() pass, instead makes at most one attempt and returns:
+//
+//   LINK_WIFI  Wi-Fi down: (re)started, then waited for with a backoff.
+//   LINK_MQTT  Wi-Fi up: one client.connect() each time the backoff runs out.
+//   LINK_UP    both up; a drop of either goes back to the state above.
+//
+// The backoff starts at LINK_BACKOFF_MIN_MS and doubles after every failed
+// attempt up to LINK_BACKOFF_MAX_MS; coming up resets it. While the link is
+// down loop() keeps running: queued samples are processed and their rows go
+// to the outbox (outbox.h), which is flushed once the link is back.
+//
+// A connect attempt still blocks for its TCP connect and its wait for the
+// broker's CONNACK, the latter bounded by LINK_SOCKET_TIMEOUT_S (PubSubClient
+// waits 15 s by default). With PIPELINE the inference task runs on through it.
+//
+// The radio and the client are reached through LinkOps, so host/bench_link.cpp
+// runs the same state machine against a TCP broker stand-in.
+
+#ifndef LINK_BACKOFF_MIN_MS
+#define LINK_BACKOFF_MIN_MS 500
+#endif
+#ifndef LINK_BACKOFF_MAX_MS
+#define LINK_BACKOFF_MAX_MS 30000
+#endif
+#ifndef LINK_SOCKET_TIMEOUT_S
+#define LINK_SOCKET_TIMEOUT_S 3
+#endif
+
+enum LinkState { LINK_WIFI, LINK_MQTT, LINK_UP };
+
+struct LinkOps {
+    bool (*wifi_up)(void* ctx);
+    void (*wifi_begin)(void* ctx);
+    bool (*mqtt_up)(void* ctx);
+    bool (*mqtt_connect)(void* ctx);    // one attempt; true once connected
+    void* ctx;
+};
+
+struct Link {
+    LinkOps ops;
+    LinkState state;
+    unsigned long next_ms;      // next attempt
+    unsigned long backoff_ms;
+    unsigned long down_ms;      // when the link last went down
+    uint32_t attempts;          // client.connect() calls
+    uint32_t connects;          // of those, succeeded
+    uint32_t drops;             // times the link went down once up
+};
+
+Link net_link;     // not "link": unistd.h declares link()
+
+void link_begin(Link& l, const LinkOps& ops, unsigned long now_ms) {
+    l = Link();
+    l.ops = ops;
+    l.state = LINK_WIFI;
+    l.next_ms = now_ms;
+    l.backoff_ms = LINK_BACKOFF_MIN_MS;
+    l.down_ms = now_ms;
+}
+
+bool link_up(const Link& l) {
+    return l.state == LINK_UP;
+}
+
+static void link_retry(Link& l, unsigned long now_ms) {
+    l.next_ms = now_ms + l.backoff_ms;
+    l.backoff_ms = (l.backoff_ms * 2 < LINK_BACKOFF_MAX_MS) ? l.backoff_ms * 2 : LINK_BACKOFF_MAX_MS;
+}
+
+static void link_down(Link& l, LinkState to, unsigned long now_ms) {
+    l.state = to;
+    l.drops++;
+    l.down_ms = now_ms;
+    l.next_ms = now_ms;     // the first attempt right away
+    l.backoff_ms = LINK_BACKOFF_MIN_MS;
+}
+
+// One step, never more than one attempt. Returns true when the link has just
+// come up.
+bool link_poll(Link& l, unsigned long now_ms) {
+    switch(l.state) {
+    case LINK_UP:
+        if(!l.ops.wifi_up(l.ops.ctx)) link_down(l, LINK_WIFI, now_ms);
+        else if(!l.ops.mqtt_up(l.ops.ctx)) link_down(l, LINK_MQTT, now_ms);
+        return false;
+    case LINK_WIFI:
+        if(l.ops.wifi_up(l.ops.ctx)) {
+            l.state = LINK_MQTT;
+            l.next_ms = now_ms;
+            l.backoff_ms = LINK_BACKOFF_MIN_MS;
+            return link_poll(l, now_ms);
+        }
+        if((long)(now_ms - l.next_ms) < 0) return false;
+        l.ops.wifi_begin(l.ops.ctx);
+        link_retry(l, now_ms);
+        return false;
+    case LINK_MQTT:
+        if(!l.ops.wifi_up(l.ops.ctx)) {
+            l.state = LINK_WIFI;
+            l.next_ms = now_ms;
+            return false;
+        }
+        if((long)(now_ms - l.next_ms) < 0) return false;
+        l.attempts++;
+        if(!l.ops.mqtt_connect(l.ops.ctx)) {
+            link_retry(l, now_ms);
+            return false;
+        }
+        l.state = LINK_UP;
+        l.connects++;
+        l.backoff_ms = LINK_BACKOFF_MIN_MS;
+        return true;
+    }
+    return false;
+}
+
+// {"stats": true}: the link and the outbox.
+int link_stats_json(const Link& l, const Outbox& o, char* buf, size_t n) {
+    static const char* const names[] = { "wifi", "mqtt", "up" };
+    int len = snprintf(buf, n, "{\"link\": \"%s\", \"attempts\": %lu, \"connects\": %lu, \"drops\": %lu, ",
+                       names[l.state], (unsigned long)l.attempts, (unsigned long)l.connects,
+                       (unsigned long)l.drops);
+    if(len < 0 || (size_t)len >= n) return len;
+    len += outbox_stats_json(o, buf + len, n - len);
+    if((size_t)len + 1 < n) {
+        buf[len++] = '}';
+        buf[len] = '\0';
+    }
+    return len;
+}
@@ -0,0 +1,270 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+// ================= WARM-START CHECKPOINT =================
+// With -DCHECKPOINT=1 the extractor's state is saved to flash while the
+// firmware runs and read back in setup(). The state is what the features
+// header lists in its *_checkpoint_regions: windows, rings, lags, EWMA and
+// sample counts. After a reboot the windows are full again, and the warm
+// model answers the first message instead of the cold one, or zero features.
+//
+// The regions are copied one after the other into an image, which is stored
+// as CHECKPOINT_BLOCK-byte blocks, one key each, plus a header key last:
+//   - delta writes: a save writes only the blocks whose CRC differs from the
+//     one last written. The windows are saved slot by slot as they sit in
+//     memory, so between two saves only the slots written since change;
+//   - a restore reads every block and checks the image CRC, the size and the
+//     layout tag in the header. A save cut short by a reset mixes two
+//     generations of blocks and is refused like a missing or foreign
+//     checkpoint: the build then starts cold, as it did before.
+// Wear: NVS appends every write to its pages and levels the erases itself;
+// what the firmware controls is how much it writes. Besides the delta, saves
+// are CHECKPOINT_EVERY samples and at least CHECKPOINT_MIN_MS apart: with the
+// defaults, every sample of a slow feed (the datasets' 30 minutes) and every
+// 10 minutes of a fast one, which keeps a default 5-page NVS partition within
+// its erase cycles for 15 years or more (host/README.md). Checkpoint counts the
+// blocks, bytes and NVS entries that went to flash. Each key costs NVS two
+// entries on top of its data, so the delta pays off when few blocks change
+// between saves; the RFE rings all move on every sample and are rewritten
+// whole.
+//
+// The store is a pair of functions (CheckpointStore): NVS through
+// Preferences on the ESP32, or one file per key in a directory, which is
+// what host/bench_checkpoint.cpp runs against.
+
+#ifndef CHECKPOINT
+#define CHECKPOINT 0
+#endif
+#ifndef CHECKPOINT_EVERY
+#define CHECKPOINT_EVERY 1          // samples between saves
+#endif
+#ifndef CHECKPOINT_MIN_MS
+#define CHECKPOINT_MIN_MS 600000    // and at least this long
+#endif
+#ifndef CHECKPOINT_BLOCK
+#define CHECKPOINT_BLOCK 64
+#endif
+#ifndef CHECKPOINT_MAX
+#define CHECKPOINT_MAX 2048         // image bytes
+#endif
+#define CHECKPOINT_MAX_REGIONS 96
+#define CHECKPOINT_MAGIC 0x31504B43u    // "CKP1"
+#define CHECKPOINT_BLOCKS ((CHECKPOINT_MAX + CHECKPOINT_BLOCK - 1) / CHECKPOINT_BLOCK)
+
+struct CheckpointRegion {
+    void* p;
+    size_t n;
+};
+
+struct CheckpointStore {
+    // Reads key into buf; false when it is missing or not exactly n bytes.
+    bool (*read)(void* ctx, const char* key, void* buf, size_t n);
+    bool (*write)(void* ctx, const char* key, const void* buf, size_t n);
+    void* ctx;
+};
+
+struct CheckpointHeader {
+    uint32_t magic;
+    uint32_t tag;       // extractor name and region sizes
+    uint32_t size;      // image bytes
+    uint32_t crc;       // of the image
+    uint32_t seq;       // saves so far
+};
+
+struct Checkpoint {
+    CheckpointStore store;
+    const char* name;
+    uint8_t image[CHECKPOINT_MAX];
+    uint32_t block_crc[CHECKPOINT_BLOCKS];  // what the store holds, when known
+    bool known;
+    uint32_t seq;
+    uint32_t image_crc;
+    uint32_t samples;           // since the last save
+    unsigned long last_ms;
+    uint32_t saves;
+    uint32_t blocks_written;
+    uint32_t blocks_skipped;    // unchanged since the last save
+    uint32_t bytes_written;     // headers included
+    uint32_t entries_written;   // the 32-byte NVS entries those writes take
+};
+
+uint32_t checkpoint_crc(const void* p, size_t n, uint32_t crc = 0) {
+    const uint8_t* b = (const uint8_t*)p;
+    crc = ~crc;
+    for(size_t i=0; i<n; i++) {
+        crc ^= b[i];
+        for(int k=0; k<8; k++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+    }
+    return ~crc;
+}
+
+static uint32_t cp_tag(const char* name, const CheckpointRegion* r, int n_regions) {
+    uint32_t tag = checkpoint_crc(name, strlen(name));
+    for(int i=0; i<n_regions; i++) {
+        uint32_t n = (uint32_t)r[i].n;
+        tag = checkpoint_crc(&n, sizeof(n), tag);
+    }
+    return tag;
+}
+
+static size_t cp_size(const CheckpointRegion* r, int n_regions) {
+    size_t n = 0;
+    for(int i=0; i<n_regions; i++) n += r[i].n;
+    return n;
+}
+
+static void cp_block_key(char* key, int b) { snprintf(key, 16, "b%d", b); }
+
+// One write of n bytes: NVS stores a blob as a data item (a header entry and
+// the data, 32 bytes an entry) and an index entry.
+static void cp_count(Checkpoint& cp, size_t n) {
+    cp.bytes_written += (uint32_t)n;
+    cp.entries_written += (uint32_t)(2 + (n + 31) / 32);
+}
+
+void checkpoint_begin(Checkpoint& cp, const CheckpointStore& store, const char* name) {
+    memset(&cp, 0, sizeof(cp));
+    cp.store = store;
+    cp.name = name;
+}
+
+// Writes the regions' current contents: the blocks that changed, then the
+// header. Returns false when the image does not fit or the store fails (the
+// next save then writes every block again).
+bool checkpoint_save(Checkpoint& cp, const CheckpointRegion* r, int n_regions, unsigned long now_ms) {
+    size_t size = cp_size(r, n_regions);
+    if(size > CHECKPOINT_MAX) return false;
+    size_t off = 0;
+    for(int i=0; i<n_regions; i++) {
+        memcpy(cp.image + off, r[i].p, r[i].n);
+        off += r[i].n;
+    }
+    cp.samples = 0;
+    cp.last_ms = now_ms;
+    uint32_t crc = checkpoint_crc(cp.image, size);
+    if(cp.known && crc == cp.image_crc) {
+        cp.blocks_skipped += (uint32_t)((size + CHECKPOINT_BLOCK - 1) / CHECKPOINT_BLOCK);
+        return true;
+    }
+
+    char key[16];
+    for(size_t b=0; b * CHECKPOINT_BLOCK < size; b++) {
+        size_t n = (size - b * CHECKPOINT_BLOCK < CHECKPOINT_BLOCK) ? size - b * CHECKPOINT_BLOCK : CHECKPOINT_BLOCK;
+        uint32_t bc = checkpoint_crc(cp.image + b * CHECKPOINT_BLOCK, n);
+        if(cp.known && bc == cp.block_crc[b]) { cp.blocks_skipped++; continue; }
+        cp_block_key(key, (int)b);
+        if(!cp.store.write(cp.store.ctx, key, cp.image + b * CHECKPOINT_BLOCK, n)) { cp.known = false; return false; }
+        cp.block_crc[b] = bc;
+        cp.blocks_written++;
+        cp_count(cp, n);
+    }
+    // The store holds these blocks now, even if the header write fails: a
+    // restore then refuses the mix, and the next save rewrites the header.
+    cp.known = true;
+    CheckpointHeader h = { CHECKPOINT_MAGIC, cp_tag(cp.name, r, n_regions), (uint32_t)size, crc, ++cp.seq };
+    if(!cp.store.write(cp.store.ctx, "hdr", &h, sizeof(h))) return false;
+    cp.image_crc = crc;
+    cp.saves++;
+    cp_count(cp, sizeof(h));
+    return true;
+}
+
+// Reads the checkpoint back into the regions. Returns false, with the regions
+// untouched, when there is none, it was saved by another layout, or its
+// blocks do not add up to the CRC the header carries.
+bool checkpoint_restore(Checkpoint& cp, const CheckpointRegion* r, int n_regions) {
+    CheckpointHeader h;
+    size_t size = cp_size(r, n_regions);
+    if(size > CHECKPOINT_MAX) return false;
+    if(!cp.store.read(cp.store.ctx, "hdr", &h, sizeof(h))) return false;
+    if(h.magic != CHECKPOINT_MAGIC || h.tag != cp_tag(cp.name, r, n_regions) || h.size != size) return false;
+
+    char key[16];
+    for(size_t b=0; b * CHECKPOINT_BLOCK < size; b++) {
+        size_t n = (size - b * CHECKPOINT_BLOCK < CHECKPOINT_BLOCK) ? size - b * CHECKPOINT_BLOCK : CHECKPOINT_BLOCK;
+        cp_block_key(key, (int)b);
+        if(!cp.store.read(cp.store.ctx, key, cp.image + b * CHECKPOINT_BLOCK, n)) return false;
+        cp.block_crc[b] = checkpoint_crc(cp.image + b * CHECKPOINT_BLOCK, n);
+    }
+    if(checkpoint_crc(cp.image, size) != h.crc) return false;
+
+    size_t off = 0;
+    for(int i=0; i<n_regions; i++) {
+        memcpy(r[i].p, cp.image + off, r[i].n);
+        off += r[i].n;
+    }
+    cp.known = true;
+    cp.image_crc = h.crc;
+    cp.seq = h.seq;
+    return true;
+}
+
+// Invalidates the stored checkpoint (one header write), so the next boot
+// starts cold; the reset command uses it.
+bool checkpoint_forget(Checkpoint& cp) {
+    CheckpointHeader h = {};
+    cp.image_crc = 0;
+    cp.samples = 0;
+    if(!cp.store.write(cp.store.ctx, "hdr", &h, sizeof(h))) return false;
+    cp_count(cp, sizeof(h));
+    return true;
+}
+
+// Called once per processed sample: true when a save is due.
+bool checkpoint_due(Checkpoint& cp, unsigned long now_ms) {
+    cp.samples++;
+    return cp.samples >= CHECKPOINT_EVERY && (cp.saves == 0 || now_ms - cp.last_ms >= CHECKPOINT_MIN_MS);
+}
+
+// ---- stores ----
+
+static bool cp_file_read(void* ctx, const char* key, void* buf, size_t n) {
+    char path[128];
+    snprintf(path, sizeof(path), "%s/%s", (const char*)ctx, key);
+    FILE* f = fopen(path, "rb");
+    if(!f) return false;
+    size_t got = fread(buf, 1, n, f);
+    bool more = fgetc(f) != EOF;
+    fclose(f);
+    return got == n && !more;
+}
+
+static bool cp_file_write(void* ctx, const char* key, const void* buf, size_t n) {
+    char path[128];
+    snprintf(path, sizeof(path), "%s/%s", (const char*)ctx, key);
+    FILE* f = fopen(path, "wb");
+    if(!f) return false;
+    bool ok = fwrite(buf, 1, n, f) == n;
+    return (fclose(f) == 0) && ok;
+}
+
+// One file per key in dir, which must exist.
+CheckpointStore checkpoint_file_store(const char* dir) {
+    CheckpointStore s = { cp_file_read, cp_file_write, (void*)dir };
+    return s;
+}
+
+#if defined(ARDUINO_ARCH_ESP32)
+#include <Preferences.h>
+
+Preferences checkpoint_prefs;
+
+static bool cp_nvs_read(void* ctx, const char* key, void* buf, size_t n) {
+    Preferences* p = (Preferences*)ctx;
+    return p->getBytesLength(key) == n && p->getBytes(key, buf, n) == n;
+}
+
+static bool cp_nvs_write(void* ctx, const char* key, const void* buf, size_t n) {
+    return ((Preferences*)ctx)->putBytes(key, buf, n) == n;
+}
+
+// The "checkpoint" namespace of the default NVS partition.
+CheckpointStore checkpoint_nvs_store() {
+    checkpoint_prefs.begin("checkpoint", false);
+    CheckpointStore s = { cp_nvs_read, cp_nvs_write, &checkpoint_prefs };
+    return s;
+}
+#endif
@@ -0,0 +1,138 @@
+#pragma once
+#include <stdint.h>
+
+// ================= DEADLINE SCHEDULER =================
+// Every message gets DEADLINE_US from the moment onMqtt is entered, plus the
+// time it is estimated to have waited behind the previous one. Before the
+// work starts, deadline_pick takes the most accurate level whose measured
+// cost still fits what is left; when none fits it takes the cheapest level
+// allowed, so the work per message stays bounded and a burst is drained
+// instead of piling up.
+//
+// The waiting time is not visible to the device (the message sits in the
+// TCP buffer), so it follows the queue recursion
+//   wait = max(0, wait_prev + service_prev - DEADLINE_PERIOD_US)
+// whenever a message starts less than DEADLINE_IDLE_US after the previous one
+// ended, and 0 after an idle gap. DEADLINE_PERIOD_US = 0 assumes the message
+// waited for the whole previous service, the pessimistic bound; a known period
+// sheds less but cannot see a burst, which arrives faster than the period.
+//
+// DEADLINE_SHED only drains a backlog: a message that did not wait always
+// runs a model. A level unused for DEADLINE_REPROBE messages is tried again
+// on the next message that did not wait, so one slow measurement (a cache
+// miss, a WiFi interrupt) does not shut it out for good.
+
+#define DEADLINE_FULL   0   // the full model (the warm one for new)
+#define DEADLINE_TREES  1   // the forest cut to DEADLINE_TREES trees, in RF_*TREE_ORDER
+#define DEADLINE_COLD   2   // new only: cold features and models after warm-up
+#define DEADLINE_LINEAR 3   // LR instead of the forest
+#define DEADLINE_SHED   4   // nothing extracted: the previous decision again
+#define DEADLINE_LEVELS 5
+#define DEADLINE_RULE   5   // not a level: the pre-filter (prefilter.h) decided, nothing was picked
+
+#define DEADLINE_BIT(level) (1u << (level))
+
+#ifndef DEADLINE_PERIOD_US
+#define DEADLINE_PERIOD_US 0
+#endif
+#ifndef DEADLINE_IDLE_US
+#define DEADLINE_IDLE_US 2000
+#endif
+#ifndef DEADLINE_TREES
+#define DEADLINE_TREES 5
+#endif
+#ifndef DEADLINE_REPROBE
+#define DEADLINE_REPROBE 64
+#endif
+
+struct DeadlineSched {
+    uint32_t budget_us, period_us, idle_us;
+    uint32_t allowed;                   // DEADLINE_BIT per level; DEADLINE_FULL is always allowed
+    float cost_us[DEADLINE_LEVELS];     // moving average of the measured work, 0 = not measured yet
+    uint32_t since[DEADLINE_LEVELS];    // messages since the level last ran
+    uint32_t t_rx;                      // onMqtt entry of the current message
+    uint32_t wait_us;                   // its estimated queueing delay
+    uint32_t last_end, last_service;
+    bool has_last;
+    bool has_decision;
+    int label;                          // last decision, republished by DEADLINE_SHED
+    float score;
+    uint32_t used[DEADLINE_LEVELS];
+    uint32_t late;                      // messages that still missed the deadline
+    uint32_t ruled;                     // messages the pre-filter decided (DEADLINE_RULE)
+};
+
+void deadline_init(DeadlineSched& s, uint32_t budget_us, uint32_t period_us, uint32_t allowed) {
+    s = DeadlineSched();
+    s.budget_us = budget_us;
+    s.period_us = period_us;
+    s.idle_us = DEADLINE_IDLE_US;
+    s.allowed = allowed | DEADLINE_BIT(DEADLINE_FULL);
+}
+
+// First thing for each sample; the samples of a batch (batch.h) arrive
+// together, so each one has waited for those before it.
+void deadline_arrive(DeadlineSched& s, uint32_t now_us) {
+    s.t_rx = now_us;
+    if(s.has_last && (uint32_t)(now_us - s.last_end) < s.idle_us) {
+        uint32_t w = s.wait_us + s.last_service;
+        s.wait_us = (w > s.period_us) ? w - s.period_us : 0;
+    } else {
+        s.wait_us = 0;
+    }
+}
+
+// With PIPELINE (pipeline.h) instead of deadline_arrive: the sample was
+// stamped by onMqtt at rx_us, so the time it spent in the ring is measured,
+// not estimated. One that found the ring empty (ahead 0) did not wait; its
+// hand-off to the inference task counts as part of the service.
+void deadline_arrive_queued(DeadlineSched& s, uint32_t rx_us, uint32_t ahead, uint32_t now_us) {
+    if(ahead > 0) {
+        s.t_rx = now_us;
+        s.wait_us = (uint32_t)(now_us - rx_us);
+    } else {
+        s.t_rx = rx_us;
+        s.wait_us = 0;
+    }
+}
+
+// Level for the current message, given the time now.
+int deadline_pick(const DeadlineSched& s, uint32_t now_us) {
+    uint32_t spent = s.wait_us + (uint32_t)(now_us - s.t_rx);
+    float left = (spent < s.budget_us) ? (float)(s.budget_us - spent) : 0.0f;
+    int cheapest = DEADLINE_FULL;
+    for(int level=0; level<DEADLINE_LEVELS; level++) {
+        if(!(s.allowed & DEADLINE_BIT(level))) continue;
+        if(level == DEADLINE_SHED && (!s.has_decision || s.wait_us == 0)) continue;
+        if(s.cost_us[level] <= left) return level;    // unmeasured levels get one try
+        if(s.wait_us == 0 && s.since[level] >= DEADLINE_REPROBE) return level;
+        cheapest = level;
+    }
+    return cheapest;
+}
+
+// After the decision is published. cost_us: extraction + inference at level;
+// measure = false keeps it out of the averages (the new builds' warm-up,
+// where every level runs the cold models). DEADLINE_RULE, a pre-filter
+// decision, touches no level and only closes the message, so the next wait
+// is estimated from when it ended.
+void deadline_done(DeadlineSched& s, int level, int label, float score, uint32_t cost_us, bool measure,
+                   uint32_t now_us)
+{
+    if(level == DEADLINE_RULE) {
+        s.ruled++;
+    } else {
+        if(measure) {
+            float& c = s.cost_us[level];
+            c = (c == 0.0f) ? (float)cost_us : 0.875f * c + 0.125f * (float)cost_us;
+        }
+        if(level != DEADLINE_SHED) { s.label = label; s.score = score; s.has_decision = true; }
+        s.used[level]++;
+        for(int l=0; l<DEADLINE_LEVELS; l++) s.since[l]++;
+        s.since[level] = 0;
+    }
+    s.last_service = (uint32_t)(now_us - s.t_rx);
+    if(s.wait_us + s.last_service > s.budget_us) s.late++;
+    s.last_end = now_us;
+    s.has_last = true;
+}
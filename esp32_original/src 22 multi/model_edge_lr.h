@@ -0,0 +1,7 @@
+#pragma once
+#include <stdint.h>
+#define LR_N_FEATURES 24
+static const float LR_SCALE_MEAN[] = { -0.345925, -0.256083, 5.666628, 17.534018, 0.054044, 0.705093, -0.108649, -0.125611, 5.271984, 15.722354, 0.038028, 0.750205, -0.220051, -0.213182, 6.843994, 19.741364, -0.009769, 0.538575, -0.200087, -0.131411, 6.503111, 18.244618, 0.017388, 0.609078 };
+static const float LR_SCALE_STD[]  = { 0.650748, 0.829888, 1.882127, 6.220583, 0.135037, 0.133711, 0.703444, 0.778839, 2.366533, 7.437454, 0.337566, 0.146693, 0.879196, 0.803170, 1.262642, 3.723799, 0.058771, 0.171153, 0.706507, 0.806236, 1.534211, 5.305865, 0.052933, 0.133098 };
+static const float LR_COEF[] = { 0.210868, -1.245511, 0.303019, -0.455848, -0.298576, -0.591463, -0.976708, 2.454236, -0.267100, 0.603291, -0.341027, 0.308261, 0.031871, 0.456536, -0.307804, 0.283418, 0.061555, 0.820114, -0.188615, 0.072598, -0.137900, -0.551878, 0.298411, -1.291343 };
+static const float LR_BIAS = 0.127557;
@@ -0,0 +1,16 @@
+#pragma once
+#include <stdint.h>
+
+// Random Forest: 10 estimators
+#define RF_N_FEATURES 24
+static const float RF_SCALE_MEAN[] = { -0.345925, -0.256083, 5.666628, 17.534018, 0.054044, 0.705093, -0.108649, -0.125611, 5.271984, 15.722354, 0.038028, 0.750205, -0.220051, -0.213182, 6.843994, 19.741364, -0.009769, 0.538575, -0.200087, -0.131411, 6.503111, 18.244618, 0.017388, 0.609078 };
+static const float RF_SCALE_STD[]  = { 0.650748, 0.829888, 1.882127, 6.220583, 0.135037, 0.133711, 0.703444, 0.778839, 2.366533, 7.437454, 0.337566, 0.146693, 0.879196, 0.803170, 1.262642, 3.723799, 0.058771, 0.171153, 0.706507, 0.806236, 1.534211, 5.305865, 0.052933, 0.133098 };
+
+#define RF_NUM_TREES 10
+static const int RF_TREE_ROOTS[] = { 0, 51, 116, 191, 248, 315, 386, 461, 534, 599 };
+static const int RF_LEFT[] = { 1, 2, 3, -1, 5, 6, 7, -1, -1, 10, 11, 12, -1, -1, -1, 16, -1, -1, 19, 20, 21, 22, -1, -1, 25, -1, -1, -1, -1, 30, 31, -1, -1, -1, 35, 36, 37, -1, -1, 40, 41, -1, 43, -1, -1, -1, 47, 48, -1, -1, -1, 52, 53, 54, 55, 56, 57, -1, -1, -1, -1, 62, 63, -1, -1, -1, 67, -1, 69, 70, 71, 72, -1, -1, -1, -1, 77, 78, -1, -1, -1, 82, 83, 84, 85, 86, -1, 88, -1, -1, -1, 92, 93, 94, -1, -1, -1, 98, -1, -1, 101, 102, 103, -1, -1, -1, 107, 108, -1, -1, -1, 112, -1, 114, -1, -1, 117, 118, -1, 120, 121, -1, -1, 124, 125, -1, 127, -1, 129, -1, 131, -1, -1, -1, 135, 136, 137, -1, -1, 140, 141, -1, 143, -1, -1, -1, 147, 148, 149, 150, 151, -1, 153, -1, -1, 156, -1, -1, 159, -1, 161, -1, 163, -1, -1, 166, 167, -1, 169, 170, -1, -1, -1, 174, 175, -1, -1, -1, 179, -1, 181, 182, 183, -1, 185, -1, -1, -1, 189, -1, -1, 192, 193, -1, 195, 196, 197, 198, -1, -1, 201, -1, 203, -1, -1, 206, 207, -1, 209, -1, -1, 212, 213, -1, -1, -1, 217, -1, -1, 220, 221, 222, 223, -1, -1, -1, 227, 228, 229, -1, 231, 232, -1, -1, -1, 236, 237, 238, -1, -1, 241, -1, -1, 244, -1, -1, -1, -1, 249, 250, 251, 252, -1, -1, -1, 256, 257, 258, -1, 260, 261, -1, 263, -1, -1, 266, -1, -1, 269, 270, -1, -1, -1, 274, -1, 276, 277, 278, -1, -1, 281, 282, -1, -1, -1, 286, 287, -1, -1, -1, 291, 292, 293, 294, -1, -1, 297, -1, 299, -1, -1, 302, -1, 304, -1, -1, 307, -1, 309, 310, 311, -1, -1, -1, -1, 316, 317, 318, 319, -1, -1, 322, 323, 324, -1, -1, -1, 328, 329, -1, 331, -1, -1, -1, 335, 336, 337, -1, 339, -1, 341, -1, -1, 344, -1, 346, 347, 348, -1, -1, -1, 352, -1, -1, 355, 356, 357, 358, -1, 360, -1, -1, -1, 364, -1, -1, -1, 368, 369, 370, -1, -1, -1, 374, 375, 376, -1, 378, -1, -1, 381, -1, 383, -1, -1, -1, 387, 388, 389, 390, 391, 392, -1, 394, 395, -1, -1, -1, -1, 400, 401, 402, 403, -1, -1, -1, -1, -1, 409, 410, 411, -1, 413, 414, -1, -1, 417, -1, -1, 420, -1, 422, -1, -1, 425, 426, -1, -1, 429, 430, -1, -1, -1, 434, 435, -1, -1, 438, -1, 440, 441, -1, -1, -1, 445, 446, -1, 448, 449, -1, -1, 452, 453, -1, 455, -1, -1, -1, 459, -1, -1, 462, 463, 464, 465, 466, -1, 468, -1, -1, 471, 472, -1, 474, 475, -1, -1, 478, -1, -1, -1, 482, 483, 484, 485, 486, -1, -1, 489, -1, -1, 492, -1, -1, 495, -1, -1, -1, 499, 500, 501, 502, -1, 504, 505, -1, -1, -1, -1, -1, 511, 512, -1, -1, 515, 516, 517, 518, -1, -1, -1, 522, -1, 524, -1, -1, 527, -1, -1, 530, 531, -1, -1, -1, 535, 536, 537, 538, 539, -1, -1, 542, 543, -1, 545, -1, -1, 548, 549, -1, -1, 552, 553, -1, -1, 556, -1, -1, 559, 560, 561, -1, -1, 564, 565, 566, -1, -1, -1, 570, 571, -1, -1, 574, -1, -1, 577, 578, 579, 580, -1, -1, 583, -1, -1, -1, -1, 588, 589, -1, -1, 592, -1, 594, -1, 596, -1, -1, -1, 600, 601, 602, -1, 604, -1, -1, 607, 608, -1, -1, 611, -1, 613, -1, -1, 616, 617, 618, -1, 620, -1, 622, -1, 624, -1, -1, 627, 628, 629, -1, -1, -1, 633, -1, 635, -1, -1, 638, 639, 640, -1, -1, -1, -1 };
+static const int RF_RIGHT[] = { 34, 29, 4, -1, 18, 9, 8, -1, -1, 15, 14, 13, -1, -1, -1, 17, -1, -1, 28, 27, 24, 23, -1, -1, 26, -1, -1, -1, -1, 33, 32, -1, -1, -1, 46, 39, 38, -1, -1, 45, 42, -1, 44, -1, -1, -1, 50, 49, -1, -1, -1, 81, 66, 61, 60, 59, 58, -1, -1, -1, -1, 65, 64, -1, -1, -1, 68, -1, 76, 75, 74, 73, -1, -1, -1, -1, 80, 79, -1, -1, -1, 111, 100, 91, 90, 87, -1, 89, -1, -1, -1, 97, 96, 95, -1, -1, -1, 99, -1, -1, 106, 105, 104, -1, -1, -1, 110, 109, -1, -1, -1, 113, -1, 115, -1, -1, 134, 119, -1, 123, 122, -1, -1, 133, 126, -1, 128, -1, 130, -1, 132, -1, -1, -1, 146, 139, 138, -1, -1, 145, 142, -1, 144, -1, -1, -1, 178, 165, 158, 155, 152, -1, 154, -1, -1, 157, -1, -1, 160, -1, 162, -1, 164, -1, -1, 173, 168, -1, 172, 171, -1, -1, -1, 177, 176, -1, -1, -1, 180, -1, 188, 187, 184, -1, 186, -1, -1, -1, 190, -1, -1, 219, 194, -1, 216, 205, 200, 199, -1, -1, 202, -1, 204, -1, -1, 211, 208, -1, 210, -1, -1, 215, 214, -1, -1, -1, 218, -1, -1, 247, 226, 225, 224, -1, -1, -1, 246, 235, 230, -1, 234, 233, -1, -1, -1, 243, 240, 239, -1, -1, 242, -1, -1, 245, -1, -1, -1, -1, 290, 255, 254, 253, -1, -1, -1, 273, 268, 259, -1, 265, 262, -1, 264, -1, -1, 267, -1, -1, 272, 271, -1, -1, -1, 275, -1, 285, 280, 279, -1, -1, 284, 283, -1, -1, -1, 289, 288, -1, -1, -1, 306, 301, 296, 295, -1, -1, 298, -1, 300, -1, -1, 303, -1, 305, -1, -1, 308, -1, 314, 313, 312, -1, -1, -1, -1, 367, 334, 321, 320, -1, -1, 327, 326, 325, -1, -1, -1, 333, 330, -1, 332, -1, -1, -1, 354, 343, 338, -1, 340, -1, 342, -1, -1, 345, -1, 351, 350, 349, -1, -1, -1, 353, -1, -1, 366, 363, 362, 359, -1, 361, -1, -1, -1, 365, -1, -1, -1, 373, 372, 371, -1, -1, -1, 385, 380, 377, -1, 379, -1, -1, 382, -1, 384, -1, -1, -1, 444, 433, 408, 399, 398, 393, -1, 397, 396, -1, -1, -1, -1, 407, 406, 405, 404, -1, -1, -1, -1, -1, 424, 419, 412, -1, 416, 415, -1, -1, 418, -1, -1, 421, -1, 423, -1, -1, 428, 427, -1, -1, 432, 431, -1, -1, -1, 437, 436, -1, -1, 439, -1, 443, 442, -1, -1, -1, 458, 447, -1, 451, 450, -1, -1, 457, 454, -1, 456, -1, -1, -1, 460, -1, -1, 529, 498, 481, 470, 467, -1, 469, -1, -1, 480, 473, -1, 477, 476, -1, -1, 479, -1, -1, -1, 497, 494, 491, 488, 487, -1, -1, 490, -1, -1, 493, -1, -1, 496, -1, -1, -1, 510, 509, 508, 503, -1, 507, 506, -1, -1, -1, -1, -1, 514, 513, -1, -1, 526, 521, 520, 519, -1, -1, -1, 523, -1, 525, -1, -1, 528, -1, -1, 533, 532, -1, -1, -1, 598, 587, 558, 541, 540, -1, -1, 547, 544, -1, 546, -1, -1, 551, 550, -1, -1, 555, 554, -1, -1, 557, -1, -1, 576, 563, 562, -1, -1, 569, 568, 567, -1, -1, -1, 573, 572, -1, -1, 575, -1, -1, 586, 585, 582, 581, -1, -1, 584, -1, -1, -1, -1, 591, 590, -1, -1, 593, -1, 595, -1, 597, -1, -1, -1, 615, 606, 603, -1, 605, -1, -1, 610, 609, -1, -1, 612, -1, 614, -1, -1, 637, 626, 619, -1, 621, -1, 623, -1, 625, -1, -1, 632, 631, 630, -1, -1, -1, 634, -1, 636, -1, -1, 643, 642, 641, -1, -1, -1, -1 };
+static const int RF_FEATURE[] = { 4, 7, 13, -2, 3, 3, 16, -2, -2, 5, 23, 11, -2, -2, -2, 2, -2, -2, 11, 10, 18, 8, -2, -2, 23, -2, -2, -2, -2, 10, 4, -2, -2, -2, 10, 6, 2, -2, -2, 16, 1, -2, 23, -2, -2, -2, 5, 13, -2, -2, -2, 11, 16, 2, 1, 13, 21, -2, -2, -2, -2, 23, 6, -2, -2, -2, 12, -2, 20, 23, 13, 5, -2, -2, -2, -2, 1, 1, -2, -2, -2, 1, 2, 7, 0, 0, -2, 14, -2, -2, -2, 18, 18, 2, -2, -2, -2, 1, -2, -2, 15, 0, 13, -2, -2, -2, 20, 8, -2, -2, -2, 2, -2, 20, -2, -2, 9, 3, -2, 8, 10, -2, -2, 1, 17, -2, 6, -2, 5, -2, 22, -2, -2, -2, 3, 6, 5, -2, -2, 0, 9, -2, 20, -2, -2, -2, 7, 21, 9, 15, 19, -2, 11, -2, -2, 1, -2, -2, 2, -2, 16, -2, 13, -2, -2, 8, 17, -2, 1, 6, -2, -2, -2, 21, 9, -2, -2, -2, 5, -2, 23, 16, 11, -2, 7, -2, -2, -2, 2, -2, -2, 2, 2, -2, 17, 1, 9, 20, -2, -2, 17, -2, 19, -2, -2, 13, 14, -2, 14, -2, -2, 12, 4, -2, -2, -2, 7, -2, -2, 16, 5, 7, 3, -2, -2, -2, 4, 4, 9, -2, 3, 20, -2, -2, -2, 2, 7, 23, -2, -2, 4, -2, -2, 0, -2, -2, -2, -2, 4, 8, 6, 12, -2, -2, -2, 10, 19, 10, -2, 13, 9, -2, 3, -2, -2, 3, -2, -2, 7, 2, -2, -2, -2, 16, -2, 1, 10, 19, -2, -2, 13, 11, -2, -2, -2, 2, 23, -2, -2, -2, 6, 7, 16, 9, -2, -2, 15, -2, 3, -2, -2, 2, -2, 16, -2, -2, 22, -2, 1, 1, 17, -2, -2, -2, -2, 7, 7, 8, 5, -2, -2, 22, 6, 23, -2, -2, -2, 1, 1, -2, 1, -2, -2, -2, 4, 22, 20, -2, 22, -2, 18, -2, -2, 9, -2, 3, 9, 10, -2, -2, -2, 7, -2, -2, 8, 13, 15, 8, -2, 10, -2, -2, -2, 17, -2, -2, -2, 7, 1, 6, -2, -2, -2, 18, 23, 1, -2, 10, -2, -2, 4, -2, 13, -2, -2, -2, 7, 10, 9, 18, 22, 1, -2, 3, 7, -2, -2, -2, -2, 6, 5, 23, 3, -2, -2, -2, -2, -2, 17, 4, 3, -2, 5, 7, -2, -2, 13, -2, -2, 10, -2, 7, -2, -2, 18, 2, -2, -2, 10, 14, -2, -2, -2, 18, 19, -2, -2, 15, -2, 23, 4, -2, -2, -2, 16, 10, -2, 0, 0, -2, -2, 22, 4, -2, 15, -2, -2, -2, 5, -2, -2, 0, 7, 2, 2, 4, -2, 23, -2, -2, 17, 11, -2, 7, 9, -2, -2, 14, -2, -2, -2, 19, 10, 3, 11, 13, -2, -2, 7, -2, -2, 4, -2, -2, 13, -2, -2, -2, 17, 10, 16, 8, -2, 20, 9, -2, -2, -2, -2, -2, 5, 22, -2, -2, 1, 11, 7, 18, -2, -2, -2, 21, -2, 4, -2, -2, 21, -2, -2, 14, 7, -2, -2, -2, 0, 10, 2, 9, 9, -2, -2, 16, 8, -2, 6, -2, -2, 13, 4, -2, -2, 6, 0, -2, -2, 3, -2, -2, 10, 18, 21, -2, -2, 21, 10, 17, -2, -2, -2, 20, 6, -2, -2, 5, -2, -2, 8, 22, 5, 9, -2, -2, 10, -2, -2, -2, -2, 14, 16, -2, -2, 22, -2, 5, -2, 19, -2, -2, -2, 8, 17, 15, -2, 16, -2, -2, 0, 2, -2, -2, 6, -2, 2, -2, -2, 7, 21, 2, -2, 0, -2, 1, -2, 21, -2, -2, 6, 4, 14, -2, -2, -2, 20, -2, 18, -2, -2, 22, 18, 10, -2, -2, -2, -2 };
+static const float RF_THRESHOLD[] = { -0.288269, 0.344143, -1.353361, -2.000000, 0.155288, -1.130765, 0.152787, -2.000000, -2.000000, 0.767324, -0.723210, 1.091063, -2.000000, -2.000000, -2.000000, 0.092859, -2.000000, -2.000000, 1.178460, -0.133189, -1.149910, 1.273897, -2.000000, -2.000000, -1.397475, -2.000000, -2.000000, -2.000000, -2.000000, -0.143627, -0.413978, -2.000000, -2.000000, -2.000000, -0.007930, -0.405086, -1.288630, -2.000000, -2.000000, 1.170643, -0.208954, -2.000000, 0.047379, -2.000000, -2.000000, -2.000000, 0.575559, 0.648319, -2.000000, -2.000000, -2.000000, -0.132495, 0.215046, 1.608708, 0.285431, -0.935383, -0.705751, -2.000000, -2.000000, -2.000000, -2.000000, 0.336350, -0.978159, -2.000000, -2.000000, -2.000000, -1.080799, -2.000000, -0.329398, 1.203263, -1.154314, -1.054443, -2.000000, -2.000000, -2.000000, -2.000000, 0.940336, -0.645557, -2.000000, -2.000000, -2.000000, 0.939107, 0.006623, -0.631116, 0.966525, 0.301375, -2.000000, 0.816825, -2.000000, -2.000000, -2.000000, 1.085433, -0.730945, -0.091719, -2.000000, -2.000000, -2.000000, -0.267382, -2.000000, -2.000000, 0.472269, -1.055621, 1.137996, -2.000000, -2.000000, -2.000000, 1.179359, 0.446599, -2.000000, -2.000000, -2.000000, 1.451842, -2.000000, 1.372599, -2.000000, -2.000000, -1.239988, -1.934548, -2.000000, -1.782938, 0.993923, -2.000000, -2.000000, 0.714238, -1.348983, -2.000000, -0.727416, -2.000000, 0.192029, -2.000000, 1.709573, -2.000000, -2.000000, -2.000000, -0.809252, -0.464286, -0.766796, -2.000000, -2.000000, 0.794808, 0.239013, -2.000000, -0.277383, -2.000000, -2.000000, -2.000000, 0.372216, 0.613544, 0.171785, -1.266612, -0.101630, -2.000000, -0.656877, -2.000000, -2.000000, -0.680876, -2.000000, -2.000000, -0.110642, -2.000000, -0.162465, -2.000000, -1.114091, -2.000000, -2.000000, 0.830418, 0.673499, -2.000000, 0.161793, -0.816018, -2.000000, -2.000000, -2.000000, 0.990485, 0.642377, -2.000000, -2.000000, -2.000000, 0.000264, -2.000000, 0.047379, 0.409428, 0.916269, -2.000000, 1.647000, -2.000000, -2.000000, -2.000000, 0.382045, -2.000000, -2.000000, -0.109295, -1.693682, -2.000000, 0.523686, 0.259026, -1.239988, -1.136639, -2.000000, -2.000000, 0.373872, -2.000000, -0.344936, -2.000000, -2.000000, 0.185817, 0.826415, -2.000000, 0.929927, -2.000000, -2.000000, 0.418716, 5.397208, -2.000000, -2.000000, -2.000000, 0.605299, -2.000000, -2.000000, 1.637476, -1.150326, 0.720053, 0.316045, -2.000000, -2.000000, -2.000000, 0.204154, -0.396919, 0.776831, -2.000000, 0.637558, -0.333972, -2.000000, -2.000000, -2.000000, 1.699397, 0.917952, 1.203263, -2.000000, -2.000000, -0.381760, -2.000000, -2.000000, -1.002699, -2.000000, -2.000000, -2.000000, -2.000000, -0.270881, -0.857363, -0.491633, -0.771474, -2.000000, -2.000000, -2.000000, -0.136044, -0.328949, -0.191361, -2.000000, 1.477033, 0.776831, -2.000000, 1.280585, -2.000000, -2.000000, 0.155288, -2.000000, -2.000000, -0.602780, -0.142583, -2.000000, -2.000000, -2.000000, 0.110067, -2.000000, 0.587245, -0.133189, -1.302020, -2.000000, -2.000000, -0.948022, -0.219892, -2.000000, -2.000000, -2.000000, 1.182931, -1.397475, -2.000000, -2.000000, -2.000000, -0.157478, -0.268695, -1.961418, -1.307215, -2.000000, -2.000000, 1.814984, -2.000000, -1.532657, -2.000000, -2.000000, -1.543641, -2.000000, -2.171770, -2.000000, -2.000000, -0.545417, -2.000000, -0.290767, -0.670785, -0.150475, -2.000000, -2.000000, -2.000000, -2.000000, -0.066098, -0.973734, 0.246861, 0.959089, -2.000000, -2.000000, -0.510989, -1.239065, 1.299587, -2.000000, -2.000000, -2.000000, -0.596449, -0.699706, -2.000000, -0.623165, -2.000000, -2.000000, -2.000000, -0.310019, -0.652196, -0.650048, -2.000000, -0.705821, -2.000000, -0.864230, -2.000000, -2.000000, 0.575149, -2.000000, 0.637558, 0.776831, -0.153012, -2.000000, -2.000000, -2.000000, -0.656492, -2.000000, -2.000000, -0.784372, 0.837747, -1.266612, -1.310618, -2.000000, -0.620725, -2.000000, -2.000000, -2.000000, -1.274076, -2.000000, -2.000000, -2.000000, 0.908659, 0.643113, 1.466488, -2.000000, -2.000000, -2.000000, 1.751705, -1.397475, -0.468054, -2.000000, -0.151227, -2.000000, -2.000000, 0.005327, -2.000000, -1.277267, -2.000000, -2.000000, -2.000000, 0.659983, -0.000314, 0.239013, 0.500803, -0.036037, 0.056688, -2.000000, -0.005469, -0.730497, -2.000000, -2.000000, -2.000000, -2.000000, 0.086480, 0.096147, 0.914292, 0.959071, -2.000000, -2.000000, -2.000000, -2.000000, -2.000000, 0.979663, -0.368232, -1.050387, -2.000000, -1.533856, -1.012526, -2.000000, -2.000000, -1.354159, -2.000000, -2.000000, -0.155744, -2.000000, -0.687215, -2.000000, -2.000000, -0.052780, -0.304165, -2.000000, -2.000000, -0.069962, -1.000099, -2.000000, -2.000000, -2.000000, -0.021264, 0.805555, -2.000000, -2.000000, 1.277898, -2.000000, -0.337915, 4.829450, -2.000000, -2.000000, -2.000000, 0.405515, -1.462113, -2.000000, -1.078774, -1.132476, -2.000000, -2.000000, -0.399329, 0.010719, -2.000000, -0.333360, -2.000000, -2.000000, -2.000000, 1.342619, -2.000000, -2.000000, 1.904237, -0.187833, 0.023752, -1.528274, 2.172621, -2.000000, -1.012181, -2.000000, -2.000000, 0.074245, -0.045098, -2.000000, -0.932222, -0.769397, -2.000000, -2.000000, 0.826415, -2.000000, -2.000000, -2.000000, -0.344766, -0.133380, 0.622816, 0.042299, 1.102634, -2.000000, -2.000000, -1.318269, -2.000000, -2.000000, -0.462759, -2.000000, -2.000000, -1.393605, -2.000000, -2.000000, -2.000000, -1.423889, 1.483356, 0.409428, 0.107293, -2.000000, -1.334016, 0.709604, -2.000000, -2.000000, -2.000000, -2.000000, -2.000000, -2.492681, -0.349507, -2.000000, -2.000000, 0.995569, -1.181259, 1.440342, 1.447502, -2.000000, -2.000000, -2.000000, 1.555897, -2.000000, 0.804343, -2.000000, -2.000000, 0.330838, -2.000000, -2.000000, -1.501263, -0.668598, -2.000000, -2.000000, -2.000000, 2.025538, 0.004121, 0.022800, -0.702170, -1.239988, -2.000000, -2.000000, 0.128299, 0.102976, -2.000000, 0.144054, -2.000000, -2.000000, -1.258413, -0.372363, -2.000000, -2.000000, -0.292188, 1.645056, -2.000000, -2.000000, -0.246604, -2.000000, -2.000000, -0.157998, -1.229376, 0.330838, -2.000000, -2.000000, -0.383025, -0.164322, 1.272753, -2.000000, -2.000000, -2.000000, -1.062963, 0.214016, -2.000000, -2.000000, 0.479677, -2.000000, -2.000000, 1.303404, -0.286783, -1.629738, 0.911286, -2.000000, -2.000000, -0.087406, -2.000000, -2.000000, -2.000000, -2.000000, 0.701338, 0.618965, -2.000000, -2.000000, 0.178147, -2.000000, 0.767324, -2.000000, 0.960448, -2.000000, -2.000000, -2.000000, -0.670146, -0.225382, 1.143627, -2.000000, -0.651616, -2.000000, -2.000000, -0.508601, -1.459002, -2.000000, -2.000000, -0.507172, -2.000000, -1.594908, -2.000000, -2.000000, 0.004160, 0.236603, 0.018692, -2.000000, -0.804332, -2.000000, -0.648906, -2.000000, -0.328809, -2.000000, -2.000000, -0.875299, -0.442350, -0.441211, -2.000000, -2.000000, -2.000000, 1.472659, -2.000000, -1.032503, -2.000000, -2.000000, -0.555072, 1.662963, -0.145479, -2.000000, -2.000000, -2.000000, -2.000000 };
+static const float RF_VALUE[] = { 0.484234, 0.636364, 0.506250, 0.000000, 0.540000, 0.800000, 0.090909, 1.000000, 0.000000, 0.959184, 0.978723, 0.750000, 0.000000, 1.000000, 1.000000, 0.500000, 0.000000, 1.000000, 0.366667, 0.304878, 0.149254, 0.800000, 1.000000, 0.000000, 0.096774, 1.000000, 0.081967, 1.000000, 1.000000, 0.890244, 0.307692, 1.000000, 0.000000, 1.000000, 0.301980, 0.411765, 0.146667, 1.000000, 0.000000, 0.737705, 0.865385, 1.000000, 0.461538, 1.000000, 0.000000, 0.000000, 0.075758, 0.333333, 0.000000, 1.000000, 0.000000, 0.511261, 0.644670, 0.831933, 0.920000, 0.958333, 0.826087, 0.000000, 1.000000, 1.000000, 0.000000, 0.368421, 0.875000, 0.000000, 1.000000, 0.000000, 0.358974, 0.000000, 0.444444, 0.692308, 0.947368, 0.666667, 0.000000, 1.000000, 1.000000, 0.000000, 0.270270, 0.588235, 0.000000, 1.000000, 0.000000, 0.404858, 0.600000, 0.380952, 0.088889, 0.023810, 0.000000, 0.333333, 0.000000, 1.000000, 1.000000, 0.717949, 0.923077, 0.666667, 1.000000, 0.000000, 1.000000, 0.307692, 1.000000, 0.000000, 0.827160, 0.967742, 0.500000, 0.000000, 1.000000, 1.000000, 0.368421, 0.875000, 1.000000, 0.000000, 0.000000, 0.012195, 0.000000, 0.333333, 0.000000, 1.000000, 0.513514, 0.077778, 1.000000, 0.067416, 0.600000, 1.000000, 0.000000, 0.035714, 0.142857, 0.000000, 0.214286, 1.000000, 0.153846, 1.000000, 0.083333, 0.000000, 0.250000, 0.000000, 0.624294, 0.318841, 0.062500, 1.000000, 0.000000, 0.904762, 0.950000, 1.000000, 0.500000, 1.000000, 0.000000, 0.000000, 0.698246, 0.458904, 0.537736, 0.181818, 0.750000, 1.000000, 0.500000, 0.000000, 1.000000, 0.055556, 1.000000, 0.000000, 0.790323, 0.000000, 0.875000, 0.000000, 0.907407, 0.428571, 0.978723, 0.250000, 0.176471, 0.000000, 0.400000, 0.250000, 1.000000, 0.000000, 1.000000, 0.666667, 0.800000, 0.000000, 1.000000, 0.000000, 0.949640, 1.000000, 0.917647, 0.971014, 0.985294, 1.000000, 0.857143, 0.000000, 1.000000, 0.000000, 0.687500, 1.000000, 0.000000, 0.481982, 0.312796, 1.000000, 0.256410, 0.365217, 0.700000, 0.076923, 1.000000, 0.000000, 0.918919, 1.000000, 0.625000, 0.000000, 1.000000, 0.107692, 0.036364, 0.000000, 0.142857, 1.000000, 0.000000, 0.500000, 0.833333, 1.000000, 0.000000, 0.000000, 0.100000, 0.000000, 1.000000, 0.635193, 0.698113, 0.200000, 0.040000, 1.000000, 0.000000, 1.000000, 0.780220, 0.840237, 0.974359, 1.000000, 0.875000, 0.600000, 1.000000, 0.000000, 1.000000, 0.725275, 0.783133, 0.518519, 0.700000, 0.000000, 0.910714, 0.000000, 1.000000, 0.125000, 1.000000, 0.000000, 0.000000, 0.000000, 0.490991, 0.644195, 0.142857, 0.800000, 0.000000, 1.000000, 0.000000, 0.702929, 0.467890, 0.312500, 1.000000, 0.191176, 0.046512, 0.000000, 0.105263, 0.055556, 1.000000, 0.440000, 1.000000, 0.000000, 0.896552, 0.750000, 0.000000, 1.000000, 1.000000, 0.900000, 1.000000, 0.843373, 0.944444, 0.600000, 0.000000, 1.000000, 0.970149, 0.900000, 0.666667, 1.000000, 1.000000, 0.181818, 0.100000, 1.000000, 0.000000, 1.000000, 0.259887, 0.121739, 0.049020, 0.571429, 0.000000, 1.000000, 0.010526, 0.000000, 0.090909, 1.000000, 0.000000, 0.692308, 1.000000, 0.200000, 1.000000, 0.000000, 0.516129, 0.000000, 0.640000, 0.941176, 0.714286, 1.000000, 0.000000, 1.000000, 0.000000, 0.484234, 0.274131, 0.554054, 0.904762, 1.000000, 0.000000, 0.415094, 0.058824, 0.500000, 1.000000, 0.000000, 0.000000, 0.583333, 0.913043, 1.000000, 0.666667, 0.000000, 1.000000, 0.000000, 0.162162, 0.322034, 0.705882, 0.000000, 0.923077, 1.000000, 0.500000, 1.000000, 0.000000, 0.166667, 0.000000, 0.250000, 0.050000, 0.500000, 0.000000, 1.000000, 0.000000, 0.750000, 0.000000, 1.000000, 0.087302, 0.177419, 0.090909, 0.294118, 0.000000, 0.833333, 0.000000, 1.000000, 0.000000, 0.857143, 0.000000, 1.000000, 0.000000, 0.778378, 0.602410, 0.980392, 1.000000, 0.000000, 0.000000, 0.921569, 0.949495, 0.842105, 1.000000, 0.400000, 0.000000, 1.000000, 0.975000, 1.000000, 0.800000, 1.000000, 0.000000, 0.000000, 0.495495, 0.309211, 0.412322, 0.285714, 0.141026, 0.069444, 0.000000, 0.156250, 0.714286, 0.000000, 1.000000, 0.000000, 1.000000, 0.703704, 0.791667, 0.904762, 0.950000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.537736, 0.437500, 0.666667, 0.000000, 0.723404, 0.285714, 0.000000, 0.800000, 0.909091, 0.000000, 0.937500, 0.034483, 0.000000, 0.333333, 1.000000, 0.000000, 0.846154, 0.952381, 0.000000, 1.000000, 0.400000, 0.666667, 0.000000, 1.000000, 0.000000, 0.075269, 0.266667, 0.000000, 1.000000, 0.038462, 0.000000, 0.333333, 0.600000, 1.000000, 0.000000, 0.000000, 0.900000, 0.954198, 0.000000, 0.961538, 0.636364, 1.000000, 0.000000, 0.991597, 0.976190, 1.000000, 0.888889, 1.000000, 0.000000, 1.000000, 0.111111, 0.000000, 1.000000, 0.500000, 0.548223, 0.292079, 0.076271, 0.750000, 1.000000, 0.333333, 1.000000, 0.000000, 0.027273, 0.093750, 1.000000, 0.064516, 0.500000, 1.000000, 0.000000, 0.034483, 0.000000, 0.166667, 0.000000, 0.595238, 0.492537, 0.346939, 0.535714, 0.250000, 0.083333, 0.750000, 0.916667, 0.000000, 1.000000, 0.095238, 1.000000, 0.000000, 0.888889, 0.000000, 1.000000, 1.000000, 0.817708, 0.553191, 0.812500, 0.896552, 0.000000, 0.928571, 0.333333, 0.000000, 1.000000, 1.000000, 0.000000, 0.000000, 0.903448, 0.166667, 0.000000, 1.000000, 0.935252, 0.977273, 0.920000, 0.958333, 1.000000, 0.000000, 0.000000, 0.990654, 1.000000, 0.833333, 0.000000, 1.000000, 0.142857, 0.000000, 1.000000, 0.120000, 0.857143, 1.000000, 0.000000, 0.000000, 0.529279, 0.571776, 0.654971, 0.492188, 0.850000, 0.000000, 1.000000, 0.329545, 0.888889, 1.000000, 0.333333, 0.000000, 1.000000, 0.185714, 0.857143, 0.000000, 1.000000, 0.111111, 0.035088, 0.000000, 1.000000, 0.833333, 1.000000, 0.000000, 0.752336, 0.293103, 0.857143, 1.000000, 0.000000, 0.215686, 0.636364, 0.777778, 1.000000, 0.000000, 0.000000, 0.100000, 0.600000, 1.000000, 0.000000, 0.028571, 0.000000, 0.250000, 0.923077, 0.875000, 0.750000, 0.272727, 0.000000, 0.750000, 0.891892, 0.942857, 0.000000, 1.000000, 1.000000, 0.159420, 0.052632, 0.000000, 1.000000, 0.666667, 0.000000, 0.800000, 1.000000, 0.333333, 1.000000, 0.000000, 0.000000, 0.490991, 0.231343, 0.046154, 0.000000, 0.500000, 1.000000, 0.000000, 0.405797, 0.750000, 1.000000, 0.000000, 0.265306, 1.000000, 0.076923, 1.000000, 0.000000, 0.603226, 0.267974, 0.371429, 0.000000, 0.702703, 0.000000, 0.866667, 1.000000, 0.428571, 1.000000, 0.000000, 0.180723, 0.590909, 0.928571, 0.000000, 1.000000, 0.000000, 0.032787, 0.000000, 0.222222, 0.000000, 1.000000, 0.929936, 0.744186, 0.842105, 0.000000, 1.000000, 0.000000, 1.000000 };
+static const int RF_TREE_ORDER[] = { 7, 8, 5, 1, 4, 3, 9, 2, 0, 6 };
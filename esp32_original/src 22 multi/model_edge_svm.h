@@ -0,0 +1,10 @@
+#pragma once
+#include <stdint.h>
+
+// Linear SVM Model
+#define SVM_N_FEATURES 24
+static const float SVM_SCALE_MEAN[] = { -0.345925, -0.256083, 5.666628, 17.534018, 0.054044, 0.705093, -0.108649, -0.125611, 5.271984, 15.722354, 0.038028, 0.750205, -0.220051, -0.213182, 6.843994, 19.741364, -0.009769, 0.538575, -0.200087, -0.131411, 6.503111, 18.244618, 0.017388, 0.609078 };
+static const float SVM_SCALE_STD[]  = { 0.650748, 0.829888, 1.882127, 6.220583, 0.135037, 0.133711, 0.703444, 0.778839, 2.366533, 7.437454, 0.337566, 0.146693, 0.879196, 0.803170, 1.262642, 3.723799, 0.058771, 0.171153, 0.706507, 0.806236, 1.534211, 5.305865, 0.052933, 0.133098 };
+
+static const float SVM_COEF[] = { 0.019381, -0.739871, 0.135391, -0.209379, -0.097113, -0.509964, -1.024236, 1.945723, -0.022133, 0.247445, -0.077688, 0.202613, -0.016763, 0.211411, 0.035023, 0.120825, 0.169910, 0.919863, -0.065923, 0.046164, -0.283335, -0.144072, 0.098186, -1.400458 };
+static const float SVM_BIAS = -0.011470;
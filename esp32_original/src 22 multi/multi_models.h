@@ -0,0 +1,185 @@
+#pragma once
+#include <string.h>
+#include <cmath>
+#include "score_mode.h"
+
+// ================= MULTI-MODEL SCORING =================
+// One extracted feature vector feeds every model of the build. The models were
+// trained on the same StandardScaler, so z = (x - mean) / std is computed once
+// and each head only does its own dot product or tree walk. multi_init checks
+// that assumption table by table: a model whose SCALE_MEAN / SCALE_STD differ
+// from the shared one scales the raw features itself, exactly like its
+// single-model build. Each head gives the same labels and scores as that build.
+
+#define MULTI_LR  1
+#define MULTI_SVM 2
+#define MULTI_RF  4
+#define MULTI_ALL (MULTI_LR | MULTI_SVM | MULTI_RF)
+
+#define MULTI_SCORE_SIGMOID  0   // LR: sigmoid(decision)
+#define MULTI_SCORE_PLATT    1   // SVM with Platt scaling: 1 / (1 + exp(A d + B))
+#define MULTI_SCORE_DECISION 2   // SVM without Platt scaling: the decision itself
+
+#define MULTI_MAX_FEATURES 96
+
+struct MultiScale {
+    int n_features;
+    const float* mean;
+    const float* std;
+};
+
+struct MultiLinear {
+    MultiScale scale;
+    const float* coef;
+    float bias;
+    int score_kind;     // MULTI_SCORE_*
+    float prob_a, prob_b;
+};
+
+// Node arrays as exported; tree t starts at roots[t], leaves have left == -1.
+struct MultiForest {
+    MultiScale scale;
+    int n_trees;
+    const int* roots;
+    const int* feature;
+    const float* threshold;
+    const int* left;
+    const int* right;
+    const float* leaf;
+    const int* order;   // RF_*TREE_ORDER: the order multi_predict_forest_trees takes trees in
+};
+
+// The models of one build (or of one warm-up phase); null = not built in.
+struct MultiSet {
+    MultiScale shared;
+    const MultiLinear* lr;
+    const MultiLinear* svm;
+    const MultiForest* rf;
+    bool own_scale[3];  // set by multi_init, indexed lr / svm / rf
+};
+
+bool multi_same_scale(const MultiScale& a, const MultiScale& b) {
+    return a.n_features == b.n_features &&
+           memcmp(a.mean, b.mean, sizeof(float) * a.n_features) == 0 &&
+           memcmp(a.std, b.std, sizeof(float) * a.n_features) == 0;
+}
+
+void multi_init(MultiSet& set) {
+    set.own_scale[0] = set.lr && !multi_same_scale(set.lr->scale, set.shared);
+    set.own_scale[1] = set.svm && !multi_same_scale(set.svm->scale, set.shared);
+    set.own_scale[2] = set.rf && !multi_same_scale(set.rf->scale, set.shared);
+}
+
+void multi_scale(const float* features, const MultiScale& sc, float* z) {
+    for(int i=0; i<sc.n_features; i++) {
+        float s = sc.std[i];
+        if(s < 1e-9f) s = 1.0f;
+        z[i] = (features[i] - sc.mean[i]) / s;
+    }
+}
+
+// features: raw vector, z: the shared scaled vector.
+float multi_linear_decision(const MultiLinear& m, bool own_scale, const float* features, const float* z) {
+    float own[MULTI_MAX_FEATURES];
+    if(own_scale) { multi_scale(features, m.scale, own); z = own; }
+    float decision = 0.0f;
+    for(int i=0; i<m.scale.n_features; i++) decision += z[i] * m.coef[i];
+    return decision + m.bias;
+}
+
+int multi_linear_label_score(const MultiLinear& m, float decision, float* out_score, int mode) {
+    if(m.score_kind == MULTI_SCORE_SIGMOID) return lr_label_score(decision, mode, out_score);
+    if(m.score_kind == MULTI_SCORE_PLATT) return platt_label_score(decision, m.prob_a, m.prob_b, mode, out_score);
+    if(out_score) *out_score = decision;
+    return (decision >= 0.0f) ? 1 : 0;
+}
+
+int multi_predict_linear(const MultiLinear& m, bool own_scale, const float* features, const float* z,
+                         float* out_score, int mode)
+{
+    return multi_linear_label_score(m, multi_linear_decision(m, own_scale, features, z), out_score, mode);
+}
+
+int multi_predict_forest(const MultiForest& m, bool own_scale, const float* features, const float* z,
+                         float* out_score)
+{
+    float own[MULTI_MAX_FEATURES];
+    if(own_scale) { multi_scale(features, m.scale, own); z = own; }
+    float sum_prob = 0.0f;
+    for(int t=0; t<m.n_trees; t++) {
+        int idx = m.roots[t];
+        while(m.left[idx] != -1) {
+            if(z[m.feature[idx]] <= m.threshold[idx]) idx = m.left[idx];
+            else idx = m.right[idx];
+        }
+        sum_prob += m.leaf[idx];
+    }
+    float avg_prob = sum_prob / (float)m.n_trees;
+    if(out_score) *out_score = avg_prob;
+    return (avg_prob >= 0.5f) ? 1 : 0;
+}
+
+// The forest cut to its first n_trees trees in m.order (all of them when
+// n_trees >= m.n_trees); the score is the mean vote of those trees.
+int multi_predict_forest_trees(const MultiForest& m, bool own_scale, const float* features, const float* z,
+                               int n_trees, float* out_score)
+{
+    if(n_trees >= m.n_trees) return multi_predict_forest(m, own_scale, features, z, out_score);
+    float own[MULTI_MAX_FEATURES];
+    if(own_scale) { multi_scale(features, m.scale, own); z = own; }
+    float sum_prob = 0.0f;
+    for(int k=0; k<n_trees; k++) {
+        int idx = m.roots[m.order[k]];
+        while(m.left[idx] != -1) {
+            if(z[m.feature[idx]] <= m.threshold[idx]) idx = m.left[idx];
+            else idx = m.right[idx];
+        }
+        sum_prob += m.leaf[idx];
+    }
+    float avg_prob = sum_prob / (float)n_trees;
+    if(out_score) *out_score = avg_prob;
+    return (avg_prob >= 0.5f) ? 1 : 0;
+}
+
+// Scales features into z (MULTI_MAX_FEATURES long) with the shared table.
+void multi_prepare(const MultiSet& set, const float* features, float* z) {
+    multi_scale(features, set.shared, z);
+}
+
+// ================= CASCADE =================
+// The linear head decides alone when its probability is at least band away
+// from 0.5; only the samples inside the band pay for the forest. sigmoid(l) is
+// outside [0.5 - band, 0.5 + band] exactly when |l| >= logit(0.5 + band), so
+// the gate compares the logit (the LR decision, or -(A d + B) for Platt) and
+// needs no exp. band = 0 never runs the forest, band >= 0.5 always does.
+
+#define MULTI_STAGE_LINEAR 1
+#define MULTI_STAGE_FOREST 2
+
+struct MultiCascade {
+    int linear_head;    // 0 = set.lr, 1 = set.svm; needs a probability (not MULTI_SCORE_DECISION)
+    float band;
+    float gate;         // logit(0.5 + band), set by multi_cascade_init
+};
+
+void multi_cascade_init(MultiCascade& c, int linear_head, float band) {
+    c.linear_head = linear_head;
+    c.band = band;
+    c.gate = (band >= 0.5f) ? INFINITY : (band <= 0.0f) ? 0.0f : logf((0.5f + band) / (0.5f - band));
+}
+
+// Label of the deciding stage; out_score gets its score (the linear
+// probability under mode, or the forest vote), out_stage MULTI_STAGE_*.
+int multi_predict_cascade(const MultiSet& set, const MultiCascade& c, const float* features, const float* z,
+                          float* out_score, int* out_stage, int mode)
+{
+    const MultiLinear& lin = c.linear_head ? *set.svm : *set.lr;
+    float decision = multi_linear_decision(lin, set.own_scale[c.linear_head], features, z);
+    float logit = (lin.score_kind == MULTI_SCORE_PLATT) ? -(lin.prob_a * decision + lin.prob_b) : decision;
+    if(fabsf(logit) >= c.gate) {
+        if(out_stage) *out_stage = MULTI_STAGE_LINEAR;
+        return multi_linear_label_score(lin, decision, out_score, mode);
+    }
+    if(out_stage) *out_stage = MULTI_STAGE_FOREST;
+    return multi_predict_forest(*set.rf, set.own_scale[2], features, z, out_score);
+}
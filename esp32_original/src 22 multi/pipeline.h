@@ -0,0 +1,167 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+
+// ================= INGEST / INFERENCE PIPELINE =================
+// With -DPIPELINE=1 onMqtt only decodes: each sample is copied into
+// pipeline.samples and the inference task, pinned to PIPELINE_CORE (the core
+// the Arduino loop does not run on), takes it from there through
+// process_sample. Its detection rows come back through pipeline.rows, which
+// loop() drains into publish_detection. The network side thus keeps running
+// while a slow extraction or model is busy, and the PubSubClient is only ever
+// touched by the loop task.
+//
+// Both rings are single-producer / single-consumer and lock-free: head is
+// written by the producer only, tail by the consumer only, and a release
+// store of one paired with an acquire load on the other side is all the
+// synchronisation there is. The indices run freely; N must be a power of two.
+//
+// A sample that finds pipeline.samples full is dropped and counted. A row
+// that finds pipeline.rows full makes the inference task wait for loop()
+// (counted as a stall): the backlog then builds up in pipeline.samples and
+// shows up there as drops, so no processed sample loses its row.
+// {"stats": true} and {"reboot": true} are answered by onMqtt and never
+// queued; with PIPELINE, stats also reports the counters below. {"reset": true}
+// is queued like a sample, so the inference task clears the history in order,
+// and its READY comes back through pipeline.rows marked as a status message.
+// A reset that finds pipeline.samples full is dropped like a sample: no
+// READY comes back, and the sender can ask again.
+//
+// Nothing here is ESP32-specific: host/bench_pipeline.cpp runs the same
+// rings between two std::threads.
+
+#ifndef PIPELINE
+#define PIPELINE 0
+#endif
+#ifndef PIPELINE_DEPTH
+#define PIPELINE_DEPTH 32       // samples in flight, a power of two
+#endif
+#ifndef PIPELINE_ROWS
+#define PIPELINE_ROWS 16        // rows waiting for loop(), a power of two
+#endif
+#ifndef PIPELINE_CORE
+#define PIPELINE_CORE 0
+#endif
+#ifndef PIPELINE_STACK
+#define PIPELINE_STACK 8192
+#endif
+#define PIPELINE_TIME_MAX 32
+
+template <typename T, uint32_t N>
+struct SpscRing {
+    static_assert(N > 0 && (N & (N - 1)) == 0, "SpscRing size must be a power of two");
+    T slot[N];
+    std::atomic<uint32_t> head;         // next slot to write; the producer's
+    std::atomic<uint32_t> tail;         // next slot to read; the consumer's
+    std::atomic<uint32_t> high_water;   // deepest the ring has been; the producer's
+};
+
+template <typename T, uint32_t N>
+uint32_t spsc_depth(const SpscRing<T, N>& r) {
+    return r.head.load(std::memory_order_acquire) - r.tail.load(std::memory_order_acquire);
+}
+
+// Producer: the slot to fill next, or nullptr when the ring is full.
+template <typename T, uint32_t N>
+T* spsc_claim(SpscRing<T, N>& r) {
+    uint32_t h = r.head.load(std::memory_order_relaxed);
+    if(h - r.tail.load(std::memory_order_acquire) >= N) return nullptr;
+    return &r.slot[h & (N - 1)];
+}
+
+// Producer: hands the claimed slot to the consumer.
+template <typename T, uint32_t N>
+void spsc_commit(SpscRing<T, N>& r) {
+    uint32_t h = r.head.load(std::memory_order_relaxed) + 1;
+    r.head.store(h, std::memory_order_release);
+    uint32_t depth = h - r.tail.load(std::memory_order_relaxed);
+    if(depth > r.high_water.load(std::memory_order_relaxed)) r.high_water.store(depth, std::memory_order_relaxed);
+}
+
+// Consumer: the oldest item, or nullptr when the ring is empty. It stays
+// valid, and in the ring, until spsc_pop.
+template <typename T, uint32_t N>
+T* spsc_front(SpscRing<T, N>& r) {
+    uint32_t t = r.tail.load(std::memory_order_relaxed);
+    if(t == r.head.load(std::memory_order_acquire)) return nullptr;
+    return &r.slot[t & (N - 1)];
+}
+
+template <typename T, uint32_t N>
+void spsc_pop(SpscRing<T, N>& r) {
+    r.tail.store(r.tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+struct PipelineSample {
+    SensorJson in;                  // in.time points into time[]
+    char time[PIPELINE_TIME_MAX];
+    uint32_t rx_us;                 // micros() when onMqtt decoded it
+    uint32_t ahead;                 // samples queued before it
+};
+
+struct PipelineRow {
+    char buf[DETECTION_ROW_MAX];
+    size_t len;
+    bool status;                    // a status message, not a detection row
+};
+
+struct Pipeline {
+    SpscRing<PipelineSample, PIPELINE_DEPTH> samples;   // onMqtt -> inference task
+    SpscRing<PipelineRow, PIPELINE_ROWS> rows;          // inference task -> loop()
+    std::atomic<uint32_t> received;     // samples onMqtt offered
+    std::atomic<uint32_t> dropped;      // of those, found the ring full
+    std::atomic<uint32_t> row_stalls;   // rows that had to wait for loop()
+};
+
+Pipeline pipeline;
+
+// Ingest side: queues a copy of in, stamped rx_us. Returns false, counted in
+// dropped, when the ring is full.
+bool pipeline_put_sample(Pipeline& p, const SensorJson& in, uint32_t rx_us) {
+    p.received.fetch_add(1, std::memory_order_relaxed);
+    PipelineSample* s = spsc_claim(p.samples);
+    if(!s) {
+        p.dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    size_t n = (in.time_len < PIPELINE_TIME_MAX) ? in.time_len : PIPELINE_TIME_MAX;
+    memcpy(s->time, in.time, n);
+    s->in = in;
+    s->in.time = s->time;
+    s->in.time_len = n;
+    s->rx_us = rx_us;
+    s->ahead = spsc_depth(p.samples);
+    spsc_commit(p.samples);
+    return true;
+}
+
+// Inference side: queues one row, or with status a status message, for
+// loop(). Returns false when the ring is full; the caller waits and tries again.
+bool pipeline_put_row(Pipeline& p, const char* row, size_t n, bool status) {
+    PipelineRow* r = spsc_claim(p.rows);
+    if(!r) return false;
+    if(n >= sizeof(r->buf)) n = sizeof(r->buf) - 1;
+    memcpy(r->buf, row, n);
+    r->buf[n] = '\0';
+    r->len = n;
+    r->status = status;
+    spsc_commit(p.rows);
+    return true;
+}
+
+// Read from the loop task while the inference task runs, so the figures are
+// a snapshot, each consistent on its own.
+int pipeline_stats_json(const Pipeline& p, char* buf, size_t n) {
+    return snprintf(buf, n,
+                    "{\"received\": %lu, \"dropped\": %lu, \"depth\": %lu, \"max_depth\": %lu, "
+                    "\"rows_waiting\": %lu, \"row_stalls\": %lu}",
+                    (unsigned long)p.received.load(std::memory_order_relaxed),
+                    (unsigned long)p.dropped.load(std::memory_order_relaxed),
+                    (unsigned long)spsc_depth(p.samples),
+                    (unsigned long)p.samples.high_water.load(std::memory_order_relaxed),
+                    (unsigned long)spsc_depth(p.rows),
+                    (unsigned long)p.row_stalls.load(std::memory_order_relaxed));
+}
@@ -0,0 +1,276 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <cmath>
+#include "detection_log.h"     // detlog_row_record: a row's labels, score and timings
+
+// ================= REPORTING =================
+// Every sample used to be published as a full row, even when the label had
+// been 1 for the last thousand. With -DREPORT=1 publish_detection hands each
+// row to report_row first, which decides what of it goes out:
+//
+//   k-of-n     the published label of a head changes only once k of its last
+//              n labels disagree with it, so a lone flip in a steady run is
+//              overruled. The row goes out with the debounced label(s) in
+//              place of the model's; k = n = 1 publishes the model's.
+//   changes    only the rows where a head's debounced label changes are
+//              published (and the first row), the others are counted.
+//   heartbeat  every heartbeat_ms, whether rows went out or not, loop()
+//              publishes one message for the interval: rows seen and
+//              published, labels flipped, the debounced labels, min / mean /
+//              max Score and p95 FeatTime + TestTime.
+//
+// The rows are read back from their text, as the detection log reads them, so
+// the single-model and multi builds go through the same hook: a multi build
+// debounces each head's label on its own. Only the loop task touches the
+// stage: rows reach publish_detection through loop() with PIPELINE too, and
+// handle_command, which changes the settings, runs there as well. The window
+// and the interval carry on across {"reset": true}: they follow what was
+// published, not the model.
+//
+// REPORT_K / REPORT_N / REPORT_CHANGES / REPORT_HEARTBEAT_MS are the settings
+// at boot; {"report_k": k, "report_n": n, "report_changes": true|false,
+// "report_heartbeat_ms": ms} changes any of them at run time (the window
+// starts over) and is answered with the settings in force. The defaults
+// publish every row as before.
+
+#ifndef REPORT
+#define REPORT 0
+#endif
+#ifndef REPORT_K
+#define REPORT_K 1
+#endif
+#ifndef REPORT_N
+#define REPORT_N 1
+#endif
+#ifndef REPORT_CHANGES
+#define REPORT_CHANGES 0
+#endif
+#ifndef REPORT_HEARTBEAT_MS
+#define REPORT_HEARTBEAT_MS 0
+#endif
+#define REPORT_MAX_N 32
+// The heartbeat's buffer. Its longest (every counter at 10 digits, scores of
+// up to 20 characters each) is 242 characters; it goes through the outbox as
+// a status message when the link is down.
+#define REPORT_HEARTBEAT_MAX 256
+#if REPORT
+static_assert(REPORT_HEARTBEAT_MAX <= OUTBOX_STATUS_MAX, "the heartbeat must fit an outbox slot");
+#endif
+#define REPORT_HEADS 8
+// Latency histogram: exact below 16 us, then 16 buckets per power of two (6%)
+// up to 2^17 us.
+#define REPORT_LAT_SUB 16
+#define REPORT_LAT_BUCKETS (REPORT_LAT_SUB * 14)
+
+struct ReportConfig {
+    uint32_t k, n;
+    bool changes;
+    uint32_t heartbeat_ms;      // 0: none
+};
+
+struct Report {
+    ReportConfig cfg;
+    uint32_t window[REPORT_HEADS];  // last n labels of each head, newest in bit 0
+    uint32_t seen;                  // labels in the window, up to n
+    uint8_t state;                  // debounced labels, bit h for head h
+    bool started;
+    // this heartbeat interval
+    unsigned long hb_start;
+    uint32_t hb_rows, hb_published, hb_flips, hb_scored;
+    float hb_min, hb_max;
+    double hb_sum;
+    uint32_t hb_lat[REPORT_LAT_BUCKETS];
+    // since boot
+    uint32_t rows, published, transitions, flips, heartbeats;
+    char row[DETECTION_ROW_MAX];    // the row with the debounced labels
+};
+
+Report report;
+
+static void report_interval(Report& r, unsigned long now_ms) {
+    r.hb_start = now_ms;
+    r.hb_rows = r.hb_published = r.hb_flips = r.hb_scored = 0;
+    r.hb_min = INFINITY;
+    r.hb_max = -INFINITY;
+    r.hb_sum = 0.0;
+    memset(r.hb_lat, 0, sizeof(r.hb_lat));
+}
+
+static bool report_valid(const ReportConfig& c) {
+    return c.n >= 1 && c.n <= REPORT_MAX_N && c.k >= 1 && c.k <= c.n;
+}
+
+void report_begin(Report& r, unsigned long now_ms) {
+    r = Report();
+    r.cfg.k = REPORT_K;
+    r.cfg.n = REPORT_N;
+    r.cfg.changes = REPORT_CHANGES;
+    r.cfg.heartbeat_ms = REPORT_HEARTBEAT_MS;
+    if(!report_valid(r.cfg)) r.cfg.k = r.cfg.n = 1;
+    report_interval(r, now_ms);
+}
+
+// New settings; 0xFFFFFFFF (changes: -1) leaves one as it is. The window
+// starts over, the debounced labels stay. Returns false, changing nothing,
+// when k and n do not make 1 <= k <= n <= REPORT_MAX_N.
+bool report_configure(Report& r, uint32_t k, uint32_t n, int changes, uint32_t heartbeat_ms, unsigned long now_ms) {
+    ReportConfig c = r.cfg;
+    if(k != 0xFFFFFFFFu) c.k = k;
+    if(n != 0xFFFFFFFFu) c.n = n;
+    if(changes >= 0) c.changes = changes != 0;
+    if(heartbeat_ms != 0xFFFFFFFFu) c.heartbeat_ms = heartbeat_ms;
+    if(!report_valid(c)) return false;
+    if(c.heartbeat_ms != r.cfg.heartbeat_ms) r.hb_start = now_ms;
+    r.cfg = c;
+    memset(r.window, 0, sizeof(r.window));
+    r.seen = 0;
+    return true;
+}
+
+// Where each head's Label starts in a row (the layouts detlog_row_record
+// reads). Returns the number of heads.
+static int report_label_fields(const char* row, size_t n, size_t* at, int max) {
+    size_t f[32];
+    int nf = 0;
+    f[nf++] = 0;
+    for(size_t i=0; i<n && nf < 32; i++) {
+        if(row[i] == ',') f[nf++] = i + 1;
+    }
+    int first = DETECTION_COMPACT ? 1 : 5;
+#if defined(MULTI_MODELS)
+    int heads = (nf - first - 1) / 3;
+    if(heads > max) heads = max;
+    for(int h=0; h<heads; h++) at[h] = f[first + 1 + 3 * h];
+    return heads;
+#else
+    if(first >= nf || max < 1) return 0;
+    at[0] = f[first];
+    return 1;
+#endif
+}
+
+static int report_lat_bucket(uint32_t us) {
+    if(us < REPORT_LAT_SUB) return (int)us;
+    int msb = 31 - __builtin_clz(us);
+    int b = (msb - 3) * REPORT_LAT_SUB + (int)((us >> (msb - 4)) & (REPORT_LAT_SUB - 1));
+    return (b < REPORT_LAT_BUCKETS) ? b : REPORT_LAT_BUCKETS - 1;
+}
+
+// The largest latency bucket b holds, in us.
+static uint32_t report_lat_upper(int b) {
+    if(b < REPORT_LAT_SUB) return (uint32_t)b;
+    int msb = b / REPORT_LAT_SUB + 3;
+    uint32_t lo = (uint32_t)(REPORT_LAT_SUB + b % REPORT_LAT_SUB) << (msb - 4);
+    return lo + (1u << (msb - 4)) - 1;
+}
+
+// One row, n chars. Returns what to publish in its place (row itself when the
+// labels stand, r.row when the debounced ones differ), or nullptr when the row
+// is held back.
+const char* report_row(Report& r, const char* row, size_t n) {
+    if(n >= DETECTION_ROW_MAX) n = DETECTION_ROW_MAX - 1;
+    r.rows++;
+    r.hb_rows++;
+
+    DetLogRecord rec;
+    detlog_row_record(row, n, rec);
+    if(!std::isnan(rec.score)) {
+        if(rec.score < r.hb_min) r.hb_min = rec.score;
+        if(rec.score > r.hb_max) r.hb_max = rec.score;
+        r.hb_sum += rec.score;
+        r.hb_scored++;
+    }
+    r.hb_lat[report_lat_bucket((uint32_t)rec.feat_us + rec.test_us)]++;
+
+    size_t at[REPORT_HEADS] = { 0 };
+    int heads = report_label_fields(row, n, at, REPORT_HEADS);
+    uint32_t mask = (r.cfg.n >= 32) ? 0xFFFFFFFFu : ((1u << r.cfg.n) - 1);
+    if(r.seen < r.cfg.n) r.seen++;
+    uint8_t prev = r.state;
+    for(int h=0; h<heads; h++) {
+        uint32_t bit = (rec.labels >> h) & 1u;
+        r.window[h] = ((r.window[h] << 1) | bit) & mask;
+        uint32_t ones = (uint32_t)__builtin_popcount(r.window[h]);
+        bool on = (r.state >> h) & 1u;
+        if(!r.started) on = bit;
+        else if(!on && ones >= r.cfg.k) on = true;
+        else if(on && r.seen - ones >= r.cfg.k) on = false;
+        r.state = on ? (uint8_t)(r.state | (1u << h)) : (uint8_t)(r.state & ~(1u << h));
+    }
+    bool changed = !r.started || r.state != prev;
+    r.started = true;
+    if(changed) r.transitions++;
+
+    // the debounced labels into the row, where they differ from the model's
+    const char* out = row;
+    uint8_t flipped = (uint8_t)((rec.labels ^ r.state) & ((1u << heads) - 1));
+    if(flipped) {
+        memcpy(r.row, row, n);
+        r.row[n] = '\0';
+        for(int h=0; h<heads; h++) {
+            size_t a = at[h];
+            if(((flipped >> h) & 1u) && a < n && (row[a] == '0' || row[a] == '1') && (a + 1 == n || row[a + 1] == ',')) {
+                r.row[a] = ((r.state >> h) & 1u) ? '1' : '0';
+            }
+        }
+        r.flips++;
+        r.hb_flips++;
+        out = r.row;
+    }
+    if(r.cfg.changes && !changed) return nullptr;
+    r.published++;
+    r.hb_published++;
+    return out;
+}
+
+bool report_due(const Report& r, unsigned long now_ms) {
+    return r.cfg.heartbeat_ms > 0 && now_ms - r.hb_start >= r.cfg.heartbeat_ms;
+}
+
+// The interval's heartbeat, then a new interval.
+int report_heartbeat_json(Report& r, char* buf, size_t n, unsigned long now_ms) {
+    char scores[96], p95[16];
+    if(r.hb_scored > 0) {
+        snprintf(scores, sizeof(scores), "%.4f, \"score_mean\": %.4f, \"score_max\": %.4f", r.hb_min,
+                 r.hb_sum / r.hb_scored, r.hb_max);
+    } else {
+        snprintf(scores, sizeof(scores), "null, \"score_mean\": null, \"score_max\": null");
+    }
+    snprintf(p95, sizeof(p95), "null");
+    uint32_t want = (r.hb_rows * 95 + 99) / 100, acc = 0;
+    for(int b=0; r.hb_rows > 0 && b<REPORT_LAT_BUCKETS; b++) {
+        acc += r.hb_lat[b];
+        if(acc >= want) {
+            snprintf(p95, sizeof(p95), "%.3f", report_lat_upper(b) / 1000.0);
+            break;
+        }
+    }
+    int len = snprintf(buf, n,
+                       "{\"heartbeat_ms\": %lu, \"rows\": %lu, \"published\": %lu, \"flipped\": %lu, \"labels\": %u, "
+                       "\"score_min\": %s, \"latency_p95_ms\": %s}",
+                       (unsigned long)(now_ms - r.hb_start), (unsigned long)r.hb_rows,
+                       (unsigned long)r.hb_published, (unsigned long)r.hb_flips, (unsigned)r.state, scores, p95);
+    r.heartbeats++;
+    report_interval(r, now_ms);
+    return len;
+}
+
+// The settings in force, the answer to {"report_k": ...}.
+int report_config_json(const Report& r, bool ok, char* buf, size_t n) {
+    return snprintf(buf, n,
+                    "{\"report\": \"%s\", \"report_k\": %lu, \"report_n\": %lu, \"report_changes\": %s, "
+                    "\"report_heartbeat_ms\": %lu}",
+                    ok ? "ok" : "invalid", (unsigned long)r.cfg.k, (unsigned long)r.cfg.n,
+                    r.cfg.changes ? "true" : "false", (unsigned long)r.cfg.heartbeat_ms);
+}
+
+int report_stats_json(const Report& r, char* buf, size_t n) {
+    return snprintf(buf, n,
+                    "{\"report_rows\": %lu, \"report_published\": %lu, \"report_transitions\": %lu, "
+                    "\"report_flipped\": %lu, \"report_heartbeats\": %lu}",
+                    (unsigned long)r.rows, (unsigned long)r.published, (unsigned long)r.transitions,
+                    (unsigned long)r.flips, (unsigned long)r.heartbeats);
+}
@@ -13,3 +13,4 @@ static const int RF_RIGHT[] = { 34, 29, 4, -1, 18, 9, 8, -1, -1, 15, 14, 13, -1,
 static const int RF_FEATURE[] = { 4, 7, 13, -2, 3, 3, 16, -2, -2, 5, 23, 11, -2, -2, -2, 2, -2, -2, 11, 10, 18, 8, -2, -2, 23, -2, -2, -2, -2, 10, 4, -2, -2, -2, 10, 6, 2, -2, -2, 16, 1, -2, 23, -2, -2, -2, 5, 13, -2, -2, -2, 11, 16, 2, 1, 13, 21, -2, -2, -2, -2, 23, 6, -2, -2, -2, 12, -2, 20, 23, 13, 5, -2, -2, -2, -2, 1, 1, -2, -2, -2, 1, 2, 7, 0, 0, -2, 14, -2, -2, -2, 18, 18, 2, -2, -2, -2, 1, -2, -2, 15, 0, 13, -2, -2, -2, 20, 8, -2, -2, -2, 2, -2, 20, -2, -2, 9, 3, -2, 8, 10, -2, -2, 1, 17, -2, 6, -2, 5, -2, 22, -2, -2, -2, 3, 6, 5, -2, -2, 0, 9, -2, 20, -2, -2, -2, 7, 21, 9, 15, 19, -2, 11, -2, -2, 1, -2, -2, 2, -2, 16, -2, 13, -2, -2, 8, 17, -2, 1, 6, -2, -2, -2, 21, 9, -2, -2, -2, 5, -2, 23, 16, 11, -2, 7, -2, -2, -2, 2, -2, -2, 2, 2, -2, 17, 1, 9, 20, -2, -2, 17, -2, 19, -2, -2, 13, 14, -2, 14, -2, -2, 12, 4, -2, -2, -2, 7, -2, -2, 16, 5, 7, 3, -2, -2, -2, 4, 4, 9, -2, 3, 20, -2, -2, -2, 2, 7, 23, -2, -2, 4, -2, -2, 0, -2, -2, -2, -2, 4, 8, 6, 12, -2, -2, -2, 10, 19, 10, -2, 13, 9, -2, 3, -2, -2, 3, -2, -2, 7, 2, -2, -2, -2, 16, -2, 1, 10, 19, -2, -2, 13, 11, -2, -2, -2, 2, 23, -2, -2, -2, 6, 7, 16, 9, -2, -2, 15, -2, 3, -2, -2, 2, -2, 16, -2, -2, 22, -2, 1, 1, 17, -2, -2, -2, -2, 7, 7, 8, 5, -2, -2, 22, 6, 23, -2, -2, -2, 1, 1, -2, 1, -2, -2, -2, 4, 22, 20, -2, 22, -2, 18, -2, -2, 9, -2, 3, 9, 10, -2, -2, -2, 7, -2, -2, 8, 13, 15, 8, -2, 10, -2, -2, -2, 17, -2, -2, -2, 7, 1, 6, -2, -2, -2, 18, 23, 1, -2, 10, -2, -2, 4, -2, 13, -2, -2, -2, 7, 10, 9, 18, 22, 1, -2, 3, 7, -2, -2, -2, -2, 6, 5, 23, 3, -2, -2, -2, -2, -2, 17, 4, 3, -2, 5, 7, -2, -2, 13, -2, -2, 10, -2, 7, -2, -2, 18, 2, -2, -2, 10, 14, -2, -2, -2, 18, 19, -2, -2, 15, -2, 23, 4, -2, -2, -2, 16, 10, -2, 0, 0, -2, -2, 22, 4, -2, 15, -2, -2, -2, 5, -2, -2, 0, 7, 2, 2, 4, -2, 23, -2, -2, 17, 11, -2, 7, 9, -2, -2, 14, -2, -2, -2, 19, 10, 3, 11, 13, -2, -2, 7, -2, -2, 4, -2, -2, 13, -2, -2, -2, 17, 10, 16, 8, -2, 20, 9, -2, -2, -2, -2, -2, 5, 22, -2, -2, 1, 11, 7, 18, -2, -2, -2, 21, -2, 4, -2, -2, 21, -2, -2, 14, 7, -2, -2, -2, 0, 10, 2, 9, 9, -2, -2, 16, 8, -2, 6, -2, -2, 13, 4, -2, -2, 6, 0, -2, -2, 3, -2, -2, 10, 18, 21, -2, -2, 21, 10, 17, -2, -2, -2, 20, 6, -2, -2, 5, -2, -2, 8, 22, 5, 9, -2, -2, 10, -2, -2, -2, -2, 14, 16, -2, -2, 22, -2, 5, -2, 19, -2, -2, -2, 8, 17, 15, -2, 16, -2, -2, 0, 2, -2, -2, 6, -2, 2, -2, -2, 7, 21, 2, -2, 0, -2, 1, -2, 21, -2, -2, 6, 4, 14, -2, -2, -2, 20, -2, 18, -2, -2, 22, 18, 10, -2, -2, -2, -2 };
 static const float RF_THRESHOLD[] = { -0.288269, 0.344143, -1.353361, -2.000000, 0.155288, -1.130765, 0.152787, -2.000000, -2.000000, 0.767324, -0.723210, 1.091063, -2.000000, -2.000000, -2.000000, 0.092859, -2.000000, -2.000000, 1.178460, -0.133189, -1.149910, 1.273897, -2.000000, -2.000000, -1.397475, -2.000000, -2.000000, -2.000000, -2.000000, -0.143627, -0.413978, -2.000000, -2.000000, -2.000000, -0.007930, -0.405086, -1.288630, -2.000000, -2.000000, 1.170643, -0.208954, -2.000000, 0.047379, -2.000000, -2.000000, -2.000000, 0.575559, 0.648319, -2.000000, -2.000000, -2.000000, -0.132495, 0.215046, 1.608708, 0.285431, -0.935383, -0.705751, -2.000000, -2.000000, -2.000000, -2.000000, 0.336350, -0.978159, -2.000000, -2.000000, -2.000000, -1.080799, -2.000000, -0.329398, 1.203263, -1.154314, -1.054443, -2.000000, -2.000000, -2.000000, -2.000000, 0.940336, -0.645557, -2.000000, -2.000000, -2.000000, 0.939107, 0.006623, -0.631116, 0.966525, 0.301375, -2.000000, 0.816825, -2.000000, -2.000000, -2.000000, 1.085433, -0.730945, -0.091719, -2.000000, -2.000000, -2.000000, -0.267382, -2.000000, -2.000000, 0.472269, -1.055621, 1.137996, -2.000000, -2.000000, -2.000000, 1.179359, 0.446599, -2.000000, -2.000000, -2.000000, 1.451842, -2.000000, 1.372599, -2.000000, -2.000000, -1.239988, -1.934548, -2.000000, -1.782938, 0.993923, -2.000000, -2.000000, 0.714238, -1.348983, -2.000000, -0.727416, -2.000000, 0.192029, -2.000000, 1.709573, -2.000000, -2.000000, -2.000000, -0.809252, -0.464286, -0.766796, -2.000000, -2.000000, 0.794808, 0.239013, -2.000000, -0.277383, -2.000000, -2.000000, -2.000000, 0.372216, 0.613544, 0.171785, -1.266612, -0.101630, -2.000000, -0.656877, -2.000000, -2.000000, -0.680876, -2.000000, -2.000000, -0.110642, -2.000000, -0.162465, -2.000000, -1.114091, -2.000000, -2.000000, 0.830418, 0.673499, -2.000000, 0.161793, -0.816018, -2.000000, -2.000000, -2.000000, 0.990485, 0.642377, -2.000000, -2.000000, -2.000000, 0.000264, -2.000000, 0.047379, 0.409428, 0.916269, -2.000000, 1.647000, -2.000000, -2.000000, -2.000000, 0.382045, -2.000000, -2.000000, -0.109295, -1.693682, -2.000000, 0.523686, 0.259026, -1.239988, -1.136639, -2.000000, -2.000000, 0.373872, -2.000000, -0.344936, -2.000000, -2.000000, 0.185817, 0.826415, -2.000000, 0.929927, -2.000000, -2.000000, 0.418716, 5.397208, -2.000000, -2.000000, -2.000000, 0.605299, -2.000000, -2.000000, 1.637476, -1.150326, 0.720053, 0.316045, -2.000000, -2.000000, -2.000000, 0.204154, -0.396919, 0.776831, -2.000000, 0.637558, -0.333972, -2.000000, -2.000000, -2.000000, 1.699397, 0.917952, 1.203263, -2.000000, -2.000000, -0.381760, -2.000000, -2.000000, -1.002699, -2.000000, -2.000000, -2.000000, -2.000000, -0.270881, -0.857363, -0.491633, -0.771474, -2.000000, -2.000000, -2.000000, -0.136044, -0.328949, -0.191361, -2.000000, 1.477033, 0.776831, -2.000000, 1.280585, -2.000000, -2.000000, 0.155288, -2.000000, -2.000000, -0.602780, -0.142583, -2.000000, -2.000000, -2.000000, 0.110067, -2.000000, 0.587245, -0.133189, -1.302020, -2.000000, -2.000000, -0.948022, -0.219892, -2.000000, -2.000000, -2.000000, 1.182931, -1.397475, -2.000000, -2.000000, -2.000000, -0.157478, -0.268695, -1.961418, -1.307215, -2.000000, -2.000000, 1.814984, -2.000000, -1.532657, -2.000000, -2.000000, -1.543641, -2.000000, -2.171770, -2.000000, -2.000000, -0.545417, -2.000000, -0.290767, -0.670785, -0.150475, -2.000000, -2.000000, -2.000000, -2.000000, -0.066098, -0.973734, 0.246861, 0.959089, -2.000000, -2.000000, -0.510989, -1.239065, 1.299587, -2.000000, -2.000000, -2.000000, -0.596449, -0.699706, -2.000000, -0.623165, -2.000000, -2.000000, -2.000000, -0.310019, -0.652196, -0.650048, -2.000000, -0.705821, -2.000000, -0.864230, -2.000000, -2.000000, 0.575149, -2.000000, 0.637558, 0.776831, -0.153012, -2.000000, -2.000000, -2.000000, -0.656492, -2.000000, -2.000000, -0.784372, 0.837747, -1.266612, -1.310618, -2.000000, -0.620725, -2.000000, -2.000000, -2.000000, -1.274076, -2.000000, -2.000000, -2.000000, 0.908659, 0.643113, 1.466488, -2.000000, -2.000000, -2.000000, 1.751705, -1.397475, -0.468054, -2.000000, -0.151227, -2.000000, -2.000000, 0.005327, -2.000000, -1.277267, -2.000000, -2.000000, -2.000000, 0.659983, -0.000314, 0.239013, 0.500803, -0.036037, 0.056688, -2.000000, -0.005469, -0.730497, -2.000000, -2.000000, -2.000000, -2.000000, 0.086480, 0.096147, 0.914292, 0.959071, -2.000000, -2.000000, -2.000000, -2.000000, -2.000000, 0.979663, -0.368232, -1.050387, -2.000000, -1.533856, -1.012526, -2.000000, -2.000000, -1.354159, -2.000000, -2.000000, -0.155744, -2.000000, -0.687215, -2.000000, -2.000000, -0.052780, -0.304165, -2.000000, -2.000000, -0.069962, -1.000099, -2.000000, -2.000000, -2.000000, -0.021264, 0.805555, -2.000000, -2.000000, 1.277898, -2.000000, -0.337915, 4.829450, -2.000000, -2.000000, -2.000000, 0.405515, -1.462113, -2.000000, -1.078774, -1.132476, -2.000000, -2.000000, -0.399329, 0.010719, -2.000000, -0.333360, -2.000000, -2.000000, -2.000000, 1.342619, -2.000000, -2.000000, 1.904237, -0.187833, 0.023752, -1.528274, 2.172621, -2.000000, -1.012181, -2.000000, -2.000000, 0.074245, -0.045098, -2.000000, -0.932222, -0.769397, -2.000000, -2.000000, 0.826415, -2.000000, -2.000000, -2.000000, -0.344766, -0.133380, 0.622816, 0.042299, 1.102634, -2.000000, -2.000000, -1.318269, -2.000000, -2.000000, -0.462759, -2.000000, -2.000000, -1.393605, -2.000000, -2.000000, -2.000000, -1.423889, 1.483356, 0.409428, 0.107293, -2.000000, -1.334016, 0.709604, -2.000000, -2.000000, -2.000000, -2.000000, -2.000000, -2.492681, -0.349507, -2.000000, -2.000000, 0.995569, -1.181259, 1.440342, 1.447502, -2.000000, -2.000000, -2.000000, 1.555897, -2.000000, 0.804343, -2.000000, -2.000000, 0.330838, -2.000000, -2.000000, -1.501263, -0.668598, -2.000000, -2.000000, -2.000000, 2.025538, 0.004121, 0.022800, -0.702170, -1.239988, -2.000000, -2.000000, 0.128299, 0.102976, -2.000000, 0.144054, -2.000000, -2.000000, -1.258413, -0.372363, -2.000000, -2.000000, -0.292188, 1.645056, -2.000000, -2.000000, -0.246604, -2.000000, -2.000000, -0.157998, -1.229376, 0.330838, -2.000000, -2.000000, -0.383025, -0.164322, 1.272753, -2.000000, -2.000000, -2.000000, -1.062963, 0.214016, -2.000000, -2.000000, 0.479677, -2.000000, -2.000000, 1.303404, -0.286783, -1.629738, 0.911286, -2.000000, -2.000000, -0.087406, -2.000000, -2.000000, -2.000000, -2.000000, 0.701338, 0.618965, -2.000000, -2.000000, 0.178147, -2.000000, 0.767324, -2.000000, 0.960448, -2.000000, -2.000000, -2.000000, -0.670146, -0.225382, 1.143627, -2.000000, -0.651616, -2.000000, -2.000000, -0.508601, -1.459002, -2.000000, -2.000000, -0.507172, -2.000000, -1.594908, -2.000000, -2.000000, 0.004160, 0.236603, 0.018692, -2.000000, -0.804332, -2.000000, -0.648906, -2.000000, -0.328809, -2.000000, -2.000000, -0.875299, -0.442350, -0.441211, -2.000000, -2.000000, -2.000000, 1.472659, -2.000000, -1.032503, -2.000000, -2.000000, -0.555072, 1.662963, -0.145479, -2.000000, -2.000000, -2.000000, -2.000000 };
 static const float RF_VALUE[] = { 0.484234, 0.636364, 0.506250, 0.000000, 0.540000, 0.800000, 0.090909, 1.000000, 0.000000, 0.959184, 0.978723, 0.750000, 0.000000, 1.000000, 1.000000, 0.500000, 0.000000, 1.000000, 0.366667, 0.304878, 0.149254, 0.800000, 1.000000, 0.000000, 0.096774, 1.000000, 0.081967, 1.000000, 1.000000, 0.890244, 0.307692, 1.000000, 0.000000, 1.000000, 0.301980, 0.411765, 0.146667, 1.000000, 0.000000, 0.737705, 0.865385, 1.000000, 0.461538, 1.000000, 0.000000, 0.000000, 0.075758, 0.333333, 0.000000, 1.000000, 0.000000, 0.511261, 0.644670, 0.831933, 0.920000, 0.958333, 0.826087, 0.000000, 1.000000, 1.000000, 0.000000, 0.368421, 0.875000, 0.000000, 1.000000, 0.000000, 0.358974, 0.000000, 0.444444, 0.692308, 0.947368, 0.666667, 0.000000, 1.000000, 1.000000, 0.000000, 0.270270, 0.588235, 0.000000, 1.000000, 0.000000, 0.404858, 0.600000, 0.380952, 0.088889, 0.023810, 0.000000, 0.333333, 0.000000, 1.000000, 1.000000, 0.717949, 0.923077, 0.666667, 1.000000, 0.000000, 1.000000, 0.307692, 1.000000, 0.000000, 0.827160, 0.967742, 0.500000, 0.000000, 1.000000, 1.000000, 0.368421, 0.875000, 1.000000, 0.000000, 0.000000, 0.012195, 0.000000, 0.333333, 0.000000, 1.000000, 0.513514, 0.077778, 1.000000, 0.067416, 0.600000, 1.000000, 0.000000, 0.035714, 0.142857, 0.000000, 0.214286, 1.000000, 0.153846, 1.000000, 0.083333, 0.000000, 0.250000, 0.000000, 0.624294, 0.318841, 0.062500, 1.000000, 0.000000, 0.904762, 0.950000, 1.000000, 0.500000, 1.000000, 0.000000, 0.000000, 0.698246, 0.458904, 0.537736, 0.181818, 0.750000, 1.000000, 0.500000, 0.000000, 1.000000, 0.055556, 1.000000, 0.000000, 0.790323, 0.000000, 0.875000, 0.000000, 0.907407, 0.428571, 0.978723, 0.250000, 0.176471, 0.000000, 0.400000, 0.250000, 1.000000, 0.000000, 1.000000, 0.666667, 0.800000, 0.000000, 1.000000, 0.000000, 0.949640, 1.000000, 0.917647, 0.971014, 0.985294, 1.000000, 0.857143, 0.000000, 1.000000, 0.000000, 0.687500, 1.000000, 0.000000, 0.481982, 0.312796, 1.000000, 0.256410, 0.365217, 0.700000, 0.076923, 1.000000, 0.000000, 0.918919, 1.000000, 0.625000, 0.000000, 1.000000, 0.107692, 0.036364, 0.000000, 0.142857, 1.000000, 0.000000, 0.500000, 0.833333, 1.000000, 0.000000, 0.000000, 0.100000, 0.000000, 1.000000, 0.635193, 0.698113, 0.200000, 0.040000, 1.000000, 0.000000, 1.000000, 0.780220, 0.840237, 0.974359, 1.000000, 0.875000, 0.600000, 1.000000, 0.000000, 1.000000, 0.725275, 0.783133, 0.518519, 0.700000, 0.000000, 0.910714, 0.000000, 1.000000, 0.125000, 1.000000, 0.000000, 0.000000, 0.000000, 0.490991, 0.644195, 0.142857, 0.800000, 0.000000, 1.000000, 0.000000, 0.702929, 0.467890, 0.312500, 1.000000, 0.191176, 0.046512, 0.000000, 0.105263, 0.055556, 1.000000, 0.440000, 1.000000, 0.000000, 0.896552, 0.750000, 0.000000, 1.000000, 1.000000, 0.900000, 1.000000, 0.843373, 0.944444, 0.600000, 0.000000, 1.000000, 0.970149, 0.900000, 0.666667, 1.000000, 1.000000, 0.181818, 0.100000, 1.000000, 0.000000, 1.000000, 0.259887, 0.121739, 0.049020, 0.571429, 0.000000, 1.000000, 0.010526, 0.000000, 0.090909, 1.000000, 0.000000, 0.692308, 1.000000, 0.200000, 1.000000, 0.000000, 0.516129, 0.000000, 0.640000, 0.941176, 0.714286, 1.000000, 0.000000, 1.000000, 0.000000, 0.484234, 0.274131, 0.554054, 0.904762, 1.000000, 0.000000, 0.415094, 0.058824, 0.500000, 1.000000, 0.000000, 0.000000, 0.583333, 0.913043, 1.000000, 0.666667, 0.000000, 1.000000, 0.000000, 0.162162, 0.322034, 0.705882, 0.000000, 0.923077, 1.000000, 0.500000, 1.000000, 0.000000, 0.166667, 0.000000, 0.250000, 0.050000, 0.500000, 0.000000, 1.000000, 0.000000, 0.750000, 0.000000, 1.000000, 0.087302, 0.177419, 0.090909, 0.294118, 0.000000, 0.833333, 0.000000, 1.000000, 0.000000, 0.857143, 0.000000, 1.000000, 0.000000, 0.778378, 0.602410, 0.980392, 1.000000, 0.000000, 0.000000, 0.921569, 0.949495, 0.842105, 1.000000, 0.400000, 0.000000, 1.000000, 0.975000, 1.000000, 0.800000, 1.000000, 0.000000, 0.000000, 0.495495, 0.309211, 0.412322, 0.285714, 0.141026, 0.069444, 0.000000, 0.156250, 0.714286, 0.000000, 1.000000, 0.000000, 1.000000, 0.703704, 0.791667, 0.904762, 0.950000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.537736, 0.437500, 0.666667, 0.000000, 0.723404, 0.285714, 0.000000, 0.800000, 0.909091, 0.000000, 0.937500, 0.034483, 0.000000, 0.333333, 1.000000, 0.000000, 0.846154, 0.952381, 0.000000, 1.000000, 0.400000, 0.666667, 0.000000, 1.000000, 0.000000, 0.075269, 0.266667, 0.000000, 1.000000, 0.038462, 0.000000, 0.333333, 0.600000, 1.000000, 0.000000, 0.000000, 0.900000, 0.954198, 0.000000, 0.961538, 0.636364, 1.000000, 0.000000, 0.991597, 0.976190, 1.000000, 0.888889, 1.000000, 0.000000, 1.000000, 0.111111, 0.000000, 1.000000, 0.500000, 0.548223, 0.292079, 0.076271, 0.750000, 1.000000, 0.333333, 1.000000, 0.000000, 0.027273, 0.093750, 1.000000, 0.064516, 0.500000, 1.000000, 0.000000, 0.034483, 0.000000, 0.166667, 0.000000, 0.595238, 0.492537, 0.346939, 0.535714, 0.250000, 0.083333, 0.750000, 0.916667, 0.000000, 1.000000, 0.095238, 1.000000, 0.000000, 0.888889, 0.000000, 1.000000, 1.000000, 0.817708, 0.553191, 0.812500, 0.896552, 0.000000, 0.928571, 0.333333, 0.000000, 1.000000, 1.000000, 0.000000, 0.000000, 0.903448, 0.166667, 0.000000, 1.000000, 0.935252, 0.977273, 0.920000, 0.958333, 1.000000, 0.000000, 0.000000, 0.990654, 1.000000, 0.833333, 0.000000, 1.000000, 0.142857, 0.000000, 1.000000, 0.120000, 0.857143, 1.000000, 0.000000, 0.000000, 0.529279, 0.571776, 0.654971, 0.492188, 0.850000, 0.000000, 1.000000, 0.329545, 0.888889, 1.000000, 0.333333, 0.000000, 1.000000, 0.185714, 0.857143, 0.000000, 1.000000, 0.111111, 0.035088, 0.000000, 1.000000, 0.833333, 1.000000, 0.000000, 0.752336, 0.293103, 0.857143, 1.000000, 0.000000, 0.215686, 0.636364, 0.777778, 1.000000, 0.000000, 0.000000, 0.100000, 0.600000, 1.000000, 0.000000, 0.028571, 0.000000, 0.250000, 0.923077, 0.875000, 0.750000, 0.272727, 0.000000, 0.750000, 0.891892, 0.942857, 0.000000, 1.000000, 1.000000, 0.159420, 0.052632, 0.000000, 1.000000, 0.666667, 0.000000, 0.800000, 1.000000, 0.333333, 1.000000, 0.000000, 0.000000, 0.490991, 0.231343, 0.046154, 0.000000, 0.500000, 1.000000, 0.000000, 0.405797, 0.750000, 1.000000, 0.000000, 0.265306, 1.000000, 0.076923, 1.000000, 0.000000, 0.603226, 0.267974, 0.371429, 0.000000, 0.702703, 0.000000, 0.866667, 1.000000, 0.428571, 1.000000, 0.000000, 0.180723, 0.590909, 0.928571, 0.000000, 1.000000, 0.000000, 0.032787, 0.000000, 0.222222, 0.000000, 1.000000, 0.929936, 0.744186, 0.842105, 0.000000, 1.000000, 0.000000, 1.000000 };
+static const int RF_TREE_ORDER[] = { 7, 8, 5, 1, 4, 3, 9, 2, 0, 6 };
@@ -1,6 +1,8 @@
 #pragma once
 #include <cmath>
 #include "model_edge.h"
+#include "model_edge_q.h"
+#include "linear_q.h"
 #include "catch22_settings.h"
 
 int predict_svm(const float* raw_features, float* out_score) {
@@ -26,4 +28,24 @@ int predict_svm(const float* raw_features, float* out_score) {
     
     // Decision Boundary is 0.0 for SVM
     return (decision >= 0.0f) ? 1 : 0;
-}
\ No newline at end of file
+}
+
+// ================= FIXED-POINT PATH =================
+// LINEAR_Q = 16 or 8 makes main.cpp use the int16 / int8 kernels of
+// linear_q.h (parameters in model_edge_q.h); 0 keeps the float path.
+#ifndef LINEAR_Q
+#define LINEAR_Q 0
+#endif
+
+static const LinearQ<int16_t> SVM_Q16 = { SVM_N_FEATURES, SVM_Q_SHIFT, SVM_Q_MEAN, SVM_Q16_COEF,
+    SVM_Q16_ACC_FRAC, SVM_Q16_THRESHOLD, SVM_Q_POLARITY, SVM_Q_SCORE_MUL };
+static const LinearQ<int8_t> SVM_Q8 = { SVM_N_FEATURES, SVM_Q_SHIFT, SVM_Q_MEAN, SVM_Q8_COEF,
+    SVM_Q8_ACC_FRAC, SVM_Q8_THRESHOLD, SVM_Q_POLARITY, SVM_Q_SCORE_MUL };
+
+int predict_svm_q16(const float* features, float* out_score) {
+    return predict_linear_q(features, SVM_Q16, out_score);
+}
+
+int predict_svm_q8(const float* features, float* out_score) {
+    return predict_linear_q(features, SVM_Q8, out_score);
+}
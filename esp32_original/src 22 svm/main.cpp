@@ -7,6 +7,19 @@
 
 #include "catch22_settings.h" 
 #include "infer.h"
+#include "catch22_features.h"
+#include "prefilter.h"
+#include "sensor_json.h"
+#include "sample_frame.h"
+#include "batch.h"
+#include "detection_row.h"
+#include "pipeline.h"
+#include "checkpoint.h"
+#include "link.h"
+#include "detection_log.h"
+#include "report.h"
+#include "transport.h"
+#include "hop.h"
 
 #define SERIAL_BAUD 9600
 
@@ -18,207 +31,510 @@ const char *MQTT_USER = "abcsolution";
 const char *MQTT_PASSWD = "CseLAbC5c6";
 const char *MQTT_TOPIC_DATA = "duy/sensorFault";
 const char *MQTT_TOPIC_OUT = "duy/sensorDetection";
+const char *MQTT_TOPIC_BIN = "duy/sensorFault/bin";
+const char *MQTT_TOPIC_LOG = "duy/sensorDetection/log";
 
 WiFiClient espClient;
 PubSubClient client(espClient);
 
-float history_buffer[NUM_RAW_INPUTS][C22_WINDOW_SIZE];
-int buffer_idx = 0;
-bool buffer_full = false;
+bool wifiUp(void *ctx) { return WiFi.status() == WL_CONNECTED; }
 
-// ================= CATCH22 ALGORITHMS =================
-float c22_histogram_mode(const std::vector<float>& x, int bins) {
-    if(x.empty()) return 0.0f;
-    float min_v = x[0], max_v = x[0];
-    for(float v : x) {
-        if(v < min_v) min_v = v;
-        if(v > max_v) max_v = v;
-    }
-    if (abs(max_v - min_v) < 1e-9) return 0.0f;
+void wifiBegin(void *ctx) { WiFi.begin(WIFI_SSID, WIFI_PASS); }
 
-    std::vector<int> counts(bins, 0);
-    float step = (max_v - min_v) / bins;
-    
-    for(float v : x) {
-        int idx = (int)((v - min_v) / step);
-        if(idx >= bins) idx = bins - 1;
-        counts[idx]++;
+bool mqttUp(void *ctx) { return client.connected(); }
+
+// One connection attempt, made by link_poll (link.h): subscribes and sends
+// READY once connected.
+bool mqttConnect(void *ctx) {
+    if(!client.connect("esp32_catch22_svm", MQTT_USER, MQTT_PASSWD)) return false;
+    client.subscribe(MQTT_TOPIC_DATA);
+#if SAMPLE_FRAME
+    client.subscribe(MQTT_TOPIC_BIN);
+#endif
+    // READY signal
+    client.publish(MQTT_TOPIC_OUT, "{\"status\": \"READY\"}");
+    Serial.println("MQTT Connected. Sent READY.");
+    return true;
+}
+
+#if TRANSPORT == TRANSPORT_MQTT
+// The MQTT transport (transport.h): MQTT_TOPIC_OUT while the link is up.
+bool mqttReady(void *ctx) { return link_up(net_link); }
+
+bool mqttSend(void *ctx, const uint8_t *p, size_t n) { return client.publish(MQTT_TOPIC_OUT, p, n); }
+#endif
+
+// One row or message: published now, or kept in the outbox (outbox.h) while
+// the transport cannot send or older rows are still waiting there.
+void publish_row(const char *row) {
+    if(transport_ready(transport) && outbox_depth(outbox) == 0 && transport_send(transport, row, strlen(row))) return;
+    outbox_put(outbox, row, strlen(row));
+}
+
+// The oldest rows the outbox kept, as many as fit in one message.
+void flush_outbox() {
+    int rows;
+    size_t n = outbox_pack(outbox, &rows);
+    if(rows > 0 && transport_send(transport, outbox.msg, n)) outbox_pop(outbox, rows);
+}
+
+#if DETLOG
+DetLog detlog;
+
+// One chunk of a range upload (detection_log.h); the next pass sends the
+// next one. On its own topic with MQTT, among the rows otherwise; a gap of
+// lost records (n == 0) is passed over without sending anything.
+void upload_log() {
+    uint32_t next;
+    size_t n = detlog_pack(detlog, &next);
+#if TRANSPORT == TRANSPORT_MQTT
+    bool sent = n == 0 || client.publish(MQTT_TOPIC_LOG, detlog.chunk, n);
+#else
+    bool sent = n == 0 || transport_send(transport, detlog.chunk, n);
+#endif
+    if(sent) detlog_sent(detlog, next);
+}
+#endif
+
+#if BATCH_MAX > 1
+// Sends the queued detection rows as one message (batch.h), or to the
+// outbox as publish_row would.
+void flush_detections() {
+    if(detection_batch.rows == 0) return;
+    if(!transport_ready(transport) || outbox_depth(outbox) > 0 ||
+       !transport_send(transport, detection_batch.buf, detection_batch.len)) {
+        outbox_put_lines(outbox, detection_batch.buf, detection_batch.len);
     }
-    
-    int max_count = -1;
-    int max_idx = 0;
-    for(int i=0; i<bins; i++) {
-        if(counts[i] > max_count) {
-            max_count = counts[i];
-            max_idx = i;
-        }
+    batch_clear(detection_batch);
+}
+#endif
+
+// One detection row: published now, or queued in the batch with BATCH_MAX > 1.
+void publish_detection(const char *row) {
+#if DETLOG
+    // On flash first (detection_log.h), whatever becomes of the publish.
+    detlog_append_row(detlog, row, strlen(row));
+#endif
+#if REPORT
+    // Debounced labels, change-only publishing, the heartbeat's figures (report.h).
+    row = report_row(report, row, strlen(row));
+    if(!row) return;
+#endif
+#if BATCH_MAX > 1
+    size_t n = strlen(row);
+    if(!batch_add(detection_batch, row, n, millis())) {
+        flush_detections();
+        if(!batch_add(detection_batch, row, n, millis())) publish_row(row);
     }
-    return min_v + (max_idx + 0.5f) * step;
-}
-
-float c22_co_f1ecac(const std::vector<float>& x) {
-    size_t N = x.size();
-    if(N < 2) return 0.0f;
-    float mean = 0.0f;
-    for(float v : x) mean += v;
-    mean /= N;
-    float var = 0.0f;
-    for(float v : x) var += (v - mean) * (v - mean);
-    if(var < 1e-9) return (float)N;
-    float thresh = 0.367879f; 
-    for(size_t tau=1; tau < N; tau++) {
-        float cov = 0.0f;
-        for(size_t i=0; i < N - tau; i++) cov += (x[i] - mean) * (x[i+tau] - mean);
-        if(cov / var < thresh) return (float)tau;
-    }
-    return (float)N;
-}
-
-float c22_co_first_min_ac(const std::vector<float>& x) {
-    size_t N = x.size();
-    if(N < 2) return 0.0f;
-    float mean = 0.0f;
-    for(float v : x) mean += v;
-    mean /= N;
-    float var = 0.0f;
-    for(float v : x) var += (v - mean) * (v - mean);
-    if(var < 1e-9) return 0.0f;
-    float prev_ac = 1.0f;
-    for(size_t tau=1; tau < N; tau++) {
-        float cov = 0.0f;
-        for(size_t i=0; i < N - tau; i++) cov += (x[i] - mean) * (x[i+tau] - mean);
-        float ac = cov / var;
-        if (ac > prev_ac) return (float)(tau - 1);
-        prev_ac = ac;
-    }
-    return (float)N;
-}
-
-float c22_co_trev_1_num(const std::vector<float>& x) {
-    size_t N = x.size();
-    if(N < 2) return 0.0f;
-    float sum_val = 0.0f;
-    for(size_t i=0; i < N - 1; i++) {
-        float diff = x[i+1] - x[i];
-        sum_val += (diff * diff * diff);
-    }
-    return sum_val / (N - 1);
-}
-
-float c22_md_hrv_pnn40(const std::vector<float>& x) {
-    size_t N = x.size();
-    if(N < 2) return 0.0f;
-    int count = 0;
-    for(size_t i=0; i < N - 1; i++) {
-        if(abs(x[i+1] - x[i]) > 0.04f) count++;
-    }
-    return (float)count / (N - 1);
-}
-
-void extract_catch22_features(float* raw, float* out) {
-    for(int i=0; i<NUM_RAW_INPUTS; i++) {
-        history_buffer[i][buffer_idx] = raw[i];
-    }
-    buffer_idx = (buffer_idx + 1) % C22_WINDOW_SIZE;
-    if (buffer_idx == 0) buffer_full = true;
-
-    int f_idx = 0;
-    int count = buffer_full ? C22_WINDOW_SIZE : buffer_idx;
-
-    for (int s = 0; s < NUM_RAW_INPUTS; s++) {
-        std::vector<float> x;
-        x.reserve(count);
-        if (buffer_full) {
-            for(int i=buffer_idx; i<C22_WINDOW_SIZE; i++) x.push_back(history_buffer[s][i]);
-            for(int i=0; i<buffer_idx; i++) x.push_back(history_buffer[s][i]);
-        } else {
-            for(int i=0; i<buffer_idx; i++) x.push_back(history_buffer[s][i]);
-        }
-        
-        if (x.size() < 5) {
-            for(int k=0; k<6; k++) out[f_idx++] = 0.0f;
-            continue;
-        }
+    if(batch_full(detection_batch)) flush_detections();
+#else
+    publish_row(row);
+#endif
+}
 
-        out[f_idx++] = c22_histogram_mode(x, 5);
-        out[f_idx++] = c22_histogram_mode(x, 10);
-        out[f_idx++] = c22_co_f1ecac(x);
-        out[f_idx++] = c22_co_first_min_ac(x);
-        out[f_idx++] = c22_co_trev_1_num(x);
-        out[f_idx++] = c22_md_hrv_pnn40(x);
+// Where process_sample's rows go: publish_detection, or with PIPELINE back
+// to loop() through pipeline.rows, waiting while it is full (pipeline.h).
+void emit_detection(const char *row) {
+#if PIPELINE
+    size_t n = strlen(row);
+    if(!pipeline_put_row(pipeline, row, n, false)) {
+        pipeline.row_stalls.fetch_add(1, std::memory_order_relaxed);
+        while(!pipeline_put_row(pipeline, row, n, false)) vTaskDelay(1);
     }
+#else
+    publish_detection(row);
+#endif
 }
 
-void wifiConnect() {
-  WiFi.mode(WIFI_STA); WiFi.begin(WIFI_SSID, WIFI_PASS);
-  while (WiFi.status() != WL_CONNECTED) delay(500);
+// A status message ({"status": "READY"}): published now, after the rows
+// batched before it.
+void publish_status(const char *msg) {
+#if BATCH_MAX > 1
+    flush_detections();
+#endif
+    publish_row(msg);
 }
 
-void mqttConnect() {
-  client.setServer(MQTT_HOST, MQTT_PORT);
-  while (!client.connected()) {
-    if (client.connect("esp32_catch22_svm", MQTT_USER, MQTT_PASSWD)) {
-        client.subscribe(MQTT_TOPIC_DATA);
-        // READY signal
-        client.publish(MQTT_TOPIC_OUT, "{\"status\": \"READY\"}");
-        Serial.println("MQTT Connected. Sent READY.");
-    }
-    else delay(2000);
-  }
+#if REPORT
+// The interval's heartbeat (report.h), behind the rows batched before it.
+void publish_heartbeat() {
+    char hb[REPORT_HEARTBEAT_MAX];
+    report_heartbeat_json(report, hb, sizeof(hb), millis());
+    publish_status(hb);
 }
+#endif
 
-void onMqtt(char *topic, byte *payload, unsigned int length) {
-    JsonDocument doc; 
+// Where handle_command's status messages go: publish_status, or with PIPELINE
+// through pipeline.rows behind the rows already queued.
+void emit_status(const char *msg) {
+#if PIPELINE
+    size_t n = strlen(msg);
+    while(!pipeline_put_row(pipeline, msg, n, true)) vTaskDelay(1);
+#else
+    publish_status(msg);
+#endif
+}
+
+// Decodes one JSON data-topic message into in.
+bool decode_json(byte *payload, unsigned int length, SensorJson& in) {
+#if FAST_JSON
+    // Fixed-schema parser (sensor_json.h): the payload is scanned in place.
+    return sensor_json_parse((const char*)payload, length, in);
+#else
+    JsonDocument doc;
     DeserializationError error = deserializeJson(doc, payload, length);
-    if(error) return;
+    if(error) return false;
+    sensor_json_from_doc(doc, in);
+    return true;
+#endif
+}
 
-    // Check Reset
-    if (doc.containsKey("reset") && doc["reset"] == true) {
-        Serial.println("RESET CMD. REBOOTING...");
+#if CHECKPOINT
+Checkpoint checkpoint;
+CheckpointRegion checkpoint_regions[CHECKPOINT_MAX_REGIONS];
+
+// After each message processed, on the task that owns the extractor's state:
+// saves it when a checkpoint is due (checkpoint.h).
+void checkpoint_tick() {
+    if(!checkpoint_due(checkpoint, millis())) return;
+    int n = catch22_checkpoint_regions(checkpoint_regions);
+    if(!checkpoint_save(checkpoint, checkpoint_regions, n, millis())) Serial.println("Checkpoint: save failed");
+}
+#endif
+
+// Puts the model back where a reboot leaves it, in microseconds instead of
+// seconds: the extractor's history, the pre-filter's and hop's caches. The
+// transport's counters (sample_frame_rx, pipeline) are kept. A stored
+// checkpoint is invalidated, so a reboot before the next one starts cold too.
+void reset_state() {
+    reset_catch22_state();
+    prefilter_reset(prefilter_state);
+    hop_state = HopState();
+#if CHECKPOINT
+    checkpoint_forget(checkpoint);
+#endif
+}
+
+// {"reset": true} / {"reboot": true} / {"stats": true}. Returns true when in
+// was a command.
+bool handle_command(SensorJson& in) {
+    // Check Reboot, then Reset
+    if (in.reboot) {
+        Serial.println("REBOOT CMD. REBOOTING...");
         delay(100);
         ESP.restart();
-        return;
+        return true;
+    }
+    // In place: same READY as after a boot, without the Wi-Fi and MQTT reconnect.
+    if (in.reset) {
+        reset_state();
+        emit_status("{\"status\": \"READY\"}");
+        Serial.println("RESET CMD. Sent READY.");
+        return true;
     }
 
-    String timeStr = doc["Time"] | "";
+#if DETLOG
+    // Range upload of the detection log, sent from loop(): {"log_from": a, "log_to": b}
+    if(in.log) {
+        detlog_upload_begin(detlog, in.log_from, in.log_to);
+        Serial.println("LOG UPLOAD CMD.");
+        return true;
+    }
+#endif
+
+#if REPORT
+    // Reporting settings (report.h): {"report_k": k, "report_n": n,
+    // "report_changes": true|false, "report_heartbeat_ms": ms}, any of them
+    if(in.report) {
+        char cfg[160];
+        bool ok = report_configure(report, in.report_k, in.report_n, in.report_changes, in.report_heartbeat_ms, millis());
+        report_config_json(report, ok, cfg, sizeof(cfg));
+        transport_send(transport, cfg, strlen(cfg));
+        Serial.println(cfg);
+        return true;
+    }
+#endif
+
+    // Link, outbox and transport counters (link.h, transport.h): {"stats":
+    // true}, then the pipeline's and the pre-filter's
+    if(in.stats) {
+        char stats[256];
+        link_stats_json(net_link, outbox, stats, sizeof(stats));
+        transport_send(transport, stats, strlen(stats));
+        Serial.println(stats);
+        transport_stats_json(transport, stats, sizeof(stats));
+        transport_send(transport, stats, strlen(stats));
+        Serial.println(stats);
+#if DETLOG
+        detlog_stats_json(detlog, stats, sizeof(stats));
+        transport_send(transport, stats, strlen(stats));
+        Serial.println(stats);
+#endif
+#if REPORT
+        report_stats_json(report, stats, sizeof(stats));
+        transport_send(transport, stats, strlen(stats));
+        Serial.println(stats);
+#endif
+        if(!PIPELINE && !PREFILTER) return true;
+    }
+
+#if PIPELINE
+    // Pipeline counters (pipeline.h)
+    if(in.stats) {
+        char stats[160];
+        pipeline_stats_json(pipeline, stats, sizeof(stats));
+        transport_send(transport, stats, strlen(stats));
+        Serial.println(stats);
+        if(!PREFILTER) return true;
+    }
+#endif
+
+#if PREFILTER
+    // Pre-filter counters: {"stats": true}
+    if(in.stats) {
+        char stats[160];
+        prefilter_stats_json(prefilter_state, stats, sizeof(stats));
+        transport_send(transport, stats, strlen(stats));
+        Serial.println(stats);
+        return true;
+    }
+#endif
+    return false;
+}
+
+// One sample, from a JSON message or a frame of a batch.
+void process_sample(SensorJson& in) {
+    if(handle_command(in)) return;
+
     float raw[NUM_RAW_INPUTS];
-    raw[IDX_TEMPERATURE] = doc["Temperature"];
-    raw[IDX_HUMIDITY] = doc["Humidity"];
-    raw[IDX_HUMIDITY_WEATHERSTATION] = doc["Humidity_WeatherStation"];
-    raw[IDX_TEMPERATURE_WEATHERSTATION] = doc["Temperature_WeatherStation"];
+    for(int i=0; i<NUM_RAW_INPUTS; i++) raw[i] = in.raw[i];
     
     if(isnan(raw[0])) return;
 
+#if PREFILTER
+    // Rule pre-filter (prefilter.h): a trivial reading skips extraction and
+    // inference and gets the previous or a rule decision, FeatTime 0 and the
+    // filter's own time as TestTime.
+    int pf_rule;
+    unsigned long t_pf = micros();
+    int pf_action = prefilter_check(PREFILTER_DEFAULT, prefilter_state, raw, &pf_rule);
+    if(pf_action != PREFILTER_PASS) {
+        if(pf_rule != PREFILTER_RULE_RANGE) push_catch22_sample(raw);
+        float pf_score;
+        int pf_label = prefilter_result(prefilter_state, pf_action, 0, &pf_score);
+        DetectionRow& msg = detection_row;
+        row_begin(msg, in.time, in.time_len);
+        row_raw(msg, raw);
+        row_int(msg, pf_label);
+        row_fixed(msg, 0.0f, 3);
+        row_fixed(msg, (micros() - t_pf) / 1000.0f, 3);
+        row_score(msg, pf_score, !isnan(pf_score));
+        emit_detection(row_end(msg));
+        Serial.println(msg.buf);
+        return;
+    }
+#endif
+
     static float features[C22_N_FEATURES];
     unsigned long t0 = micros();
+#if C22_HOP > 1
+    // Hop scheduling (hop.h): between hops the reading only enters the window
+    // and the last decision is published again, with TestTime 0.
+    if(!extract_catch22_features_hop(raw, features)) {
+        float hop_score;
+        int hop_label = hop_result(hop_state, 0, catch22_pending, &hop_score);
+        DetectionRow& msg = detection_row;
+        row_begin(msg, in.time, in.time_len);
+        row_raw(msg, raw);
+        row_int(msg, hop_label);
+        row_fixed(msg, (micros() - t0) / 1000.0f, 3);
+        row_fixed(msg, 0.0f, 3);
+        row_score(msg, hop_score, !isnan(hop_score));
+        emit_detection(row_end(msg));
+        Serial.println(msg.buf);
+        return;
+    }
+#else
     extract_catch22_features(raw, features);
+#endif
     float t_feat = (micros() - t0) / 1000.0f;
     
     float score = 0;
     unsigned long t1 = micros();
-    int label = predict_svm(features, &score); 
+    int label;
+#if LINEAR_Q == 16
+    label = predict_svm_q16(features, &score);
+#elif LINEAR_Q == 8
+    label = predict_svm_q8(features, &score);
+#else
+    label = predict_svm(features, &score);
+#endif
     float t_infer = (micros() - t1) / 1000.0f;
 
-    String msg = timeStr + ",";
-    msg += String(raw[IDX_TEMPERATURE],2)+","+String(raw[IDX_HUMIDITY],2)+","+
-           String(raw[IDX_HUMIDITY_WEATHERSTATION],2)+","+String(raw[IDX_TEMPERATURE_WEATHERSTATION],2)+",";
-    msg += String(label) + "," + String(t_feat, 3) + "," + String(t_infer, 3) + "," + String(score, 4);
+    DetectionRow& msg = detection_row;
+    row_begin(msg, in.time, in.time_len);
+    row_raw(msg, raw);
+    row_int(msg, label);
+    row_fixed(msg, t_feat, 3);
+    row_fixed(msg, t_infer, 3);
+    row_fixed(msg, score, 4);
     
-    client.publish(MQTT_TOPIC_OUT, msg.c_str());
-    Serial.println(msg);
+    emit_detection(row_end(msg));
+    Serial.println(msg.buf);
+#if PREFILTER
+    prefilter_decided(prefilter_state, 0, label, score);
+#endif
+#if C22_HOP > 1
+    hop_decided(hop_state, 0, label, score, catch22_gap);
+#endif
+}
+
+#if PIPELINE
+TaskHandle_t inference_task_handle;
+
+// The inference task, pinned to PIPELINE_CORE: the queued samples through
+// process_sample, in order (pipeline.h).
+void inference_task(void *arg) {
+    while(true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        PipelineSample *s;
+        while((s = spsc_front(pipeline.samples)) != nullptr) {
+            process_sample(s->in);
+#if CHECKPOINT
+            checkpoint_tick();
+#endif
+            spsc_pop(pipeline.samples);
+        }
+    }
 }
+#endif
+
+// A decoded sample: processed here, or with PIPELINE queued for the
+// inference task once stats and reboot are answered. A reset is queued too,
+// so it clears the history after the samples before it, not under them.
+void ingest_sample(SensorJson& in) {
+#if PIPELINE
+    if(!in.reset && handle_command(in)) return;
+    if(pipeline_put_sample(pipeline, in, micros())) xTaskNotifyGive(inference_task_handle);
+#else
+    process_sample(in);
+#if CHECKPOINT
+    checkpoint_tick();
+#endif
+#endif
+}
+
+// One payload, whichever transport carried it (transport.h).
+void on_payload(uint8_t *payload, size_t length) {
+#if SAMPLE_FRAME
+    // Sample frames, one or a batch back to back (batch.h). Publishing may
+    // reuse the buffer the payload sits in (the MQTT client's), so the frames
+    // are copied first.
+    if(sample_frame_is(payload, length)) {
+        static uint8_t frames[OUTBOX_MQTT_BUFFER];
+        size_t n = (length < sizeof(frames)) ? length : sizeof(frames);
+        memcpy(frames, payload, n);
+        SensorJson in;
+        size_t off = 0, used;
+        while(off < n && (used = sample_frame_decode(frames + off, n - off, in)) > 0) {
+            ingest_sample(in);
+            off += used;
+        }
+        return;
+    }
+#endif
+    SensorJson in;
+    if(!decode_json(payload, length, in)) return;
+    ingest_sample(in);
+}
+
+#if TRANSPORT == TRANSPORT_MQTT
+void onMqtt(char *topic, byte *payload, unsigned int length) {
+    transport.rx_payloads++;
+    transport.rx_bytes += length;
+    on_payload(payload, length);
+}
+#endif
 
 void setup() {
     Serial.begin(SERIAL_BAUD);
     for(int i=0; i<NUM_RAW_INPUTS; i++) {
         for(int j=0; j<C22_WINDOW_SIZE; j++) history_buffer[i][j] = 0.0f;
     }
-    wifiConnect();
+#if CHECKPOINT
+    // Warm start: the state saved before the last reboot, if it is intact.
+    checkpoint_begin(checkpoint, checkpoint_nvs_store(), "catch22");
+    if(checkpoint_restore(checkpoint, checkpoint_regions, catch22_checkpoint_regions(checkpoint_regions))) {
+        Serial.println("Checkpoint restored.");
+    }
+#endif
+#if DETLOG
+    // Detection log (detection_log.h): appends after the last boot's records.
+    if(detlog_begin(detlog, detlog_partition_store(DETLOG_PARTITION))) {
+        Serial.print("Detection log: next record ");
+        Serial.println(detlog.next_seq);
+    } else {
+        Serial.println("Detection log: no partition " DETLOG_PARTITION);
+    }
+#endif
+#if REPORT
+    report_begin(report, millis());
+#endif
+#if PIPELINE
+    xTaskCreatePinnedToCore(inference_task, "inference", PIPELINE_STACK, nullptr, 1,
+                            &inference_task_handle, PIPELINE_CORE);
+#endif
+#if TRANSPORT == TRANSPORT_UART
+    // The hub on the UART (transport.h), no Wi-Fi: READY right away.
+    Serial2.begin(TRANSPORT_UART_BAUD, SERIAL_8N1, TRANSPORT_UART_RX, TRANSPORT_UART_TX);
+    transport_begin(transport, transport_uart_ops(Serial2));
+    publish_status("{\"status\": \"READY\"}");
+#elif TRANSPORT == TRANSPORT_UDP
+    // Wi-Fi comes up from loop(), then the socket is bound (link.h). READY
+    // waits in the outbox for the first datagram.
+    WiFi.mode(WIFI_STA);
+    transport_begin(transport, transport_udp_ops(transport_udp));
+    link_begin(net_link, { wifiUp, wifiBegin, transport_udp_bound, transport_udp_bind, &transport_udp }, millis());
+    publish_status("{\"status\": \"READY\"}");
+#else
+    WiFi.mode(WIFI_STA);
+    client.setServer(MQTT_HOST, MQTT_PORT);
+    client.setSocketTimeout(LINK_SOCKET_TIMEOUT_S);
     client.setCallback(onMqtt);
-    mqttConnect();
+    client.setBufferSize(OUTBOX_MQTT_BUFFER);
+    transport_begin(transport, { mqttReady, mqttSend, nullptr, false, nullptr });
+    // Wi-Fi and MQTT come up from loop() (link.h).
+    link_begin(net_link, { wifiUp, wifiBegin, mqttUp, mqttConnect, nullptr }, millis());
+#endif
 }
 
 void loop() {
-    if (!client.connected()) mqttConnect();
-    client.loop();
+#if TRANSPORT != TRANSPORT_UART
+    // Never waits for the network: one step of the link at most (link.h).
+    link_poll(net_link, millis());
+#endif
+#if TRANSPORT == TRANSPORT_MQTT
+    if(link_up(net_link)) client.loop();
+#else
+    // What the hub sent since the last pass, a bounded number of reads (transport.h).
+    transport_poll(transport, on_payload);
+#endif
+#if PIPELINE
+    PipelineRow *row;
+    while((row = spsc_front(pipeline.rows)) != nullptr) {
+        if(row->status) publish_status(row->buf);
+        else publish_detection(row->buf);
+        spsc_pop(pipeline.rows);
+    }
+#endif
+    if(transport_ready(transport) && outbox_depth(outbox) > 0) flush_outbox();
+#if DETLOG
+    if(transport_ready(transport) && detlog.uploading) upload_log();
+#endif
+#if REPORT
+    if(report_due(report, millis())) publish_heartbeat();
+#endif
+#if BATCH_MAX > 1
+    if(batch_due(detection_batch, millis())) flush_detections();
+#endif
 }
\ No newline at end of file
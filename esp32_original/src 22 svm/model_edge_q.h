@@ -0,0 +1,15 @@
+#pragma once
+#include <stdint.h>
+// Generated by host/quantise_linear.cpp; parameters for linear_q.h.
+
+// ===== SVM: inputs have room for 2^20 std =====
+static const int8_t SVM_Q_SHIFT[] = { 9, 9, 8, 6, 11, 11, 9, 9, 7, 6, 10, 11, 9, 9, 8, 7, 13, 11, 9, 9, 8, 6, 13, 11 };
+static const int32_t SVM_Q_MEAN[] = { -177, -131, 1451, 1122, 111, 1444, -56, -64, 675, 1006, 39, 1536, -113, -109, 1752, 2527, -80, 1103, -102, -67, 1665, 1168, 142, 1247 };
+#define SVM_Q_POLARITY 1
+#define SVM_Q_SCORE_MUL 0
+#define SVM_Q16_ACC_FRAC 22
+static const int16_t SVM_Q16_COEF[] = { 244, -7303, 1179, -2206, -1473, -7811, -11928, 20466, -306, 2180, -943, 2829, -156, 2156, 454, 1063, 1480, 11007, -764, 469, -3026, -1780, 950, -21549 };
+static const int64_t SVM_Q16_THRESHOLD = 48109LL;
+#define SVM_Q8_ACC_FRAC 14
+static const int8_t SVM_Q8_COEF[] = { 1, -29, 5, -9, -6, -31, -47, 80, -1, 9, -4, 11, -1, 8, 2, 4, 6, 43, -3, 2, -12, -7, 4, -84 };
+static const int64_t SVM_Q8_THRESHOLD = 188LL;
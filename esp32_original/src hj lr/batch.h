@@ -0,0 +1,70 @@
+#pragma once
+#include <stddef.h>
+#include <string.h>
+
+// ================= BATCHING =================
+// Inbound, one message may carry several sample frames back to back
+// (sample_frame.h, e.g. host/publish_frames.cpp --batch N); onMqtt runs them
+// through the extractor in order, one detection row each.
+//
+// Outbound, with BATCH_MAX > 1 the detection rows are not published one by
+// one: publish_detection appends them to detection_batch, newline-separated,
+// and the batch goes out as one message on MQTT_TOPIC_OUT once it holds
+// max_rows rows, or linger_ms after its first row (checked from loop()).
+// get.py writes such a message as that many CSV lines. BATCH_MAX 1 publishes
+// every row on its own, as before.
+//
+// PubSubClient keeps one buffer for both directions, 256 bytes by default
+// (about 8 frames in and one row out); BATCH_MAX > 1 raises it to
+// BATCH_MQTT_BUFFER. A larger inbound message is dropped by the client.
+
+#ifndef BATCH_MAX
+#define BATCH_MAX 1
+#endif
+#ifndef BATCH_LINGER_MS
+#define BATCH_LINGER_MS 1000
+#endif
+#ifndef BATCH_ROW_MAX
+#define BATCH_ROW_MAX 128    // longest detection row, newline included
+#endif
+#ifndef BATCH_MQTT_BUFFER
+#define BATCH_MQTT_BUFFER ((BATCH_MAX) > 1 ? (BATCH_MAX) * BATCH_ROW_MAX + 64 : 256)
+#endif
+
+struct DetectionBatch {
+    char buf[BATCH_MAX * BATCH_ROW_MAX];
+    size_t len;
+    int rows;
+    int max_rows;               // at most BATCH_MAX
+    unsigned long linger_ms;
+    unsigned long first_ms;     // when the first row went in
+};
+
+DetectionBatch detection_batch = { {0}, 0, 0, BATCH_MAX, BATCH_LINGER_MS, 0 };
+
+// Appends one row (n chars, no newline). Returns false, the batch unchanged,
+// when it is full or the row does not fit.
+bool batch_add(DetectionBatch& b, const char* row, size_t n, unsigned long now_ms) {
+    size_t need = n + (b.rows > 0 ? 1 : 0);
+    if(b.rows >= b.max_rows || b.len + need > sizeof(b.buf)) return false;
+    if(b.rows > 0) b.buf[b.len++] = '\n';
+    else b.first_ms = now_ms;
+    memcpy(b.buf + b.len, row, n);
+    b.len += n;
+    b.rows++;
+    return true;
+}
+
+bool batch_full(const DetectionBatch& b) {
+    return b.rows >= b.max_rows;
+}
+
+// True when the batch has rows and the first one has waited linger_ms.
+bool batch_due(const DetectionBatch& b, unsigned long now_ms) {
+    return b.rows > 0 && now_ms - b.first_ms >= b.linger_ms;
+}
+
+void batch_clear(DetectionBatch& b) {
+    b.len = 0;
+    b.rows = 0;
+}
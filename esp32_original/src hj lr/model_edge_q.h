@@ -0,0 +1,15 @@
+#pragma once
+#include <stdint.h>
+// Generated by host/quantise_linear.cpp; parameters for linear_q.h.
+
+// ===== LR: inputs have room for 2^16 std =====
+static const int8_t LR_Q_SHIFT[] = { 6, 1, 11, 6, 4, -25, 10, 14, 11, 6, 14, 12 };
+static const int32_t LR_Q_MEAN[] = { 4091, 275, 5583, 3619, 267, 474, 4098, 10277, 6264, 3909, 11967, 10687 };
+#define LR_Q_POLARITY 1
+#define LR_Q_SCORE_MUL 65536
+#define LR_Q16_ACC_FRAC 27
+static const int16_t LR_Q16_COEF[] = { -31144, -4740, 1155, 15447, 9078, 4955, 325, -291, 6046, 4701, -3839, -5892 };
+static const int64_t LR_Q16_THRESHOLD = 28338060LL;
+#define LR_Q8_ACC_FRAC 19
+static const int8_t LR_Q8_COEF[] = { -122, -19, 5, 60, 35, 19, 1, -1, 24, 18, -15, -23 };
+static const int64_t LR_Q8_THRESHOLD = 110696LL;
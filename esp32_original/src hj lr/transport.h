@@ -0,0 +1,348 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include "outbox.h"     // OUTBOX_MQTT_BUFFER: the largest message the firmware sends
+
+// ================= TRANSPORT =================
+// Samples used to reach the firmware only as MQTT messages (client.setCallback
+// (onMqtt)), so a sensor hub wired to the ESP32 still had to go through Wi-Fi
+// and a broker. TRANSPORT picks what carries them in and the rows out:
+//
+//   TRANSPORT_MQTT  as before (the default): the data topics in, MQTT_TOPIC_OUT
+//                   out, over the link (link.h).
+//   TRANSPORT_UART  the hub on TRANSPORT_UART_RX / TRANSPORT_UART_TX at
+//                   TRANSPORT_UART_BAUD. No Wi-Fi, no broker; READY goes out
+//                   at boot. Each payload, both ways, is framed:
+//                     0xA5 0x5A  u16 length  payload  u16 CRC-16/CCITT
+//                   length and CRC little-endian, the CRC over length and
+//                   payload. A frame with a bad length or CRC is dropped and
+//                   the reader resyncs on the next 0xA5 0x5A after its first
+//                   byte, so noise or a lost byte costs only the frames it hit.
+//   TRANSPORT_UDP   one datagram per payload on TRANSPORT_UDP_PORT. Wi-Fi
+//                   comes from the link, whose MQTT step binds the socket
+//                   instead; rows go to whoever sent the last datagram, and
+//                   wait in the outbox until someone has.
+//
+// Whatever carries it, a payload is what a data-topic message was: a JSON
+// sample or command, or sample frames (sample_frame.h), and on_payload in
+// main.cpp hands it to the same ingest_sample. Rows, status messages,
+// batches and outbox bulk messages go out through transport_send, one payload
+// each; a range upload of the detection log keeps its own topic with MQTT and
+// goes out on the transport otherwise (DETLOG_CHUNK_MAGIC tells it apart).
+//
+// A UART write blocks while the driver's TX buffer is full, for about the
+// time the bytes take on the wire. loop() reads at most TRANSPORT_POLL_READS
+// times a pass, so a hub sending faster than the firmware keeps up fills the
+// UART's RX buffer (or the socket's) rather than stalling the rest of loop().
+//
+// The transport is reached through TransportOps, so host/bench_transport.cpp
+// runs the same framing and polling over a pty and a UDP socket.
+
+#define TRANSPORT_MQTT 0
+#define TRANSPORT_UART 1
+#define TRANSPORT_UDP 2
+
+#ifndef TRANSPORT
+#define TRANSPORT TRANSPORT_MQTT
+#endif
+#ifndef TRANSPORT_UART_BAUD
+#define TRANSPORT_UART_BAUD 921600
+#endif
+#ifndef TRANSPORT_UART_RX
+#define TRANSPORT_UART_RX 16
+#endif
+#ifndef TRANSPORT_UART_TX
+#define TRANSPORT_UART_TX 17
+#endif
+#ifndef TRANSPORT_UDP_PORT
+#define TRANSPORT_UDP_PORT 5005
+#endif
+#ifndef TRANSPORT_POLL_READS
+#define TRANSPORT_POLL_READS 8
+#endif
+#define TRANSPORT_PAYLOAD_MAX OUTBOX_MQTT_BUFFER
+#define TRANSPORT_SYNC0 0xA5
+#define TRANSPORT_SYNC1 0x5A
+#define TRANSPORT_FRAMING 6     // sync, length, CRC
+
+typedef void (*TransportHandler)(uint8_t* payload, size_t n);
+
+struct TransportOps {
+    bool (*ready)(void* ctx);                               // a send can go out now
+    bool (*send)(void* ctx, const uint8_t* p, size_t n);    // all n bytes, or false
+    // Without waiting: what the stream has (up to cap), or one datagram
+    // (its full length, cap bytes of it stored). 0 when there is nothing.
+    int (*recv)(void* ctx, uint8_t* buf, size_t cap);       // nullptr: payloads come in elsewhere
+    bool stream;                                            // framed byte stream, else datagrams
+    void* ctx;
+};
+
+struct Transport {
+    TransportOps ops;
+    uint8_t rx[TRANSPORT_PAYLOAD_MAX + TRANSPORT_FRAMING];  // stream bytes not yet parsed, or a datagram
+    size_t rx_have;
+    uint8_t tx[TRANSPORT_PAYLOAD_MAX + TRANSPORT_FRAMING];  // the frame being sent
+    uint32_t rx_payloads, rx_bytes;
+    uint32_t rx_bad;            // frames with a bad length or CRC, datagrams too long
+    uint32_t rx_skipped;        // stream bytes passed over looking for a frame
+    uint32_t tx_payloads, tx_failed;
+};
+
+Transport transport;
+
+void transport_begin(Transport& t, const TransportOps& ops) {
+    t.ops = ops;
+    t.rx_have = 0;
+    t.rx_payloads = t.rx_bytes = t.rx_bad = t.rx_skipped = 0;
+    t.tx_payloads = t.tx_failed = 0;
+}
+
+bool transport_ready(const Transport& t) {
+    return t.ops.ready(t.ops.ctx);
+}
+
+// CRC-16/CCITT-FALSE: polynomial 0x1021, initial 0xFFFF.
+uint16_t transport_crc16(const uint8_t* p, size_t n, uint16_t crc = 0xFFFF) {
+    for(size_t i=0; i<n; i++) {
+        crc ^= (uint16_t)p[i] << 8;
+        for(int b=0; b<8; b++) crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+    }
+    return crc;
+}
+
+// One payload framed into out (n + TRANSPORT_FRAMING bytes). Returns the
+// frame's length, 0 when it does not fit in cap or n exceeds
+// TRANSPORT_PAYLOAD_MAX.
+size_t transport_frame(const uint8_t* p, size_t n, uint8_t* out, size_t cap) {
+    if(n == 0 || n > TRANSPORT_PAYLOAD_MAX || n + TRANSPORT_FRAMING > cap) return 0;
+    out[0] = TRANSPORT_SYNC0;
+    out[1] = TRANSPORT_SYNC1;
+    out[2] = (uint8_t)n;
+    out[3] = (uint8_t)(n >> 8);
+    memcpy(out + 4, p, n);
+    uint16_t crc = transport_crc16(out + 2, n + 2);
+    out[4 + n] = (uint8_t)crc;
+    out[5 + n] = (uint8_t)(crc >> 8);
+    return n + TRANSPORT_FRAMING;
+}
+
+// The frames complete in t.rx to on_payload; a partial one is kept at the
+// front for the next read.
+static void transport_parse(Transport& t, TransportHandler on_payload) {
+    size_t off = 0, have = t.rx_have;
+    for(;;) {
+        size_t from = off;
+        while(off + 1 < have && !(t.rx[off] == TRANSPORT_SYNC0 && t.rx[off + 1] == TRANSPORT_SYNC1)) off++;
+        if(off + 1 == have && t.rx[off] != TRANSPORT_SYNC0) off++;
+        t.rx_skipped += (uint32_t)(off - from);
+        if(off + 4 > have) break;
+        size_t n = t.rx[off + 2] | ((size_t)t.rx[off + 3] << 8);
+        if(n == 0 || n > TRANSPORT_PAYLOAD_MAX) {
+            t.rx_bad++;
+            off++;
+            continue;
+        }
+        if(off + n + TRANSPORT_FRAMING > have) break;
+        uint16_t crc = t.rx[off + 4 + n] | ((uint16_t)t.rx[off + 5 + n] << 8);
+        if(transport_crc16(t.rx + off + 2, n + 2) != crc) {
+            t.rx_bad++;
+            off++;
+            continue;
+        }
+        t.rx_payloads++;
+        t.rx_bytes += (uint32_t)n;
+        on_payload(t.rx + off + 4, n);
+        off += n + TRANSPORT_FRAMING;
+    }
+    memmove(t.rx, t.rx + off, have - off);
+    t.rx_have = have - off;
+}
+
+// One loop() pass: up to TRANSPORT_POLL_READS reads, each payload received to
+// on_payload. Returns the number of reads that got something.
+int transport_poll(Transport& t, TransportHandler on_payload) {
+    if(!t.ops.recv) return 0;
+    int reads = 0;
+    for(int i=0; i<TRANSPORT_POLL_READS; i++) {
+        if(t.ops.stream) {
+            int n = t.ops.recv(t.ops.ctx, t.rx + t.rx_have, sizeof(t.rx) - t.rx_have);
+            if(n <= 0) break;
+            t.rx_have += (size_t)n;
+            transport_parse(t, on_payload);
+        } else {
+            int n = t.ops.recv(t.ops.ctx, t.rx, TRANSPORT_PAYLOAD_MAX);
+            if(n <= 0) break;
+            if(n > TRANSPORT_PAYLOAD_MAX) {
+                t.rx_bad++;
+            } else {
+                t.rx_payloads++;
+                t.rx_bytes += (uint32_t)n;
+                on_payload(t.rx, (size_t)n);
+            }
+        }
+        reads++;
+    }
+    return reads;
+}
+
+// One payload out: framed on a stream, as it is otherwise.
+bool transport_send(Transport& t, const void* p, size_t n) {
+    bool ok;
+    if(t.ops.stream) {
+        size_t len = transport_frame((const uint8_t*)p, n, t.tx, sizeof(t.tx));
+        ok = len > 0 && t.ops.send(t.ops.ctx, t.tx, len);
+    } else {
+        ok = n <= TRANSPORT_PAYLOAD_MAX && t.ops.send(t.ops.ctx, (const uint8_t*)p, n);
+    }
+    if(ok) t.tx_payloads++;
+    else t.tx_failed++;
+    return ok;
+}
+
+int transport_stats_json(const Transport& t, char* buf, size_t n) {
+    static const char* const names[] = { "mqtt", "uart", "udp" };
+    return snprintf(buf, n,
+                    "{\"transport\": \"%s\", \"rx\": %lu, \"rx_bytes\": %lu, \"rx_bad\": %lu, \"rx_skipped\": %lu, "
+                    "\"tx\": %lu, \"tx_failed\": %lu}",
+                    names[TRANSPORT], (unsigned long)t.rx_payloads, (unsigned long)t.rx_bytes,
+                    (unsigned long)t.rx_bad, (unsigned long)t.rx_skipped, (unsigned long)t.tx_payloads,
+                    (unsigned long)t.tx_failed);
+}
+
+#if defined(__linux__)
+#include <errno.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+// A file descriptor carrying the framed stream, opened O_NONBLOCK: a pty, a
+// serial device, a pipe.
+struct TransportFd {
+    int fd;
+};
+
+static bool tr_fd_ready(void* ctx) { return ((TransportFd*)ctx)->fd >= 0; }
+
+static bool tr_fd_send(void* ctx, const uint8_t* p, size_t n) {
+    int fd = ((TransportFd*)ctx)->fd;
+    while(n > 0) {
+        ssize_t w = write(fd, p, n);
+        if(w > 0) {
+            p += w;
+            n -= (size_t)w;
+        } else if(w < 0 && (errno == EAGAIN || errno == EINTR)) {
+            pollfd pf = { fd, POLLOUT, 0 };
+            poll(&pf, 1, 100);
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+static int tr_fd_recv(void* ctx, uint8_t* buf, size_t cap) {
+    ssize_t r = read(((TransportFd*)ctx)->fd, buf, cap);
+    return (r > 0) ? (int)r : 0;
+}
+
+TransportOps transport_fd_ops(TransportFd& f) {
+    return { tr_fd_ready, tr_fd_send, tr_fd_recv, true, &f };
+}
+
+// A bound UDP socket; replies go to the last sender.
+struct TransportSock {
+    int fd;
+    sockaddr_storage peer;
+    socklen_t peer_len;         // 0: nobody has sent yet
+};
+
+static bool tr_sock_ready(void* ctx) { return ((TransportSock*)ctx)->peer_len > 0; }
+
+static bool tr_sock_send(void* ctx, const uint8_t* p, size_t n) {
+    TransportSock* s = (TransportSock*)ctx;
+    return sendto(s->fd, p, n, 0, (const sockaddr*)&s->peer, s->peer_len) == (ssize_t)n;
+}
+
+static int tr_sock_recv(void* ctx, uint8_t* buf, size_t cap) {
+    TransportSock* s = (TransportSock*)ctx;
+    sockaddr_storage from;
+    socklen_t len = sizeof(from);
+    ssize_t r = recvfrom(s->fd, buf, cap, MSG_DONTWAIT | MSG_TRUNC, (sockaddr*)&from, &len);
+    if(r <= 0) return 0;
+    s->peer = from;
+    s->peer_len = len;
+    return (int)r;
+}
+
+TransportOps transport_sock_ops(TransportSock& s) {
+    return { tr_sock_ready, tr_sock_send, tr_sock_recv, false, &s };
+}
+#endif
+
+#if defined(ARDUINO_ARCH_ESP32)
+#include <HardwareSerial.h>
+#include <WiFi.h>
+#include <WiFiUdp.h>
+
+static bool tr_uart_ready(void* ctx) { return true; }
+
+static bool tr_uart_send(void* ctx, const uint8_t* p, size_t n) {
+    return ((HardwareSerial*)ctx)->write(p, n) == n;
+}
+
+static int tr_uart_recv(void* ctx, uint8_t* buf, size_t cap) {
+    HardwareSerial* s = (HardwareSerial*)ctx;
+    int avail = s->available();
+    if(avail <= 0) return 0;
+    return (int)s->read(buf, ((size_t)avail < cap) ? (size_t)avail : cap);
+}
+
+TransportOps transport_uart_ops(HardwareSerial& s) {
+    return { tr_uart_ready, tr_uart_send, tr_uart_recv, true, &s };
+}
+
+struct TransportUdp {
+    WiFiUDP udp;
+    bool bound;
+    IPAddress peer;
+    uint16_t peer_port;         // 0: nobody has sent yet
+};
+
+TransportUdp transport_udp;
+
+// The link's MQTT step with TRANSPORT_UDP (link.h): the socket bound.
+bool transport_udp_bound(void* ctx) { return ((TransportUdp*)ctx)->bound; }
+
+bool transport_udp_bind(void* ctx) {
+    TransportUdp* u = (TransportUdp*)ctx;
+    u->bound = u->udp.begin(TRANSPORT_UDP_PORT) == 1;
+    return u->bound;
+}
+
+static bool tr_udp_ready(void* ctx) {
+    TransportUdp* u = (TransportUdp*)ctx;
+    return u->bound && u->peer_port != 0 && WiFi.status() == WL_CONNECTED;
+}
+
+static bool tr_udp_send(void* ctx, const uint8_t* p, size_t n) {
+    TransportUdp* u = (TransportUdp*)ctx;
+    return u->udp.beginPacket(u->peer, u->peer_port) == 1 && u->udp.write(p, n) == n && u->udp.endPacket() == 1;
+}
+
+static int tr_udp_recv(void* ctx, uint8_t* buf, size_t cap) {
+    TransportUdp* u = (TransportUdp*)ctx;
+    if(!u->bound) return 0;
+    int n = u->udp.parsePacket();
+    if(n <= 0) return 0;
+    u->peer = u->udp.remoteIP();
+    u->peer_port = u->udp.remotePort();
+    u->udp.read(buf, ((size_t)n < cap) ? (size_t)n : cap);
+    return n;
+}
+
+TransportOps transport_udp_ops(TransportUdp& u) {
+    return { tr_udp_ready, tr_udp_send, tr_udp_recv, false, &u };
+}
+#endif
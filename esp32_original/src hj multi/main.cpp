@@ -0,0 +1,670 @@
+#include <WiFi.h>
+#include <PubSubClient.h>
+#include <ArduinoJson.h>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include "hjorth_settings.h" 
+#include "infer.h"
+#include "hjorth_features.h"
+#include "prefilter.h"
+#include "sensor_json.h"
+#include "sample_frame.h"
+#include "batch.h"
+#include "detection_row.h"
+#include "pipeline.h"
+#include "checkpoint.h"
+#include "link.h"
+#include "detection_log.h"
+#include "report.h"
+#include "transport.h"
+#include "hop.h"
+
+#define SERIAL_BAUD 9600
+
+const char *WIFI_SSID = "393B_Home_1";
+const char *WIFI_PASS = "1234567890";
+const char *MQTT_HOST = "mqtt.abcsolutions.com.vn";
+const int MQTT_PORT = 1883;
+const char *MQTT_USER = "abcsolution";
+const char *MQTT_PASSWD = "CseLAbC5c6";
+const char *MQTT_TOPIC_DATA = "duy/sensorFault";
+const char *MQTT_TOPIC_OUT = "duy/sensorDetection";
+const char *MQTT_TOPIC_BIN = "duy/sensorFault/bin";
+const char *MQTT_TOPIC_LOG = "duy/sensorDetection/log";
+
+WiFiClient espClient;
+PubSubClient client(espClient);
+
+bool wifiUp(void *ctx) { return WiFi.status() == WL_CONNECTED; }
+
+void wifiBegin(void *ctx) { WiFi.begin(WIFI_SSID, WIFI_PASS); }
+
+bool mqttUp(void *ctx) { return client.connected(); }
+
+// One connection attempt, made by link_poll (link.h): subscribes and sends
+// READY once connected.
+bool mqttConnect(void *ctx) {
+    if(!client.connect("esp32_hjorth_multi", MQTT_USER, MQTT_PASSWD)) return false;
+    client.subscribe(MQTT_TOPIC_DATA);
+#if SAMPLE_FRAME
+    client.subscribe(MQTT_TOPIC_BIN);
+#endif
+    // READY signal
+    client.publish(MQTT_TOPIC_OUT, "{\"status\": \"READY\"}");
+    Serial.println("MQTT Connected. Sent READY.");
+    return true;
+}
+
+#if TRANSPORT == TRANSPORT_MQTT
+// The MQTT transport (transport.h): MQTT_TOPIC_OUT while the link is up.
+bool mqttReady(void *ctx) { return link_up(net_link); }
+
+bool mqttSend(void *ctx, const uint8_t *p, size_t n) { return client.publish(MQTT_TOPIC_OUT, p, n); }
+#endif
+
+// One row or message: published now, or kept in the outbox (outbox.h) while
+// the transport cannot send or older rows are still waiting there.
+void publish_row(const char *row) {
+    if(transport_ready(transport) && outbox_depth(outbox) == 0 && transport_send(transport, row, strlen(row))) return;
+    outbox_put(outbox, row, strlen(row));
+}
+
+// The oldest rows the outbox kept, as many as fit in one message.
+void flush_outbox() {
+    int rows;
+    size_t n = outbox_pack(outbox, &rows);
+    if(rows > 0 && transport_send(transport, outbox.msg, n)) outbox_pop(outbox, rows);
+}
+
+#if DETLOG
+DetLog detlog;
+
+// One chunk of a range upload (detection_log.h); the next pass sends the
+// next one. On its own topic with MQTT, among the rows otherwise; a gap of
+// lost records (n == 0) is passed over without sending anything.
+void upload_log() {
+    uint32_t next;
+    size_t n = detlog_pack(detlog, &next);
+#if TRANSPORT == TRANSPORT_MQTT
+    bool sent = n == 0 || client.publish(MQTT_TOPIC_LOG, detlog.chunk, n);
+#else
+    bool sent = n == 0 || transport_send(transport, detlog.chunk, n);
+#endif
+    if(sent) detlog_sent(detlog, next);
+}
+#endif
+
+// One head of the output line: Label,TestTime,Score (score empty in label mode).
+void append_head(DetectionRow& msg, int label, float t_infer, float score, bool with_score) {
+    row_int(msg, label);
+    row_fixed(msg, t_infer, 3);
+    row_score(msg, score, with_score);
+}
+
+#if BATCH_MAX > 1
+// Sends the queued detection rows as one message (batch.h), or to the
+// outbox as publish_row would.
+void flush_detections() {
+    if(detection_batch.rows == 0) return;
+    if(!transport_ready(transport) || outbox_depth(outbox) > 0 ||
+       !transport_send(transport, detection_batch.buf, detection_batch.len)) {
+        outbox_put_lines(outbox, detection_batch.buf, detection_batch.len);
+    }
+    batch_clear(detection_batch);
+}
+#endif
+
+// One detection row: published now, or queued in the batch with BATCH_MAX > 1.
+void publish_detection(const char *row) {
+#if DETLOG
+    // On flash first (detection_log.h), whatever becomes of the publish.
+    detlog_append_row(detlog, row, strlen(row));
+#endif
+#if REPORT
+    // Debounced labels, change-only publishing, the heartbeat's figures (report.h).
+    row = report_row(report, row, strlen(row));
+    if(!row) return;
+#endif
+#if BATCH_MAX > 1
+    size_t n = strlen(row);
+    if(!batch_add(detection_batch, row, n, millis())) {
+        flush_detections();
+        if(!batch_add(detection_batch, row, n, millis())) publish_row(row);
+    }
+    if(batch_full(detection_batch)) flush_detections();
+#else
+    publish_row(row);
+#endif
+}
+
+// Where process_sample's rows go: publish_detection, or with PIPELINE back
+// to loop() through pipeline.rows, waiting while it is full (pipeline.h).
+void emit_detection(const char *row) {
+#if PIPELINE
+    size_t n = strlen(row);
+    if(!pipeline_put_row(pipeline, row, n, false)) {
+        pipeline.row_stalls.fetch_add(1, std::memory_order_relaxed);
+        while(!pipeline_put_row(pipeline, row, n, false)) vTaskDelay(1);
+    }
+#else
+    publish_detection(row);
+#endif
+}
+
+// A status message ({"status": "READY"}): published now, after the rows
+// batched before it.
+void publish_status(const char *msg) {
+#if BATCH_MAX > 1
+    flush_detections();
+#endif
+    publish_row(msg);
+}
+
+#if REPORT
+// The interval's heartbeat (report.h), behind the rows batched before it.
+void publish_heartbeat() {
+    char hb[REPORT_HEARTBEAT_MAX];
+    report_heartbeat_json(report, hb, sizeof(hb), millis());
+    publish_status(hb);
+}
+#endif
+
+// Where handle_command's status messages go: publish_status, or with PIPELINE
+// through pipeline.rows behind the rows already queued.
+void emit_status(const char *msg) {
+#if PIPELINE
+    size_t n = strlen(msg);
+    while(!pipeline_put_row(pipeline, msg, n, true)) vTaskDelay(1);
+#else
+    publish_status(msg);
+#endif
+}
+
+// Decodes one JSON data-topic message into in.
+bool decode_json(byte *payload, unsigned int length, SensorJson& in) {
+#if FAST_JSON
+    // Fixed-schema parser (sensor_json.h): the payload is scanned in place.
+    return sensor_json_parse((const char*)payload, length, in);
+#else
+    JsonDocument doc;
+    DeserializationError error = deserializeJson(doc, payload, length);
+    if(error) return false;
+    sensor_json_from_doc(doc, in);
+    return true;
+#endif
+}
+
+#if CHECKPOINT
+Checkpoint checkpoint;
+CheckpointRegion checkpoint_regions[CHECKPOINT_MAX_REGIONS];
+
+// After each message processed, on the task that owns the extractor's state:
+// saves it when a checkpoint is due (checkpoint.h).
+void checkpoint_tick() {
+    if(!checkpoint_due(checkpoint, millis())) return;
+    int n = hjorth_checkpoint_regions(checkpoint_regions);
+    if(!checkpoint_save(checkpoint, checkpoint_regions, n, millis())) Serial.println("Checkpoint: save failed");
+}
+#endif
+
+// Puts the model back where a reboot leaves it, in microseconds instead of
+// seconds: the extractor's history, the pre-filter's and hop's caches. The
+// transport's counters (sample_frame_rx, pipeline) are kept. A stored
+// checkpoint is invalidated, so a reboot before the next one starts cold too.
+void reset_state() {
+    reset_hjorth_state();
+    prefilter_reset(prefilter_state);
+    hop_state = HopState();
+#if MULTI_CASCADE
+    multi_cascade_setup();
+#endif
+#if DEADLINE_US
+    deadline_setup();
+#endif
+#if CHECKPOINT
+    checkpoint_forget(checkpoint);
+#endif
+}
+
+// {"reset": true} / {"reboot": true} / {"stats": true}. Returns true when in
+// was a command.
+bool handle_command(SensorJson& in) {
+    // Check Reboot, then Reset
+    if (in.reboot) {
+        Serial.println("REBOOT CMD. REBOOTING...");
+        delay(100);
+        ESP.restart();
+        return true;
+    }
+    // In place: same READY as after a boot, without the Wi-Fi and MQTT reconnect.
+    if (in.reset) {
+        reset_state();
+        emit_status("{\"status\": \"READY\"}");
+        Serial.println("RESET CMD. Sent READY.");
+        return true;
+    }
+
+#if DETLOG
+    // Range upload of the detection log, sent from loop(): {"log_from": a, "log_to": b}
+    if(in.log) {
+        detlog_upload_begin(detlog, in.log_from, in.log_to);
+        Serial.println("LOG UPLOAD CMD.");
+        return true;
+    }
+#endif
+
+#if REPORT
+    // Reporting settings (report.h): {"report_k": k, "report_n": n,
+    // "report_changes": true|false, "report_heartbeat_ms": ms}, any of them
+    if(in.report) {
+        char cfg[160];
+        bool ok = report_configure(report, in.report_k, in.report_n, in.report_changes, in.report_heartbeat_ms, millis());
+        report_config_json(report, ok, cfg, sizeof(cfg));
+        transport_send(transport, cfg, strlen(cfg));
+        Serial.println(cfg);
+        return true;
+    }
+#endif
+
+    // Link, outbox and transport counters (link.h, transport.h): {"stats":
+    // true}, then the pipeline's and the pre-filter's
+    if(in.stats) {
+        char stats[256];
+        link_stats_json(net_link, outbox, stats, sizeof(stats));
+        transport_send(transport, stats, strlen(stats));
+        Serial.println(stats);
+        transport_stats_json(transport, stats, sizeof(stats));
+        transport_send(transport, stats, strlen(stats));
+        Serial.println(stats);
+#if DETLOG
+        detlog_stats_json(detlog, stats, sizeof(stats));
+        transport_send(transport, stats, strlen(stats));
+        Serial.println(stats);
+#endif
+#if REPORT
+        report_stats_json(report, stats, sizeof(stats));
+        transport_send(transport, stats, strlen(stats));
+        Serial.println(stats);
+#endif
+        if(!PIPELINE && !PREFILTER) return true;
+    }
+
+#if PIPELINE
+    // Pipeline counters (pipeline.h)
+    if(in.stats) {
+        char stats[160];
+        pipeline_stats_json(pipeline, stats, sizeof(stats));
+        transport_send(transport, stats, strlen(stats));
+        Serial.println(stats);
+        if(!PREFILTER) return true;
+    }
+#endif
+
+#if PREFILTER
+    // Pre-filter counters: {"stats": true}
+    if(in.stats) {
+        char stats[160];
+        prefilter_stats_json(prefilter_state, stats, sizeof(stats));
+        transport_send(transport, stats, strlen(stats));
+        Serial.println(stats);
+        return true;
+    }
+#endif
+    return false;
+}
+
+// One sample, from a JSON message or a frame of a batch.
+void process_sample(SensorJson& in) {
+#if DEADLINE_US && !PIPELINE
+    deadline_arrive(deadline_sched, micros());
+#endif
+
+    if(handle_command(in)) return;
+
+    float raw[NUM_RAW_INPUTS];
+    for(int i=0; i<NUM_RAW_INPUTS; i++) raw[i] = in.raw[i];
+    
+    if(isnan(raw[0])) return;
+
+#if PREFILTER
+    // Rule pre-filter (prefilter.h): a trivial reading skips extraction and
+    // inference and gets the previous or a rule decision, FeatTime 0 and the
+    // filter's own time as TestTime.
+    int pf_rule;
+    unsigned long t_pf = micros();
+    int pf_action = prefilter_check(PREFILTER_DEFAULT, prefilter_state, raw, &pf_rule);
+    if(pf_action != PREFILTER_PASS) {
+        if(pf_rule != PREFILTER_RULE_RANGE) push_hjorth_sample(raw);
+        float pf_score;
+        float t_pf_ms = (micros() - t_pf) / 1000.0f;
+        DetectionRow& msg = detection_row;
+        row_begin(msg, in.time, in.time_len);
+        row_raw(msg, raw);
+        row_fixed(msg, 0.0f, 3);
+#if MULTI_CASCADE || DEADLINE_US
+        int pf_label = prefilter_result(prefilter_state, pf_action, 0, &pf_score);
+        append_head(msg, pf_label, t_pf_ms, pf_score, !isnan(pf_score));
+#if DEADLINE_US
+        row_int(msg, DEADLINE_RULE);
+#else
+        row_int(msg, 0);
+#endif
+#else
+        for(int h=0; h<PREFILTER_MAX_HEADS; h++) {
+            if(!(MULTI_MODELS & (1 << h))) continue;
+            int pf_label = prefilter_result(prefilter_state, pf_action, h, &pf_score);
+            append_head(msg, pf_label, t_pf_ms, pf_score, !isnan(pf_score));
+        }
+#endif
+        emit_detection(row_end(msg));
+        Serial.println(msg.buf);
+#if DEADLINE_US
+        // closes the message for the scheduler: the next wait starts from here
+        deadline_done(deadline_sched, DEADLINE_RULE, pf_label, pf_score, 0, false, micros());
+#endif
+        return;
+    }
+#endif
+
+#if DEADLINE_US
+    // Deadline mode (deadline.h): one decision, at the level the time left allows.
+    // CSV Format: Time,Temp,Hum,HumWS,TempWS,FeatTime,Label,TestTime,Score,Level
+    {
+        int level = deadline_pick(deadline_sched, micros());
+        static float features[HJORTH_N_FEATURES];
+        static float z[MULTI_MAX_FEATURES];
+        float score, t_feat = 0;
+        int label;
+        unsigned long t0 = micros();
+        if(level == DEADLINE_SHED) {
+            push_hjorth_sample(raw);
+            label = deadline_sched.label;
+            score = deadline_sched.score;
+        } else {
+            extract_hjorth_features(raw, features);
+            multi_prepare(multi_models, features, z);
+            t_feat = (micros() - t0) / 1000.0f;
+            label = predict_deadline(level, features, z, &score, MULTI_SCORE_MODE_LR);
+        }
+        unsigned long t_work = micros() - t0;
+
+        DetectionRow& msg = detection_row;
+        row_begin(msg, in.time, in.time_len);
+        row_raw(msg, raw);
+        row_fixed(msg, t_feat, 3);
+        append_head(msg, label, t_work / 1000.0f - t_feat, score, !isnan(score));
+        row_int(msg, level);
+        emit_detection(row_end(msg));
+        Serial.println(msg.buf);
+#if PREFILTER
+        if(level != DEADLINE_SHED) prefilter_decided(prefilter_state, 0, label, score);
+#endif
+        deadline_done(deadline_sched, level, label, score, t_work, true, micros());
+        return;
+    }
+#endif
+
+    // Extraction and the shared scaling run once; FeatTime covers both.
+    static float features[HJORTH_N_FEATURES];
+    static float z[MULTI_MAX_FEATURES];
+    unsigned long t0 = micros();
+#if HJORTH_HOP > 1
+#if DEADLINE_US
+#error "HJORTH_HOP and DEADLINE_US both skip work on some readings; use one of them"
+#endif
+    // Hop scheduling (hop.h): between hops the reading only enters the window
+    // and every head publishes its last decision again, with TestTime 0.
+    if(!extract_hjorth_features_hop(raw, features)) {
+        float hop_score;
+        DetectionRow& msg = detection_row;
+        row_begin(msg, in.time, in.time_len);
+        row_raw(msg, raw);
+        row_fixed(msg, (micros() - t0) / 1000.0f, 3);
+#if MULTI_CASCADE
+        int hop_label = hop_result(hop_state, 0, hjorth_pending, &hop_score);
+        append_head(msg, hop_label, 0.0f, hop_score, !isnan(hop_score));
+        row_int(msg, 0);
+#else
+        for(int h=0; h<HOP_MAX_HEADS; h++) {
+            if(!(MULTI_MODELS & (1 << h))) continue;
+            int hop_label = hop_result(hop_state, h, hjorth_pending, &hop_score);
+            append_head(msg, hop_label, 0.0f, hop_score, !isnan(hop_score));
+        }
+#endif
+        emit_detection(row_end(msg));
+        Serial.println(msg.buf);
+        return;
+    }
+#else
+    extract_hjorth_features(raw, features);
+#endif
+    multi_prepare(multi_models, features, z);
+    float t_feat = (micros() - t0) / 1000.0f;
+
+    // CSV Format: Time,Temp,Hum,HumWS,TempWS,FeatTime, then Label,TestTime,Score
+    // for each head built in, in the order LR, SVM, RF. With MULTI_CASCADE:
+    // Time,Temp,Hum,HumWS,TempWS,FeatTime,Label,TestTime,Score,Stage
+    DetectionRow& msg = detection_row;
+    row_begin(msg, in.time, in.time_len);
+    row_raw(msg, raw);
+    row_fixed(msg, t_feat, 3);
+
+    float score = 0;
+    unsigned long t1;
+    int label;
+#if MULTI_CASCADE
+    int stage;
+    t1 = micros();
+    label = predict_cascade(features, z, &score, &stage, MULTI_CASCADE_SCORE_MODE);
+    append_head(msg, label, (micros() - t1) / 1000.0f, score,
+                stage == MULTI_STAGE_FOREST || MULTI_CASCADE_SCORE_MODE != SCORE_MODE_LABEL);
+#if PREFILTER
+    prefilter_decided(prefilter_state, 0, label,
+                      (stage == MULTI_STAGE_FOREST || MULTI_CASCADE_SCORE_MODE != SCORE_MODE_LABEL) ? score : NAN);
+#endif
+#if HJORTH_HOP > 1
+    hop_decided(hop_state, 0, label,
+                (stage == MULTI_STAGE_FOREST || MULTI_CASCADE_SCORE_MODE != SCORE_MODE_LABEL) ? score : NAN, hjorth_gap);
+#endif
+    row_int(msg, stage);
+#else
+#if MULTI_MODELS & MULTI_LR
+    t1 = micros();
+    label = predict_lr(features, z, &score, MULTI_SCORE_MODE_LR);
+    append_head(msg, label, (micros() - t1) / 1000.0f, score, MULTI_SCORE_MODE_LR != SCORE_MODE_LABEL);
+#if PREFILTER
+    prefilter_decided(prefilter_state, 0, label, (MULTI_SCORE_MODE_LR != SCORE_MODE_LABEL) ? score : NAN);
+#endif
+#if HJORTH_HOP > 1
+    hop_decided(hop_state, 0, label, (MULTI_SCORE_MODE_LR != SCORE_MODE_LABEL) ? score : NAN, hjorth_gap);
+#endif
+#endif
+#if MULTI_MODELS & MULTI_SVM
+    t1 = micros();
+    label = predict_svm(features, z, &score, MULTI_SCORE_MODE_SVM);
+    append_head(msg, label, (micros() - t1) / 1000.0f, score, true);
+#if PREFILTER
+    prefilter_decided(prefilter_state, 1, label, score);
+#endif
+#if HJORTH_HOP > 1
+    hop_decided(hop_state, 1, label, score, hjorth_gap);
+#endif
+#endif
+#if MULTI_MODELS & MULTI_RF
+    t1 = micros();
+    label = predict_rf(features, z, &score);
+    append_head(msg, label, (micros() - t1) / 1000.0f, score, true);
+#if PREFILTER
+    prefilter_decided(prefilter_state, 2, label, score);
+#endif
+#if HJORTH_HOP > 1
+    hop_decided(hop_state, 2, label, score, hjorth_gap);
+#endif
+#endif
+#endif
+    
+    emit_detection(row_end(msg));
+    Serial.println(msg.buf);
+}
+
+#if PIPELINE
+TaskHandle_t inference_task_handle;
+
+// The inference task, pinned to PIPELINE_CORE: the queued samples through
+// process_sample, in order (pipeline.h).
+void inference_task(void *arg) {
+    while(true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        PipelineSample *s;
+        while((s = spsc_front(pipeline.samples)) != nullptr) {
+#if DEADLINE_US
+            deadline_arrive_queued(deadline_sched, s->rx_us, s->ahead, micros());
+#endif
+            process_sample(s->in);
+#if CHECKPOINT
+            checkpoint_tick();
+#endif
+            spsc_pop(pipeline.samples);
+        }
+    }
+}
+#endif
+
+// A decoded sample: processed here, or with PIPELINE queued for the
+// inference task once stats and reboot are answered. A reset is queued too,
+// so it clears the history after the samples before it, not under them.
+void ingest_sample(SensorJson& in) {
+#if PIPELINE
+    if(!in.reset && handle_command(in)) return;
+    if(pipeline_put_sample(pipeline, in, micros())) xTaskNotifyGive(inference_task_handle);
+#else
+    process_sample(in);
+#if CHECKPOINT
+    checkpoint_tick();
+#endif
+#endif
+}
+
+// One payload, whichever transport carried it (transport.h).
+void on_payload(uint8_t *payload, size_t length) {
+#if SAMPLE_FRAME
+    // Sample frames, one or a batch back to back (batch.h). Publishing may
+    // reuse the buffer the payload sits in (the MQTT client's), so the frames
+    // are copied first.
+    if(sample_frame_is(payload, length)) {
+        static uint8_t frames[OUTBOX_MQTT_BUFFER];
+        size_t n = (length < sizeof(frames)) ? length : sizeof(frames);
+        memcpy(frames, payload, n);
+        SensorJson in;
+        size_t off = 0, used;
+        while(off < n && (used = sample_frame_decode(frames + off, n - off, in)) > 0) {
+            ingest_sample(in);
+            off += used;
+        }
+        return;
+    }
+#endif
+    SensorJson in;
+    if(!decode_json(payload, length, in)) return;
+    ingest_sample(in);
+}
+
+#if TRANSPORT == TRANSPORT_MQTT
+void onMqtt(char *topic, byte *payload, unsigned int length) {
+    transport.rx_payloads++;
+    transport.rx_bytes += length;
+    on_payload(payload, length);
+}
+#endif
+
+void setup() {
+    Serial.begin(SERIAL_BAUD);
+    for(int i=0; i<NUM_RAW_INPUTS; i++) {
+        for(int j=0; j<HJORTH_WINDOW_SIZE; j++) history_buffer[i][j] = 0.0f;
+    }
+    multi_init(multi_models);
+#if MULTI_CASCADE
+    multi_cascade_setup();
+#endif
+#if DEADLINE_US
+    deadline_setup();
+#endif
+#if CHECKPOINT
+    // Warm start: the state saved before the last reboot, if it is intact.
+    checkpoint_begin(checkpoint, checkpoint_nvs_store(), "hjorth");
+    if(checkpoint_restore(checkpoint, checkpoint_regions, hjorth_checkpoint_regions(checkpoint_regions))) {
+        Serial.println("Checkpoint restored.");
+    }
+#endif
+#if DETLOG
+    // Detection log (detection_log.h): appends after the last boot's records.
+    if(detlog_begin(detlog, detlog_partition_store(DETLOG_PARTITION))) {
+        Serial.print("Detection log: next record ");
+        Serial.println(detlog.next_seq);
+    } else {
+        Serial.println("Detection log: no partition " DETLOG_PARTITION);
+    }
+#endif
+#if REPORT
+    report_begin(report, millis());
+#endif
+#if PIPELINE
+    xTaskCreatePinnedToCore(inference_task, "inference", PIPELINE_STACK, nullptr, 1,
+                            &inference_task_handle, PIPELINE_CORE);
+#endif
+#if TRANSPORT == TRANSPORT_UART
+    // The hub on the UART (transport.h), no Wi-Fi: READY right away.
+    Serial2.begin(TRANSPORT_UART_BAUD, SERIAL_8N1, TRANSPORT_UART_RX, TRANSPORT_UART_TX);
+    transport_begin(transport, transport_uart_ops(Serial2));
+    publish_status("{\"status\": \"READY\"}");
+#elif TRANSPORT == TRANSPORT_UDP
+    // Wi-Fi comes up from loop(), then the socket is bound (link.h). READY
+    // waits in the outbox for the first datagram.
+    WiFi.mode(WIFI_STA);
+    transport_begin(transport, transport_udp_ops(transport_udp));
+    link_begin(net_link, { wifiUp, wifiBegin, transport_udp_bound, transport_udp_bind, &transport_udp }, millis());
+    publish_status("{\"status\": \"READY\"}");
+#else
+    WiFi.mode(WIFI_STA);
+    client.setServer(MQTT_HOST, MQTT_PORT);
+    client.setSocketTimeout(LINK_SOCKET_TIMEOUT_S);
+    client.setCallback(onMqtt);
+    client.setBufferSize(OUTBOX_MQTT_BUFFER);
+    transport_begin(transport, { mqttReady, mqttSend, nullptr, false, nullptr });
+    // Wi-Fi and MQTT come up from loop() (link.h).
+    link_begin(net_link, { wifiUp, wifiBegin, mqttUp, mqttConnect, nullptr }, millis());
+#endif
+}
+
+void loop() {
+#if TRANSPORT != TRANSPORT_UART
+    // Never waits for the network: one step of the link at most (link.h).
+    link_poll(net_link, millis());
+#endif
+#if TRANSPORT == TRANSPORT_MQTT
+    if(link_up(net_link)) client.loop();
+#else
+    // What the hub sent since the last pass, a bounded number of reads (transport.h).
+    transport_poll(transport, on_payload);
+#endif
+#if PIPELINE
+    PipelineRow *row;
+    while((row = spsc_front(pipeline.rows)) != nullptr) {
+        if(row->status) publish_status(row->buf);
+        else publish_detection(row->buf);
+        spsc_pop(pipeline.rows);
+    }
+#endif
+    if(transport_ready(transport) && outbox_depth(outbox) > 0) flush_outbox();
+#if DETLOG
+    if(transport_ready(transport) && detlog.uploading) upload_log();
+#endif
+#if REPORT
+    if(report_due(report, millis())) publish_heartbeat();
+#endif
+#if BATCH_MAX > 1
+    if(batch_due(detection_batch, millis())) flush_detections();
+#endif
+}
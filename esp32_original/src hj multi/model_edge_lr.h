@@ -0,0 +1,8 @@
+#pragma once
+#include <stdint.h>
+
+#define LR_N_FEATURES 12
+static const float LR_SCALE_MEAN[] = { 63.925299, 137.370628, 2.726192, 56.546488, 16.679739, 15903307826.828808, 4.001573, 0.627270, 3.058572, 61.071565, 0.730437, 2.609241 };
+static const float LR_SCALE_STD[]  = { 113.389793, 3127.757767, 2.378375, 93.446694, 261.986734, 262033239413.603516, 5.510141, 0.336330, 2.213622, 79.676855, 0.386879, 1.766159 };
+static const float LR_COEF[] = { -1.683928, -0.220915, 0.041934, 0.688320, 0.283509, 0.288292, 0.013673, -0.011965, 0.204217, 0.178604, -0.181308, -0.317571 };
+static const float LR_BIAS = -0.211135;
@@ -0,0 +1,10 @@
+#pragma once
+#include <stdint.h>
+
+// Linear SVM Model
+#define SVM_N_FEATURES 12
+static const float SVM_SCALE_MEAN[] = { 63.925299, 137.370628, 2.726192, 56.546488, 16.679739, 15903307826.828808, 4.001573, 0.627270, 3.058572, 61.071565, 0.730437, 2.609241 };
+static const float SVM_SCALE_STD[]  = { 113.389793, 3127.757767, 2.378375, 93.446694, 261.986734, 262033239413.603516, 5.510141, 0.336330, 2.213622, 79.676855, 0.386879, 1.766159 };
+
+static const float SVM_COEF[] = { -2.302079, -0.085636, 0.009413, 0.514514, 0.029214, 0.028691, 0.058443, 0.065425, 0.310980, 0.087307, -0.201279, -0.408343 };
+static const float SVM_BIAS = -0.298067;
@@ -0,0 +1,127 @@
+#pragma once
+#include <vector>
+#include <cmath>
+#include "hjorth_settings.h"
+#include "checkpoint.h"
+
+float history_buffer[NUM_RAW_INPUTS][HJORTH_WINDOW_SIZE];
+int buffer_idx = 0;
+bool buffer_full = false;
+
+// Helper: Calculate Variance
+float calc_variance(const std::vector<float>& data) {
+    if (data.size() < 2) return 0.0f;
+    float mean = 0.0f;
+    for (float v : data) mean += v;
+    mean /= data.size();
+    float var = 0.0f;
+    for (float v : data) var += (v - mean) * (v - mean);
+    return var / (data.size() - 1);
+}
+
+// ================= FEATURE EXTRACTION (HJORTH) =================
+// Hop scheduling: consecutive windows share all but one sample, so
+// extract_hjorth_features_hop recomputes the features only every hjorth_hop
+// samples (HJORTH_HOP by default) and the caller reuses its last decision in
+// between (hop.h). Every sample still enters the window.
+int hjorth_hop = HJORTH_HOP;
+int hjorth_pending = 0;         // samples pushed since the features were last computed
+int hjorth_gap = 0;             // samples between the last two computations (hop.h's slope)
+bool hjorth_computed = false;
+
+// What a checkpoint saves (checkpoint.h): the window. The hop counters are
+// left to restart, so the first sample after a restore computes.
+int hjorth_checkpoint_regions(CheckpointRegion* out) {
+    out[0] = { history_buffer, sizeof(history_buffer) };
+    out[1] = { &buffer_idx, sizeof(buffer_idx) };
+    out[2] = { &buffer_full, sizeof(buffer_full) };
+    return 3;
+}
+
+// Empties the window as a reboot would, for the reset command.
+void reset_hjorth_state() {
+    for(int i=0; i<NUM_RAW_INPUTS; i++) {
+        for(int j=0; j<HJORTH_WINDOW_SIZE; j++) history_buffer[i][j] = 0.0f;
+    }
+    buffer_idx = 0;
+    buffer_full = false;
+    hjorth_pending = 0;
+    hjorth_gap = 0;
+    hjorth_computed = false;
+}
+
+// Appends one reading to the window without computing features (the
+// pre-filter uses it for readings it decides on its own).
+void push_hjorth_sample(const float* raw) {
+    for(int i=0; i<NUM_RAW_INPUTS; i++) {
+        history_buffer[i][buffer_idx] = raw[i];
+    }
+    buffer_idx = (buffer_idx + 1) % HJORTH_WINDOW_SIZE;
+    if (buffer_idx == 0) buffer_full = true;
+    hjorth_pending++;
+}
+
+// Window features of the samples pushed so far.
+void compute_hjorth_features(float* out) {
+    int f_idx = 0;
+    int count = buffer_full ? HJORTH_WINDOW_SIZE : buffer_idx;
+
+    for (int s = 0; s < NUM_RAW_INPUTS; s++) {
+        std::vector<float> x;
+        x.reserve(count);
+        
+        if (buffer_full) {
+            for(int i=buffer_idx; i<HJORTH_WINDOW_SIZE; i++) x.push_back(history_buffer[s][i]);
+            for(int i=0; i<buffer_idx; i++) x.push_back(history_buffer[s][i]);
+        } else {
+            for(int i=0; i<buffer_idx; i++) x.push_back(history_buffer[s][i]);
+        }
+
+        if (x.size() < 3) {
+            out[f_idx++] = 0.0f; out[f_idx++] = 0.0f; out[f_idx++] = 0.0f;
+            continue;
+        }
+
+        std::vector<float> dx;
+        for(size_t i=1; i<x.size(); i++) dx.push_back(x[i] - x[i-1]);
+
+        std::vector<float> ddx;
+        for(size_t i=1; i<dx.size(); i++) ddx.push_back(dx[i] - dx[i-1]);
+
+        float var_x = calc_variance(x);
+        float activity = var_x;
+
+        float var_dx = calc_variance(dx);
+        float mobility = 0.0f;
+        if (var_x > 1e-9f) mobility = sqrt(var_dx / var_x);
+
+        float var_ddx = calc_variance(ddx);
+        float mob_dx = 0.0f;
+        if (var_dx > 1e-9f) mob_dx = sqrt(var_ddx / var_dx);
+
+        float complexity = 0.0f;
+        if (mobility > 1e-9f) complexity = mob_dx / mobility;
+
+        out[f_idx++] = activity;
+        out[f_idx++] = mobility;
+        out[f_idx++] = complexity;
+    }
+    hjorth_gap = hjorth_pending;     // more than hjorth_hop when the pre-filter pushed some
+    hjorth_pending = 0;
+    hjorth_computed = true;
+}
+
+void extract_hjorth_features(float* raw, float* out) {
+    push_hjorth_sample(raw);
+    compute_hjorth_features(out);
+}
+
+// Pushes raw; computes the features into out only on the first sample and
+// once hjorth_hop samples have been pushed since the last computation.
+// Returns whether out was written.
+bool extract_hjorth_features_hop(float* raw, float* out) {
+    push_hjorth_sample(raw);
+    if(hjorth_computed && hjorth_pending < hjorth_hop) return false;
+    compute_hjorth_features(out);
+    return true;
+}
@@ -6,5 +6,9 @@
 #define IDX_HUMIDITY_WEATHERSTATION 3
 #define NUM_RAW_INPUTS 4
 #define HJORTH_WINDOW_SIZE 10
+// Recompute the window features every HJORTH_HOP samples (1 = every sample).
+#ifndef HJORTH_HOP
+#define HJORTH_HOP 1
+#endif
 
 #define HJORTH_N_FEATURES 12
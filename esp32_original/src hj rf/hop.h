@@ -0,0 +1,49 @@
+#pragma once
+#include <cmath>
+
+// ================= HOP SCHEDULING =================
+// With a hop of k (C22_HOP / HJORTH_HOP > 1) the model runs only on the
+// samples where extract_*_features_hop recomputed the window features. The
+// k - 1 samples in between publish the last decision again:
+//   HOP_SCORE_HOLD         label and score as last computed
+//   HOP_SCORE_EXTRAPOLATE  same label; the score continues the line through
+//                          the last two computed scores, one step per sample
+// Scores are not clamped, since the SVM score is a margin, not a probability.
+
+#define HOP_SCORE_HOLD        0
+#define HOP_SCORE_EXTRAPOLATE 1
+
+#ifndef HOP_SCORE
+#define HOP_SCORE HOP_SCORE_HOLD
+#endif
+
+#define HOP_MAX_HEADS 3    // multi builds: LR, SVM, RF
+
+struct HopState {
+    int label[HOP_MAX_HEADS];
+    float score[HOP_MAX_HEADS];
+    float slope[HOP_MAX_HEADS];     // score change per sample between the last two decisions
+    bool has_decision[HOP_MAX_HEADS];
+};
+
+HopState hop_state;
+
+// After a computed decision, once per head. hop: samples since the previous one
+// (catch22_gap / hjorth_gap: k, or more when the pre-filter decided some).
+void hop_decided(HopState& st, int head, int label, float score, int hop) {
+    bool line = st.has_decision[head] && !isnan(score) && !isnan(st.score[head]) && hop > 0;
+    st.slope[head] = line ? (score - st.score[head]) / hop : 0.0f;
+    st.label[head] = label;
+    st.score[head] = score;
+    st.has_decision[head] = true;
+}
+
+// Decision for a sample between hops; since: samples pushed since the last
+// computed one. NaN scores (label-only builds) stay NaN.
+int hop_result(const HopState& st, int head, int since, float* out_score) {
+    if(out_score) {
+        *out_score = st.score[head];
+        if(HOP_SCORE == HOP_SCORE_EXTRAPOLATE) *out_score += st.slope[head] * since;
+    }
+    return st.label[head];
+}
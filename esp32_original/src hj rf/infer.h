@@ -1,6 +1,7 @@
 #pragma once
 #include <cmath>
 #include "model_edge.h"
+#include "rf_early_exit.h"
 #include "hjorth_settings.h"
 
 void scale_features(const float* input, float* output) {
@@ -36,4 +37,40 @@ int predict_rf(const float* raw_features, float* out_score) {
     float avg_prob = sum_prob / (float)RF_NUM_TREES;
     if(out_score) *out_score = avg_prob;
     return (avg_prob >= 0.5f) ? 1 : 0;
+}
+
+// ================= EARLY EXIT =================
+// Label-only prediction (see rf_early_exit.h). Defaults keep the reference
+// behaviour; override with build flags, e.g. -DRF_EXIT_POLICY=RF_EXIT_EXACT.
+#ifndef RF_EXIT_POLICY
+#define RF_EXIT_POLICY RF_EXIT_OFF
+#endif
+#ifndef RF_EXIT_CONF_MARGIN
+#define RF_EXIT_CONF_MARGIN 0.3f
+#endif
+#ifndef RF_EXIT_MIN_TREES
+#define RF_EXIT_MIN_TREES 3
+#endif
+#ifndef RF_EXIT_ORDERED
+#define RF_EXIT_ORDERED 1
+#endif
+
+RfExitConfig rf_exit_config = { RF_EXIT_POLICY, RF_EXIT_CONF_MARGIN, RF_EXIT_MIN_TREES, RF_EXIT_ORDERED };
+
+int predict_rf_early(const float* raw_features, float* out_score, int* out_trees) {
+    static float rem[4][RF_NUM_TREES + 1];
+    static RfExitTables tables[2] = { { nullptr, rem[0], rem[1] }, { RF_TREE_ORDER, rem[2], rem[3] } };
+    static bool ready[2] = { false, false };
+    int which = rf_exit_config.ordered ? 1 : 0;
+    if(!ready[which]) {
+        rf_exit_build_tables(RF_NUM_TREES, sizeof(RF_LEFT) / sizeof(RF_LEFT[0]), RF_TREE_ROOTS, RF_LEFT, RF_VALUE, tables[which]);
+        ready[which] = true;
+    }
+
+    float features[RF_N_FEATURES];
+    scale_features(raw_features, features);
+
+    return rf_vote_early_exit(features, RF_NUM_TREES, RF_TREE_ROOTS, RF_FEATURE, RF_THRESHOLD,
+                              RF_LEFT, RF_RIGHT, RF_VALUE, tables[which], rf_exit_config,
+                              out_score, out_trees);
 }
\ No newline at end of file
@@ -13,3 +13,4 @@ static const int RF_RIGHT[] = { 2, -1, 18, 11, 8, 7, -1, -1, 10, -1, -1, 13, -1,
 static const int RF_FEATURE[] = { 9, -2, 4, 8, 6, 0, -2, -2, 0, -2, -2, 3, -2, 6, 2, -2, -2, -2, 3, 8, 11, 10, 0, -2, 1, -2, -2, 1, 1, -2, -2, -2, -2, 2, 8, 6, -2, 4, -2, -2, -2, 6, -2, 7, -2, -2, 1, 6, 9, 1, -2, -2, 0, 4, -2, -2, 11, -2, -2, 7, 6, -2, 0, -2, -2, 0, 3, -2, -2, 0, -2, -2, 6, 0, 3, 3, -2, -2, -2, 3, 7, -2, -2, -2, 11, 9, -2, 1, -2, -2, 9, -2, -2, 4, 8, 10, 9, -2, 3, -2, -2, 4, 11, -2, -2, -2, 3, -2, 7, -2, 1, -2, -2, 6, 1, 3, 0, -2, 8, -2, -2, 2, 2, -2, 1, -2, 1, -2, -2, 0, -2, 4, 7, -2, -2, -2, 0, 3, 6, 0, -2, -2, -2, 6, 1, 4, -2, -2, 9, -2, -2, 4, 2, -2, -2, -2, -2, 8, 11, -2, 1, -2, 2, -2, 2, -2, -2, 6, -2, -2, 4, 1, 6, 4, -2, 4, -2, -2, 8, 3, -2, 10, -2, 8, -2, -2, -2, 3, 0, -2, -2, 6, 0, -2, 1, -2, 4, -2, 8, -2, -2, -2, 7, 6, 6, 0, 8, 4, 7, -2, -2, -2, 4, 4, -2, -2, -2, -2, 3, -2, 2, -2, -2, 9, 2, -2, -2, 8, -2, 4, -2, -2, 3, 3, -2, 1, 2, -2, 2, 7, -2, -2, 6, -2, -2, 9, 0, -2, -2, -2, 7, 0, 8, 3, -2, -2, 4, 4, -2, -2, -2, 3, 7, 4, -2, -2, -2, -2, 1, 6, 0, 8, -2, -2, -2, 0, -2, -2, -2, 4, 2, -2, 6, 0, -2, 1, -2, -2, 3, -2, -2, 3, 7, 10, -2, 0, -2, 9, 10, -2, -2, -2, 0, -2, 3, -2, 4, 9, -2, 8, -2, -2, 3, -2, -2, 1, 7, -2, 9, -2, 8, 4, -2, -2, 4, 6, -2, -2, 0, -2, -2, 4, 4, 11, 1, 1, -2, -2, -2, -2, 8, 6, 1, -2, -2, -2, 4, 3, -2, -2, 4, -2, -2, 7, 1, -2, -2, 0, 4, -2, -2, 11, 6, -2, -2, -2, 1, -2, 6, 10, 4, 0, 10, 11, -2, -2, -2, -2, 3, 0, 3, 4, -2, -2, 9, -2, -2, 6, 9, -2, -2, 11, -2, -2, 6, 4, 7, -2, -2, 10, -2, -2, 7, 10, -2, -2, 4, -2, -2, 0, 4, -2, 1, -2, -2, -2, 8, -2, -2, 0, 7, 11, 6, -2, 1, 3, 0, -2, 6, -2, -2, -2, 11, -2, -2, 6, -2, -2, 10, 11, -2, 3, 7, 0, -2, -2, -2, -2, 7, -2, 7, -2, -2, 4, 9, 3, -2, -2, 3, -2, 7, -2, 1, 6, -2, -2, -2, 2, 3, 3, -2, 9, 7, 4, -2, -2, 0, -2, -2, -2, 9, 3, 8, 6, -2, -2, 1, -2, -2, 7, -2, 1, -2, -2, 11, 3, -2, -2, -2, -2, 4, 6, 3, 11, -2, 5, -2, -2, -2, 6, 4, 9, -2, 3, 10, 7, -2, -2, 0, -2, -2, 0, 9, -2, -2, 2, -2, -2, 9, 0, -2, 3, -2, -2, -2, 0, 1, 10, 1, 2, -2, -2, -2, -2, 6, 11, 3, -2, -2, -2, 8, 2, -2, -2, 10, -2, -2, -2, 11, 2, -2, 6, 11, 2, -2, 3, -2, 4, -2, -2, -2, 2, 4, -2, -2, 6, -2, -2, 0, -2, 1, 9, 11, -2, -2, 1, 8, -2, -2, -2, -2, 0, 11, 2, -2, 3, 4, 6, -2, 6, 10, -2, -2, -2, 2, 3, -2, 3, -2, -2, -2, 0, -2, 7, -2, 6, -2, -2, -2, 0, 9, 10, -2, 4, -2, 2, 3, -2, 0, -2, -2, -2, 4, 3, -2, -2, 11, 6, -2, -2, 0, 8, 6, -2, -2, 3, -2, -2, 2, 1, -2, -2, 6, -2, -2, -2, 8, 0, 7, -2, 1, -2, -2, -2, 0, 1, 3, 9, 7, -2, 7, -2, -2, 0, -2, 8, -2, -2, 10, 2, -2, -2, -2, 3, -2, 11, -2, -2, 6, 0, 3, 3, -2, -2, 3, -2, 3, -2, 10, -2, -2, 9, -2, 1, 3, -2, 11, -2, -2, 9, -2, -2, 7, 2, 9, -2, -2, 3, 9, 4, -2, -2, 7, -2, -2, 1, 0, -2, -2, -2, 7, 1, -2, 4, -2, 4, -2, -2, 10, 3, -2, -2, 4, -2, -2, 4, 6, 9, -2, 0, -2, -2, 0, 3, -2, 11, 6, 3, -2, -2, -2, -2, -2, 3, 10, 0, -2, 10, 0, -2, -2, 10, 3, -2, -2, 0, -2, -2, 2, -2, 3, -2, -2, 9, 6, 7, -2, -2, 2, 1, -2, -2, 6, -2, 9, -2, -2, 0, 0, 4, -2, 11, -2, -2, 11, 11, 6, -2, -2, 8, -2, -2, 9, 6, -2, -2, 4, -2, -2, 11, 8, 0, -2, -2, 3, 6, -2, -2, -2, 0, 9, -2, -2, -2 };
 static const float RF_THRESHOLD[] = { -0.724376, -2.000000, -0.062276, 0.160162, -0.218906, 0.765440, -2.000000, -2.000000, 0.332930, -2.000000, -2.000000, -0.005654, -2.000000, 0.146796, 0.096167, -2.000000, -2.000000, -2.000000, -0.573493, 0.232209, 1.276950, 1.910954, -0.557879, -2.000000, -0.043833, -2.000000, -2.000000, -0.043745, -0.043817, -2.000000, -2.000000, -2.000000, -2.000000, -0.221885, 0.608728, -0.448597, -2.000000, -0.058373, -2.000000, -2.000000, -2.000000, 0.346298, -2.000000, -1.045990, -2.000000, -2.000000, -0.043741, -0.432102, -0.604866, -0.043754, -2.000000, -2.000000, -0.291186, -0.060799, -2.000000, -2.000000, 0.559916, -2.000000, -2.000000, -1.229392, 2.836805, -2.000000, 0.549542, -2.000000, -2.000000, -0.411602, 0.449127, -2.000000, -2.000000, 0.804066, -2.000000, -2.000000, 0.837417, -0.006478, 1.252614, 0.234149, -2.000000, -2.000000, -2.000000, 1.913257, 1.343822, -2.000000, -2.000000, -2.000000, 3.597719, 0.687229, -2.000000, -0.043634, -2.000000, -2.000000, 1.559084, -2.000000, -2.000000, -0.062276, 0.218196, 1.893167, 0.117427, -2.000000, -0.350809, -2.000000, -2.000000, -0.062404, -0.822051, -2.000000, -2.000000, -2.000000, 0.051402, -2.000000, -0.897350, -2.000000, -0.043800, -2.000000, -2.000000, 1.204533, -0.043729, -0.550006, -0.555156, -2.000000, 1.031373, -2.000000, -2.000000, 0.400060, -0.681746, -2.000000, -0.043815, -2.000000, -0.043775, -2.000000, -2.000000, -0.438398, -2.000000, -0.061567, -0.337612, -2.000000, -2.000000, -2.000000, 0.342411, -0.588427, -0.250371, -0.558712, -2.000000, -2.000000, -2.000000, 0.393802, -0.043558, -0.058218, -2.000000, -2.000000, -0.504460, -2.000000, -2.000000, -0.057864, -0.668880, -2.000000, -2.000000, -2.000000, -2.000000, 1.783640, 0.295784, -2.000000, -0.043809, -2.000000, -0.517634, -2.000000, -0.443378, -2.000000, -2.000000, 2.636681, -2.000000, -2.000000, -0.061913, -0.043796, 0.078324, -0.062103, -2.000000, -0.062066, -2.000000, -2.000000, 1.112021, -0.038375, -2.000000, 0.049972, -2.000000, 0.190532, -2.000000, -2.000000, -2.000000, -0.476612, -0.442603, -2.000000, -2.000000, 3.071166, -0.562595, -2.000000, -0.043793, -2.000000, -0.062003, -2.000000, 0.412160, -2.000000, -2.000000, -2.000000, -0.588216, 0.752149, 0.027282, -0.064131, 0.441454, -0.057846, -0.704661, -2.000000, -2.000000, -2.000000, -0.060701, -0.061432, -2.000000, -2.000000, -2.000000, -2.000000, -0.568088, -2.000000, -0.687891, -2.000000, -2.000000, -0.045105, -0.162054, -2.000000, -2.000000, 2.699637, -2.000000, -0.061305, -2.000000, -2.000000, -0.559889, -0.604550, -2.000000, -0.043597, -0.860021, -2.000000, 1.150318, -0.534818, -2.000000, -2.000000, -0.492873, -2.000000, -2.000000, -0.180443, -0.515161, -2.000000, -2.000000, -2.000000, 0.789557, -0.090272, -0.567582, -0.191026, -2.000000, -2.000000, -0.061292, -0.061561, -2.000000, -2.000000, -2.000000, 3.251665, 0.728480, -0.061343, -2.000000, -2.000000, -2.000000, -2.000000, -0.043653, -0.252830, 0.707219, -0.753414, -2.000000, -2.000000, -2.000000, -0.254105, -2.000000, -2.000000, -2.000000, -0.062276, -0.370378, -2.000000, 0.668116, 0.119080, -2.000000, -0.043821, -2.000000, -2.000000, -0.005654, -2.000000, -2.000000, -0.560975, -0.647990, -1.328115, -2.000000, -0.547115, -2.000000, -0.406355, 0.677016, -2.000000, -2.000000, -2.000000, -0.558032, -2.000000, -0.604768, -2.000000, -0.057002, -0.431736, -2.000000, 0.272329, -2.000000, -2.000000, -0.602759, -2.000000, -2.000000, -0.043791, -1.239808, -2.000000, -0.631780, -2.000000, -0.715629, -0.061533, -2.000000, -2.000000, -0.060165, -0.357405, -2.000000, -2.000000, 0.009260, -2.000000, -2.000000, -0.059670, -0.061959, 1.064683, -0.043670, -0.043736, -2.000000, -2.000000, -2.000000, -2.000000, -0.233634, -0.102192, -0.043729, -2.000000, -2.000000, -2.000000, -0.060625, -0.542162, -2.000000, -2.000000, -0.060532, -2.000000, -2.000000, 0.002811, -0.043757, -2.000000, -2.000000, -0.065484, -0.057279, -2.000000, -2.000000, -0.813384, -0.438327, -2.000000, -2.000000, -2.000000, -0.043864, -2.000000, 3.262360, 1.571769, -0.062369, 0.074376, -0.974495, 0.994640, -2.000000, -2.000000, -2.000000, -2.000000, -0.528238, -0.555573, -0.554879, -0.059671, -2.000000, -2.000000, -0.554454, -2.000000, -2.000000, -0.140786, -0.694464, -2.000000, -2.000000, 1.897554, -2.000000, -2.000000, -0.438567, -0.060059, 0.407805, -2.000000, -2.000000, 0.549148, -2.000000, -2.000000, -0.334137, -1.106265, -2.000000, -2.000000, -0.059569, -2.000000, -2.000000, -0.472650, -0.061074, -2.000000, -0.043622, -2.000000, -2.000000, -2.000000, 1.299110, -2.000000, -2.000000, -0.552356, 0.059595, 2.735729, -0.441750, -2.000000, -0.043479, -0.601563, -0.558712, -2.000000, -0.403468, -2.000000, -2.000000, -2.000000, 0.411964, -2.000000, -2.000000, 1.980285, -2.000000, -2.000000, 0.823738, -0.581822, -2.000000, 0.240902, 0.824471, -0.556559, -2.000000, -2.000000, -2.000000, -2.000000, 2.175888, -2.000000, 3.892167, -2.000000, -2.000000, -0.062276, -0.368982, -0.320548, -2.000000, -2.000000, -0.310504, -2.000000, -1.189817, -2.000000, -0.043800, 2.600889, -2.000000, -2.000000, -2.000000, 0.481856, -0.397212, -0.584639, -2.000000, 0.135277, -0.637214, -0.060453, -2.000000, -2.000000, -0.416540, -2.000000, -2.000000, -2.000000, 0.238748, 1.313133, -0.216454, -0.561576, -2.000000, -2.000000, -0.043775, -2.000000, -2.000000, -0.309123, -2.000000, -0.043661, -2.000000, -2.000000, -0.008690, 0.646032, -2.000000, -2.000000, -2.000000, -2.000000, -0.060101, -0.633797, -0.573054, -1.017181, -2.000000, 6.299824, -2.000000, -2.000000, -2.000000, -0.446037, -0.060937, -0.722630, -2.000000, -0.463881, -0.066204, -0.361014, -2.000000, -2.000000, -0.555057, -2.000000, -2.000000, -0.542366, -0.155690, -2.000000, -2.000000, -0.386820, -2.000000, -2.000000, 0.393333, -0.520974, -2.000000, -0.567298, -2.000000, -2.000000, -2.000000, 0.896552, -0.043824, 1.320872, -0.043832, 1.311515, -2.000000, -2.000000, -2.000000, -2.000000, -0.391669, -0.258435, 1.422423, -2.000000, -2.000000, -2.000000, 2.424844, 0.449494, -2.000000, -2.000000, -1.386934, -2.000000, -2.000000, -2.000000, -0.259555, -0.760089, -2.000000, -0.450776, -0.797374, -0.604887, -2.000000, -0.603627, -2.000000, -0.057686, -2.000000, -2.000000, -2.000000, -0.182587, -0.057200, -2.000000, -2.000000, -0.276106, -2.000000, -2.000000, -0.557463, -2.000000, -0.043537, -0.205196, 0.075574, -2.000000, -2.000000, -0.043765, 0.787748, -2.000000, -2.000000, -2.000000, -2.000000, -0.544672, 2.592778, -0.685519, -2.000000, 0.234149, -0.060696, -0.523294, -2.000000, -0.392575, -0.035114, -2.000000, -2.000000, -2.000000, 2.049162, -0.602603, -2.000000, -0.599213, -2.000000, -2.000000, -2.000000, -0.558482, -2.000000, 0.236924, -2.000000, -0.601725, -2.000000, -2.000000, -2.000000, 1.401516, -0.664691, -0.302068, -2.000000, -0.062248, -2.000000, -0.428282, -0.559978, -2.000000, -0.343207, -2.000000, -2.000000, -2.000000, -0.062276, -0.175634, -2.000000, -2.000000, -0.823446, -0.542902, -2.000000, -2.000000, -0.111995, -0.435222, -0.509600, -2.000000, -2.000000, -0.578324, -2.000000, -2.000000, -0.309069, -0.043635, -2.000000, -2.000000, 0.841163, -2.000000, -2.000000, -2.000000, -0.837542, 1.369413, 2.553092, -2.000000, -0.043690, -2.000000, -2.000000, -2.000000, -0.555206, -0.043455, -0.172994, -0.701157, 0.326984, -2.000000, 0.660042, -2.000000, -2.000000, -0.556082, -2.000000, 0.066266, -2.000000, -2.000000, 0.907000, -0.658281, -2.000000, -2.000000, -2.000000, -0.211064, -2.000000, 3.553049, -2.000000, -2.000000, -0.392854, -0.506149, -0.577572, -0.604609, -2.000000, -2.000000, 0.191418, -2.000000, 0.334000, -2.000000, -0.774744, -2.000000, -2.000000, -0.731837, -2.000000, -0.043642, -0.552036, -2.000000, 0.050770, -2.000000, -2.000000, -0.534721, -2.000000, -2.000000, 0.015244, -0.706906, 0.473867, -2.000000, -2.000000, -0.069868, 0.076149, -0.061517, -2.000000, -2.000000, -1.035677, -2.000000, -2.000000, -0.043682, 1.470942, -2.000000, -2.000000, -2.000000, 0.815551, -0.043843, -2.000000, -0.059299, -2.000000, -0.054189, -2.000000, -2.000000, 0.564833, -0.413121, -2.000000, -2.000000, -0.060334, -2.000000, -2.000000, -0.062258, -0.043680, 0.117427, -2.000000, 0.932855, -2.000000, -2.000000, 1.892511, -0.277818, -2.000000, -0.348283, 0.019808, 0.882709, -2.000000, -2.000000, -2.000000, -2.000000, -2.000000, -0.573493, 2.133934, -0.556082, -2.000000, -1.015138, -0.394667, -2.000000, -2.000000, 1.848098, -0.604768, -2.000000, -2.000000, -0.523446, -2.000000, -2.000000, -0.129085, -2.000000, -0.602392, -2.000000, -2.000000, -0.631710, -0.569046, 0.004661, -2.000000, -2.000000, -0.510170, -0.043439, -2.000000, -2.000000, -0.556596, -2.000000, -0.648165, -2.000000, -2.000000, -0.012520, -0.562693, -0.061271, -2.000000, -0.246577, -2.000000, -2.000000, 1.430757, -0.481574, -0.575582, -2.000000, -2.000000, 3.145929, -2.000000, -2.000000, 0.683056, 1.662975, -2.000000, -2.000000, -0.059088, -2.000000, -2.000000, 0.811521, -0.832857, 1.659015, -2.000000, -2.000000, 3.224882, -0.510845, -2.000000, -2.000000, -2.000000, 1.965206, 2.076242, -2.000000, -2.000000, -2.000000 };
 static const float RF_VALUE[] = { 0.503817, 1.000000, 0.487179, 0.811594, 0.878049, 0.962963, 1.000000, 0.000000, 0.714286, 1.000000, 0.000000, 0.714286, 0.000000, 0.909091, 0.500000, 0.000000, 1.000000, 1.000000, 0.436073, 0.235669, 0.155039, 0.134921, 0.094017, 1.000000, 0.009346, 0.071429, 0.000000, 0.666667, 0.400000, 1.000000, 0.000000, 1.000000, 1.000000, 0.607143, 0.333333, 0.500000, 0.000000, 0.625000, 0.000000, 1.000000, 0.000000, 0.923077, 1.000000, 0.666667, 1.000000, 0.000000, 0.548043, 0.384615, 0.628571, 0.823529, 1.000000, 0.000000, 0.444444, 0.777778, 0.875000, 0.000000, 0.111111, 0.000000, 1.000000, 0.280488, 0.785714, 1.000000, 0.500000, 0.250000, 1.000000, 0.176471, 0.777778, 1.000000, 0.000000, 0.084746, 0.125000, 0.000000, 0.664634, 0.726027, 0.831933, 0.780220, 0.831169, 0.500000, 1.000000, 0.259259, 0.166667, 0.000000, 0.666667, 1.000000, 0.166667, 0.071429, 0.000000, 0.200000, 1.000000, 0.000000, 0.500000, 0.000000, 1.000000, 0.517176, 0.822222, 0.964286, 0.980769, 1.000000, 0.888889, 0.000000, 1.000000, 0.750000, 0.500000, 0.000000, 1.000000, 1.000000, 0.588235, 0.000000, 0.952381, 1.000000, 0.500000, 1.000000, 0.000000, 0.453917, 0.480818, 0.327957, 0.206897, 1.000000, 0.010753, 0.000000, 1.000000, 0.528571, 0.622642, 1.000000, 0.574468, 1.000000, 0.487179, 0.350000, 0.631579, 0.235294, 1.000000, 0.071429, 0.333333, 0.000000, 1.000000, 0.000000, 0.619512, 0.682796, 0.270270, 0.129032, 1.000000, 0.000000, 1.000000, 0.785235, 0.828125, 0.896226, 0.913462, 0.000000, 0.500000, 0.266667, 1.000000, 0.523810, 0.444444, 0.800000, 0.000000, 1.000000, 0.000000, 0.209302, 0.088235, 0.000000, 0.230769, 1.000000, 0.090909, 0.000000, 0.200000, 1.000000, 0.000000, 0.666667, 1.000000, 0.000000, 0.501908, 0.840909, 0.915663, 0.982143, 1.000000, 0.857143, 0.000000, 1.000000, 0.777778, 0.647059, 0.000000, 0.916667, 1.000000, 0.500000, 1.000000, 0.000000, 1.000000, 0.714286, 0.250000, 1.000000, 0.000000, 0.804878, 0.868421, 0.000000, 0.916667, 0.000000, 0.942857, 1.000000, 0.777778, 0.000000, 1.000000, 0.000000, 0.387755, 0.580357, 0.534091, 0.630769, 0.820000, 0.684211, 0.812500, 0.500000, 1.000000, 0.000000, 0.903226, 0.700000, 1.000000, 0.250000, 1.000000, 0.000000, 0.260870, 1.000000, 0.105263, 1.000000, 0.000000, 0.750000, 0.285714, 1.000000, 0.000000, 0.941176, 1.000000, 0.666667, 0.000000, 1.000000, 0.310714, 0.171429, 1.000000, 0.114504, 0.088710, 1.000000, 0.081301, 0.060870, 0.500000, 0.053097, 0.375000, 0.000000, 0.750000, 0.571429, 0.800000, 1.000000, 0.000000, 0.000000, 0.450000, 0.340426, 0.666667, 0.214286, 1.000000, 0.000000, 0.892857, 0.769231, 1.000000, 0.250000, 1.000000, 0.076923, 0.058824, 0.040000, 0.117647, 0.000000, 1.000000, 1.000000, 0.673913, 0.531250, 0.652174, 0.882353, 0.600000, 1.000000, 0.000000, 0.222222, 1.000000, 0.000000, 1.000000, 0.456107, 0.795181, 1.000000, 0.716667, 0.866667, 1.000000, 0.142857, 0.000000, 1.000000, 0.266667, 0.000000, 1.000000, 0.392290, 0.251366, 0.588235, 0.000000, 0.645161, 1.000000, 0.083333, 0.200000, 1.000000, 0.000000, 0.000000, 0.174497, 1.000000, 0.046512, 1.000000, 0.039062, 0.032258, 0.000000, 0.071429, 0.042553, 0.222222, 0.250000, 1.000000, 0.000000, 0.492248, 0.237288, 1.000000, 0.166667, 1.000000, 0.081633, 0.500000, 0.000000, 1.000000, 0.063830, 0.045455, 0.142857, 0.000000, 0.333333, 1.000000, 0.000000, 0.567839, 0.649351, 0.275862, 0.421053, 0.666667, 0.333333, 1.000000, 0.000000, 0.000000, 0.736000, 0.553846, 0.642857, 0.210526, 0.864865, 0.000000, 0.933333, 0.975610, 0.000000, 1.000000, 0.842105, 0.000000, 0.888889, 0.288889, 0.074074, 1.000000, 0.000000, 0.611111, 0.888889, 1.000000, 0.000000, 0.333333, 0.142857, 0.000000, 1.000000, 1.000000, 0.448473, 1.000000, 0.426587, 0.418182, 0.399103, 0.842105, 0.941176, 0.500000, 0.000000, 1.000000, 1.000000, 0.000000, 0.357843, 0.225962, 0.868421, 0.911765, 0.727273, 1.000000, 0.500000, 0.000000, 1.000000, 0.082353, 0.045455, 0.200000, 0.025641, 0.210526, 0.296296, 0.000000, 0.495000, 0.727273, 0.805970, 0.631579, 0.875000, 0.200000, 0.000000, 0.666667, 0.349593, 0.461538, 0.296296, 0.578947, 0.224138, 0.166667, 1.000000, 0.591837, 0.828571, 1.000000, 0.500000, 0.000000, 1.000000, 0.000000, 0.888889, 0.000000, 1.000000, 0.461832, 0.793893, 0.871795, 0.893333, 1.000000, 0.777778, 0.866667, 0.555556, 1.000000, 0.200000, 1.000000, 0.000000, 1.000000, 0.333333, 0.000000, 1.000000, 0.333333, 1.000000, 0.000000, 0.679245, 0.448276, 0.000000, 0.650000, 0.764706, 0.666667, 1.000000, 0.000000, 1.000000, 0.000000, 0.958333, 1.000000, 0.500000, 0.000000, 1.000000, 0.351145, 0.690141, 0.916667, 0.000000, 1.000000, 0.574468, 0.000000, 0.870968, 1.000000, 0.714286, 0.909091, 1.000000, 0.000000, 0.000000, 0.276398, 0.315603, 0.131148, 0.000000, 0.212389, 0.342857, 0.857143, 0.333333, 1.000000, 0.214286, 0.900000, 0.065217, 0.000000, 0.656566, 0.547945, 0.636364, 0.838710, 1.000000, 0.750000, 0.375000, 0.857143, 0.176471, 0.277778, 1.000000, 0.133333, 0.000000, 0.666667, 0.961538, 0.750000, 1.000000, 0.000000, 1.000000, 0.000000, 0.496183, 0.584699, 0.870370, 0.500000, 1.000000, 0.222222, 0.000000, 1.000000, 1.000000, 0.535256, 0.630252, 0.549451, 0.000000, 0.574713, 0.348837, 0.100000, 0.500000, 0.000000, 0.565217, 1.000000, 0.000000, 0.795455, 0.416667, 0.125000, 1.000000, 0.937500, 0.818182, 1.000000, 0.892857, 0.961538, 1.000000, 0.909091, 0.000000, 1.000000, 0.000000, 0.476684, 0.585987, 0.909091, 0.937500, 0.888889, 0.777778, 1.000000, 1.000000, 0.000000, 0.500000, 0.214286, 0.428571, 0.600000, 0.000000, 0.000000, 0.536364, 0.489796, 0.551724, 0.000000, 0.916667, 0.500000, 1.000000, 0.000000, 0.291139, 0.155556, 1.000000, 0.126437, 0.093750, 0.206897, 1.000000, 0.115385, 1.000000, 0.080000, 0.047619, 0.250000, 0.000000, 0.217391, 0.066667, 0.000000, 1.000000, 0.500000, 1.000000, 0.000000, 0.470588, 1.000000, 0.217391, 0.162791, 0.750000, 1.000000, 0.000000, 0.028571, 0.125000, 0.000000, 1.000000, 0.000000, 1.000000, 0.513359, 0.792899, 0.812121, 1.000000, 0.759690, 0.814159, 0.918033, 1.000000, 0.827586, 0.615385, 0.000000, 0.800000, 1.000000, 0.692308, 0.720000, 1.000000, 0.562500, 0.090909, 0.809524, 0.000000, 0.375000, 0.000000, 0.750000, 1.000000, 0.333333, 1.000000, 0.000000, 0.000000, 0.380282, 0.439739, 0.140351, 1.000000, 0.057692, 1.000000, 0.039216, 0.125000, 0.000000, 0.666667, 0.000000, 1.000000, 0.000000, 0.508000, 0.960784, 0.000000, 1.000000, 0.391960, 0.800000, 1.000000, 0.000000, 0.370370, 0.471154, 0.722222, 0.470588, 0.947368, 0.338235, 0.000000, 0.534884, 0.247059, 0.041667, 0.000000, 0.500000, 0.327869, 0.220000, 0.818182, 0.000000, 0.496183, 0.909091, 0.967742, 1.000000, 0.833333, 1.000000, 0.000000, 0.000000, 0.468432, 0.816514, 0.904255, 0.950617, 0.833333, 1.000000, 0.600000, 0.000000, 1.000000, 0.971014, 1.000000, 0.600000, 0.000000, 1.000000, 0.615385, 0.166667, 1.000000, 0.000000, 1.000000, 0.266667, 1.000000, 0.083333, 0.000000, 1.000000, 0.369110, 0.266667, 0.456140, 0.071429, 1.000000, 0.000000, 0.827586, 1.000000, 0.583333, 0.000000, 0.700000, 0.000000, 0.875000, 0.178862, 1.000000, 0.151261, 0.102804, 0.000000, 0.343750, 0.275862, 1.000000, 0.583333, 0.000000, 1.000000, 0.460396, 0.532895, 0.100000, 0.000000, 1.000000, 0.563380, 0.361111, 0.588235, 0.000000, 0.769231, 0.157895, 0.428571, 0.000000, 0.771429, 0.686275, 0.729167, 0.000000, 1.000000, 0.240000, 0.121212, 1.000000, 0.033333, 0.000000, 0.333333, 1.000000, 0.000000, 0.470588, 0.666667, 0.000000, 1.000000, 0.250000, 1.000000, 0.000000, 0.528626, 0.878505, 0.982759, 1.000000, 0.888889, 1.000000, 0.000000, 0.755102, 0.822222, 0.000000, 0.948718, 0.800000, 0.333333, 1.000000, 0.000000, 1.000000, 1.000000, 0.000000, 0.438849, 0.224242, 0.184211, 1.000000, 0.031250, 0.666667, 1.000000, 0.000000, 0.016000, 0.008850, 1.000000, 0.000000, 0.083333, 1.000000, 0.000000, 0.692308, 1.000000, 0.333333, 1.000000, 0.000000, 0.579365, 0.750000, 0.956522, 0.000000, 1.000000, 0.606061, 0.857143, 1.000000, 0.000000, 0.166667, 1.000000, 0.090909, 0.000000, 1.000000, 0.530612, 0.765766, 0.142857, 0.000000, 0.500000, 0.000000, 1.000000, 0.807692, 0.847059, 0.681818, 1.000000, 0.533333, 0.904762, 0.947368, 0.500000, 0.631579, 0.333333, 0.600000, 0.000000, 0.900000, 1.000000, 0.000000, 0.223529, 0.126761, 0.800000, 1.000000, 0.000000, 0.075758, 0.046875, 0.153846, 0.019608, 1.000000, 0.714286, 0.909091, 1.000000, 0.000000, 0.000000 };
+static const int RF_TREE_ORDER[] = { 9, 0, 1, 3, 5, 7, 2, 8, 4, 6 };
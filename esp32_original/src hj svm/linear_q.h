@@ -0,0 +1,101 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+// ================= FIXED-POINT LINEAR MODELS =================
+// Integer form of decision = sum(coef_i * (x_i - mean_i) / std_i) + bias for
+// cores without an FPU (ESP32-C3), where each float add, multiply and divide
+// of predict_lr / predict_svm is a soft-float library call. Parameters come
+// from host/quantise_linear.cpp via the *_q.h model header:
+//   d_i   = fix(x_i * 2^shift_i) - mean_q_i    in int32, mean_q_i = round(mean_i * 2^shift_i)
+//   acc   = sum(w_i * d_i)                     in int64, w_i = round(coef_i / std_i * 2^(acc_frac - shift_i))
+//   label = acc >= threshold  (acc <= threshold when polarity < 0)
+// fix() reads the IEEE-754 bits directly, so the feature loop has no float
+// operation at all. shift_i leaves the value room for many standard
+// deviations beyond the training range: some catch22 features land ~20000
+// std out on the test sets, and saturating them flips labels. The threshold
+// holds the bias, and for Platt-scaled SVMs the prob >= 0.5 boundary, in
+// accumulator units. On RV32 the int64 multiply-add is a mul / mulh pair plus
+// an add with carry.
+
+template<typename W>
+struct LinearQ {
+    int n_features;
+    const int8_t* shift;
+    const int32_t* mean_q;
+    const W* coef;
+    int acc_frac;
+    int64_t threshold;
+    int polarity;        // +1 or -1
+    int32_t score_mul;   // Q16 slope of the score sigmoid, 0 when the score is the decision
+};
+
+#define LINEAR_Q_FIX_MAX (1 << 30)
+
+// round(x * 2^shift) from the float bits, saturated to +-2^30. NaN is
+// reported through *nan so the caller can treat it as the training mean.
+inline int32_t linear_q_fix(float x, int shift, bool* nan) {
+    uint32_t u;
+    memcpy(&u, &x, sizeof(u));
+    int exp = (int)((u >> 23) & 0xFF);
+    uint32_t frac = u & 0x7FFFFF;
+    *nan = (exp == 0xFF) && frac;
+    int32_t mag;
+    int s = exp - 150 + shift;              // |x| * 2^shift = (frac | 2^23) * 2^s
+    if(exp == 0) mag = 0;                   // zero / denormal
+    else if(s >= 7) mag = LINEAR_Q_FIX_MAX; // also +-inf
+    else if(s >= 0) mag = (int32_t)((frac | 0x800000) << s);
+    else if(s > -25) mag = (int32_t)(((frac | 0x800000) + (1u << (-s - 1))) >> -s);
+    else mag = 0;
+    return (u >> 31) ? -mag : mag;
+}
+
+// sigmoid(k / 4) in Q15 for k = -32..32
+static const int16_t LINEAR_Q_SIGMOID_Q15[65] = {
+    11, 14, 18, 23, 30, 38, 49, 63, 81, 104, 133, 171, 219, 281, 360, 461,
+    589, 753, 961, 1223, 1554, 1969, 2486, 3124, 3906, 4851, 5978, 7297, 8813, 10513, 12371, 14347,
+    16384, 18421, 20397, 22255, 23955, 25471, 26790, 27917, 28862, 29644, 30282, 30799, 31214, 31545, 31807, 32015,
+    32179, 32307, 32408, 32487, 32549, 32597, 32635, 32664, 32687, 32705, 32719, 32730, 32738, 32745, 32750, 32754,
+    32757 };
+
+// x in Q8 (x / 256 is the sigmoid argument), result in Q15.
+inline int32_t linear_q_sigmoid_q15(int32_t x_q8) {
+    if(x_q8 <= -32 * 64) return LINEAR_Q_SIGMOID_Q15[0];
+    if(x_q8 >= 32 * 64) return LINEAR_Q_SIGMOID_Q15[64];
+    int32_t u = x_q8 + 32 * 64;          // 0 .. 4095, 64 per table step
+    int32_t k = u >> 6, f = u & 63;
+    return LINEAR_Q_SIGMOID_Q15[k] + (((LINEAR_Q_SIGMOID_Q15[k + 1] - LINEAR_Q_SIGMOID_Q15[k]) * f) >> 6);
+}
+
+// Score for the Score column from the accumulator relative to the threshold:
+// the probability (Q15 table) for LR / Platt SVM, the decision value when
+// score_mul is 0. This is the only float conversion per call.
+template<typename W>
+float linear_q_score(const LinearQ<W>& m, int64_t rel) {
+    if(m.score_mul == 0) return ldexpf((float)rel, -m.acc_frac);
+    // decision in Q8, clamped well past the end of the table, then the slope
+    int64_t d = (m.acc_frac >= 8) ? (rel >> (m.acc_frac - 8)) : (rel << (8 - m.acc_frac));
+    if(d > 1 << 24) d = 1 << 24;
+    if(d < -(1 << 24)) d = -(1 << 24);
+    int64_t x = (d * m.score_mul) >> 16;
+    if(x > 1 << 20) x = 1 << 20;
+    if(x < -(1 << 20)) x = -(1 << 20);
+    return linear_q_sigmoid_q15((int32_t)x) * (1.0f / 32768.0f);
+}
+
+// Same contract as predict_lr / predict_svm: returns the label, writes the
+// score when out_score is set.
+template<typename W>
+int predict_linear_q(const float* features, const LinearQ<W>& m, float* out_score) {
+    int64_t acc = 0;
+    for(int i=0; i<m.n_features; i++) {
+        bool nan;
+        int32_t d = linear_q_fix(features[i], m.shift[i], &nan) - m.mean_q[i];
+        if(nan) d = 0;   // NaN feature: treated as the training mean
+        acc += (int64_t)m.coef[i] * d;
+    }
+    int64_t rel = acc - m.threshold;
+    if(out_score) *out_score = linear_q_score(m, rel);
+    return (m.polarity > 0) ? (rel >= 0) : (rel <= 0);
+}
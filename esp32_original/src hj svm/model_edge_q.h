@@ -0,0 +1,15 @@
+#pragma once
+#include <stdint.h>
+// Generated by host/quantise_linear.cpp; parameters for linear_q.h.
+
+// ===== SVM: inputs have room for 2^20 std =====
+static const int8_t SVM_Q_SHIFT[] = { 2, -3, 7, 2, 0, -29, 6, 10, 7, 2, 10, 8 };
+static const int32_t SVM_Q_MEAN[] = { 256, 17, 349, 226, 17, 30, 256, 642, 391, 244, 748, 668 };
+#define SVM_Q_POLARITY 1
+#define SVM_Q_SCORE_MUL 0
+#define SVM_Q16_ACC_FRAC 22
+static const int16_t SVM_Q16_COEF[] = { -21289, -919, 130, 5773, 468, 247, 695, 797, 4603, 1149, -2131, -3788 };
+static const int64_t SVM_Q16_THRESHOLD = 1250184LL;
+#define SVM_Q8_ACC_FRAC 14
+static const int8_t SVM_Q8_COEF[] = { -83, -4, 1, 23, 2, 1, 3, 3, 18, 4, -8, -15 };
+static const int64_t SVM_Q8_THRESHOLD = 4884LL;
@@ -2,6 +2,10 @@
 #include <cmath>
 #include <vector>
 #include "model_edge_dual.h" 
+#include "model_edge_dual_q.h"
+#include "linear_q.h"
+#include "score_mode.h"
+#include "linear_simd.h"
 
 inline float sigmoid(float x) {
     return 1.0f / (1.0f + expf(-x));
@@ -10,7 +14,8 @@ inline float sigmoid(float x) {
 int predict_lr_generic(const float* features, float* out_score,
                        const int n_features,
                        const float* scale_mean, const float* scale_std,
-                       const float* coef, const float bias) 
+                       const float* coef, const float bias,
+                       int mode = SCORE_MODE_EXACT) 
 {
     float decision = 0.0f;
     for(int i=0; i<n_features; i++) {
@@ -20,21 +25,141 @@ int predict_lr_generic(const float* features, float* out_score,
         decision += val_norm * coef[i];
     }
     decision += bias;
-    float prob = sigmoid(decision);
-    if(out_score) *out_score = prob;
-    return (prob >= 0.5f) ? 1 : 0;
+    return lr_label_score(decision, mode, out_score);
 }
 
-int predict_cold(const float* features, float* out_score) {
+int predict_cold(const float* features, float* out_score, int mode) {
     return predict_lr_generic(features, out_score, 
         LR_COLD_N_FEATURES, 
         LR_COLD_SCALE_MEAN, LR_COLD_SCALE_STD,
-        LR_COLD_COEF, LR_COLD_BIAS);
+        LR_COLD_COEF, LR_COLD_BIAS, mode);
 }
 
-int predict_warm(const float* features, float* out_score) {
+int predict_cold(const float* features, float* out_score) {
+    return predict_cold(features, out_score, SCORE_MODE_EXACT);
+}
+
+int predict_warm(const float* features, float* out_score, int mode) {
     return predict_lr_generic(features, out_score, 
         LR_WARM_N_FEATURES, 
         LR_WARM_SCALE_MEAN, LR_WARM_SCALE_STD,
-        LR_WARM_COEF, LR_WARM_BIAS);
-}
\ No newline at end of file
+        LR_WARM_COEF, LR_WARM_BIAS, mode);
+}
+
+int predict_warm(const float* features, float* out_score) {
+    return predict_warm(features, out_score, SCORE_MODE_EXACT);
+}
+
+// ================= SCORE MODE =================
+// How main.cpp fills the Score column (score_mode.h): SCORE_MODE_EXACT as
+// before, SCORE_MODE_FAST for the polynomial exp, SCORE_MODE_LABEL to leave
+// it empty and skip the exp. The Label column does not depend on it.
+#ifndef SCORE_MODE
+#define SCORE_MODE SCORE_MODE_EXACT
+#endif
+
+// ================= FIXED-POINT PATH =================
+// LINEAR_Q = 16 or 8 makes main.cpp use the int16 / int8 kernels of
+// linear_q.h (parameters in model_edge_dual_q.h); 0 keeps the float path.
+#ifndef LINEAR_Q
+#define LINEAR_Q 0
+#endif
+
+static const LinearQ<int16_t> LR_COLD_Q16 = { LR_COLD_N_FEATURES, LR_COLD_Q_SHIFT, LR_COLD_Q_MEAN, LR_COLD_Q16_COEF,
+    LR_COLD_Q16_ACC_FRAC, LR_COLD_Q16_THRESHOLD, LR_COLD_Q_POLARITY, LR_COLD_Q_SCORE_MUL };
+static const LinearQ<int8_t> LR_COLD_Q8 = { LR_COLD_N_FEATURES, LR_COLD_Q_SHIFT, LR_COLD_Q_MEAN, LR_COLD_Q8_COEF,
+    LR_COLD_Q8_ACC_FRAC, LR_COLD_Q8_THRESHOLD, LR_COLD_Q_POLARITY, LR_COLD_Q_SCORE_MUL };
+
+int predict_cold_q16(const float* features, float* out_score) {
+    return predict_linear_q(features, LR_COLD_Q16, out_score);
+}
+
+int predict_cold_q8(const float* features, float* out_score) {
+    return predict_linear_q(features, LR_COLD_Q8, out_score);
+}
+
+static const LinearQ<int16_t> LR_WARM_Q16 = { LR_WARM_N_FEATURES, LR_WARM_Q_SHIFT, LR_WARM_Q_MEAN, LR_WARM_Q16_COEF,
+    LR_WARM_Q16_ACC_FRAC, LR_WARM_Q16_THRESHOLD, LR_WARM_Q_POLARITY, LR_WARM_Q_SCORE_MUL };
+static const LinearQ<int8_t> LR_WARM_Q8 = { LR_WARM_N_FEATURES, LR_WARM_Q_SHIFT, LR_WARM_Q_MEAN, LR_WARM_Q8_COEF,
+    LR_WARM_Q8_ACC_FRAC, LR_WARM_Q8_THRESHOLD, LR_WARM_Q_POLARITY, LR_WARM_Q_SCORE_MUL };
+
+int predict_warm_q16(const float* features, float* out_score) {
+    return predict_linear_q(features, LR_WARM_Q16, out_score);
+}
+
+int predict_warm_q8(const float* features, float* out_score) {
+    return predict_linear_q(features, LR_WARM_Q8, out_score);
+}
+
+// ================= VECTORISED PATH =================
+// LINEAR_SIMD = 1 makes main.cpp score through linear_simd.h (coef / std
+// folded, widest kernel the target has). The batch form is for replay and
+// gateway use, where many rows meet the same model.
+#ifndef LINEAR_SIMD
+#define LINEAR_SIMD 0
+#endif
+
+int predict_lr_simd_generic(const LinearSimd& m, const float* features, float* out_score,
+                            int mode = SCORE_MODE_EXACT)
+{
+    return lr_label_score(linear_simd_dot(m, features), mode, out_score);
+}
+
+// labels / scores may be null.
+void predict_lr_simd_batch(const LinearSimd& m, const float* features, int n_rows, int stride,
+                           int* labels, float* scores)
+{
+    const int block = 64;
+    float decision[block];
+    for(int r=0; r<n_rows; r+=block) {
+        int n = (n_rows - r < block) ? n_rows - r : block;
+        linear_simd_batch(m, features + (size_t)r * stride, n, stride, decision);
+        for(int j=0; j<n; j++) {
+            float prob = sigmoid(decision[j]);
+            if(scores) scores[r + j] = prob;
+            if(labels) labels[r + j] = (prob >= 0.5f) ? 1 : 0;
+        }
+    }
+}
+
+// Folded on first use.
+const LinearSimd& cold_simd() {
+    static LinearSimd m;
+    static bool ready = false;
+    if(!ready) {
+        linear_simd_init(m, LR_COLD_N_FEATURES, LR_COLD_SCALE_MEAN, LR_COLD_SCALE_STD, LR_COLD_COEF, LR_COLD_BIAS);
+        ready = true;
+    }
+    return m;
+}
+
+// Folded on first use.
+const LinearSimd& warm_simd() {
+    static LinearSimd m;
+    static bool ready = false;
+    if(!ready) {
+        linear_simd_init(m, LR_WARM_N_FEATURES, LR_WARM_SCALE_MEAN, LR_WARM_SCALE_STD, LR_WARM_COEF, LR_WARM_BIAS);
+        ready = true;
+    }
+    return m;
+}
+
+int predict_cold_simd(const float* features, float* out_score, int mode) {
+    return predict_lr_simd_generic(cold_simd(), features, out_score, mode);
+}
+
+int predict_cold_simd(const float* features, float* out_score) {
+    return predict_cold_simd(features, out_score, SCORE_MODE_EXACT);
+}
+
+int predict_warm_simd(const float* features, float* out_score, int mode) {
+    return predict_lr_simd_generic(warm_simd(), features, out_score, mode);
+}
+
+int predict_warm_simd(const float* features, float* out_score) {
+    return predict_warm_simd(features, out_score, SCORE_MODE_EXACT);
+}
+
+void predict_warm_simd_batch(const float* features, int n_rows, int stride, int* labels, float* scores) {
+    predict_lr_simd_batch(warm_simd(), features, n_rows, stride, labels, scores);
+}
@@ -0,0 +1,169 @@
+#pragma once
+#include <stdint.h>
+#include <cmath>
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(CONFIG_IDF_TARGET_ESP32S3) && defined(__has_include)
+#if __has_include("dsps_dotprod.h")
+#include "dsps_dotprod.h"
+#define LINEAR_SIMD_ESP_DSP 1
+#endif
+#endif
+
+// ================= VECTORISED LINEAR SCORING =================
+// decision = sum((x_i - mean_i) * k_i) + bias with k_i = coef_i / std_i folded
+// once, so each input costs a subtract and a multiply-add instead of a
+// divide. The mean is kept apart rather than folded into the bias: several
+// warm features sit hundreds of std from zero, and sum(x_i * k_i) would
+// cancel away most of the float mantissa. Parameter arrays are 32-byte
+// aligned and zero-padded to a multiple of 8, so the vector loops need no
+// tail on the parameter side; the input is read unaligned and its last
+// n % 8 values go through a scalar tail, since main.cpp's feature buffers are
+// exactly n long.
+//
+// Kernels: scalar with four accumulators (any core), SSE2, AVX2 + FMA, and on
+// the ESP32-S3 esp-dsp's dsps_dotprod_f32 (its S3 build uses the FPU with
+// zero-overhead loops; the PIE vector unit only has integer lanes).
+// linear_simd_dot picks the widest the build has. The summation order
+// differs from predict_*_generic, so scores move in the last bits.
+
+#define LINEAR_SIMD_MAX_FEATURES 96
+
+struct LinearSimd {
+    alignas(32) float mean[LINEAR_SIMD_MAX_FEATURES];
+    alignas(32) float k[LINEAR_SIMD_MAX_FEATURES];
+    int n_features;
+    int n_padded;
+    float bias;
+};
+
+void linear_simd_init(LinearSimd& m, int n_features, const float* mean, const float* std,
+                      const float* coef, float bias)
+{
+    m.n_features = n_features;
+    m.n_padded = (n_features + 7) & ~7;
+    for(int i=0; i<LINEAR_SIMD_MAX_FEATURES; i++) {
+        if(i < n_features) {
+            float s = std[i];
+            if(s < 1e-9f) s = 1.0f;
+            m.mean[i] = mean[i];
+            m.k[i] = coef[i] / s;
+        } else {
+            m.mean[i] = 0.0f;
+            m.k[i] = 0.0f;
+        }
+    }
+    m.bias = bias;
+}
+
+float linear_simd_dot_scalar(const LinearSimd& m, const float* x) {
+    float a0 = 0.0f, a1 = 0.0f, a2 = 0.0f, a3 = 0.0f;
+    int i = 0;
+    for(; i + 4 <= m.n_features; i += 4) {
+        a0 += (x[i] - m.mean[i]) * m.k[i];
+        a1 += (x[i + 1] - m.mean[i + 1]) * m.k[i + 1];
+        a2 += (x[i + 2] - m.mean[i + 2]) * m.k[i + 2];
+        a3 += (x[i + 3] - m.mean[i + 3]) * m.k[i + 3];
+    }
+    for(; i < m.n_features; i++) a0 += (x[i] - m.mean[i]) * m.k[i];
+    return (a0 + a1) + (a2 + a3) + m.bias;
+}
+
+#if defined(__SSE2__)
+float linear_simd_dot_sse(const LinearSimd& m, const float* x) {
+    __m128 a0 = _mm_setzero_ps(), a1 = _mm_setzero_ps();
+    int i = 0;
+    for(; i + 8 <= m.n_features; i += 8) {
+        a0 = _mm_add_ps(a0, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(x + i), _mm_load_ps(m.mean + i)), _mm_load_ps(m.k + i)));
+        a1 = _mm_add_ps(a1, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(x + i + 4), _mm_load_ps(m.mean + i + 4)),
+                                       _mm_load_ps(m.k + i + 4)));
+    }
+    float lane[4];
+    _mm_storeu_ps(lane, _mm_add_ps(a0, a1));
+    float acc = (lane[0] + lane[1]) + (lane[2] + lane[3]);
+    for(; i < m.n_features; i++) acc += (x[i] - m.mean[i]) * m.k[i];
+    return acc + m.bias;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline float linear_simd_hsum256(__m256 v) {
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+    return _mm_cvtss_f32(s);
+}
+
+// Two accumulators hide the FMA latency; 94 inputs are 11 full vectors and a
+// 6-wide scalar tail.
+float linear_simd_dot_avx2(const LinearSimd& m, const float* x) {
+    __m256 a0 = _mm256_setzero_ps(), a1 = _mm256_setzero_ps();
+    int i = 0;
+    for(; i + 16 <= m.n_features; i += 16) {
+        a0 = _mm256_fmadd_ps(_mm256_sub_ps(_mm256_loadu_ps(x + i), _mm256_load_ps(m.mean + i)), _mm256_load_ps(m.k + i), a0);
+        a1 = _mm256_fmadd_ps(_mm256_sub_ps(_mm256_loadu_ps(x + i + 8), _mm256_load_ps(m.mean + i + 8)),
+                             _mm256_load_ps(m.k + i + 8), a1);
+    }
+    for(; i + 8 <= m.n_features; i += 8)
+        a0 = _mm256_fmadd_ps(_mm256_sub_ps(_mm256_loadu_ps(x + i), _mm256_load_ps(m.mean + i)), _mm256_load_ps(m.k + i), a0);
+    float acc = linear_simd_hsum256(_mm256_add_ps(a0, a1));
+    for(; i < m.n_features; i++) acc += (x[i] - m.mean[i]) * m.k[i];
+    return acc + m.bias;
+}
+#endif
+
+#if defined(LINEAR_SIMD_ESP_DSP)
+// Centre into a scratch buffer, then the esp-dsp dot product against k.
+float linear_simd_dot_dsp(const LinearSimd& m, const float* x) {
+    float z[LINEAR_SIMD_MAX_FEATURES];
+    for(int i=0; i<m.n_features; i++) z[i] = x[i] - m.mean[i];
+    float acc = 0.0f;
+    dsps_dotprod_f32(z, m.k, &acc, m.n_features);
+    return acc + m.bias;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+#define linear_simd_dot linear_simd_dot_avx2
+#elif defined(__SSE2__)
+#define linear_simd_dot linear_simd_dot_sse
+#elif defined(LINEAR_SIMD_ESP_DSP)
+#define linear_simd_dot linear_simd_dot_dsp
+#else
+#define linear_simd_dot linear_simd_dot_scalar
+#endif
+
+// Decisions for n_rows feature vectors, row r at x + r * stride. Rows are
+// taken four at a time so each parameter vector is loaded once per block
+// instead of once per row.
+void linear_simd_batch(const LinearSimd& m, const float* x, int n_rows, int stride, float* decision) {
+    int r = 0;
+#if defined(__AVX2__) && defined(__FMA__)
+    for(; r + 4 <= n_rows; r += 4) {
+        const float* x0 = x + (size_t)r * stride;
+        const float* x1 = x0 + stride; const float* x2 = x1 + stride; const float* x3 = x2 + stride;
+        __m256 a0 = _mm256_setzero_ps(), a1 = _mm256_setzero_ps(), a2 = _mm256_setzero_ps(), a3 = _mm256_setzero_ps();
+        int i = 0;
+        for(; i + 8 <= m.n_features; i += 8) {
+            __m256 mu = _mm256_load_ps(m.mean + i), k = _mm256_load_ps(m.k + i);
+            a0 = _mm256_fmadd_ps(_mm256_sub_ps(_mm256_loadu_ps(x0 + i), mu), k, a0);
+            a1 = _mm256_fmadd_ps(_mm256_sub_ps(_mm256_loadu_ps(x1 + i), mu), k, a1);
+            a2 = _mm256_fmadd_ps(_mm256_sub_ps(_mm256_loadu_ps(x2 + i), mu), k, a2);
+            a3 = _mm256_fmadd_ps(_mm256_sub_ps(_mm256_loadu_ps(x3 + i), mu), k, a3);
+        }
+        float d0 = linear_simd_hsum256(a0), d1 = linear_simd_hsum256(a1);
+        float d2 = linear_simd_hsum256(a2), d3 = linear_simd_hsum256(a3);
+        for(; i < m.n_features; i++) {
+            float mu = m.mean[i], k = m.k[i];
+            d0 += (x0[i] - mu) * k; d1 += (x1[i] - mu) * k;
+            d2 += (x2[i] - mu) * k; d3 += (x3[i] - mu) * k;
+        }
+        decision[r] = d0 + m.bias; decision[r + 1] = d1 + m.bias;
+        decision[r + 2] = d2 + m.bias; decision[r + 3] = d3 + m.bias;
+    }
+#endif
+    for(; r < n_rows; r++) decision[r] = linear_simd_dot(m, x + (size_t)r * stride);
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include <stdint.h>
+// Generated by host/quantise_linear.cpp; parameters for linear_q.h.
+
+// ===== LR_COLD: inputs have room for 2^20 std =====
+static const int8_t LR_COLD_Q_SHIFT[] = { 4, 4, 6, 4, 0, 0, -3, -1, -3, 0 };
+static const int32_t LR_COLD_Q_MEAN[] = { 635, 652, 1407, 988, 1262, 840, 327, 435, 332, 1211 };
+#define LR_COLD_Q_POLARITY 1
+#define LR_COLD_Q_SCORE_MUL 65536
+#define LR_COLD_Q16_ACC_FRAC 21
+static const int16_t LR_COLD_Q16_COEF[] = { -3937, 11109, -949, 2841, 1103, 6247, -8862, -6534, 18593, -8747 };
+static const int64_t LR_COLD_Q16_THRESHOLD = -2107449LL;
+#define LR_COLD_Q8_ACC_FRAC 13
+static const int8_t LR_COLD_Q8_COEF[] = { -15, 43, -4, 11, 4, 24, -35, -26, 73, -34 };
+static const int64_t LR_COLD_Q8_THRESHOLD = -8232LL;
+
+// ===== LR_WARM: inputs have room for 2^20 std =====
+static const int8_t LR_WARM_Q_SHIFT[] = { 4, 4, 6, 4, 6, 6, 8, 6, 4, 4, 6, 2, 4, 4, 4, 4, 7, 3, 4, 4, 6, 6, 9, 7, 6, 6, 4, 4, 7, 3, 4, 4, 4, 4, 6, 1, 4, 4, 4, 4, 6, 1, 4, 4, 6, 6, 8, 5, 6, 6, 4, 4, 6, 2, 4, 4, 7, 7, 7, 7, 9, 9, 7, 7, 8, 7, 8, 7, 10, 10, 8, 8, 4, 4, 6, 4, 4, 4, 6, 4, 4, 4, 6, 4, 4, 4, 6, 4, 0, 0, -3, 0, -3, 0 };
+static const int32_t LR_WARM_Q_MEAN[] = { 640, 642, 1410, 990, -6, -12, 3, -5, 641, 640, 216, 116, 577, 706, 649, 647, 428, 206, 586, 715, 1408, 1409, 504, 189, 1334, 1482, 993, 989, 539, 210, 916, 1073, 644, 642, 479, 196, 474, 820, 663, 658, 456, 175, 497, 844, 1408, 1402, 581, 229, 1196, 1638, 994, 997, 566, 414, 778, 1202, 0, 310, -28, 357, 7, 397, -10, 484, -7, 406, -38, 441, -8, 906, 2, 1072, 642, 645, 1409, 991, 642, 649, 1408, 992, 641, 652, 1407, 994, 641, 649, 1408, 992, 1261, 850, 330, 857, 329, 1214 };
+#define LR_WARM_Q_POLARITY 1
+#define LR_WARM_Q_SCORE_MUL 65536
+#define LR_WARM_Q16_ACC_FRAC 22
+static const int16_t LR_WARM_Q16_COEF[] = { -2042, 8647, 1314, -1925, -5936, 1675, -2097, -579, 499, -94, -7783, -9567, 3704, -212, 4770, 7385, 9392, -4039, -1270, 8048, -2391, -1894, 7240, -4204, -4872, -671, -1093, -4367, -534, -5230, 1282, -1734, 8067, 18345, -1226, -1656, 7355, 5044, 15046, 10414, -3762, 18051, 1217, 13890, 2630, 3200, -2955, -11397, -6521, 5189, -6818, -10512, -14792, 12670, 131, 5606, -10130, -6689, 1538, -4668, 13884, 548, -1313, -9297, -4958, 4550, -9729, 5378, -4266, -3651, -3205, -3110, -1104, 8402, 1511, -2450, 1998, 2019, -1639, -3720, 3363, -2177, -4266, 1689, 1444, 7351, -615, -2646, 16101, 13004, -19079, -12511, 26786, -19189 };
+static const int64_t LR_WARM_Q16_THRESHOLD = -4470969LL;
+#define LR_WARM_Q8_ACC_FRAC 14
+static const int8_t LR_WARM_Q8_COEF[] = { -8, 34, 5, -8, -23, 7, -8, -2, 2, 0, -30, -37, 14, -1, 19, 29, 37, -16, -5, 31, -9, -7, 28, -16, -19, -3, -4, -17, -2, -20, 5, -7, 32, 72, -5, -6, 29, 20, 59, 41, -15, 71, 5, 54, 10, 12, -12, -45, -25, 20, -27, -41, -58, 49, 1, 22, -40, -26, 6, -18, 54, 2, -5, -36, -19, 18, -38, 21, -17, -14, -13, -12, -4, 33, 6, -10, 8, 8, -6, -15, 13, -9, -17, 7, 6, 29, -2, -10, 63, 51, -75, -49, 105, -75 };
+static const int64_t LR_WARM_Q8_THRESHOLD = -17465LL;
@@ -0,0 +1,138 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <cmath>
+
+// ================= BINARY SAMPLE FRAME =================
+// One sample in 12 + 4 * n bytes instead of ~150 bytes of JSON. Little-endian:
+//   offset  size  field
+//   0       u8    SAMPLE_FRAME_MAGIC (0xB5; a JSON payload never starts with it)
+//   1       u8    SAMPLE_FRAME_VERSION
+//   2       u8    n, the channel count
+//   3       u8    flags, 0 (reserved)
+//   4       u32   sequence number
+//   8       u32   timestamp, seconds since 1970-01-01
+//   12      f32   channel[n], in IDX_* order
+// Channels past NUM_RAW_INPUTS are ignored and missing ones read NaN, so a
+// sender with more or fewer sensors still decodes. Frames of another version
+// are rejected. Time is formatted back from the timestamp as dd/mm/yyyy HH:MM
+// in UTC; host/publish_frames.cpp sends the dataset's wall-clock Time as if it
+// were UTC, so the output lines keep the dataset's date and time (zero-padded:
+// "8:00" comes back as "08:00").
+//
+// -DSAMPLE_FRAME=1 makes onMqtt accept frames alongside JSON: on
+// MQTT_TOPIC_BIN, or on the data topic when the first byte is the magic.
+
+#ifndef SAMPLE_FRAME
+#define SAMPLE_FRAME 0
+#endif
+
+#define SAMPLE_FRAME_MAGIC        0xB5
+#define SAMPLE_FRAME_VERSION      1
+#define SAMPLE_FRAME_HEADER       12
+#define SAMPLE_FRAME_MAX_CHANNELS 32
+#define SAMPLE_FRAME_TIME_LEN     16    // "dd/mm/yyyy HH:MM"
+
+// Sequence bookkeeping of the frames received.
+struct SampleFrameRx {
+    uint32_t frames;
+    uint32_t lost;          // sequence numbers skipped (QoS 0 drops)
+    uint32_t next_seq;
+};
+
+SampleFrameRx sample_frame_rx;
+
+size_t sample_frame_size(int n_channels) {
+    return SAMPLE_FRAME_HEADER + 4 * (size_t)n_channels;
+}
+
+static void sf_put_u32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); p[2] = (uint8_t)(v >> 16); p[3] = (uint8_t)(v >> 24);
+}
+
+static uint32_t sf_get_u32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// Writes one frame into buf (cap bytes). Returns its size, 0 when it does not fit.
+size_t sample_frame_encode(uint8_t* buf, size_t cap, uint32_t seq, uint32_t ts, const float* ch, int n_channels) {
+    size_t n = sample_frame_size(n_channels);
+    if(n_channels < 0 || n_channels > SAMPLE_FRAME_MAX_CHANNELS || n > cap) return 0;
+    buf[0] = SAMPLE_FRAME_MAGIC;
+    buf[1] = SAMPLE_FRAME_VERSION;
+    buf[2] = (uint8_t)n_channels;
+    buf[3] = 0;
+    sf_put_u32(buf + 4, seq);
+    sf_put_u32(buf + 8, ts);
+    for(int i=0; i<n_channels; i++) {
+        uint32_t u;
+        memcpy(&u, &ch[i], sizeof(u));
+        sf_put_u32(buf + SAMPLE_FRAME_HEADER + 4 * i, u);
+    }
+    return n;
+}
+
+bool sample_frame_is(const uint8_t* p, size_t n) {
+    return n > 0 && p[0] == SAMPLE_FRAME_MAGIC;
+}
+
+static void sf_put_2(char* p, uint32_t v) { p[0] = (char)('0' + v / 10 % 10); p[1] = (char)('0' + v % 10); }
+
+// ts as dd/mm/yyyy HH:MM (UTC) into buf, SAMPLE_FRAME_TIME_LEN chars, not terminated.
+void sample_frame_format_time(uint32_t ts, char* buf) {
+    // civil_from_days (H. Hinnant), days since 1970-01-01 -> y/m/d
+    uint32_t z = ts / 86400 + 719468;
+    uint32_t era = z / 146097;
+    uint32_t doe = z - era * 146097;
+    uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    uint32_t mp = (5 * doy + 2) / 153;
+    uint32_t d = doy - (153 * mp + 2) / 5 + 1;
+    uint32_t m = (mp < 10) ? mp + 3 : mp - 9;
+    uint32_t y = yoe + era * 400 + (m <= 2);
+    uint32_t sec = ts % 86400;
+    sf_put_2(buf, d);
+    buf[2] = '/';
+    sf_put_2(buf + 3, m);
+    buf[5] = '/';
+    sf_put_2(buf + 6, y / 100);
+    sf_put_2(buf + 8, y);
+    buf[10] = ' ';
+    sf_put_2(buf + 11, sec / 3600);
+    buf[13] = ':';
+    sf_put_2(buf + 14, sec / 60 % 60);
+}
+
+static char sf_time[SAMPLE_FRAME_TIME_LEN];
+
+// Reads the frame at p into in, the struct the JSON parsers fill
+// (sensor_json.h); Time points into a static buffer. Returns the frame's size,
+// where the next one of a batch starts, or 0 on a wrong magic or version or
+// fewer than n bytes left for its channels.
+size_t sample_frame_decode(const uint8_t* p, size_t n, SensorJson& in) {
+    if(n < SAMPLE_FRAME_HEADER || p[0] != SAMPLE_FRAME_MAGIC || p[1] != SAMPLE_FRAME_VERSION) return 0;
+    int n_channels = p[2];
+    size_t size = sample_frame_size(n_channels);
+    if(n < size) return 0;
+
+    uint32_t seq = sf_get_u32(p + 4);
+    SampleFrameRx& rx = sample_frame_rx;
+    if(rx.frames > 0 && (int32_t)(seq - rx.next_seq) > 0) rx.lost += seq - rx.next_seq;
+    rx.next_seq = seq + 1;
+    rx.frames++;
+
+    sample_frame_format_time(sf_get_u32(p + 8), sf_time);
+    in.time = sf_time;
+    in.time_len = SAMPLE_FRAME_TIME_LEN;
+    for(int i=0; i<NUM_RAW_INPUTS; i++) {
+        if(i < n_channels) {
+            uint32_t u = sf_get_u32(p + SAMPLE_FRAME_HEADER + 4 * i);
+            memcpy(&in.raw[i], &u, sizeof(float));
+        } else {
+            in.raw[i] = NAN;
+        }
+    }
+    in.reset = in.reboot = in.stats = in.log = in.report = false;
+    return size;
+}
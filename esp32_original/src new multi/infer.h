@@ -0,0 +1,169 @@
+#pragma once
+#include <cmath>
+#include "multi_models.h"
+#include "deadline.h"
+
+// ================= MODELS =================
+// MULTI_MODELS picks the heads built in (multi_models.h), e.g.
+// -DMULTI_MODELS="(MULTI_LR|MULTI_RF)". Headers of the others are left out.
+#ifndef MULTI_MODELS
+#define MULTI_MODELS MULTI_ALL
+#endif
+
+// ================= SCORE MODE =================
+// How the LR / SVM scores are produced (score_mode.h); the RF score and the
+// labels do not depend on it.
+#ifndef SCORE_MODE
+#define SCORE_MODE SCORE_MODE_EXACT
+#endif
+// MULTI_SCORE_MODE_LR / MULTI_SCORE_MODE_SVM set the mode of one head, e.g.
+// exact LR scores next to a label-only SVM; both default to SCORE_MODE. The
+// deadline's LR level uses MULTI_SCORE_MODE_LR.
+#ifndef MULTI_SCORE_MODE_LR
+#define MULTI_SCORE_MODE_LR SCORE_MODE
+#endif
+#ifndef MULTI_SCORE_MODE_SVM
+#define MULTI_SCORE_MODE_SVM SCORE_MODE
+#endif
+
+// ================= CASCADE =================
+// MULTI_CASCADE = 1 makes main.cpp publish one decision per message: the
+// MULTI_CASCADE_LINEAR head, and the forest only when that head's probability
+// is within MULTI_CASCADE_BAND of 0.5 (multi_models.h). Both heads must be in
+// MULTI_MODELS.
+#ifndef MULTI_CASCADE
+#define MULTI_CASCADE 0
+#endif
+#ifndef MULTI_CASCADE_LINEAR
+#define MULTI_CASCADE_LINEAR MULTI_LR
+#endif
+#ifndef MULTI_CASCADE_BAND
+#define MULTI_CASCADE_BAND 0.3f
+#endif
+// The cascade's Score column follows the mode of its linear head.
+#define MULTI_CASCADE_SCORE_MODE ((MULTI_CASCADE_LINEAR == MULTI_SVM) ? MULTI_SCORE_MODE_SVM : MULTI_SCORE_MODE_LR)
+#if MULTI_CASCADE && !((MULTI_MODELS & MULTI_CASCADE_LINEAR) && (MULTI_MODELS & MULTI_RF))
+#error "MULTI_CASCADE needs MULTI_CASCADE_LINEAR and MULTI_RF in MULTI_MODELS"
+#endif
+
+// ================= DEADLINE =================
+// DEADLINE_US > 0 gives every message that many microseconds (deadline.h) and
+// makes main.cpp publish one decision per message, at the level picked for it:
+// the warm forest, the warm forest cut to DEADLINE_TREES trees, the cold
+// forest, the cold LR, or the previous decision. DEADLINE_LEVEL_MASK leaves
+// levels out. Needs MULTI_LR and MULTI_RF.
+#ifndef DEADLINE_US
+#define DEADLINE_US 0
+#endif
+#ifndef DEADLINE_LEVEL_MASK
+#define DEADLINE_LEVEL_MASK (DEADLINE_BIT(DEADLINE_TREES) | DEADLINE_BIT(DEADLINE_COLD) | \
+                             DEADLINE_BIT(DEADLINE_LINEAR) | DEADLINE_BIT(DEADLINE_SHED))
+#endif
+#if DEADLINE_US && !((MULTI_MODELS & MULTI_LR) && (MULTI_MODELS & MULTI_RF))
+#error "DEADLINE_US needs MULTI_LR and MULTI_RF in MULTI_MODELS"
+#endif
+#if DEADLINE_US && MULTI_CASCADE
+#error "DEADLINE_US and MULTI_CASCADE each pick one decision per message; use one of them"
+#endif
+
+#if MULTI_MODELS & MULTI_LR
+#include "model_edge_dual_lr.h"
+static const MultiLinear LR_COLD_MODEL = { { LR_COLD_N_FEATURES, LR_COLD_SCALE_MEAN, LR_COLD_SCALE_STD },
+    LR_COLD_COEF, LR_COLD_BIAS, MULTI_SCORE_SIGMOID, 0.0f, 0.0f };
+static const MultiLinear LR_WARM_MODEL = { { LR_WARM_N_FEATURES, LR_WARM_SCALE_MEAN, LR_WARM_SCALE_STD },
+    LR_WARM_COEF, LR_WARM_BIAS, MULTI_SCORE_SIGMOID, 0.0f, 0.0f };
+#endif
+#if MULTI_MODELS & MULTI_SVM
+#include "model_edge_dual_svm.h"
+static const MultiLinear SVM_COLD_MODEL = { { SVM_COLD_N_FEATURES, SVM_COLD_SCALE_MEAN, SVM_COLD_SCALE_STD },
+    SVM_COLD_COEF, SVM_COLD_BIAS, MULTI_SCORE_PLATT, SVM_COLD_PROB_A, SVM_COLD_PROB_B };
+static const MultiLinear SVM_WARM_MODEL = { { SVM_WARM_N_FEATURES, SVM_WARM_SCALE_MEAN, SVM_WARM_SCALE_STD },
+    SVM_WARM_COEF, SVM_WARM_BIAS, MULTI_SCORE_PLATT, SVM_WARM_PROB_A, SVM_WARM_PROB_B };
+#endif
+#if MULTI_MODELS & MULTI_RF
+#include "model_edge_dual_rf.h"
+static const MultiForest RF_COLD_MODEL = { { RF_COLD_N_FEATURES, RF_COLD_SCALE_MEAN, RF_COLD_SCALE_STD },
+    RF_COLD_N_TREES, RF_COLD_TREE_OFFSETS, RF_COLD_FEATURE, RF_COLD_THRESHOLD,
+    RF_COLD_LEFT, RF_COLD_RIGHT, RF_COLD_PROB1, RF_COLD_TREE_ORDER };
+static const MultiForest RF_WARM_MODEL = { { RF_WARM_N_FEATURES, RF_WARM_SCALE_MEAN, RF_WARM_SCALE_STD },
+    RF_WARM_N_TREES, RF_WARM_TREE_OFFSETS, RF_WARM_FEATURE, RF_WARM_THRESHOLD,
+    RF_WARM_LEFT, RF_WARM_RIGHT, RF_WARM_PROB1, RF_WARM_TREE_ORDER };
+#endif
+
+// One set per warm-up phase; the first model built in owns the shared
+// scaling table of each.
+#if MULTI_MODELS & MULTI_LR
+#define MULTI_SET(PHASE) { LR_##PHASE##_MODEL.scale, &LR_##PHASE##_MODEL, MULTI_SVM_OF(PHASE), MULTI_RF_OF(PHASE), { false, false, false } }
+#elif MULTI_MODELS & MULTI_SVM
+#define MULTI_SET(PHASE) { SVM_##PHASE##_MODEL.scale, nullptr, MULTI_SVM_OF(PHASE), MULTI_RF_OF(PHASE), { false, false, false } }
+#else
+#define MULTI_SET(PHASE) { RF_##PHASE##_MODEL.scale, nullptr, nullptr, MULTI_RF_OF(PHASE), { false, false, false } }
+#endif
+#if MULTI_MODELS & MULTI_SVM
+#define MULTI_SVM_OF(PHASE) &SVM_##PHASE##_MODEL
+#else
+#define MULTI_SVM_OF(PHASE) nullptr
+#endif
+#if MULTI_MODELS & MULTI_RF
+#define MULTI_RF_OF(PHASE) &RF_##PHASE##_MODEL
+#else
+#define MULTI_RF_OF(PHASE) nullptr
+#endif
+
+MultiSet multi_cold = MULTI_SET(COLD);
+MultiSet multi_warm = MULTI_SET(WARM);
+
+void multi_init_all() {
+    multi_init(multi_cold);
+    multi_init(multi_warm);
+}
+
+#if MULTI_MODELS & MULTI_LR
+int predict_lr(const MultiSet& set, const float* features, const float* z, float* out_score, int mode) {
+    return multi_predict_linear(*set.lr, set.own_scale[0], features, z, out_score, mode);
+}
+#endif
+
+#if MULTI_MODELS & MULTI_SVM
+int predict_svm(const MultiSet& set, const float* features, const float* z, float* out_score, int mode) {
+    return multi_predict_linear(*set.svm, set.own_scale[1], features, z, out_score, mode);
+}
+#endif
+
+#if MULTI_MODELS & MULTI_RF
+int predict_rf(const MultiSet& set, const float* features, const float* z, float* out_score) {
+    return multi_predict_forest(*set.rf, set.own_scale[2], features, z, out_score);
+}
+#endif
+
+#if MULTI_CASCADE
+MultiCascade multi_cascade;
+
+void multi_cascade_setup() {
+    multi_cascade_init(multi_cascade, (MULTI_CASCADE_LINEAR == MULTI_SVM) ? 1 : 0, MULTI_CASCADE_BAND);
+}
+
+// out_stage: MULTI_STAGE_LINEAR or MULTI_STAGE_FOREST, whichever decided.
+int predict_cascade(const MultiSet& set, const float* features, const float* z, float* out_score, int* out_stage,
+                    int mode) {
+    return multi_predict_cascade(set, multi_cascade, features, z, out_score, out_stage, mode);
+}
+#endif
+
+#if DEADLINE_US
+DeadlineSched deadline_sched;
+
+void deadline_setup() {
+    deadline_init(deadline_sched, DEADLINE_US, DEADLINE_PERIOD_US, DEADLINE_LEVEL_MASK);
+}
+
+// Decision at DEADLINE_FULL, _TREES, _COLD or _LINEAR. main.cpp extracts the
+// cold features and passes multi_cold from DEADLINE_COLD on, so LR is the cold
+// LR, the cheapest model of the build.
+int predict_deadline(const MultiSet& set, int level, const float* features, const float* z, float* out_score,
+                     int mode) {
+    if(level == DEADLINE_LINEAR) return predict_lr(set, features, z, out_score, mode);
+    int n_trees = (level == DEADLINE_TREES) ? DEADLINE_TREES : set.rf->n_trees;
+    return multi_predict_forest_trees(*set.rf, set.own_scale[2], features, z, n_trees, out_score);
+}
+#endif
@@ -0,0 +1,15 @@
+#pragma once
+#include <stdint.h>
+
+#define LR_COLD_N_FEATURES 10
+static const float LR_COLD_SCALE_MEAN[] = { 39.668745, 40.767153, 21.980640, 61.748092, 1262.070627, 840.190692, 2614.651303, 870.748592, 2658.941995, 1211.266810 };
+static const float LR_COLD_SCALE_STD[]  = { 22.739339, 25.345283, 6.576783, 24.667976, 405.143831, 467.205716, 2170.097269, 516.318524, 2367.295088, 280.510033 };
+static const float LR_COLD_COEF[] = { -0.683071, 2.148059, -0.190552, 0.534758, 0.213040, 1.391684, -1.146281, -0.804277, 2.623462, -1.170032 };
+static const float LR_COLD_BIAS = 1.004910;
+
+// ===== MODEL: LR_WARM (Logistic Regression) =====
+#define LR_WARM_N_FEATURES 94
+static const float LR_WARM_SCALE_MEAN[] = { 40.022883, 40.143036, 22.023758, 61.868421, -0.091330, -0.189724, 0.011001, -0.070414, 40.083022, 40.023814, 3.373714, 28.876837, 36.093592, 44.114440, 40.560358, 40.453717, 3.344651, 25.769215, 36.624309, 44.685398, 22.002042, 22.017840, 0.984007, 1.478026, 20.836185, 23.159283, 62.047309, 61.785671, 4.209061, 26.223135, 57.226004, 67.079451, 40.268705, 40.132154, 7.479007, 98.122946, 29.622548, 51.255556, 41.457890, 41.095956, 7.130459, 87.257959, 31.080515, 52.723775, 22.003938, 21.899311, 2.269845, 7.146066, 18.693055, 25.588376, 62.124324, 62.335066, 8.844855, 103.427756, 48.634617, 75.109623, 0.001894, 2.419411, -0.221146, 2.788440, 0.014484, 0.775360, -0.077484, 3.784373, -0.026763, 3.173281, -0.149346, 3.446938, -0.007874, 0.884647, 0.006070, 4.188804, 40.114213, 40.332759, 22.012757, 61.964473, 40.120312, 40.547930, 22.001966, 62.016602, 40.074118, 40.766154, 21.990743, 62.138268, 40.086292, 40.552060, 22.004745, 62.022290, 1260.893883, 849.784965, 2638.400427, 857.365573, 2634.478555, 1214.431703 };
+static const float LR_WARM_SCALE_STD[]  = { 22.635028, 24.659752, 6.637408, 24.828009, 4.489480, 4.463081, 1.033380, 4.608479, 22.090047, 22.399616, 4.170438, 69.544304, 20.621312, 23.990648, 24.298566, 24.590963, 3.802511, 53.046647, 23.872676, 25.037143, 6.586006, 6.638438, 0.710269, 2.278279, 6.332907, 6.893939, 24.524666, 24.699840, 2.901788, 39.947918, 24.133516, 24.936798, 20.350955, 21.816441, 6.482616, 152.093114, 16.159203, 24.210024, 23.188624, 24.610372, 6.033286, 133.918293, 20.841868, 24.870519, 6.154309, 6.420804, 1.411129, 8.980090, 5.201973, 7.035254, 22.936267, 24.234138, 5.015976, 122.317171, 21.576238, 23.646332, 2.730369, 3.308590, 2.524238, 3.226802, 0.646899, 0.531532, 2.527936, 2.258735, 1.598626, 2.980860, 1.517310, 2.702399, 0.497887, 0.394434, 1.819929, 1.571932, 22.670228, 24.696689, 6.650956, 24.862516, 22.644311, 24.713809, 6.675819, 24.933769, 22.521890, 24.743081, 6.700328, 25.033905, 21.706362, 23.996679, 6.476382, 24.122752, 404.556801, 468.549214, 2168.882675, 498.829250, 2358.174604, 283.932326 };
+static const float LR_WARM_COEF[] = { -0.176322, 0.813374, 0.133040, -0.182292, -0.406663, 0.114049, -0.132255, -0.040684, 0.042010, -0.007999, -0.495262, -0.634517, 0.291404, -0.019391, 0.442094, 0.692810, 1.089887, -0.408674, -0.115640, 0.768687, -0.240244, -0.191818, 0.627757, -0.292322, -0.470773, -0.070630, -0.102259, -0.411503, -0.047303, -0.398527, 0.118004, -0.164976, 0.626249, 1.526694, -0.121281, -0.120078, 0.453406, 0.465873, 1.330938, 0.977694, -0.346375, 1.152677, 0.096754, 1.317834, 0.247003, 0.313485, -0.254490, -0.780830, -0.517609, 0.557075, -0.596505, -0.971806, -1.132113, 1.477984, 0.010763, 0.505638, -0.844045, -0.675340, 0.118481, -0.459645, 1.096407, 0.035574, -0.101258, -0.640878, -0.483735, 0.413872, -0.900972, 0.443530, -0.518541, -0.351607, -0.356058, -0.298366, -0.095515, 0.791547, 0.153318, -0.232374, 0.172580, 0.190368, -0.166985, -0.353857, 0.288901, -0.205512, -0.436110, 0.161284, 0.119572, 0.672954, -0.060804, -0.243502, 1.553041, 1.452677, -1.233222, -1.487910, 1.882496, -1.299018 };
+static const float LR_WARM_BIAS = 1.065962;
@@ -0,0 +1,19 @@
+#pragma once
+#include <stdint.h>
+
+#define SVM_COLD_N_FEATURES 10
+static const float SVM_COLD_SCALE_MEAN[] = { 39.668745, 40.767153, 21.980640, 61.748092, 1262.070627, 840.190692, 2614.651303, 870.748592, 2658.941995, 1211.266810 };
+static const float SVM_COLD_SCALE_STD[]  = { 22.739339, 25.345283, 6.576783, 24.667976, 405.143831, 467.205716, 2170.097269, 516.318524, 2367.295088, 280.510033 };
+static const float SVM_COLD_COEF[] = { -0.804294, 2.780687, 0.005599, 0.967812, -0.465593, 1.677860, -0.112829, -0.608074, 2.180024, -1.228094 };
+static const float SVM_COLD_BIAS = 1.180982;
+static const float SVM_COLD_PROB_A = -1.423639;
+static const float SVM_COLD_PROB_B = -0.041035;
+
+// ===== MODEL: SVM_WARM (Linear SVM) =====
+#define SVM_WARM_N_FEATURES 94
+static const float SVM_WARM_SCALE_MEAN[] = { 40.022883, 40.143036, 22.023758, 61.868421, -0.091330, -0.189724, 0.011001, -0.070414, 40.083022, 40.023814, 3.373714, 28.876837, 36.093592, 44.114440, 40.560358, 40.453717, 3.344651, 25.769215, 36.624309, 44.685398, 22.002042, 22.017840, 0.984007, 1.478026, 20.836185, 23.159283, 62.047309, 61.785671, 4.209061, 26.223135, 57.226004, 67.079451, 40.268705, 40.132154, 7.479007, 98.122946, 29.622548, 51.255556, 41.457890, 41.095956, 7.130459, 87.257959, 31.080515, 52.723775, 22.003938, 21.899311, 2.269845, 7.146066, 18.693055, 25.588376, 62.124324, 62.335066, 8.844855, 103.427756, 48.634617, 75.109623, 0.001894, 2.419411, -0.221146, 2.788440, 0.014484, 0.775360, -0.077484, 3.784373, -0.026763, 3.173281, -0.149346, 3.446938, -0.007874, 0.884647, 0.006070, 4.188804, 40.114213, 40.332759, 22.012757, 61.964473, 40.120312, 40.547930, 22.001966, 62.016602, 40.074118, 40.766154, 21.990743, 62.138268, 40.086292, 40.552060, 22.004745, 62.022290, 1260.893883, 849.784965, 2638.400427, 857.365573, 2634.478555, 1214.431703 };
+static const float SVM_WARM_SCALE_STD[]  = { 22.635028, 24.659752, 6.637408, 24.828009, 4.489480, 4.463081, 1.033380, 4.608479, 22.090047, 22.399616, 4.170438, 69.544304, 20.621312, 23.990648, 24.298566, 24.590963, 3.802511, 53.046647, 23.872676, 25.037143, 6.586006, 6.638438, 0.710269, 2.278279, 6.332907, 6.893939, 24.524666, 24.699840, 2.901788, 39.947918, 24.133516, 24.936798, 20.350955, 21.816441, 6.482616, 152.093114, 16.159203, 24.210024, 23.188624, 24.610372, 6.033286, 133.918293, 20.841868, 24.870519, 6.154309, 6.420804, 1.411129, 8.980090, 5.201973, 7.035254, 22.936267, 24.234138, 5.015976, 122.317171, 21.576238, 23.646332, 2.730369, 3.308590, 2.524238, 3.226802, 0.646899, 0.531532, 2.527936, 2.258735, 1.598626, 2.980860, 1.517310, 2.702399, 0.497887, 0.394434, 1.819929, 1.571932, 22.670228, 24.696689, 6.650956, 24.862516, 22.644311, 24.713809, 6.675819, 24.933769, 22.521890, 24.743081, 6.700328, 25.033905, 21.706362, 23.996679, 6.476382, 24.122752, 404.556801, 468.549214, 2168.882675, 498.829250, 2358.174604, 283.932326 };
+static const float SVM_WARM_COEF[] = { -0.090400, 0.810222, 0.167017, 0.212729, -0.264820, 0.048179, -0.085047, 0.086181, -0.111255, -0.072360, -0.441977, -0.051340, 0.239363, -0.137162, 0.371921, 0.532999, 0.773230, -0.600704, -0.317241, 0.892559, -0.247558, -0.279499, 0.451296, -0.232634, -0.382681, 0.039437, 0.025627, -0.259299, 0.062709, -0.239331, 0.310989, -0.219951, 0.351633, 1.544447, -0.091456, -0.046019, 0.380472, 0.174112, 1.282769, 0.290865, -1.157876, 1.519080, -0.327027, 1.179443, 0.285998, 0.388369, -0.360547, -0.503820, -0.566590, 0.848098, -0.907823, -0.695379, -1.362808, 1.503305, -0.516767, 0.701391, -0.409553, -0.584393, -0.102813, -0.146633, 0.739294, 0.070002, -0.156670, -0.556565, -0.307196, 0.479058, -0.627313, 0.108008, 0.040188, -0.381049, -0.185437, -0.226272, -0.037816, 0.800303, 0.179891, 0.112162, 0.218208, -0.215071, -0.418014, -0.317923, -0.051364, -0.565560, -0.170923, -0.031067, 0.132296, 0.601397, -0.073588, -0.023020, 0.892913, 1.065035, -0.829983, -1.414633, 1.905200, -1.186888 };
+static const float SVM_WARM_BIAS = 0.830473;
+static const float SVM_WARM_PROB_A = -1.708822;
+static const float SVM_WARM_PROB_B = 0.116053;
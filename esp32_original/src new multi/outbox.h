@@ -0,0 +1,128 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include "batch.h"
+#include "detection_row.h"
+
+// ================= OUTBOX =================
+// Detection rows (and status messages) that could not be published: while
+// the link is down (link.h), when a publish fails, and after either until the
+// rows that piled up meanwhile are out, so the broker still sees every row in
+// order. The outbox is a ring of the last OUTBOX_ROWS rows: when it is full
+// the oldest row is dropped and counted, since after a long outage the recent
+// detections are the ones worth having.
+//
+// Once the link is back, loop() publishes the rows in bulk, oldest first:
+// as many as fit in OUTBOX_FLUSH_BYTES, newline-separated as in a batch
+// (batch.h; get.py writes such a message as that many CSV lines), one message
+// per loop() pass so the client keeps being serviced. A row leaves the ring
+// only once its message is published.
+//
+// Only the loop task touches the outbox: onMqtt runs inside client.loop(),
+// and with PIPELINE the rows reach publish_detection through loop() too.
+//
+// A slot holds a row (DETECTION_ROW_MAX) or a status message, up to
+// OUTBOX_STATUS_MAX: READY, and with REPORT the heartbeat, which is longer
+// than a row (report.h checks that its longest fits).
+
+#ifndef OUTBOX_ROWS
+#define OUTBOX_ROWS 64
+#endif
+#ifndef OUTBOX_FLUSH_BYTES
+#define OUTBOX_FLUSH_BYTES 2048     // payload of one bulk message
+#endif
+#ifndef OUTBOX_STATUS_MAX
+#if REPORT
+#define OUTBOX_STATUS_MAX 256
+#else
+#define OUTBOX_STATUS_MAX DETECTION_ROW_MAX
+#endif
+#endif
+#define OUTBOX_SLOT ((DETECTION_ROW_MAX) > (OUTBOX_STATUS_MAX) ? (DETECTION_ROW_MAX) : (OUTBOX_STATUS_MAX))
+// The client buffer both bulk messages and batches fit in (topic and MQTT
+// header included).
+#define OUTBOX_MQTT_BUFFER \
+    ((BATCH_MQTT_BUFFER) > OUTBOX_FLUSH_BYTES + 64 ? (BATCH_MQTT_BUFFER) : OUTBOX_FLUSH_BYTES + 64)
+
+struct OutboxRow {
+    char buf[OUTBOX_SLOT];
+    uint16_t len;
+};
+
+struct Outbox {
+    OutboxRow row[OUTBOX_ROWS];
+    uint32_t head;              // next row to write
+    uint32_t tail;              // oldest row
+    uint32_t max_depth;
+    uint32_t queued;            // rows that went in
+    uint32_t dropped;           // of those, pushed out by newer ones
+    uint32_t flushed;           // and published from here
+    uint32_t messages;          // in that many bulk messages
+    char msg[OUTBOX_FLUSH_BYTES];
+};
+
+Outbox outbox;
+
+uint32_t outbox_depth(const Outbox& o) {
+    return o.head - o.tail;
+}
+
+// One row or status message (n chars, no newline); pushes out the oldest
+// when the ring is full.
+void outbox_put(Outbox& o, const char* row, size_t n) {
+    if(n >= OUTBOX_SLOT) n = OUTBOX_SLOT - 1;
+    if(outbox_depth(o) >= OUTBOX_ROWS) {
+        o.tail++;
+        o.dropped++;
+    }
+    OutboxRow& r = o.row[o.head % OUTBOX_ROWS];
+    memcpy(r.buf, row, n);
+    r.len = (uint16_t)n;
+    o.head++;
+    o.queued++;
+    if(outbox_depth(o) > o.max_depth) o.max_depth = outbox_depth(o);
+}
+
+// The rows of a batch, or any newline-separated text.
+void outbox_put_lines(Outbox& o, const char* buf, size_t n) {
+    size_t start = 0;
+    for(size_t i=0; i<=n; i++) {
+        if(i < n && buf[i] != '\n') continue;
+        if(i > start) outbox_put(o, buf + start, i - start);
+        start = i + 1;
+    }
+}
+
+// The oldest rows that fit in o.msg, newline-separated. Returns the length;
+// rows gets how many went in (at least one while the outbox is not empty).
+size_t outbox_pack(Outbox& o, int* rows) {
+    size_t len = 0;
+    *rows = 0;
+    for(uint32_t i=o.tail; i != o.head; i++) {
+        const OutboxRow& r = o.row[i % OUTBOX_ROWS];
+        size_t need = r.len + (*rows > 0 ? 1 : 0);
+        if(len + need > sizeof(o.msg)) break;
+        if(*rows > 0) o.msg[len++] = '\n';
+        memcpy(o.msg + len, r.buf, r.len);
+        len += r.len;
+        (*rows)++;
+    }
+    return len;
+}
+
+// The rows outbox_pack put in a message that was published.
+void outbox_pop(Outbox& o, int rows) {
+    o.tail += (uint32_t)rows;
+    o.flushed += (uint32_t)rows;
+    o.messages++;
+}
+
+int outbox_stats_json(const Outbox& o, char* buf, size_t n) {
+    return snprintf(buf, n,
+                    "\"outbox\": %lu, \"outbox_max\": %lu, \"outbox_queued\": %lu, \"outbox_dropped\": %lu, "
+                    "\"outbox_flushed\": %lu",
+                    (unsigned long)outbox_depth(o), (unsigned long)o.max_depth, (unsigned long)o.queued,
+                    (unsigned long)o.dropped, (unsigned long)o.flushed);
+}
@@ -0,0 +1,171 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+#include <cmath>
+#include <atomic>
+
+// ================= RULE PRE-FILTER =================
+// Cheap checks on the raw reading, run in onMqtt before any feature work:
+//   identical  every channel bit-equal to the previous reading
+//   range      a channel outside its physical range (or NaN)
+//   stuck      a channel unchanged for PREFILTER_STUCK_RUN readings in a row
+// Each rule has an action: PREFILTER_PASS runs extraction and inference as
+// usual, PREFILTER_REUSE publishes the previous decision again,
+// PREFILTER_DECIDE publishes PREFILTER_RULE_LABEL. State is the previous
+// reading and one run length per channel, so a check is O(1).
+//
+// A reused or rule-decided reading still enters the extractor history (main.cpp
+// pushes it), so later windows are the same as without the filter. Range
+// rejects are the exception: an impossible value would sit in the windows for
+// their whole length, so it is left out.
+//
+// The counters (readings seen, skipped, hits per rule) are published as JSON on
+// {"stats": true} in the data topic. With PIPELINE that is answered on the
+// loop task while the inference task counts on the other core, so they are
+// relaxed atomics, like pipeline.h's counters; the rest of the state is the
+// inference task's alone.
+
+#define PREFILTER_PASS   0
+#define PREFILTER_REUSE  1
+#define PREFILTER_DECIDE 2
+
+#define PREFILTER_RULE_NONE      0
+#define PREFILTER_RULE_IDENTICAL 1
+#define PREFILTER_RULE_RANGE     2
+#define PREFILTER_RULE_STUCK     3
+
+// -DPREFILTER=1 turns the stage on; off keeps the reference behaviour.
+#ifndef PREFILTER
+#define PREFILTER 0
+#endif
+#ifndef PREFILTER_ON_IDENTICAL
+#define PREFILTER_ON_IDENTICAL PREFILTER_REUSE
+#endif
+#ifndef PREFILTER_ON_RANGE
+#define PREFILTER_ON_RANGE PREFILTER_DECIDE
+#endif
+// Stuck runs carry no label signal on the test sets (weather-station channels
+// repeat for hours), so by default they are only counted.
+#ifndef PREFILTER_ON_STUCK
+#define PREFILTER_ON_STUCK PREFILTER_PASS
+#endif
+#ifndef PREFILTER_STUCK_RUN
+#define PREFILTER_STUCK_RUN 8
+#endif
+// Label published by PREFILTER_DECIDE (0 = fault, 1 = normal).
+#ifndef PREFILTER_RULE_LABEL
+#define PREFILTER_RULE_LABEL 0
+#endif
+
+#define PREFILTER_CHANNELS 4
+#define PREFILTER_MAX_HEADS 3    // multi builds: LR, SVM, RF
+
+struct PrefilterConfig {
+    int on_identical, on_range, on_stuck;   // PREFILTER_PASS / _REUSE / _DECIDE
+    int stuck_run;
+    float lo[PREFILTER_CHANNELS], hi[PREFILTER_CHANNELS];
+};
+
+struct PrefilterState {
+    float prev[PREFILTER_CHANNELS];
+    int run[PREFILTER_CHANNELS];
+    bool has_prev;
+    bool has_decision;      // set by prefilter_decided; REUSE needs one
+    int label[PREFILTER_MAX_HEADS];     // last full decision, per head
+    float score[PREFILTER_MAX_HEADS];
+    std::atomic<uint32_t> seen;
+    std::atomic<uint32_t> skipped;      // extraction and inference not run
+    std::atomic<uint32_t> hits[4];      // per PREFILTER_RULE_*, counted even when the action is PASS
+};
+
+// Ranges in IDX_* order (Temperature, Humidity, Temperature_WeatherStation,
+// Humidity_WeatherStation): the DHT22 / station sensor limits.
+static const PrefilterConfig PREFILTER_DEFAULT = {
+    PREFILTER_ON_IDENTICAL, PREFILTER_ON_RANGE, PREFILTER_ON_STUCK, PREFILTER_STUCK_RUN,
+    { -40.0f, 0.0f, -40.0f, 0.0f },
+    { 80.0f, 100.0f, 80.0f, 100.0f } };
+
+// Checks one reading and updates the state. Returns the action, *out_rule the
+// rule behind it (PREFILTER_RULE_NONE for PASS with no rule hit). The first
+// matching rule wins, in the order range, identical, stuck.
+int prefilter_check(const PrefilterConfig& cfg, PrefilterState& st, const float* raw, int* out_rule) {
+    st.seen.fetch_add(1, std::memory_order_relaxed);
+    int rule = PREFILTER_RULE_NONE, action = PREFILTER_PASS;
+
+    for(int i=0; i<PREFILTER_CHANNELS; i++) {
+        if(!(raw[i] >= cfg.lo[i] && raw[i] <= cfg.hi[i])) { rule = PREFILTER_RULE_RANGE; break; }
+    }
+    if(rule == PREFILTER_RULE_RANGE) {
+        action = cfg.on_range;
+    } else {
+        bool identical = st.has_prev;
+        bool stuck = false;
+        for(int i=0; i<PREFILTER_CHANNELS; i++) {
+            bool same = st.has_prev && memcmp(&raw[i], &st.prev[i], sizeof(float)) == 0;
+            st.run[i] = same ? st.run[i] + 1 : 1;
+            if(!same) identical = false;
+            if(st.run[i] >= cfg.stuck_run) stuck = true;
+            st.prev[i] = raw[i];
+        }
+        st.has_prev = true;
+        if(identical) { rule = PREFILTER_RULE_IDENTICAL; action = cfg.on_identical; }
+        else if(stuck) { rule = PREFILTER_RULE_STUCK; action = cfg.on_stuck; }
+    }
+
+    if(action == PREFILTER_REUSE && !st.has_decision) action = PREFILTER_PASS;
+    st.hits[rule].fetch_add(1, std::memory_order_relaxed);
+    if(action != PREFILTER_PASS) st.skipped.fetch_add(1, std::memory_order_relaxed);
+    if(out_rule) *out_rule = rule;
+    return action;
+}
+
+PrefilterState prefilter_state;
+
+// Back to no previous reading and no decision, counters at 0 ({"reset": true}).
+void prefilter_reset(PrefilterState& st) {
+    for(int i=0; i<PREFILTER_CHANNELS; i++) {
+        st.prev[i] = 0.0f;
+        st.run[i] = 0;
+    }
+    st.has_prev = false;
+    st.has_decision = false;
+    for(int h=0; h<PREFILTER_MAX_HEADS; h++) {
+        st.label[h] = 0;
+        st.score[h] = 0.0f;
+    }
+    st.seen.store(0, std::memory_order_relaxed);
+    st.skipped.store(0, std::memory_order_relaxed);
+    for(int r=0; r<4; r++) st.hits[r].store(0, std::memory_order_relaxed);
+}
+
+// Called after a full extraction + inference, once per head, so REUSE has
+// something to reuse.
+void prefilter_decided(PrefilterState& st, int head, int label, float score) {
+    st.label[head] = label;
+    st.score[head] = score;
+    st.has_decision = true;
+}
+
+// Decision published for a skipped reading: the stored one for
+// PREFILTER_REUSE, PREFILTER_RULE_LABEL with a NaN score (published empty)
+// for PREFILTER_DECIDE.
+int prefilter_result(const PrefilterState& st, int action, int head, float* out_score) {
+    if(action == PREFILTER_REUSE) {
+        if(out_score) *out_score = st.score[head];
+        return st.label[head];
+    }
+    if(out_score) *out_score = NAN;
+    return PREFILTER_RULE_LABEL;
+}
+
+// Counters as one JSON object, for the {"stats": true} command.
+int prefilter_stats_json(const PrefilterState& st, char* buf, size_t n) {
+    return snprintf(buf, n,
+                    "{\"seen\": %lu, \"skipped\": %lu, \"identical\": %lu, \"range\": %lu, \"stuck\": %lu}",
+                    (unsigned long)st.seen.load(std::memory_order_relaxed),
+                    (unsigned long)st.skipped.load(std::memory_order_relaxed),
+                    (unsigned long)st.hits[PREFILTER_RULE_IDENTICAL].load(std::memory_order_relaxed),
+                    (unsigned long)st.hits[PREFILTER_RULE_RANGE].load(std::memory_order_relaxed),
+                    (unsigned long)st.hits[PREFILTER_RULE_STUCK].load(std::memory_order_relaxed));
+}
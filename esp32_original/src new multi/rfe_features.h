@@ -0,0 +1,164 @@
+#pragma once
+#include <stdint.h>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include "rfe_settings.h"
+#include "checkpoint.h"
+
+// ================= GLOBAL STATE =================
+uint32_t sample_count = 0;
+uint32_t last_ts = 0;
+
+// ================= RING BUFFER =================
+struct RingBuffer {
+  std::vector<float> data;
+  int size, head, count;
+  RingBuffer(int s) : size(s), head(0), count(0) { data.resize(s); }
+  void clear() { head = 0; count = 0; }
+
+  void push(float val) {
+    data[head] = val;
+    head = (head + 1) % size;
+    if (count < size) count++;
+  }
+
+  float get_stat(int stat_type) {
+    if (count == 0) return 0.0f;
+    if (stat_type == 0) { // Mean
+      float sum = 0;
+      int idx = (head - 1 + size) % size;
+      for (int i = 0; i < count; i++) {
+        sum += data[idx];
+        idx = (idx - 1 + size) % size;
+      }
+      return sum / count;
+    }
+
+    std::vector<float> valid_data;
+    valid_data.reserve(count);
+    int idx = (head - 1 + size) % size;
+    for (int i = 0; i < count; i++) {
+      valid_data.push_back(data[idx]);
+      idx = (idx - 1 + size) % size;
+    }
+
+    if (stat_type == 4) return *std::min_element(valid_data.begin(), valid_data.end());
+    if (stat_type == 5) return *std::max_element(valid_data.begin(), valid_data.end());
+
+    if (stat_type == 1) { // Median
+      std::sort(valid_data.begin(), valid_data.end());
+      if (count % 2 == 0) return (valid_data[count / 2 - 1] + valid_data[count / 2]) / 2.0f;
+      else return valid_data[count / 2];
+    }
+
+    float sum = 0; for (float x : valid_data) sum += x;
+    float mean = sum / count;
+    float sq_sum = 0; for (float x : valid_data) sq_sum += (x - mean) * (x - mean);
+    float var = (count > 1) ? sq_sum / (count - 1) : 0.0f;
+
+    if (stat_type == 3) return var;
+    if (stat_type == 2) return sqrt(var);
+    return 0.0f;
+  }
+};
+
+struct ChannelState {
+  float prev_val = NAN;
+  float ewma_val = NAN;
+  RingBuffer *roll_raw[2];
+  RingBuffer *roll_diff[2];
+  float lags[3] = {NAN, NAN, NAN};
+  ChannelState() {
+    roll_raw[0] = new RingBuffer(5); roll_raw[1] = new RingBuffer(15);
+    roll_diff[0] = new RingBuffer(5); roll_diff[1] = new RingBuffer(15);
+  }
+  void clear() {
+    prev_val = ewma_val = NAN;
+    for (int i = 0; i < 3; i++) lags[i] = NAN;
+    for (int i = 0; i < 2; i++) { roll_raw[i]->clear(); roll_diff[i]->clear(); }
+  }
+  void update(float x) {
+    float diff = isnan(prev_val) ? 0.0f : (x - prev_val);
+    for (int i = 0; i < 2; i++) { roll_raw[i]->push(x); roll_diff[i]->push(diff); }
+    lags[2] = lags[1]; lags[1] = lags[0]; lags[0] = isnan(prev_val) ? x : prev_val;
+    if (isnan(ewma_val)) ewma_val = x;
+    else ewma_val = 0.333f * x + 0.667f * ewma_val;
+    prev_val = x;
+  }
+};
+ChannelState channels[NUM_RAW_INPUTS];
+RingBuffer time_diff_5(5);
+RingBuffer time_diff_15(15);
+
+void extract_features_generic(float *raw_inputs, const FeatureSpec *specs, int n_specs, float *out_feat) {
+  for (int i = 0; i < n_specs; i++) {
+    FeatureSpec s = specs[i];
+    float val = 0.0f;
+    int win_idx = (s.window == 15) ? 1 : 0;
+    switch (s.kind) {
+      case FEAT_RAW: val = raw_inputs[s.channel1]; break;
+      case FEAT_INTER: val = raw_inputs[s.channel1] * raw_inputs[s.channel2]; break;
+      case FEAT_DIFF:
+        val = raw_inputs[s.channel1] - channels[s.channel1].prev_val;
+        if (isnan(val)) val = 0.0f; break;
+      case FEAT_ROLL_RAW: val = channels[s.channel1].roll_raw[win_idx]->get_stat(s.stat); break;
+      case FEAT_ROLL_DIFF: val = channels[s.channel1].roll_diff[win_idx]->get_stat(s.stat); break;
+      case FEAT_LAG:
+        if (s.lag >= 1 && s.lag <= 3) val = channels[s.channel1].lags[s.lag - 1];
+        if (isnan(val)) val = raw_inputs[s.channel1]; break;
+      case FEAT_EWMA: val = channels[s.channel1].ewma_val; break;
+      case FEAT_ROLL_TD: val = (s.window == 5) ? time_diff_5.get_stat(2) : time_diff_15.get_stat(2); break;
+      default: val = 0.0f;
+    }
+    out_feat[i] = val;
+  }
+}
+
+// Per-sample history update (time diffs, channel rings, lags, EWMA). Must run
+// before extract_features_generic() for the same sample.
+void update_state(float *raw, uint32_t ts) {
+  float dt = (last_ts == 0) ? 0.0f : (float)(ts - last_ts);
+  last_ts = ts;
+  time_diff_5.push(dt); time_diff_15.push(dt);
+  for (int i = 0; i < NUM_RAW_INPUTS; i++) channels[i].update(raw[i]);
+  sample_count++;
+}
+
+// A ring as it sits in memory: its slots, head and count.
+static int rfe_ring_regions(RingBuffer& r, CheckpointRegion* out) {
+  out[0] = { r.data.data(), r.data.size() * sizeof(float) };
+  out[1] = { &r.head, sizeof(r.head) };
+  out[2] = { &r.count, sizeof(r.count) };
+  return 3;
+}
+
+// What a checkpoint saves (checkpoint.h): every channel's rings, lags and
+// EWMA, the time-diff rings and sample_count, which picks cold or warm.
+// last_ts is not saved: millis() restarts at 0 after a reboot, so the first
+// time diff after a restore is 0, as on a cold start.
+int rfe_checkpoint_regions(CheckpointRegion* out) {
+  int n = 0;
+  for (int i = 0; i < NUM_RAW_INPUTS; i++) {
+    ChannelState& c = channels[i];
+    out[n++] = { &c.prev_val, sizeof(c.prev_val) };
+    out[n++] = { &c.ewma_val, sizeof(c.ewma_val) };
+    out[n++] = { c.lags, sizeof(c.lags) };
+    for (int w = 0; w < 2; w++) {
+      n += rfe_ring_regions(*c.roll_raw[w], out + n);
+      n += rfe_ring_regions(*c.roll_diff[w], out + n);
+    }
+  }
+  n += rfe_ring_regions(time_diff_5, out + n);
+  n += rfe_ring_regions(time_diff_15, out + n);
+  out[n++] = { &sample_count, sizeof(sample_count) };
+  return n;
+}
+
+// Back to the state after boot, for the reset command.
+void reset_rfe_state() {
+  for (int i = 0; i < NUM_RAW_INPUTS; i++) channels[i].clear();
+  time_diff_5.clear(); time_diff_15.clear();
+  sample_count = 0;
+  last_ts = 0;
+}
@@ -0,0 +1,247 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <cmath>
+
+// ================= FIXED-SCHEMA JSON INGEST =================
+// The data topic carries one flat object per message, as data.py sends it:
+//   {"Time": "27/07/2022 13:00", "Temperature": 36.5, "Humidity": 8.833333333, ...}
+// or a command ({"reset": true}, {"reboot": true}, {"stats": true},
+// {"log_from": a, "log_to": b}, {"report_k": k, "report_n": n, ...}).
+// sensor_json_parse scans the payload in place, with no JsonDocument and no heap: Time comes back as a
+// slice of the payload, the four channels as floats in IDX_* order.
+//   - keys may come in any order; unknown keys and their values (nested ones
+//     too) are skipped;
+//   - a channel that is missing, null or not a number is NaN where ArduinoJson
+//     gives 0, so onMqtt's isnan check drops the message;
+//   - NaN / Infinity / -Infinity, which Python's json.dumps writes, are read;
+//   - escapes are not decoded: the Time slice is the text between the quotes.
+// Numbers keep up to 19 significant digits and are scaled by an exact power
+// of ten in double, so they round like strtof except in rare ties.
+//
+// -DFAST_JSON=1 selects it in onMqtt; off keeps ArduinoJson, read into the
+// same struct by sensor_json_from_doc.
+
+#ifndef FAST_JSON
+#define FAST_JSON 0
+#endif
+
+struct SensorJson {
+    const char* time;           // not terminated; into the payload, or a static buffer
+    size_t time_len;
+    float raw[NUM_RAW_INPUTS];  // IDX_* order
+    bool reset, reboot, stats;  // {"reset": true} / {"reboot": true} / {"stats": true}
+    bool log;                   // {"log_from": a, "log_to": b}, b 0xFFFFFFFF when left out
+    uint32_t log_from, log_to;
+    bool report;                // any of the report_* settings (report.h)
+    uint32_t report_k, report_n, report_heartbeat_ms;   // 0xFFFFFFFF when left out
+    int report_changes;         // -1 when left out
+};
+
+static const double SJ_POW10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+static const char* sj_ws(const char* p, const char* end) {
+    while(p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r')) p++;
+    return p;
+}
+
+// Closing quote of the string whose body starts at p, or nullptr.
+static const char* sj_string_end(const char* p, const char* end) {
+    while(p < end) {
+        if(*p == '\\') p += 2;
+        else if(*p == '"') return p;
+        else p++;
+    }
+    return nullptr;
+}
+
+// JSON number at p (NaN / Infinity too). Returns the end, or nullptr when p
+// does not start a number.
+const char* sj_parse_float(const char* p, const char* end, float* out) {
+    bool neg = false;
+    if(p < end && *p == '-') { neg = true; p++; }
+    if(end - p >= 3 && memcmp(p, "NaN", 3) == 0) { *out = NAN; return p + 3; }
+    if(end - p >= 8 && memcmp(p, "Infinity", 8) == 0) { *out = neg ? -INFINITY : INFINITY; return p + 8; }
+
+    uint64_t m = 0;
+    int digits = 0, exp10 = 0;
+    const char* start = p;
+    for(; p < end && *p >= '0' && *p <= '9'; p++) {
+        if(digits < 19) { m = m * 10 + (uint64_t)(*p - '0'); if(m) digits++; }
+        else exp10++;
+    }
+    if(p == start) return nullptr;
+    if(p < end && *p == '.') {
+        const char* frac = ++p;
+        for(; p < end && *p >= '0' && *p <= '9'; p++) {
+            if(digits < 19) { m = m * 10 + (uint64_t)(*p - '0'); if(m) digits++; exp10--; }
+        }
+        if(p == frac) return nullptr;
+    }
+    if(p < end && (*p == 'e' || *p == 'E')) {
+        p++;
+        bool eneg = false;
+        if(p < end && (*p == '+' || *p == '-')) { eneg = (*p == '-'); p++; }
+        const char* e = p;
+        int ev = 0;
+        for(; p < end && *p >= '0' && *p <= '9'; p++) {
+            if(ev < 10000) ev = ev * 10 + (*p - '0');
+        }
+        if(p == e) return nullptr;
+        exp10 += eneg ? -ev : ev;
+    }
+
+    double v = (double)m;
+    if(exp10 < 0) {
+        for(; exp10 < -22; exp10 += 22) v /= 1e22;
+        v /= SJ_POW10[-exp10];
+    } else {
+        for(; exp10 > 22; exp10 -= 22) v *= 1e22;
+        v *= SJ_POW10[exp10];
+    }
+    *out = (float)(neg ? -v : v);
+    return p;
+}
+
+// End of the value at p, whatever its type, or nullptr.
+static const char* sj_skip_value(const char* p, const char* end) {
+    if(p >= end) return nullptr;
+    if(*p == '"') {
+        const char* q = sj_string_end(p + 1, end);
+        return q ? q + 1 : nullptr;
+    }
+    if(*p == '{' || *p == '[') {
+        int depth = 0;
+        for(; p < end; p++) {
+            if(*p == '"') {
+                p = sj_string_end(p + 1, end);
+                if(!p) return nullptr;
+            } else if(*p == '{' || *p == '[') {
+                depth++;
+            } else if(*p == '}' || *p == ']') {
+                if(--depth == 0) return p + 1;
+            }
+        }
+        return nullptr;
+    }
+    while(p < end && *p != ',' && *p != '}' && *p != ']' && *p != ' ' && *p != '\t' && *p != '\n' && *p != '\r') p++;
+    return p;
+}
+
+// Unsigned JSON integer at p. Returns the end, or nullptr when p does not
+// start one.
+static const char* sj_parse_u32(const char* p, const char* end, uint32_t* out) {
+    if(p >= end || *p < '0' || *p > '9') return nullptr;
+    uint32_t v = 0;
+    while(p < end && *p >= '0' && *p <= '9') v = v * 10 + (uint32_t)(*p++ - '0');
+    *out = v;
+    return p;
+}
+
+static bool sj_key(const char* k, size_t n, const char* name) {
+    return strlen(name) == n && memcmp(k, name, n) == 0;
+}
+
+// Parses one payload. Returns false when it is not a flat JSON object.
+bool sensor_json_parse(const char* p, size_t n, SensorJson& out) {
+    const char* end = p + n;
+    out.time = "";
+    out.time_len = 0;
+    for(int i=0; i<NUM_RAW_INPUTS; i++) out.raw[i] = NAN;
+    out.reset = out.reboot = out.stats = out.log = false;
+    out.log_from = 0;
+    out.log_to = 0xFFFFFFFFu;
+    out.report = false;
+    out.report_k = out.report_n = out.report_heartbeat_ms = 0xFFFFFFFFu;
+    out.report_changes = -1;
+
+    p = sj_ws(p, end);
+    if(p >= end || *p != '{') return false;
+    p = sj_ws(p + 1, end);
+    if(p < end && *p == '}') return true;
+    while(true) {
+        if(p >= end || *p != '"') return false;
+        const char* k = p + 1;
+        const char* k_end = sj_string_end(k, end);
+        if(!k_end) return false;
+        size_t kn = (size_t)(k_end - k);
+        p = sj_ws(k_end + 1, end);
+        if(p >= end || *p != ':') return false;
+        p = sj_ws(p + 1, end);
+        if(p >= end) return false;
+
+        int ch = -1;
+        bool* cmd = nullptr;
+        if(sj_key(k, kn, "Temperature")) ch = IDX_TEMPERATURE;
+        else if(sj_key(k, kn, "Humidity")) ch = IDX_HUMIDITY;
+        else if(sj_key(k, kn, "Temperature_WeatherStation")) ch = IDX_TEMPERATURE_WEATHERSTATION;
+        else if(sj_key(k, kn, "Humidity_WeatherStation")) ch = IDX_HUMIDITY_WEATHERSTATION;
+        else if(sj_key(k, kn, "reset")) cmd = &out.reset;
+        else if(sj_key(k, kn, "reboot")) cmd = &out.reboot;
+        else if(sj_key(k, kn, "stats")) cmd = &out.stats;
+
+        const char* q = nullptr;
+        if(ch >= 0) {
+            q = sj_parse_float(p, end, &out.raw[ch]);
+        } else if(sj_key(k, kn, "Time") && *p == '"') {
+            q = sj_string_end(p + 1, end);
+            if(q) { out.time = p + 1; out.time_len = (size_t)(q - p - 1); q++; }
+        } else if(sj_key(k, kn, "log_from")) {
+            q = sj_parse_u32(p, end, &out.log_from);
+            out.log = q != nullptr;
+        } else if(sj_key(k, kn, "log_to")) {
+            q = sj_parse_u32(p, end, &out.log_to);
+        } else if(sj_key(k, kn, "report_k") || sj_key(k, kn, "report_n") || sj_key(k, kn, "report_heartbeat_ms")) {
+            uint32_t* v = (k[7] == 'k') ? &out.report_k : (k[7] == 'n') ? &out.report_n : &out.report_heartbeat_ms;
+            q = sj_parse_u32(p, end, v);
+            out.report |= q != nullptr;
+        } else if(sj_key(k, kn, "report_changes")) {
+            if(end - p >= 4 && memcmp(p, "true", 4) == 0) { out.report_changes = 1; q = p + 4; }
+            else if(end - p >= 5 && memcmp(p, "false", 5) == 0) { out.report_changes = 0; q = p + 5; }
+            out.report |= q != nullptr;
+        } else if(cmd && end - p >= 4 && memcmp(p, "true", 4) == 0) {
+            *cmd = true;
+            q = p + 4;
+        }
+        if(!q) q = sj_skip_value(p, end);    // null, or a type the schema does not expect
+        if(!q) return false;
+
+        p = sj_ws(q, end);
+        if(p < end && *p == ',') { p = sj_ws(p + 1, end); continue; }
+        return p < end && *p == '}';
+    }
+}
+
+// The same fields from an ArduinoJson document, read the way ArduinoJson
+// reads them (a missing channel is 0). Time is copied, since the document
+// goes away before the message is processed.
+static char sj_doc_time[32];
+
+template <typename Doc>
+void sensor_json_from_doc(Doc& doc, SensorJson& out) {
+    const char* t = doc["Time"] | "";
+    size_t n = strlen(t);
+    if(n >= sizeof(sj_doc_time)) n = sizeof(sj_doc_time) - 1;
+    memcpy(sj_doc_time, t, n);
+    out.time = sj_doc_time;
+    out.time_len = n;
+    out.raw[IDX_TEMPERATURE] = doc["Temperature"];
+    out.raw[IDX_HUMIDITY] = doc["Humidity"];
+    out.raw[IDX_HUMIDITY_WEATHERSTATION] = doc["Humidity_WeatherStation"];
+    out.raw[IDX_TEMPERATURE_WEATHERSTATION] = doc["Temperature_WeatherStation"];
+    out.reset = doc.containsKey("reset") && doc["reset"] == true;
+    out.reboot = doc.containsKey("reboot") && doc["reboot"] == true;
+    out.stats = doc.containsKey("stats") && doc["stats"] == true;
+    out.log = doc.containsKey("log_from");
+    out.log_from = doc["log_from"] | 0u;
+    out.log_to = doc["log_to"] | 0xFFFFFFFFu;
+    out.report = doc.containsKey("report_k") || doc.containsKey("report_n") ||
+                 doc.containsKey("report_changes") || doc.containsKey("report_heartbeat_ms");
+    out.report_k = doc["report_k"] | 0xFFFFFFFFu;
+    out.report_n = doc["report_n"] | 0xFFFFFFFFu;
+    out.report_heartbeat_ms = doc["report_heartbeat_ms"] | 0xFFFFFFFFu;
+    out.report_changes = doc.containsKey("report_changes") ? (doc["report_changes"] == true ? 1 : 0) : -1;
+}
@@ -2,6 +2,30 @@
 #include <cmath>
 #include <vector>
 #include "model_edge_dual.h"
+#include "rf_early_exit.h"
+#include "model_edge_padded.h"
+#include "rf_padded.h"
+#include "rfe_used_features.h"
+
+// ================= PROFILING =================
+// -DRF_PROFILE=1 counts how often each node is visited by predict_cold /
+// predict_warm (rf_cold_hits / rf_warm_hits, indexed like the model arrays).
+// host/relayout_forest.cpp replays the dataset with it and rewrites
+// model_edge_dual.h so the hot child of every node follows it in memory.
+#ifndef RF_PROFILE
+#define RF_PROFILE 0
+#endif
+
+#if RF_PROFILE
+#define RF_COLD_N_NODES (int)(sizeof(RF_COLD_LEFT) / sizeof(RF_COLD_LEFT[0]))
+#define RF_WARM_N_NODES (int)(sizeof(RF_WARM_LEFT) / sizeof(RF_WARM_LEFT[0]))
+uint32_t rf_cold_hits[RF_COLD_N_NODES];
+uint32_t rf_warm_hits[RF_WARM_N_NODES];
+uint32_t* rf_profile_hits = nullptr;   // set by predict_cold / predict_warm
+#define RF_PROFILE_HIT(idx) do { if(rf_profile_hits) rf_profile_hits[idx]++; } while(0)
+#else
+#define RF_PROFILE_HIT(idx) do { } while(0)
+#endif
 
 int predict_rf_generic(const float* features, float* out_score,
                        const int n_features, const int n_trees,
@@ -20,6 +44,7 @@ int predict_rf_generic(const float* features, float* out_score,
     for(int t=0; t<n_trees; t++) {
         int idx = tree_offsets[t]; 
         while(true) {
+            RF_PROFILE_HIT(idx);
             int left = left_children[idx];
             int right = right_children[idx];
             if(left == -1 && right == -1) {
@@ -39,6 +64,9 @@ int predict_rf_generic(const float* features, float* out_score,
 }
 
 int predict_cold(const float* features, float* out_score) {
+#if RF_PROFILE
+    rf_profile_hits = rf_cold_hits;
+#endif
     return predict_rf_generic(features, out_score, 
         RF_COLD_N_FEATURES, RF_COLD_N_TREES, 
         RF_COLD_SCALE_MEAN, RF_COLD_SCALE_STD,
@@ -47,9 +75,287 @@ int predict_cold(const float* features, float* out_score) {
 }
 
 int predict_warm(const float* features, float* out_score) {
+#if RF_PROFILE
+    rf_profile_hits = rf_warm_hits;
+#endif
     return predict_rf_generic(features, out_score, 
         RF_WARM_N_FEATURES, RF_WARM_N_TREES, 
         RF_WARM_SCALE_MEAN, RF_WARM_SCALE_STD,
         RF_WARM_TREE_OFFSETS, RF_WARM_FEATURE, RF_WARM_THRESHOLD, 
         RF_WARM_LEFT, RF_WARM_RIGHT, RF_WARM_PROB1);
+}
+
+// ================= USED FEATURES ONLY =================
+// -DRF_USED_FEATURES=1: the firmware extracts RF_*_USED_SPECS and these score
+// the reduced vectors (rfe_used_features.h). Same trees, same scores. Takes
+// precedence over RF_EXIT_POLICY / RF_PADDED, which read full vectors.
+#ifndef RF_USED_FEATURES
+#define RF_USED_FEATURES 0
+#endif
+
+int predict_cold_used(const float* features, float* out_score) {
+    return predict_rf_generic(features, out_score,
+        RF_COLD_N_USED, RF_COLD_N_TREES,
+        RF_COLD_USED_SCALE_MEAN, RF_COLD_USED_SCALE_STD,
+        RF_COLD_TREE_OFFSETS, RF_COLD_USED_FEATURE, RF_COLD_THRESHOLD,
+        RF_COLD_LEFT, RF_COLD_RIGHT, RF_COLD_PROB1);
+}
+
+int predict_warm_used(const float* features, float* out_score) {
+    return predict_rf_generic(features, out_score,
+        RF_WARM_N_USED, RF_WARM_N_TREES,
+        RF_WARM_USED_SCALE_MEAN, RF_WARM_USED_SCALE_STD,
+        RF_WARM_TREE_OFFSETS, RF_WARM_USED_FEATURE, RF_WARM_THRESHOLD,
+        RF_WARM_LEFT, RF_WARM_RIGHT, RF_WARM_PROB1);
+}
+
+// ================= LAZY FEATURES =================
+// -DRF_LAZY_FEATURES=1: nothing is extracted up front; each split asks the
+// accessor for its raw feature (LazyFeatures in rfe_features.h computes and
+// memoises it) and scales that one value. Same trees, same scores.
+#ifndef RF_LAZY_FEATURES
+#define RF_LAZY_FEATURES 0
+#endif
+
+template<class Accessor>
+int predict_rf_lazy(Accessor& features, float* out_score,
+                    const int n_trees, const float* scale_mean, const float* scale_std,
+                    const int* tree_offsets, const int* feat_idx, const float* thresholds,
+                    const int* left_children, const int* right_children, const float* probs)
+{
+    float total_prob1 = 0;
+    for(int t=0; t<n_trees; t++) {
+        int idx = tree_offsets[t];
+        while(left_children[idx] != -1) {
+            int f_idx = feat_idx[idx];
+            float s = scale_std[f_idx];
+            if(s < 1e-9f) s = 1.0f;
+            float val = (features(f_idx) - scale_mean[f_idx]) / s;
+            if(val <= thresholds[idx]) idx = left_children[idx];
+            else idx = right_children[idx];
+        }
+        total_prob1 += probs[idx];
+    }
+    float avg_prob = total_prob1 / (float)n_trees;
+    if(out_score) *out_score = avg_prob;
+    return (avg_prob >= 0.5f) ? 1 : 0;
+}
+
+template<class Accessor>
+int predict_cold_lazy(Accessor& features, float* out_score) {
+    return predict_rf_lazy(features, out_score, RF_COLD_N_TREES,
+        RF_COLD_SCALE_MEAN, RF_COLD_SCALE_STD,
+        RF_COLD_TREE_OFFSETS, RF_COLD_FEATURE, RF_COLD_THRESHOLD,
+        RF_COLD_LEFT, RF_COLD_RIGHT, RF_COLD_PROB1);
+}
+
+template<class Accessor>
+int predict_warm_lazy(Accessor& features, float* out_score) {
+    return predict_rf_lazy(features, out_score, RF_WARM_N_TREES,
+        RF_WARM_SCALE_MEAN, RF_WARM_SCALE_STD,
+        RF_WARM_TREE_OFFSETS, RF_WARM_FEATURE, RF_WARM_THRESHOLD,
+        RF_WARM_LEFT, RF_WARM_RIGHT, RF_WARM_PROB1);
+}
+
+// ================= BATCH (TREE-MAJOR) =================
+// Scores many samples at once: each tree is walked for a whole block of samples
+// before moving to the next tree, so its nodes stay in cache, and the block is
+// scaled in one pass with the clamped std computed once per call.
+#ifndef RF_BATCH_BLOCK
+#define RF_BATCH_BLOCK 32
+#endif
+
+// features: n_samples rows of n_features (row-major). out_labels / out_scores
+// may be nullptr. Results match predict_rf_generic() sample by sample.
+void predict_rf_batch_generic(const float* features, int n_samples, int* out_labels, float* out_scores,
+                              const int n_features, const int n_trees,
+                              const float* scale_mean, const float* scale_std,
+                              const int* tree_offsets, const int* feat_idx, const float* thresholds,
+                              const int* left_children, const int* right_children, const float* probs)
+{
+    std::vector<float> safe_std(n_features);
+    for(int i=0; i<n_features; i++) {
+        float s = scale_std[i];
+        if(s < 1e-9f) s = 1.0f;
+        safe_std[i] = s;
+    }
+    std::vector<float> z(RF_BATCH_BLOCK * n_features);
+    int idx[RF_BATCH_BLOCK];
+    float acc[RF_BATCH_BLOCK];
+
+    for(int b0=0; b0<n_samples; b0+=RF_BATCH_BLOCK) {
+        int nb = (n_samples - b0 < RF_BATCH_BLOCK) ? (n_samples - b0) : RF_BATCH_BLOCK;
+        for(int s=0; s<nb; s++) {
+            const float* x = features + (size_t)(b0 + s) * n_features;
+            float* zs = &z[s * n_features];
+            for(int i=0; i<n_features; i++) zs[i] = (x[i] - scale_mean[i]) / safe_std[i];
+            acc[s] = 0.0f;
+        }
+
+        for(int t=0; t<n_trees; t++) {
+            for(int s=0; s<nb; s++) {
+                const float* zs = &z[s * n_features];
+                int i = tree_offsets[t];
+                while(left_children[i] != -1) {
+                    i = (zs[feat_idx[i]] <= thresholds[i]) ? left_children[i] : right_children[i];
+                }
+                idx[s] = i;
+            }
+            for(int s=0; s<nb; s++) acc[s] += probs[idx[s]];
+        }
+
+        for(int s=0; s<nb; s++) {
+            float avg_prob = acc[s] / (float)n_trees;
+            if(out_scores) out_scores[b0 + s] = avg_prob;
+            if(out_labels) out_labels[b0 + s] = (avg_prob >= 0.5f) ? 1 : 0;
+        }
+    }
+}
+
+void predict_cold_batch(const float* features, int n_samples, int* out_labels, float* out_scores) {
+    predict_rf_batch_generic(features, n_samples, out_labels, out_scores,
+        RF_COLD_N_FEATURES, RF_COLD_N_TREES,
+        RF_COLD_SCALE_MEAN, RF_COLD_SCALE_STD,
+        RF_COLD_TREE_OFFSETS, RF_COLD_FEATURE, RF_COLD_THRESHOLD,
+        RF_COLD_LEFT, RF_COLD_RIGHT, RF_COLD_PROB1);
+}
+
+void predict_warm_batch(const float* features, int n_samples, int* out_labels, float* out_scores) {
+    predict_rf_batch_generic(features, n_samples, out_labels, out_scores,
+        RF_WARM_N_FEATURES, RF_WARM_N_TREES,
+        RF_WARM_SCALE_MEAN, RF_WARM_SCALE_STD,
+        RF_WARM_TREE_OFFSETS, RF_WARM_FEATURE, RF_WARM_THRESHOLD,
+        RF_WARM_LEFT, RF_WARM_RIGHT, RF_WARM_PROB1);
+}
+
+// ================= PADDED TREES =================
+// Same forest walked through the padded export (rf_padded.h); selected in the
+// firmware with -DRF_PADDED=1. Tree outputs are summed in export order, so
+// scores match predict_rf_generic().
+#ifndef RF_PADDED
+#define RF_PADDED 0
+#endif
+
+int predict_rf_padded_generic(const float* features, float* out_score,
+                              const int n_features, const int n_trees,
+                              const float* scale_mean, const float* scale_std,
+                              const RfPaddedForest& pf,
+                              const int* tree_offsets, const int* feat_idx, const float* thresholds,
+                              const int* left_children, const int* right_children, const float* probs)
+{
+    // z and the per-tree outputs share one buffer
+    std::vector<float> buf(n_features + n_trees);
+    float* z = buf.data();
+    float* tree_prob = z + n_features;
+    for(int i=0; i<n_features; i++) {
+        float s = scale_std[i];
+        if(s < 1e-9f) s = 1.0f;
+        z[i] = (features[i] - scale_mean[i]) / s;
+    }
+
+    rf_padded_walk(pf, z, 0, pf.n_padded, tree_prob);
+    for(int r=0; r<pf.n_rest; r++) {
+        int idx = tree_offsets[pf.rest_tree[r]];
+        while(left_children[idx] != -1) {
+            if(z[feat_idx[idx]] <= thresholds[idx]) idx = left_children[idx];
+            else idx = right_children[idx];
+        }
+        tree_prob[pf.rest_tree[r]] = probs[idx];
+    }
+
+    float total_prob1 = 0;
+    for(int t=0; t<n_trees; t++) total_prob1 += tree_prob[t];
+    float avg_prob = total_prob1 / (float)n_trees;
+    if(out_score) *out_score = avg_prob;
+    return (avg_prob >= 0.5f) ? 1 : 0;
+}
+
+static const RfPaddedForest RF_COLD_PADDED = {
+    RF_COLD_PAD_DEPTH, RF_COLD_PAD_N_TREES, RF_COLD_PAD_TREES,
+    RF_COLD_PAD_FEATURE, RF_COLD_PAD_THRESHOLD, RF_COLD_PAD_LEAF,
+    RF_COLD_PAD_N_REST, RF_COLD_PAD_REST };
+
+static const RfPaddedForest RF_WARM_PADDED = {
+    RF_WARM_PAD_DEPTH, RF_WARM_PAD_N_TREES, RF_WARM_PAD_TREES,
+    RF_WARM_PAD_FEATURE, RF_WARM_PAD_THRESHOLD, RF_WARM_PAD_LEAF,
+    RF_WARM_PAD_N_REST, RF_WARM_PAD_REST };
+
+int predict_cold_padded(const float* features, float* out_score) {
+    return predict_rf_padded_generic(features, out_score,
+        RF_COLD_N_FEATURES, RF_COLD_N_TREES,
+        RF_COLD_SCALE_MEAN, RF_COLD_SCALE_STD, RF_COLD_PADDED,
+        RF_COLD_TREE_OFFSETS, RF_COLD_FEATURE, RF_COLD_THRESHOLD,
+        RF_COLD_LEFT, RF_COLD_RIGHT, RF_COLD_PROB1);
+}
+
+int predict_warm_padded(const float* features, float* out_score) {
+    return predict_rf_padded_generic(features, out_score,
+        RF_WARM_N_FEATURES, RF_WARM_N_TREES,
+        RF_WARM_SCALE_MEAN, RF_WARM_SCALE_STD, RF_WARM_PADDED,
+        RF_WARM_TREE_OFFSETS, RF_WARM_FEATURE, RF_WARM_THRESHOLD,
+        RF_WARM_LEFT, RF_WARM_RIGHT, RF_WARM_PROB1);
+}
+
+// ================= EARLY EXIT =================
+// Label-only prediction (see rf_early_exit.h). Defaults keep the reference
+// behaviour; override with build flags, e.g. -DRF_EXIT_POLICY=RF_EXIT_EXACT.
+#ifndef RF_EXIT_POLICY
+#define RF_EXIT_POLICY RF_EXIT_OFF
+#endif
+#ifndef RF_EXIT_CONF_MARGIN
+#define RF_EXIT_CONF_MARGIN 0.3f
+#endif
+#ifndef RF_EXIT_MIN_TREES
+#define RF_EXIT_MIN_TREES 3
+#endif
+#ifndef RF_EXIT_ORDERED
+#define RF_EXIT_ORDERED 1
+#endif
+
+RfExitConfig rf_exit_config = { RF_EXIT_POLICY, RF_EXIT_CONF_MARGIN, RF_EXIT_MIN_TREES, RF_EXIT_ORDERED };
+
+int predict_rf_early_generic(const float* features, float* out_score, int* out_trees,
+                             const int n_features, const int n_trees, const int n_nodes,
+                             const float* scale_mean, const float* scale_std,
+                             const int* tree_offsets, const int* feat_idx, const float* thresholds,
+                             const int* left_children, const int* right_children, const float* probs,
+                             RfExitTables* tables, bool* tables_ready)
+{
+    int which = rf_exit_config.ordered ? 1 : 0;
+    if(!tables_ready[which]) {
+        rf_exit_build_tables(n_trees, n_nodes, tree_offsets, left_children, probs, tables[which]);
+        tables_ready[which] = true;
+    }
+
+    std::vector<float> z(n_features);
+    for(int i=0; i<n_features; i++) {
+        float s = scale_std[i];
+        if(s < 1e-9f) s = 1.0f;
+        z[i] = (features[i] - scale_mean[i]) / s;
+    }
+    return rf_vote_early_exit(z.data(), n_trees, tree_offsets, feat_idx, thresholds,
+                              left_children, right_children, probs,
+                              tables[which], rf_exit_config, out_score, out_trees);
+}
+
+int predict_cold_early(const float* features, float* out_score, int* out_trees) {
+    static float rem[4][RF_COLD_N_TREES + 1];
+    static RfExitTables tables[2] = { { nullptr, rem[0], rem[1] }, { RF_COLD_TREE_ORDER, rem[2], rem[3] } };
+    static bool ready[2] = { false, false };
+    return predict_rf_early_generic(features, out_score, out_trees,
+        RF_COLD_N_FEATURES, RF_COLD_N_TREES, RF_COLD_TREE_OFFSETS[RF_COLD_N_TREES],
+        RF_COLD_SCALE_MEAN, RF_COLD_SCALE_STD,
+        RF_COLD_TREE_OFFSETS, RF_COLD_FEATURE, RF_COLD_THRESHOLD,
+        RF_COLD_LEFT, RF_COLD_RIGHT, RF_COLD_PROB1, tables, ready);
+}
+
+int predict_warm_early(const float* features, float* out_score, int* out_trees) {
+    static float rem[4][RF_WARM_N_TREES + 1];
+    static RfExitTables tables[2] = { { nullptr, rem[0], rem[1] }, { RF_WARM_TREE_ORDER, rem[2], rem[3] } };
+    static bool ready[2] = { false, false };
+    return predict_rf_early_generic(features, out_score, out_trees,
+        RF_WARM_N_FEATURES, RF_WARM_N_TREES, RF_WARM_TREE_OFFSETS[RF_WARM_N_TREES],
+        RF_WARM_SCALE_MEAN, RF_WARM_SCALE_STD,
+        RF_WARM_TREE_OFFSETS, RF_WARM_FEATURE, RF_WARM_THRESHOLD,
+        RF_WARM_LEFT, RF_WARM_RIGHT, RF_WARM_PROB1, tables, ready);
 }
\ No newline at end of file
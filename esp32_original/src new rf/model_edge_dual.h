@@ -5,11 +5,12 @@
 static const float RF_COLD_SCALE_MEAN[] = { 39.668745, 40.767153, 21.980640, 61.748092, 1262.070627, 840.190692, 2614.651303, 870.748592, 2658.941995, 1211.266810 };
 static const float RF_COLD_SCALE_STD[]  = { 22.739339, 25.345283, 6.576783, 24.667976, 405.143831, 467.205716, 2170.097269, 516.318524, 2367.295088, 280.510033 };
 static const int RF_COLD_TREE_OFFSETS[] = { 0, 45, 92, 131, 162, 199, 244, 291, 338, 369, 412 };
-static const int RF_COLD_FEATURE[] = { 1, 8, 7, -2, 7, -2, 5, -2, 4, -2, -2, 0, 7, 1, -2, -2, 1, 3, -2, -2, 5, -2, -2, 4, -2, 7, 0, -2, -2, 8, -2, -2, 3, 7, -2, -2, 4, -2, 8, 4, -2, 2, -2, -2, -2, 6, 4, 4, 5, 3, -2, -2, -2, 6, 9, 6, -2, -2, -2, -2, 5, 1, 4, -2, -2, 4, -2, -2, 0, -2, 6, 0, -2, -2, 1, -2, -2, 0, -2, 4, 0, -2, -2, 3, -2, 3, 5, -2, -2, 0, -2, -2, 8, 1, 7, 3, -2, 8, 8, -2, -2, 8, -2, -2, 8, 4, 4, -2, -2, -2, 2, 4, -2, -2, -2, 6, 7, 3, 3, -2, -2, -2, -2, 2, -2, -2, 8, 5, -2, -2, -2, 1, 9, 2, 6, 8, -2, -2, -2, -2, 3, 4, -2, 8, -2, 5, -2, -2, 8, 8, 0, -2, -2, -2, -2, 6, 4, -2, -2, 4, -2, -2, 7, 3, -2, 4, 4, -2, 0, 5, -2, -2, 7, -2, -2, 8, 4, -2, 4, -2, -2, -2, 7, 4, 9, 1, -2, -2, -2, 4, 0, 6, -2, -2, -2, -2, 4, -2, -2, 5, 1, 6, -2, 2, -2, -2, 6, 7, -2, -2, 4, -2, -2, 8, 1, -2, 8, -2, -2, 7, 9, 8, 1, -2, -2, -2, 7, 8, -2, -2, 8, -2, -2, 3, 2, -2, 1, -2, -2, 4, 8, -2, -2, -2, 7, 0, 7, 6, -2, 0, -2, 6, -2, -2, -2, 3, -2, 5, 2, 9, -2, -2, -2, 5, -2, 1, -2, -2, 3, 6, 2, -2, 3, 1, -2, -2, -2, 7, 3, -2, 0, -2, -2, 0, 7, -2, -2, -2, 1, -2, -2, 7, 2, 8, 6, -2, -2, 4, 4, -2, 7, -2, -2, 2, 1, -2, -2, 4, -2, -2, 1, -2, -2, 2, 0, 8, 9, -2, -2, -2, -2, 6, 9, 8, -2, -2, 6, 6, -2, -2, 6, -2, -2, 8, -2, 0, -2, -2, 1, 2, 8, 1, -2, -2, 0, 4, 6, -2, -2, 1, -2, -2, 7, 6, -2, -2, -2, -2, 2, 3, 3, -2, -2, -2, 7, 5, -2, -2, -2, 1, 7, 1, 4, 7, -2, -2, 4, -2, 3, -2, -2, 5, 0, 4, -2, -2, 5, -2, -2, 6, -2, -2, 8, -2, 5, 4, -2, 0, -2, -2, -2, 3, 4, 1, -2, -2, 7, -2, -2, 4, -2, -2 };
-static const float RF_COLD_THRESHOLD[] = { -0.14534536749124527, -0.8390444815158844, -1.2276157438755035, -2.0, 0.08057461678981781, -2.0, 0.7853395342826843, -2.0, -0.403821125626564, -2.0, -2.0, 0.21979188174009323, -0.7868534028530121, -0.6812767684459686, -2.0, -2.0, -0.4573851078748703, 0.7601721286773682, -2.0, -2.0, -0.533500611782074, -2.0, -2.0, 0.4990996867418289, -2.0, -0.9118580222129822, 1.5415365099906921, -2.0, -2.0, -0.47291329503059387, -2.0, -2.0, -1.5505159497261047, 1.921062707901001, -2.0, -2.0, -0.9391412734985352, -2.0, -0.46670016646385193, -0.4241321384906769, -2.0, 1.8955408930778503, -2.0, -2.0, -2.0, 0.11502496525645256, -0.9920202791690826, -1.3439460396766663, 0.18847129493951797, -1.6721311211585999, -2.0, -2.0, -2.0, -0.49050474166870117, -1.7432061433792114, -0.965270072221756, -2.0, -2.0, -2.0, -2.0, -0.28121230006217957, -0.20875530689954758, -0.7430106699466705, -2.0, -2.0, -0.9391412734985352, -2.0, -2.0, -0.7561233341693878, -2.0, -0.5342684984207153, -0.15584202110767365, -2.0, -2.0, -0.3294690400362015, -2.0, -2.0, -0.20201751124113798, -2.0, -0.48326753079891205, 0.30994402058422565, -2.0, -2.0, 0.35478825867176056, -2.0, 0.6385569870471954, 0.5129965990781784, -2.0, -2.0, 2.21706485748291, -2.0, -2.0, 0.027587606920860708, -0.15455155074596405, -0.46976853907108307, -1.2262088656425476, -2.0, -0.6061525642871857, -0.6272214353084564, -2.0, -2.0, -0.4449723809957504, -2.0, -2.0, -0.8453496098518372, -0.5222852230072021, -0.5542820990085602, -2.0, -2.0, -2.0, 1.8955408930778503, -1.010120838880539, -2.0, -2.0, -2.0, -0.9642353951931, 1.9270201921463013, -1.4897083640098572, -1.712669551372528, -2.0, -2.0, -2.0, -2.0, -0.3009130507707596, -2.0, -2.0, 0.2958614379167557, 0.16303232312202454, -2.0, -2.0, -2.0, -0.15455155074596405, -1.301514983177185, 1.8955408930778503, -0.7030336260795593, -0.8683505654335022, -2.0, -2.0, -2.0, -2.0, 0.902056485414505, -1.3641574382781982, -2.0, -0.840984582901001, -2.0, 0.04773971065878868, -2.0, -2.0, -0.3203129768371582, -0.33185920119285583, 1.3192082047462463, -2.0, -2.0, -2.0, -2.0, -0.8944036662578583, -0.4237276166677475, -2.0, -2.0, -0.9777099192142487, -2.0, -2.0, -0.16144069284200668, -1.3478240370750427, -2.0, -0.5163147747516632, -1.4072980880737305, -2.0, -0.1393507942557335, -0.41317330300807953, -2.0, -2.0, -0.5258143544197083, -2.0, -2.0, 0.08528355229645967, 0.24637185782194138, -2.0, 0.2506587505340576, -2.0, -2.0, -2.0, 1.9555869698524475, -0.9391412734985352, -1.6630545854568481, -0.11011762171983719, -2.0, -2.0, -2.0, -0.2766810804605484, -0.1858927309513092, -0.8966884911060333, -2.0, -2.0, -2.0, -2.0, 0.21262044459581375, -2.0, -2.0, -0.3246774673461914, -0.1988915354013443, -0.5682316720485687, -2.0, -0.42763154208660126, -2.0, -2.0, -0.9642353951931, 1.3783628940582275, -2.0, -2.0, -0.9777099192142487, -2.0, -2.0, -0.8390444815158844, -0.59184530377388, -2.0, -0.8502567708492279, -2.0, -2.0, 0.5482030808925629, -0.13718312978744507, -0.46041661500930786, -0.8552888035774231, -2.0, -2.0, -2.0, -1.0728216171264648, -0.34055979549884796, -2.0, -2.0, 0.06011418008711189, -2.0, -2.0, -1.4491699934005737, 1.8955408930778503, -2.0, -0.11011762171983719, -2.0, -2.0, -0.27098818868398666, -0.6663478314876556, -2.0, -2.0, -2.0, -0.48187442123889923, 0.2307860478758812, -0.6145909428596497, -0.5248849093914032, -2.0, -0.25882069021463394, -2.0, -0.047026146203279495, -2.0, -2.0, -2.0, -1.2059396505355835, -2.0, 1.8371453285217285, -0.6924898326396942, -0.17414362728595734, -2.0, -2.0, -2.0, 1.9117674827575684, -2.0, -0.7299380600452423, -2.0, -2.0, -0.13167240098118782, -0.8956900835037231, 1.3967208862304688, -2.0, -1.4491699934005737, 0.48533906042575836, -2.0, -2.0, -2.0, 0.4384608715772629, -1.3478240370750427, -2.0, -0.7508729994297028, -2.0, -2.0, -0.8155441880226135, 0.7592940926551819, -2.0, -2.0, -2.0, -0.14534536749124527, -2.0, -2.0, -0.0578092597424984, 1.3718795776367188, -0.8376404047012329, -0.5481557548046112, -2.0, -2.0, -0.5163147747516632, -1.3529963493347168, -2.0, -0.9153552949428558, -2.0, -2.0, -0.891158252954483, -0.826602965593338, -2.0, -2.0, -0.2108333706855774, -2.0, -2.0, -0.6648371517658234, -2.0, -2.0, 1.3967208862304688, -0.19835278391838074, -0.4019462317228317, -0.42110369354486465, -2.0, -2.0, -2.0, -2.0, -0.7923422157764435, -1.8095588088035583, -0.7473826706409454, -2.0, -2.0, -0.8764206171035767, -1.0072826743125916, -2.0, -2.0, -0.84345743060112, -2.0, -2.0, -0.632906049489975, -2.0, -0.4721074551343918, -2.0, -2.0, -0.15455155074596405, 1.8955408930778503, -0.8453496098518372, -1.2849394381046295, -2.0, -2.0, 2.2368544340133667, -0.5244874358177185, -0.3918033242225647, -2.0, -2.0, -0.8233150541782379, -2.0, -2.0, -0.4547930657863617, 1.5732468366622925, -2.0, -2.0, -2.0, -2.0, 1.8955408930778503, -1.3883624076843262, -1.4897083640098572, -2.0, -2.0, -2.0, 1.8952758312225342, -0.2482120618224144, -2.0, -2.0, -2.0, -0.15455155074596405, -0.37116630375385284, -0.7970414459705353, -0.7309058904647827, -1.3917896747589111, -2.0, -2.0, 0.2994106411933899, -2.0, 0.9628640711307526, -2.0, -2.0, 2.5435882806777954, 1.137300729751587, -0.5877640247344971, -2.0, -2.0, 0.6186140328645706, -2.0, -2.0, 1.5732468366622925, -2.0, -2.0, -0.8448216021060944, -2.0, 0.6254221498966217, -1.010120838880539, -2.0, 0.04938235878944397, -2.0, -2.0, -2.0, -1.4694392085075378, -0.48484446108341217, 0.11346113681793213, -2.0, -2.0, 1.7858923077583313, -2.0, -2.0, -0.9391412734985352, -2.0, -2.0 };
-static const int RF_COLD_LEFT[] = { 1, 2, 3, -1, 5, -1, 7, -1, 9, -1, -1, 12, 13, 14, -1, -1, 17, 18, -1, -1, 21, -1, -1, 24, -1, 26, 27, -1, -1, 30, -1, -1, 33, 34, -1, -1, 37, -1, 39, 40, -1, 42, -1, -1, -1, 46, 47, 48, 49, 50, -1, -1, -1, 54, 55, 56, -1, -1, -1, -1, 61, 62, 63, -1, -1, 66, -1, -1, 69, -1, 71, 72, -1, -1, 75, -1, -1, 78, -1, 80, 81, -1, -1, 84, -1, 86, 87, -1, -1, 90, -1, -1, 93, 94, 95, 96, -1, 98, 99, -1, -1, 102, -1, -1, 105, 106, 107, -1, -1, -1, 111, 112, -1, -1, -1, 116, 117, 118, 119, -1, -1, -1, -1, 124, -1, -1, 127, 128, -1, -1, -1, 132, 133, 134, 135, 136, -1, -1, -1, -1, 141, 142, -1, 144, -1, 146, -1, -1, 149, 150, 151, -1, -1, -1, -1, 156, 157, -1, -1, 160, -1, -1, 163, 164, -1, 166, 167, -1, 169, 170, -1, -1, 173, -1, -1, 176, 177, -1, 179, -1, -1, -1, 183, 184, 185, 186, -1, -1, -1, 190, 191, 192, -1, -1, -1, -1, 197, -1, -1, 200, 201, 202, -1, 204, -1, -1, 207, 208, -1, -1, 211, -1, -1, 214, 215, -1, 217, -1, -1, 220, 221, 222, 223, -1, -1, -1, 227, 228, -1, -1, 231, -1, -1, 234, 235, -1, 237, -1, -1, 240, 241, -1, -1, -1, 245, 246, 247, 248, -1, 250, -1, 252, -1, -1, -1, 256, -1, 258, 259, 260, -1, -1, -1, 264, -1, 266, -1, -1, 269, 270, 271, -1, 273, 274, -1, -1, -1, 278, 279, -1, 281, -1, -1, 284, 285, -1, -1, -1, 289, -1, -1, 292, 293, 294, 295, -1, -1, 298, 299, -1, 301, -1, -1, 304, 305, -1, -1, 308, -1, -1, 311, -1, -1, 314, 315, 316, 317, -1, -1, -1, -1, 322, 323, 324, -1, -1, 327, 328, -1, -1, 331, -1, -1, 334, -1, 336, -1, -1, 339, 340, 341, 342, -1, -1, 345, 346, 347, -1, -1, 350, -1, -1, 353, 354, -1, -1, -1, -1, 359, 360, 361, -1, -1, -1, 365, 366, -1, -1, -1, 370, 371, 372, 373, 374, -1, -1, 377, -1, 379, -1, -1, 382, 383, 384, -1, -1, 387, -1, -1, 390, -1, -1, 393, -1, 395, 396, -1, 398, -1, -1, -1, 402, 403, 404, -1, -1, 407, -1, -1, 410, -1, -1 };
-static const int RF_COLD_RIGHT[] = { 32, 11, 4, -1, 6, -1, 8, -1, 10, -1, -1, 23, 16, 15, -1, -1, 20, 19, -1, -1, 22, -1, -1, 25, -1, 29, 28, -1, -1, 31, -1, -1, 36, 35, -1, -1, 38, -1, 44, 41, -1, 43, -1, -1, -1, 77, 60, 53, 52, 51, -1, -1, -1, 59, 58, 57, -1, -1, -1, -1, 68, 65, 64, -1, -1, 67, -1, -1, 70, -1, 74, 73, -1, -1, 76, -1, -1, 79, -1, 83, 82, -1, -1, 85, -1, 89, 88, -1, -1, 91, -1, -1, 126, 115, 104, 97, -1, 101, 100, -1, -1, 103, -1, -1, 110, 109, 108, -1, -1, -1, 114, 113, -1, -1, -1, 123, 122, 121, 120, -1, -1, -1, -1, 125, -1, -1, 130, 129, -1, -1, -1, 155, 140, 139, 138, 137, -1, -1, -1, -1, 148, 143, -1, 145, -1, 147, -1, -1, 154, 153, 152, -1, -1, -1, -1, 159, 158, -1, -1, 161, -1, -1, 182, 165, -1, 175, 168, -1, 172, 171, -1, -1, 174, -1, -1, 181, 178, -1, 180, -1, -1, -1, 196, 189, 188, 187, -1, -1, -1, 195, 194, 193, -1, -1, -1, -1, 198, -1, -1, 213, 206, 203, -1, 205, -1, -1, 210, 209, -1, -1, 212, -1, -1, 219, 216, -1, 218, -1, -1, 233, 226, 225, 224, -1, -1, -1, 230, 229, -1, -1, 232, -1, -1, 239, 236, -1, 238, -1, -1, 243, 242, -1, -1, -1, 268, 255, 254, 249, -1, 251, -1, 253, -1, -1, -1, 257, -1, 263, 262, 261, -1, -1, -1, 265, -1, 267, -1, -1, 288, 277, 272, -1, 276, 275, -1, -1, -1, 283, 280, -1, 282, -1, -1, 287, 286, -1, -1, -1, 290, -1, -1, 313, 310, 297, 296, -1, -1, 303, 300, -1, 302, -1, -1, 307, 306, -1, -1, 309, -1, -1, 312, -1, -1, 321, 320, 319, 318, -1, -1, -1, -1, 333, 326, 325, -1, -1, 330, 329, -1, -1, 332, -1, -1, 335, -1, 337, -1, -1, 358, 357, 344, 343, -1, -1, 352, 349, 348, -1, -1, 351, -1, -1, 356, 355, -1, -1, -1, -1, 364, 363, 362, -1, -1, -1, 368, 367, -1, -1, -1, 401, 392, 381, 376, 375, -1, -1, 378, -1, 380, -1, -1, 389, 386, 385, -1, -1, 388, -1, -1, 391, -1, -1, 394, -1, 400, 397, -1, 399, -1, -1, -1, 409, 406, 405, -1, -1, 408, -1, -1, 411, -1, -1 };
-static const float RF_COLD_PROB1[] = { 0, 0, 0, 0.0, 0, 1.0, 0, 1.0, 0, 0.0, 1.0, 0, 0, 0, 1.0, 0.0, 0, 0, 0.0, 1.0, 0, 0.0, 0.5652173913043478, 0, 0.0, 0, 0, 1.0, 0.25, 0, 0.5, 0.0, 0, 0, 1.0, 0.0, 0, 0.0, 0, 0, 1.0, 0, 1.0, 0.0, 1.0, 0, 0, 0, 0, 0, 1.0, 0.0, 1.0, 0, 0, 0, 0.0, 1.0, 0.0, 1.0, 0, 0, 0, 0.0, 1.0, 0, 0.0, 1.0, 0, 0.0, 0, 0, 1.0, 0.6818181818181818, 0, 0.13043478260869565, 1.0, 0, 1.0, 0, 0, 1.0, 0.0, 0, 0.0, 0, 0, 1.0, 0.0, 0, 0.011764705882352941, 0.3333333333333333, 0, 0, 0, 0, 1.0, 0, 0, 0.06382978723404255, 1.0, 0, 0.0, 0.08791208791208792, 0, 0, 0, 1.0, 0.0, 1.0, 0, 0, 0.0, 0.22857142857142856, 1.0, 0, 0, 0, 0, 0.0, 1.0, 0.0, 0.0, 0, 0.0, 1.0, 0, 0, 1.0, 0.0, 1.0, 0, 0, 0, 0, 0, 1.0, 0.0, 1.0, 1.0, 0, 0, 0.0, 0, 1.0, 0, 0.3235294117647059, 0.09420289855072464, 0, 0, 0, 0.16666666666666666, 0.0, 1.0, 0.0, 0, 0, 1.0, 0.0, 0, 0.0, 1.0, 0, 0, 1.0, 0, 0, 0.0, 0, 0, 0.2857142857142857, 0.0, 0, 0.9090909090909091, 0.0, 0, 0, 0.0, 0, 1.0, 0.05747126436781609, 1.0, 0, 0, 0, 0, 1.0, 0.0, 0.0, 0, 0, 0, 0.75, 1.0, 0.0, 1.0, 0, 0.0, 1.0, 0, 0, 0, 0.0, 0, 0.0, 1.0, 0, 0, 0.0, 1.0, 0, 0.0, 1.0, 0, 0, 1.0, 0, 0.0, 1.0, 0, 0, 0, 0, 0.6153846153846154, 0.056338028169014086, 1.0, 0, 0, 0.022727272727272728, 0.5, 0, 0.0, 0.5, 0, 0, 1.0, 0, 1.0, 0.07142857142857142, 0, 0, 1.0, 0.0, 1.0, 0, 0, 0, 0, 0.0, 0, 0.0, 0, 1.0, 0.6666666666666666, 0.0, 0, 1.0, 0, 0, 0, 0.2727272727272727, 0.06557377049180328, 0.0, 0, 1.0, 0, 0.0, 0.5, 0, 0, 0, 1.0, 0, 0, 0.5882352941176471, 0.0, 0.0, 0, 0, 1.0, 0, 0.0, 0.5151515151515151, 0, 0, 0.0, 1.0, 1.0, 0, 0.0, 1.0, 0, 0, 0, 0, 0.0, 1.0, 0, 0, 0.0, 0, 0.8571428571428571, 0.3, 0, 0, 0.0, 0.5, 0, 0.05263157894736842, 0.0, 0, 1.0, 0.0, 0, 0, 0, 0, 1.0, 0.0, 1.0, 0.0, 0, 0, 0, 1.0, 0.0, 0, 0, 0.3333333333333333, 0.041666666666666664, 0, 1.0, 0.0, 0, 1.0, 0, 0.0, 1.0, 0, 0, 0, 0, 0.0, 1.0, 0, 0, 0, 0.07462686567164178, 0.782608695652174, 0, 0.0, 0.07272727272727272, 0, 0, 1.0, 0.5, 0.0, 1.0, 0, 0, 0, 1.0, 0.0, 1.0, 0, 0, 1.0, 0.0, 0.0, 0, 0, 0, 0, 0, 0.0, 1.0, 0, 0.0, 0, 0.0, 0.5333333333333333, 0, 0, 0, 0.08333333333333333, 0.0, 0, 1.0, 0.05555555555555555, 0, 1.0, 0.0, 0, 1.0, 0, 0, 0.0, 0, 1.0, 0.0, 0.0, 0, 0, 0, 0.0, 1.0, 0, 1.0, 0.0, 0, 0.0, 1.0 };
+static const int RF_COLD_FEATURE[] = { 1, 8, 0, 4, -2, 3, 4, 8, -2, 7, 1, 3, -2, 7, 7, -2, 7, 8, -2, 5, -2, 7, -2, 4, -2, 0, -2, 1, -2, -2, -2, -2, 5, -2, 2, -2, -2, -2, -2, 4, -2, -2, -2, -2, -2, 6, 4, 5, 1, 4, -2, 0, 4, 3, 3, 0, -2, 0, 6, 0, -2, 4, 5, 3, -2, -2, 6, 9, -2, 1, -2, -2, 5, -2, -2, -2, 6, -2, -2, -2, 4, -2, -2, -2, -2, -2, 0, -2, -2, -2, -2, -2, 8, 1, 7, 3, 8, 8, -2, 8, -2, 8, 2, 4, -2, 6, 2, -2, -2, 8, -2, 4, -2, 7, 3, 3, -2, -2, -2, 5, -2, 4, -2, -2, -2, -2, -2, -2, -2, -2, -2, 1, 9, 3, 4, 8, 5, -2, 6, 4, -2, 8, 8, 0, -2, -2, -2, 2, -2, 4, -2, -2, -2, 6, -2, -2, -2, 8, -2, -2, -2, -2, 7, 7, 4, 4, -2, 3, 4, 8, 4, -2, 4, -2, 4, 0, 7, -2, 0, 6, -2, -2, 9, -2, 5, -2, 4, -2, -2, -2, -2, 1, -2, -2, -2, -2, -2, -2, -2, 5, 8, 7, 9, 7, 8, -2, 1, 6, 4, -2, 8, 1, -2, 8, -2, 1, -2, 6, -2, 3, 4, -2, 2, 1, -2, -2, 2, -2, -2, 7, -2, 8, -2, -2, 8, -2, -2, -2, -2, -2, -2, -2, -2, -2, 7, 3, 6, 7, 3, 0, -2, 0, 3, 5, 2, -2, 1, -2, 9, -2, 7, 6, -2, 0, -2, 2, 3, 1, -2, -2, -2, 0, 6, -2, -2, 5, 1, -2, 7, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 7, 2, 8, 4, 2, 4, -2, 2, 0, 8, -2, 4, 7, -2, 6, 9, 6, 6, -2, 1, -2, -2, 9, -2, -2, 1, -2, -2, 6, -2, 8, -2, 8, -2, -2, 6, -2, -2, 0, -2, -2, -2, -2, -2, -2, -2, -2, 1, 2, 8, 0, 4, 1, -2, 2, 3, -2, 6, -2, -2, 1, -2, -2, -2, 7, -2, -2, 3, -2, 7, 6, -2, 5, -2, -2, -2, -2, -2, 1, 7, 1, 5, 0, 4, -2, 3, 4, -2, 4, 4, -2, 8, 5, 4, -2, -2, 7, -2, -2, 3, -2, 5, -2, 4, 7, -2, -2, 0, -2, -2, -2, 1, -2, 6, -2, -2, -2, -2, -2, -2, -2 };
+static const float RF_COLD_THRESHOLD[] = { -0.14534536749124527, -0.8390444815158844, 0.21979188174009323, 0.4990996867418289, -2.0, -1.5505159497261047, -0.9391412734985352, -0.46670016646385193, -2.0, -0.7868534028530121, -0.4573851078748703, 0.7601721286773682, -2.0, -1.2276157438755035, 0.08057461678981781, -2.0, -0.9118580222129822, -0.47291329503059387, -2.0, -0.533500611782074, -2.0, 1.921062707901001, -2.0, -0.4241321384906769, -2.0, 1.5415365099906921, -2.0, -0.6812767684459686, -2.0, -2.0, -2.0, -2.0, 0.7853395342826843, -2.0, 1.8955408930778503, -2.0, -2.0, -2.0, -2.0, -0.403821125626564, -2.0, -2.0, -2.0, -2.0, -2.0, 0.11502496525645256, -0.9920202791690826, -0.28121230006217957, -0.20875530689954758, -0.9391412734985352, -2.0, -0.20201751124113798, -0.48326753079891205, 0.35478825867176056, 0.6385569870471954, 2.21706485748291, -2.0, -0.7561233341693878, -0.5342684984207153, -0.15584202110767365, -2.0, -1.3439460396766663, 0.18847129493951797, -1.6721311211585999, -2.0, -2.0, -0.49050474166870117, -1.7432061433792114, -2.0, -0.3294690400362015, -2.0, -2.0, 0.5129965990781784, -2.0, -2.0, -2.0, -0.965270072221756, -2.0, -2.0, -2.0, -0.7430106699466705, -2.0, -2.0, -2.0, -2.0, -2.0, 0.30994402058422565, -2.0, -2.0, -2.0, -2.0, -2.0, 0.027587606920860708, -0.15455155074596405, -0.46976853907108307, -1.2262088656425476, -0.6061525642871857, -0.4449723809957504, -2.0, 0.2958614379167557, -2.0, -0.8453496098518372, 1.8955408930778503, -1.010120838880539, -2.0, -0.9642353951931, -0.3009130507707596, -2.0, -2.0, -0.6272214353084564, -2.0, -0.5222852230072021, -2.0, 1.9270201921463013, -1.4897083640098572, -1.712669551372528, -2.0, -2.0, -2.0, 0.16303232312202454, -2.0, -0.5542820990085602, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -0.15455155074596405, -1.301514983177185, 0.902056485414505, -1.3641574382781982, -0.840984582901001, 0.04773971065878868, -2.0, -0.8944036662578583, -0.9777099192142487, -2.0, -0.3203129768371582, -0.33185920119285583, 1.3192082047462463, -2.0, -2.0, -2.0, 1.8955408930778503, -2.0, -0.4237276166677475, -2.0, -2.0, -2.0, -0.7030336260795593, -2.0, -2.0, -2.0, -0.8683505654335022, -2.0, -2.0, -2.0, -2.0, -0.16144069284200668, 1.9555869698524475, -0.9391412734985352, -0.2766810804605484, -2.0, -1.3478240370750427, -0.5163147747516632, 0.08528355229645967, 0.24637185782194138, -2.0, 0.2506587505340576, -2.0, -1.4072980880737305, -0.1393507942557335, -0.5258143544197083, -2.0, -0.1858927309513092, -0.8966884911060333, -2.0, -2.0, -1.6630545854568481, -2.0, -0.41317330300807953, -2.0, 0.21262044459581375, -2.0, -2.0, -2.0, -2.0, -0.11011762171983719, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -0.3246774673461914, -0.8390444815158844, 0.5482030808925629, -0.13718312978744507, -1.0728216171264648, 0.06011418008711189, -2.0, -0.1988915354013443, -0.9642353951931, -0.9777099192142487, -2.0, -0.46041661500930786, -0.8552888035774231, -2.0, -0.34055979549884796, -2.0, -0.59184530377388, -2.0, -0.5682316720485687, -2.0, -1.4491699934005737, -0.27098818868398666, -2.0, 1.8955408930778503, -0.11011762171983719, -2.0, -2.0, -0.42763154208660126, -2.0, -2.0, 1.3783628940582275, -2.0, -0.8502567708492279, -2.0, -2.0, -0.6663478314876556, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -0.48187442123889923, -0.13167240098118782, -0.8956900835037231, 0.4384608715772629, -1.3478240370750427, -0.7508729994297028, -2.0, 0.2307860478758812, -1.2059396505355835, 1.8371453285217285, -0.6924898326396942, -2.0, -0.14534536749124527, -2.0, -0.17414362728595734, -2.0, -0.6145909428596497, -0.5248849093914032, -2.0, -0.8155441880226135, -2.0, 1.3967208862304688, -1.4491699934005737, 0.48533906042575836, -2.0, -2.0, -2.0, -0.25882069021463394, -0.047026146203279495, -2.0, -2.0, 1.9117674827575684, -0.7299380600452423, -2.0, 0.7592940926551819, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -0.0578092597424984, 1.3718795776367188, -0.8376404047012329, -0.5163147747516632, -0.891158252954483, -0.2108333706855774, -2.0, 1.3967208862304688, -0.19835278391838074, -0.4019462317228317, -2.0, -1.3529963493347168, -0.9153552949428558, -2.0, -0.7923422157764435, -1.8095588088035583, -0.8764206171035767, -1.0072826743125916, -2.0, -0.826602965593338, -2.0, -2.0, -0.42110369354486465, -2.0, -2.0, -0.6648371517658234, -2.0, -2.0, -0.5481557548046112, -2.0, -0.632906049489975, -2.0, -0.7473826706409454, -2.0, -2.0, -0.84345743060112, -2.0, -2.0, -0.4721074551343918, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -0.15455155074596405, 1.8955408930778503, -0.8453496098518372, 2.2368544340133667, -0.5244874358177185, -0.8233150541782379, -2.0, 1.8955408930778503, -1.3883624076843262, -2.0, -0.3918033242225647, -2.0, -2.0, -1.2849394381046295, -2.0, -2.0, -2.0, 1.8952758312225342, -2.0, -2.0, -1.4897083640098572, -2.0, -0.4547930657863617, 1.5732468366622925, -2.0, -0.2482120618224144, -2.0, -2.0, -2.0, -2.0, -2.0, -0.15455155074596405, -0.37116630375385284, -0.7970414459705353, 2.5435882806777954, 1.137300729751587, -0.5877640247344971, -2.0, -1.4694392085075378, -0.9391412734985352, -2.0, -0.7309058904647827, 0.2994106411933899, -2.0, -0.8448216021060944, 0.6254221498966217, -1.010120838880539, -2.0, -2.0, -1.3917896747589111, -2.0, -2.0, 0.9628640711307526, -2.0, 0.6186140328645706, -2.0, -0.48484446108341217, 1.7858923077583313, -2.0, -2.0, 0.04938235878944397, -2.0, -2.0, -2.0, 0.11346113681793213, -2.0, 1.5732468366622925, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0 };
+static const int RF_COLD_LEFT[] = { 1, 13, 9, 4, -1, 21, 38, 23, -1, 27, 11, 12, -1, 29, 15, -1, 25, 37, -1, 31, -1, 22, -1, 24, -1, 36, -1, 28, -1, -1, -1, -1, 33, -1, 35, -1, -1, -1, -1, 40, -1, -1, -1, -1, -1, 46, 61, 48, 80, 89, -1, 90, 86, 65, 72, 56, -1, 75, 59, 71, -1, 62, 63, 84, -1, -1, 67, 76, -1, 70, -1, -1, 78, -1, -1, -1, 85, -1, -1, -1, 88, -1, -1, -1, -1, -1, 87, -1, -1, -1, -1, -1, 93, 94, 95, 123, 109, 108, -1, 119, -1, 111, 103, 117, -1, 113, 126, -1, -1, 110, -1, 121, -1, 114, 115, 128, -1, -1, -1, 120, -1, 122, -1, -1, -1, -1, -1, -1, -1, -1, -1, 132, 147, 134, 145, 155, 146, -1, 149, 160, -1, 142, 143, 156, -1, -1, -1, 153, -1, 150, -1, -1, -1, 157, -1, -1, -1, 161, -1, -1, -1, -1, 167, 164, 182, 178, -1, 188, 174, 170, 171, -1, 197, -1, 181, 184, 177, -1, 179, 189, -1, -1, 191, -1, 185, -1, 187, -1, -1, -1, -1, 192, -1, -1, -1, -1, -1, -1, -1, 206, 215, 202, 210, 213, 205, -1, 217, 229, 233, -1, 211, 225, -1, 214, -1, 216, -1, 218, -1, 222, 234, -1, 237, 242, -1, -1, 227, -1, -1, 239, -1, 232, -1, -1, 243, -1, -1, -1, -1, -1, -1, -1, -1, -1, 251, 246, 265, 248, 269, 280, -1, 260, 288, 254, 258, -1, 283, -1, 281, -1, 261, 262, -1, 278, -1, 285, 267, 268, -1, -1, -1, 286, 273, -1, -1, 289, 277, -1, 290, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 319, 302, 310, 315, -1, 299, 300, 313, -1, 312, 325, -1, 306, 323, 308, 331, -1, 311, -1, -1, 314, -1, -1, 317, -1, -1, 320, -1, 322, -1, 324, -1, -1, 327, -1, -1, 337, -1, -1, -1, -1, -1, -1, -1, -1, 339, 340, 351, 342, 348, 350, -1, 346, 358, -1, 349, -1, -1, 357, -1, -1, -1, 363, -1, -1, 359, -1, 361, 366, -1, 364, -1, -1, -1, -1, -1, 370, 371, 379, 373, 374, 386, -1, 394, 406, -1, 387, 381, -1, 389, 384, 385, -1, -1, 400, -1, -1, 401, -1, 407, -1, 402, 409, -1, -1, 399, -1, -1, -1, 408, -1, 405, -1, -1, -1, -1, -1, -1, -1 };
+static const int RF_COLD_RIGHT[] = { 5, 2, 3, 16, -1, 6, 7, 8, -1, 10, 19, 44, -1, 14, 32, -1, 17, 18, -1, 20, -1, 30, -1, 34, -1, 26, -1, 43, -1, -1, -1, -1, 39, -1, 41, -1, -1, -1, -1, 42, -1, -1, -1, -1, -1, 51, 47, 57, 49, 50, -1, 52, 53, 54, 55, 79, -1, 58, 69, 60, -1, 66, 82, 64, -1, -1, 74, 68, -1, 83, -1, -1, 73, -1, -1, -1, 77, -1, -1, -1, 81, -1, -1, -1, -1, -1, 91, -1, -1, -1, -1, -1, 99, 105, 101, 96, 97, 98, -1, 100, -1, 102, 125, 104, -1, 106, 107, -1, -1, 124, -1, 112, -1, 118, 129, 116, -1, -1, -1, 130, -1, 127, -1, -1, -1, -1, -1, -1, -1, -1, -1, 138, 133, 141, 135, 136, 137, -1, 139, 140, -1, 151, 159, 144, -1, -1, -1, 148, -1, 152, -1, -1, -1, 154, -1, -1, -1, 158, -1, -1, -1, -1, 163, 186, 165, 166, -1, 168, 169, 196, 172, -1, 173, -1, 175, 176, 195, -1, 194, 180, -1, -1, 183, -1, 190, -1, 193, -1, -1, -1, -1, 198, -1, -1, -1, -1, -1, -1, -1, 200, 201, 219, 203, 204, 241, -1, 207, 208, 209, -1, 236, 212, -1, 228, -1, 231, -1, 226, -1, 220, 221, -1, 223, 224, -1, -1, 238, -1, -1, 230, -1, 240, -1, -1, 235, -1, -1, -1, -1, -1, -1, -1, -1, -1, 245, 256, 247, 263, 249, 250, -1, 252, 253, 275, 255, -1, 257, -1, 259, -1, 270, 271, -1, 264, -1, 266, 287, 274, -1, -1, -1, 272, 284, -1, -1, 276, 282, -1, 279, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 298, 316, 294, 295, 296, 297, -1, 305, 334, 301, -1, 303, 304, -1, 321, 307, 326, 309, -1, 318, -1, -1, 336, -1, -1, 333, -1, -1, 328, -1, 329, -1, 335, -1, -1, 332, -1, -1, 330, -1, -1, -1, -1, -1, -1, -1, -1, 345, 354, 341, 360, 343, 344, -1, 355, 347, -1, 353, -1, -1, 352, -1, -1, -1, 356, -1, -1, 365, -1, 368, 362, -1, 367, -1, -1, -1, -1, -1, 376, 382, 372, 404, 392, 375, -1, 377, 378, -1, 380, 390, -1, 383, 397, 398, -1, -1, 388, -1, -1, 391, -1, 393, -1, 395, 396, -1, -1, 411, -1, -1, -1, 403, -1, 410, -1, -1, -1, -1, -1, -1, -1 };
+static const float RF_COLD_PROB1[] = { 0, 0, 0, 0, 0.0, 0, 0, 0, 1.0, 0, 0, 0, 0.0, 0, 0, 1.0, 0, 0, 0.0, 0, 0.5652173913043478, 0, 1.0, 0, 1.0, 0, 0.25, 0, 1.0, 0.0, 0.0, 0.0, 0, 1.0, 0, 1.0, 1.0, 0.5, 0.0, 0, 0.0, 0.0, 1.0, 0.0, 1.0, 0, 0, 0, 0, 0, 1.0, 0, 0, 0, 0, 0, 0.011764705882352941, 0, 0, 0, 0.6818181818181818, 0, 0, 0, 0.0, 0.0, 0, 0, 0.0, 0, 0.13043478260869565, 1.0, 0, 0.0, 1.0, 0.0, 0, 1.0, 1.0, 0.3333333333333333, 0, 1.0, 1.0, 1.0, 1.0, 0.0, 0, 1.0, 0.0, 0.0, 1.0, 0.0, 0, 0, 0, 0, 0, 0, 0.08791208791208792, 0, 1.0, 0, 0, 0, 0.22857142857142856, 0, 0, 1.0, 0.0, 0, 0.06382978723404255, 0, 1.0, 0, 0, 0, 1.0, 0.0, 0.0, 0, 1.0, 0, 1.0, 1.0, 1.0, 1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0, 0, 0, 0, 0, 0, 0.09420289855072464, 0, 0, 1.0, 0, 0, 0, 0.0, 0.0, 0.3235294117647059, 0, 1.0, 0, 1.0, 0.0, 0.0, 0, 1.0, 1.0, 0.16666666666666666, 0, 0.0, 1.0, 0.0, 1.0, 0, 0, 0, 0, 1.0, 0, 0, 0, 0, 0.0, 0, 0.05747126436781609, 0, 0, 0, 0.9090909090909091, 0, 0, 1.0, 0.0, 0, 0.0, 0, 0.2857142857142857, 0, 0.0, 1.0, 0.75, 0.0, 0, 1.0, 1.0, 0.0, 0.0, 1.0, 1.0, 0.0, 0, 0, 0, 0, 0, 0, 0.0, 0, 0, 0, 1.0, 0, 0, 0.056338028169014086, 0, 0.022727272727272728, 0, 1.0, 0, 0.0, 0, 0, 1.0, 0, 0, 0.07142857142857142, 0.6153846153846154, 0, 0.0, 0.5, 0, 1.0, 0, 0.0, 0.0, 0, 0.0, 1.0, 1.0, 1.0, 0.0, 1.0, 0.5, 1.0, 1.0, 0, 0, 0, 0, 0, 0, 0.5151515151515151, 0, 0, 0, 0, 0.0, 0, 1.0, 0, 0.06557377049180328, 0, 0, 0.0, 0, 1.0, 0, 0, 0, 0.5882352941176471, 1.0, 0.0, 0, 0, 1.0, 0.0, 0, 0, 0.0, 0, 1.0, 0.0, 0.2727272727272727, 0.5, 0.0, 0.6666666666666666, 1.0, 0.0, 0.0, 1.0, 1.0, 0.0, 0, 0, 0, 0, 0, 0, 0.0, 0, 0, 0, 1.0, 0, 0, 0.3, 0, 0, 0, 0, 0.041666666666666664, 0, 0.0, 0.0, 0, 1.0, 0.05263157894736842, 0, 1.0, 0.5, 0, 0.0, 0, 1.0, 0, 1.0, 0.8571428571428571, 0, 1.0, 1.0, 0, 1.0, 0.3333333333333333, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0, 0, 0, 0, 0, 0, 0.07272727272727272, 0, 0, 1.0, 0, 0.07462686567164178, 0.0, 0, 1.0, 0.782608695652174, 1.0, 0, 0.0, 0.0, 0, 1.0, 0, 0, 0.5, 0, 1.0, 0.0, 1.0, 0.0, 0.0, 0, 0, 0, 0, 0, 0, 0.0, 0, 0, 1.0, 0, 0, 0.0, 0, 0, 0, 0.0, 0.08333333333333333, 0, 1.0, 1.0, 0, 0.5333333333333333, 0, 0.05555555555555555, 0, 0, 0.0, 0.0, 0, 1.0, 0.0, 0.0, 0, 1.0, 0, 1.0, 0.0, 1.0, 0.0, 1.0, 0.0, 0.0 };
+static const int RF_COLD_TREE_ORDER[] = { 4, 0, 9, 1, 5, 2, 8, 3, 7, 6 };
 
 // ===== MODEL: RF_WARM =====
 #define RF_WARM_N_FEATURES 94
@@ -17,8 +18,9 @@ static const float RF_COLD_PROB1[] = { 0, 0, 0, 0.0, 0, 1.0, 0, 1.0, 0, 0.0, 1.0
 static const float RF_WARM_SCALE_MEAN[] = { 40.022883, 40.143036, 22.023758, 61.868421, -0.091330, -0.189724, 0.011001, -0.070414, 40.083022, 40.023814, 3.373714, 28.876837, 36.093592, 44.114440, 40.560358, 40.453717, 3.344651, 25.769215, 36.624309, 44.685398, 22.002042, 22.017840, 0.984007, 1.478026, 20.836185, 23.159283, 62.047309, 61.785671, 4.209061, 26.223135, 57.226004, 67.079451, 40.268705, 40.132154, 7.479007, 98.122946, 29.622548, 51.255556, 41.457890, 41.095956, 7.130459, 87.257959, 31.080515, 52.723775, 22.003938, 21.899311, 2.269845, 7.146066, 18.693055, 25.588376, 62.124324, 62.335066, 8.844855, 103.427756, 48.634617, 75.109623, 0.001894, 2.419411, -0.221146, 2.788440, 0.014484, 0.775360, -0.077484, 3.784373, -0.026763, 3.173281, -0.149346, 3.446938, -0.007874, 0.884647, 0.006070, 4.188804, 40.114213, 40.332759, 22.012757, 61.964473, 40.120312, 40.547930, 22.001966, 62.016602, 40.074118, 40.766154, 21.990743, 62.138268, 40.086292, 40.552060, 22.004745, 62.022290, 1260.893883, 849.784965, 2638.400427, 857.365573, 2634.478555, 1214.431703 };
 static const float RF_WARM_SCALE_STD[]  = { 22.635028, 24.659752, 6.637408, 24.828009, 4.489480, 4.463081, 1.033380, 4.608479, 22.090047, 22.399616, 4.170438, 69.544304, 20.621312, 23.990648, 24.298566, 24.590963, 3.802511, 53.046647, 23.872676, 25.037143, 6.586006, 6.638438, 0.710269, 2.278279, 6.332907, 6.893939, 24.524666, 24.699840, 2.901788, 39.947918, 24.133516, 24.936798, 20.350955, 21.816441, 6.482616, 152.093114, 16.159203, 24.210024, 23.188624, 24.610372, 6.033286, 133.918293, 20.841868, 24.870519, 6.154309, 6.420804, 1.411129, 8.980090, 5.201973, 7.035254, 22.936267, 24.234138, 5.015976, 122.317171, 21.576238, 23.646332, 2.730369, 3.308590, 2.524238, 3.226802, 0.646899, 0.531532, 2.527936, 2.258735, 1.598626, 2.980860, 1.517310, 2.702399, 0.497887, 0.394434, 1.819929, 1.571932, 22.670228, 24.696689, 6.650956, 24.862516, 22.644311, 24.713809, 6.675819, 24.933769, 22.521890, 24.743081, 6.700328, 25.033905, 21.706362, 23.996679, 6.476382, 24.122752, 404.556801, 468.549214, 2168.882675, 498.829250, 2358.174604, 283.932326 };
 static const int RF_WARM_TREE_OFFSETS[] = { 0, 37, 82, 135, 180, 221, 276, 315, 350, 391, 426, 469, 508, 547, 596, 631, 678, 717, 766, 817, 854 };
-static const int RF_WARM_FEATURE[] = { 33, 43, -2, 82, 48, -2, 64, -2, -2, 34, 1, -2, 88, 32, -2, -2, 2, -2, -2, 33, 64, -2, -2, -2, 31, -2, 50, 76, 21, -2, -2, -2, 86, 6, -2, -2, -2, 92, 87, 92, 42, 42, -2, -2, 36, 52, 21, -2, 81, -2, -2, -2, 78, -2, 65, 65, -2, -2, -2, 7, -2, 7, -2, -2, 17, 49, 59, -2, -2, 80, 38, 54, 84, -2, -2, 91, -2, -2, -2, -2, -2, -2, 90, 77, 9, 66, 64, 72, -2, 75, -2, -2, -2, -2, 68, -2, 13, 12, -2, 37, 51, -2, -2, -2, -2, 66, 10, 86, 73, 85, -2, -2, -2, -2, -2, 92, 10, -2, -2, -2, 53, -2, 61, 57, -2, 49, 25, -2, -2, -2, 88, 58, -2, -2, -2, 32, 73, 60, 37, -2, -2, 9, -2, 69, -2, -2, 86, 1, -2, 2, 82, 63, 28, -2, -2, -2, -2, 55, -2, -2, -2, 44, 63, 47, -2, -2, -2, 78, 84, 23, 40, -2, 76, -2, -2, -2, -2, 69, -2, -2, 14, 92, 64, -2, -2, 68, 58, 50, 14, 2, -2, -2, 18, -2, -2, 55, 45, 68, -2, -2, -2, -2, -2, 81, -2, 44, 39, -2, -2, -2, 25, 13, 25, -2, 44, -2, -2, -2, 85, -2, -2, 14, 3, 15, -2, -2, 67, 54, 86, 15, 44, -2, 92, -2, -2, 91, -2, -2, -2, 81, -2, 28, -2, -2, 5, 87, 59, 66, -2, 47, -2, -2, -2, 89, -2, 88, -2, -2, 66, -2, -2, 24, 23, 3, -2, 5, 8, -2, -2, 21, -2, 23, -2, -2, -2, -2, 1, 47, 74, 41, 87, 63, 76, 24, -2, -2, -2, -2, 54, -2, 56, -2, -2, -2, 17, -2, -2, 19, -2, -2, 25, 93, -2, 26, 31, -2, 56, -2, -2, 91, 4, -2, -2, -2, -2, 85, 39, 20, 40, 50, -2, 48, 16, -2, -2, -2, 5, 86, -2, 0, 70, -2, -2, -2, -2, -2, 49, -2, -2, 2, 23, -2, -2, 13, -2, 36, 3, -2, -2, -2, 39, 86, 45, 4, -2, 58, -2, -2, 67, 91, 72, 69, 47, -2, -2, 78, -2, -2, 34, -2, -2, 59, -2, -2, 26, -2, -2, 8, -2, 63, -2, 57, -2, -2, 51, -2, 19, 73, -2, -2, -2, 42, 14, 43, 30, 72, -2, 32, -2, -2, 7, 34, 93, -2, -2, -2, 80, 44, 49, -2, -2, 15, -2, -2, -2, -2, 33, 33, -2, -2, 11, -2, -2, 55, -2, -2, 73, 2, 60, 49, 65, -2, -2, 16, 43, 54, -2, 76, -2, -2, -2, 90, 13, 36, -2, -2, 10, -2, -2, -2, 90, -2, 66, -2, 74, -2, -2, 27, -2, -2, 2, 20, 20, -2, 44, -2, -2, -2, -2, 15, 91, 49, -2, 39, 23, 88, 44, -2, -2, -2, 31, -2, 66, -2, 12, -2, -2, -2, 89, 38, 90, -2, -2, 16, -2, 12, -2, -2, -2, 30, 56, 63, 72, -2, -2, -2, -2, -2, 39, 20, 14, 67, 88, 22, 56, -2, -2, -2, 39, -2, 63, -2, 33, -2, -2, 15, -2, -2, 59, -2, -2, 8, 34, -2, -2, 36, -2, -2, 87, 52, 76, -2, -2, 69, -2, -2, -2, 76, 19, 33, 27, 44, -2, -2, 52, -2, -2, 38, 74, -2, 34, -2, -2, 45, 69, 12, 56, -2, -2, -2, -2, -2, -2, 89, 27, -2, 82, 59, 86, -2, -2, -2, 69, 49, -2, -2, 52, 90, -2, -2, -2, 56, 75, -2, -2, -2, 39, 3, 32, -2, -2, 73, 9, 91, 66, -2, 86, 23, -2, -2, 41, -2, -2, 48, -2, -2, -2, 58, -2, -2, 54, 6, 30, 26, 90, -2, -2, -2, -2, -2, -2, 18, 68, 16, 87, -2, 51, 67, 84, 39, -2, -2, 59, -2, -2, -2, 86, 5, -2, 91, -2, -2, 5, 92, -2, -2, 81, -2, -2, -2, 17, 89, -2, 42, -2, 36, -2, -2, -2, 74, 14, -2, 2, -2, 76, -2, -2, -2, 33, 77, 60, -2, 72, 22, 7, -2, -2, -2, 23, -2, -2, 82, 24, -2, 43, 7, -2, -2, -2, -2, 48, 30, -2, 44, 88, -2, -2, 80, 52, 63, 86, -2, -2, -2, -2, -2, -2, 38, 86, 77, 49, -2, 91, 63, 81, 85, -2, -2, -2, -2, 4, -2, -2, -2, -2, 30, 8, -2, 85, -2, 32, 52, 33, 78, -2, -2, -2, -2, -2, 57, 44, 21, 13, -2, 6, -2, -2, 35, -2, -2, 14, -2, -2, 88, -2, -2, 85, 32, 58, 92, 61, -2, 87, -2, -2, 37, 27, -2, 25, -2, -2, -2, 72, 62, -2, -2, 38, -2, 40, -2, -2, 43, 75, -2, 13, -2, -2, 59, 46, 73, -2, 91, -2, -2, -2, -2, 45, 14, 73, -2, -2, 74, -2, -2, 23, -2, -2, 73, 40, 75, 8, -2, -2, 13, 58, 45, 88, -2, -2, 29, 17, -2, -2, 89, -2, -2, 64, -2, -2, 65, -2, -2, -2, 74, 91, 2, -2, -2, 25, -2, 24, -2, -2, -2 };
-static const float RF_WARM_THRESHOLD[] = { -0.14051274210214615, -0.33401428163051605, -2.0, 1.2786325812339783, 1.319603979587555, -2.0, 0.1307280957698822, -2.0, -2.0, 0.5140449404716492, -0.2991258352994919, -2.0, -0.4214337319135666, -0.9990002810955048, -2.0, -2.0, 1.5787550806999207, -2.0, -2.0, -0.6080500185489655, -0.5462418794631958, -2.0, -2.0, -2.0, -1.2262781858444214, -2.0, 1.263312578201294, 2.300637722015381, 1.4120129346847534, -2.0, -2.0, -2.0, -1.0650091767311096, 1.3334868550300598, -2.0, -2.0, -2.0, -0.046884520910680294, -0.23880695551633835, -0.5427129566669464, -0.6899820566177368, -1.1074110269546509, -2.0, -2.0, -0.6274576187133789, 0.05104556679725647, 1.8723321557044983, -2.0, 0.10375341027975082, -2.0, -2.0, -2.0, -0.2164178378880024, -2.0, -0.7349010407924652, -0.843422919511795, -2.0, -2.0, -2.0, -1.286668837070465, -2.0, 1.4257227778434753, -2.0, -2.0, 0.6243102103471756, -1.2679535746574402, -0.590539425611496, -2.0, -2.0, 2.3277745246887207, -0.12786583602428436, 1.815426230430603, 2.197554349899292, -2.0, -2.0, -1.1228126883506775, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, 0.13370151445269585, 0.04424947313964367, -0.4861904978752136, 1.4791808128356934, 1.0405369102954865, -0.5144117772579193, -2.0, -0.843216061592102, -2.0, -2.0, -2.0, -2.0, -0.4305511713027954, -2.0, 0.6729938685894012, -0.6123240888118744, -2.0, -0.28121885657310486, -1.284926414489746, -2.0, -2.0, -2.0, -2.0, 1.4386390447616577, 0.802089661359787, 2.05394184589386, -0.13157334178686142, 0.1143234632909298, -2.0, -2.0, -2.0, -2.0, -2.0, -0.5043004751205444, -0.7829737067222595, -2.0, -2.0, -2.0, -0.8175400197505951, -2.0, 1.400766670703888, 0.08062887191772461, -2.0, -1.1735551357269287, -0.9415927827358246, -2.0, -2.0, -2.0, 1.9574218392372131, -0.3745766580104828, -2.0, -2.0, -2.0, 0.4665750414133072, -0.20580732077360153, -0.07395930867642164, 0.11680194735527039, -2.0, -2.0, -0.6710894703865051, -2.0, 1.7808578312397003, -2.0, -2.0, 2.019630551338196, -0.617458313703537, -2.0, 2.0391456484794617, 2.0249244570732117, -1.1344248056411743, -0.5283567309379578, -2.0, -2.0, -2.0, -2.0, -1.2098968625068665, -2.0, -2.0, -2.0, -1.3725827932357788, 0.2106807753443718, -0.6481185853481293, -2.0, -2.0, -2.0, 0.19971086457371712, 2.2727746963500977, -0.6462664902210236, -0.6900474280118942, -2.0, 1.5403289794921875, -2.0, -2.0, -2.0, -2.0, -0.0001838579773902893, -2.0, -2.0, -0.1344355307519436, -0.831036239862442, -0.8423791229724884, -2.0, -2.0, 0.7969556450843811, 1.3024972081184387, 1.2662191987037659, -0.32286348938941956, 1.5787550806999207, -2.0, -2.0, -0.3507905378937721, -2.0, -2.0, 0.9257409274578094, -1.0506765842437744, -0.17017095535993576, -2.0, -2.0, -2.0, -2.0, -2.0, -0.741600751876831, -2.0, -0.301281301304698, -0.7048229575157166, -2.0, -2.0, -2.0, 1.798553466796875, -0.03742183744907379, 1.637368381023407, -2.0, 0.998725026845932, -2.0, -2.0, -2.0, -0.06608441099524498, -2.0, -2.0, -0.1905413642525673, -1.3842599987983704, -0.3505508601665497, -2.0, -2.0, 0.4164481908082962, 1.2848452925682068, 1.826284408569336, -0.2820975333452225, -1.3725827932357788, -2.0, -0.8202227652072906, -2.0, -2.0, -0.3102526068687439, -2.0, -2.0, -2.0, -0.9706209897994995, -2.0, 0.38195110857486725, -2.0, -2.0, 0.09852467477321625, 0.44495944678783417, 3.438042163848877, -1.9300159811973572, -2.0, -0.5932821333408356, -2.0, -2.0, -2.0, 0.5582208633422852, -2.0, 1.534794807434082, -2.0, -2.0, 0.12771948613226414, -2.0, -2.0, 2.1492522954940796, 5.8888019323349, -1.7064767479896545, -2.0, -3.1802268028259277, -0.6426584422588348, -2.0, -2.0, 1.7049433588981628, -2.0, 0.3064804933965206, -2.0, -2.0, -2.0, -2.0, -0.1335388794541359, 1.274818778038025, 1.869572401046753, 1.7378901839256287, 1.3190427422523499, 3.313583731651306, 2.3131500482559204, -1.316170573234558, -2.0, -2.0, -2.0, -2.0, 1.198790192604065, -2.0, -0.008018707390874624, -2.0, -2.0, -2.0, 0.7273515909910202, -2.0, -2.0, -1.0531845092773438, -2.0, -2.0, 1.959738552570343, -1.8732531070709229, -2.0, -1.4290636777877808, -1.5069878697395325, -2.0, -0.24058803729712963, -2.0, -2.0, -0.1453162021934986, -0.7852438166737556, -2.0, -2.0, -2.0, -2.0, -0.14652647823095322, -0.228349469602108, 1.720915138721466, -0.48720696568489075, 1.248779535293579, -2.0, -0.9600284099578857, -0.4869411438703537, -2.0, -2.0, -2.0, 1.8910083770751953, -1.0650091767311096, -2.0, 2.071735203266144, -2.127960503101349, -2.0, -2.0, -2.0, -2.0, -2.0, 1.338178277015686, -2.0, -2.0, 1.7043161392211914, 4.601615905761719, -2.0, -2.0, -0.994739294052124, -2.0, -0.6367402374744415, -1.7064767479896545, -2.0, -2.0, -2.0, -0.20706536620855331, 1.5777102708816528, -1.3974905014038086, -1.2047430872917175, -2.0, 0.2592780292034149, -2.0, -2.0, 2.1196902990341187, 0.762715756893158, 2.2776914834976196, -1.0218912065029144, -0.7523896992206573, -2.0, -2.0, -0.9654495418071747, -2.0, -2.0, 2.0099693536758423, -2.0, -2.0, 0.22035761922597885, -2.0, -2.0, -0.6991862654685974, -2.0, -2.0, -0.7206379771232605, -2.0, 0.5167804956436157, -2.0, -0.18092080950737, -2.0, -2.0, -1.4356189966201782, -2.0, -0.4866928160190582, -0.6140941679477692, -2.0, -2.0, -2.0, 0.07290541380643845, 0.10077610611915588, 0.38303281366825104, -1.2317311763763428, -0.4509238451719284, -2.0, -0.509372889995575, -2.0, -2.0, -2.0461385250091553, -0.056107254698872566, 0.6030827797949314, -2.0, -2.0, -2.0, 2.3388748168945312, -1.3936477303504944, -1.425900936126709, -2.0, -2.0, -0.2820975333452225, -2.0, -2.0, -2.0, -2.0, -0.8578616082668304, -0.9143939018249512, -2.0, -2.0, 0.3237573206424713, -2.0, -2.0, -1.6539403200149536, -2.0, -2.0, -0.14102130383253098, 1.8717308640480042, 0.7505895793437958, -1.2679535746574402, -0.8609647750854492, -2.0, -2.0, 0.020673967897892, 0.4500465840101242, 1.815426230430603, -2.0, 1.532968819141388, -2.0, -2.0, -2.0, 1.5631779432296753, -0.4306306093931198, -0.48151397705078125, -2.0, -2.0, 1.9053967595100403, -2.0, -2.0, -2.0, -0.7084256410598755, -2.0, -0.13994556106626987, -2.0, -0.8036074042320251, -2.0, -2.0, -1.6714954376220703, -2.0, -2.0, 2.0391456484794617, 2.024613618850708, 1.720915138721466, -2.0, 0.998725026845932, -2.0, -2.0, -2.0, -2.0, -0.18111193180084229, -0.47194039821624756, -1.425900936126709, -2.0, -0.2747874893248081, -0.6462664902210236, 0.4693627655506134, -0.9904049932956696, -2.0, -2.0, -2.0, -1.5069878697395325, -2.0, -1.8458024859428406, -2.0, 2.3473970890045166, -2.0, -2.0, -2.0, 1.4595184922218323, -0.7807995676994324, -0.7420028448104858, -2.0, -2.0, 0.3982817977666855, -2.0, -0.6123240888118744, -2.0, -2.0, -2.0, -1.148858904838562, 0.04988381452858448, -1.0113915801048279, -0.8835764527320862, -2.0, -2.0, -2.0, -2.0, -2.0, -0.11322185397148132, 1.366600215435028, -0.30538254976272583, 2.0957614183425903, 0.4693627655506134, -1.359257996082306, -1.0261961817741394, -2.0, -2.0, -2.0, -0.8504255414009094, -2.0, 2.4475890398025513, -2.0, 2.1406415700912476, -2.0, -2.0, -0.7910921275615692, -2.0, -2.0, 0.46147336065769196, -2.0, -2.0, -0.6074540615081787, 0.058602139353752136, -2.0, -2.0, -0.5433981865644455, -2.0, -2.0, -1.2382457852363586, -0.09466355480253696, -0.9032575786113739, -2.0, -2.0, 0.03249260596930981, -2.0, -2.0, -2.0, 0.14895667880773544, 0.5617494583129883, -0.8803766667842865, -1.6455469131469727, 1.8262752890586853, -2.0, -2.0, 0.903474785387516, -2.0, -2.0, -0.6108681559562683, 0.7000562250614166, -2.0, -0.19482864812016487, -2.0, -2.0, 1.9542552828788757, 2.1522228121757507, 0.14013370033353567, 1.391059696674347, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, 1.8114010691642761, -1.4285789132118225, -2.0, -1.2919283509254456, -0.48126401007175446, -1.4769704937934875, -2.0, -2.0, -2.0, -1.1478251814842224, -1.2679535746574402, -2.0, -2.0, -1.3067906498908997, 1.7600919604301453, -2.0, -2.0, -2.0, 1.9245652556419373, 0.20253490284085274, -2.0, -2.0, -2.0, -0.11322185397148132, -1.3641214966773987, -0.6832659840583801, -2.0, -2.0, -0.14776984602212906, 2.305523991584778, 0.14724402874708176, -1.8458024859428406, -2.0, -0.9304347634315491, 0.06259267963469028, -2.0, -2.0, 1.2441137433052063, -2.0, -2.0, -0.7097028493881226, -2.0, -2.0, -2.0, 1.1770468354225159, -2.0, -2.0, -1.3503103852272034, 0.5757616348564625, -1.0659865736961365, -1.6859479546546936, -1.0319974422454834, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -0.165083110332489, 0.8713499903678894, 2.202229142189026, -1.5445613265037537, -2.0, 1.2956704497337341, 2.2712520360946655, 2.197554349899292, -0.08719720738008618, -2.0, -2.0, -0.009752638638019562, -2.0, -2.0, -2.0, -1.0650091767311096, -0.12553578289225698, -2.0, -1.2450159788131714, -2.0, -2.0, -0.16287919878959656, -0.40086594223976135, -2.0, -2.0, -0.8594788014888763, -2.0, -2.0, -2.0, 2.943875551223755, -0.6397214233875275, -2.0, -0.6795862913131714, -2.0, -0.6800592243671417, -2.0, -2.0, -2.0, 2.0290709733963013, -0.15961654856801033, -2.0, 1.7043161392211914, -2.0, -0.859096348285675, -2.0, -2.0, -2.0, -0.14051274210214615, -0.09057310223579407, -0.4518234431743622, -2.0, -0.6187021136283875, -0.6071235835552216, 0.12377479020506144, -2.0, -2.0, -2.0, -0.5132535696029663, -2.0, -2.0, 1.9699872136116028, 1.479720950126648, -2.0, 0.06806821003556252, -0.16745284851640463, -2.0, -2.0, -2.0, -2.0, 1.6934237480163574, -1.273167371749878, -2.0, -1.369174599647522, 0.4600246697664261, -2.0, -2.0, 2.3388748168945312, 2.8292330503463745, -1.5142634510993958, -1.0650091767311096, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -0.5177600681781769, 1.4152988195419312, 0.04189573135226965, -1.425900936126709, -2.0, 0.1269170306622982, 3.313583731651306, -0.8594788014888763, -0.8589692413806915, -2.0, -2.0, -2.0, -2.0, -0.18569417297840118, -2.0, -2.0, -2.0, -2.0, -1.3843916058540344, -0.9059099555015564, -2.0, -0.6331115365028381, -2.0, -0.3663315549492836, 0.16147403046488762, -0.9189776182174683, 2.0306772589683533, -2.0, -2.0, -2.0, -2.0, -2.0, 1.3233490586280823, 1.7751176357269287, 1.5794017314910889, 0.21580185741186142, -2.0, -0.5482983947731555, -2.0, -2.0, 0.05519714951515198, -2.0, -2.0, -0.2088062111288309, -2.0, -2.0, -0.6535670757293701, -2.0, -2.0, 0.030643719248473644, 0.5722092986106873, 0.23286741226911545, -0.8382451832294464, 0.15494304616004229, -2.0, -1.6240843534469604, -2.0, -2.0, -0.2687133252620697, -0.9225027859210968, -2.0, 0.7911467552185059, -2.0, -2.0, -2.0, -0.6600821763277054, -1.2747618556022644, -2.0, -2.0, -0.4179985225200653, -2.0, 1.3707379400730133, -2.0, -2.0, -0.7059405744075775, 1.4091706275939941, -2.0, 1.370765745639801, -2.0, -2.0, 0.13880980014801025, -0.65741828083992, -0.6849538683891296, -2.0, -0.8121901750564575, -2.0, -2.0, -2.0, -2.0, 1.8993289470672607, 0.15157171338796616, 0.4081016182899475, -2.0, -2.0, 2.0366461277008057, -2.0, -2.0, -0.018703259527683258, -2.0, -2.0, -0.166280135512352, 1.7066449522972107, -1.3947043418884277, -0.5073788166046143, -2.0, -2.0, 2.044639468193054, 1.005377858877182, -1.3974905014038086, 0.491471990942955, -2.0, -2.0, -0.6540099084377289, -0.48082301020622253, -2.0, -2.0, 1.7088106274604797, -2.0, -2.0, -0.23625359684228897, -2.0, -2.0, 3.9806076288223267, -2.0, -2.0, -2.0, 2.0290709733963013, -0.20861762762069702, -0.5139292031526566, -2.0, -2.0, 1.798553466796875, -2.0, 2.0615200996398926, -2.0, -2.0, -2.0 };
-static const int RF_WARM_LEFT[] = { 1, 2, -1, 4, 5, -1, 7, -1, -1, 10, 11, -1, 13, 14, -1, -1, 17, -1, -1, 20, 21, -1, -1, -1, 25, -1, 27, 28, 29, -1, -1, -1, 33, 34, -1, -1, -1, 38, 39, 40, 41, 42, -1, -1, 45, 46, 47, -1, 49, -1, -1, -1, 53, -1, 55, 56, -1, -1, -1, 60, -1, 62, -1, -1, 65, 66, 67, -1, -1, 70, 71, 72, 73, -1, -1, 76, -1, -1, -1, -1, -1, -1, 83, 84, 85, 86, 87, 88, -1, 90, -1, -1, -1, -1, 95, -1, 97, 98, -1, 100, 101, -1, -1, -1, -1, 106, 107, 108, 109, 110, -1, -1, -1, -1, -1, 116, 117, -1, -1, -1, 121, -1, 123, 124, -1, 126, 127, -1, -1, -1, 131, 132, -1, -1, -1, 136, 137, 138, 139, -1, -1, 142, -1, 144, -1, -1, 147, 148, -1, 150, 151, 152, 153, -1, -1, -1, -1, 158, -1, -1, -1, 162, 163, 164, -1, -1, -1, 168, 169, 170, 171, -1, 173, -1, -1, -1, -1, 178, -1, -1, 181, 182, 183, -1, -1, 186, 187, 188, 189, 190, -1, -1, 193, -1, -1, 196, 197, 198, -1, -1, -1, -1, -1, 204, -1, 206, 207, -1, -1, -1, 211, 212, 213, -1, 215, -1, -1, -1, 219, -1, -1, 222, 223, 224, -1, -1, 227, 228, 229, 230, 231, -1, 233, -1, -1, 236, -1, -1, -1, 240, -1, 242, -1, -1, 245, 246, 247, 248, -1, 250, -1, -1, -1, 254, -1, 256, -1, -1, 259, -1, -1, 262, 263, 264, -1, 266, 267, -1, -1, 270, -1, 272, -1, -1, -1, -1, 277, 278, 279, 280, 281, 282, 283, 284, -1, -1, -1, -1, 289, -1, 291, -1, -1, -1, 295, -1, -1, 298, -1, -1, 301, 302, -1, 304, 305, -1, 307, -1, -1, 310, 311, -1, -1, -1, -1, 316, 317, 318, 319, 320, -1, 322, 323, -1, -1, -1, 327, 328, -1, 330, 331, -1, -1, -1, -1, -1, 337, -1, -1, 340, 341, -1, -1, 344, -1, 346, 347, -1, -1, -1, 351, 352, 353, 354, -1, 356, -1, -1, 359, 360, 361, 362, 363, -1, -1, 366, -1, -1, 369, -1, -1, 372, -1, -1, 375, -1, -1, 378, -1, 380, -1, 382, -1, -1, 385, -1, 387, 388, -1, -1, -1, 392, 393, 394, 395, 396, -1, 398, -1, -1, 401, 402, 403, -1, -1, -1, 407, 408, 409, -1, -1, 412, -1, -1, -1, -1, 417, 418, -1, -1, 421, -1, -1, 424, -1, -1, 427, 428, 429, 430, 431, -1, -1, 434, 435, 436, -1, 438, -1, -1, -1, 442, 443, 444, -1, -1, 447, -1, -1, -1, 451, -1, 453, -1, 455, -1, -1, 458, -1, -1, 461, 462, 463, -1, 465, -1, -1, -1, -1, 470, 471, 472, -1, 474, 475, 476, 477, -1, -1, -1, 481, -1, 483, -1, 485, -1, -1, -1, 489, 490, 491, -1, -1, 494, -1, 496, -1, -1, -1, 500, 501, 502, 503, -1, -1, -1, -1, -1, 509, 510, 511, 512, 513, 514, 515, -1, -1, -1, 519, -1, 521, -1, 523, -1, -1, 526, -1, -1, 529, -1, -1, 532, 533, -1, -1, 536, -1, -1, 539, 540, 541, -1, -1, 544, -1, -1, -1, 548, 549, 550, 551, 552, -1, -1, 555, -1, -1, 558, 559, -1, 561, -1, -1, 564, 565, 566, 567, -1, -1, -1, -1, -1, -1, 574, 575, -1, 577, 578, 579, -1, -1, -1, 583, 584, -1, -1, 587, 588, -1, -1, -1, 592, 593, -1, -1, -1, 597, 598, 599, -1, -1, 602, 603, 604, 605, -1, 607, 608, -1, -1, 611, -1, -1, 614, -1, -1, -1, 618, -1, -1, 621, 622, 623, 624, 625, -1, -1, -1, -1, -1, -1, 632, 633, 634, 635, -1, 637, 638, 639, 640, -1, -1, 643, -1, -1, -1, 647, 648, -1, 650, -1, -1, 653, 654, -1, -1, 657, -1, -1, -1, 661, 662, -1, 664, -1, 666, -1, -1, -1, 670, 671, -1, 673, -1, 675, -1, -1, -1, 679, 680, 681, -1, 683, 684, 685, -1, -1, -1, 689, -1, -1, 692, 693, -1, 695, 696, -1, -1, -1, -1, 701, 702, -1, 704, 705, -1, -1, 708, 709, 710, 711, -1, -1, -1, -1, -1, -1, 718, 719, 720, 721, -1, 723, 724, 725, 726, -1, -1, -1, -1, 731, -1, -1, -1, -1, 736, 737, -1, 739, -1, 741, 742, 743, 744, -1, -1, -1, -1, -1, 750, 751, 752, 753, -1, 755, -1, -1, 758, -1, -1, 761, -1, -1, 764, -1, -1, 767, 768, 769, 770, 771, -1, 773, -1, -1, 776, 777, -1, 779, -1, -1, -1, 783, 784, -1, -1, 787, -1, 789, -1, -1, 792, 793, -1, 795, -1, -1, 798, 799, 800, -1, 802, -1, -1, -1, -1, 807, 808, 809, -1, -1, 812, -1, -1, 815, -1, -1, 818, 819, 820, 821, -1, -1, 824, 825, 826, 827, -1, -1, 830, 831, -1, -1, 834, -1, -1, 837, -1, -1, 840, -1, -1, -1, 844, 845, 846, -1, -1, 849, -1, 851, -1, -1, -1 };
-static const int RF_WARM_RIGHT[] = { 24, 3, -1, 9, 6, -1, 8, -1, -1, 19, 12, -1, 16, 15, -1, -1, 18, -1, -1, 23, 22, -1, -1, -1, 26, -1, 32, 31, 30, -1, -1, -1, 36, 35, -1, -1, -1, 81, 64, 59, 44, 43, -1, -1, 52, 51, 48, -1, 50, -1, -1, -1, 54, -1, 58, 57, -1, -1, -1, 61, -1, 63, -1, -1, 80, 69, 68, -1, -1, 79, 78, 75, 74, -1, -1, 77, -1, -1, -1, -1, -1, -1, 120, 105, 94, 93, 92, 89, -1, 91, -1, -1, -1, -1, 96, -1, 104, 99, -1, 103, 102, -1, -1, -1, -1, 115, 114, 113, 112, 111, -1, -1, -1, -1, -1, 119, 118, -1, -1, -1, 122, -1, 130, 125, -1, 129, 128, -1, -1, -1, 134, 133, -1, -1, -1, 161, 146, 141, 140, -1, -1, 143, -1, 145, -1, -1, 160, 149, -1, 157, 156, 155, 154, -1, -1, -1, -1, 159, -1, -1, -1, 167, 166, 165, -1, -1, -1, 177, 176, 175, 172, -1, 174, -1, -1, -1, -1, 179, -1, -1, 210, 185, 184, -1, -1, 203, 202, 195, 192, 191, -1, -1, 194, -1, -1, 201, 200, 199, -1, -1, -1, -1, -1, 205, -1, 209, 208, -1, -1, -1, 218, 217, 214, -1, 216, -1, -1, -1, 220, -1, -1, 261, 226, 225, -1, -1, 244, 239, 238, 235, 232, -1, 234, -1, -1, 237, -1, -1, -1, 241, -1, 243, -1, -1, 258, 253, 252, 249, -1, 251, -1, -1, -1, 255, -1, 257, -1, -1, 260, -1, -1, 275, 274, 265, -1, 269, 268, -1, -1, 271, -1, 273, -1, -1, -1, -1, 300, 297, 294, 293, 288, 287, 286, 285, -1, -1, -1, -1, 290, -1, 292, -1, -1, -1, 296, -1, -1, 299, -1, -1, 314, 303, -1, 309, 306, -1, 308, -1, -1, 313, 312, -1, -1, -1, -1, 339, 336, 335, 326, 321, -1, 325, 324, -1, -1, -1, 334, 329, -1, 333, 332, -1, -1, -1, -1, -1, 338, -1, -1, 343, 342, -1, -1, 345, -1, 349, 348, -1, -1, -1, 384, 377, 358, 355, -1, 357, -1, -1, 374, 371, 368, 365, 364, -1, -1, 367, -1, -1, 370, -1, -1, 373, -1, -1, 376, -1, -1, 379, -1, 381, -1, 383, -1, -1, 386, -1, 390, 389, -1, -1, -1, 423, 416, 415, 400, 397, -1, 399, -1, -1, 406, 405, 404, -1, -1, -1, 414, 411, 410, -1, -1, 413, -1, -1, -1, -1, 420, 419, -1, -1, 422, -1, -1, 425, -1, -1, 460, 457, 450, 433, 432, -1, -1, 441, 440, 437, -1, 439, -1, -1, -1, 449, 446, 445, -1, -1, 448, -1, -1, -1, 452, -1, 454, -1, 456, -1, -1, 459, -1, -1, 468, 467, 464, -1, 466, -1, -1, -1, -1, 499, 488, 473, -1, 487, 480, 479, 478, -1, -1, -1, 482, -1, 484, -1, 486, -1, -1, -1, 498, 493, 492, -1, -1, 495, -1, 497, -1, -1, -1, 507, 506, 505, 504, -1, -1, -1, -1, -1, 538, 531, 528, 525, 518, 517, 516, -1, -1, -1, 520, -1, 522, -1, 524, -1, -1, 527, -1, -1, 530, -1, -1, 535, 534, -1, -1, 537, -1, -1, 546, 543, 542, -1, -1, 545, -1, -1, -1, 573, 572, 557, 554, 553, -1, -1, 556, -1, -1, 563, 560, -1, 562, -1, -1, 571, 570, 569, 568, -1, -1, -1, -1, -1, -1, 591, 576, -1, 582, 581, 580, -1, -1, -1, 586, 585, -1, -1, 590, 589, -1, -1, -1, 595, 594, -1, -1, -1, 620, 601, 600, -1, -1, 617, 616, 613, 606, -1, 610, 609, -1, -1, 612, -1, -1, 615, -1, -1, -1, 619, -1, -1, 630, 629, 628, 627, 626, -1, -1, -1, -1, -1, -1, 669, 660, 659, 636, -1, 646, 645, 642, 641, -1, -1, 644, -1, -1, -1, 652, 649, -1, 651, -1, -1, 656, 655, -1, -1, 658, -1, -1, -1, 668, 663, -1, 665, -1, 667, -1, -1, -1, 677, 672, -1, 674, -1, 676, -1, -1, -1, 700, 691, 682, -1, 688, 687, 686, -1, -1, -1, 690, -1, -1, 699, 694, -1, 698, 697, -1, -1, -1, -1, 716, 703, -1, 707, 706, -1, -1, 715, 714, 713, 712, -1, -1, -1, -1, -1, -1, 735, 734, 733, 722, -1, 730, 729, 728, 727, -1, -1, -1, -1, 732, -1, -1, -1, -1, 749, 738, -1, 740, -1, 748, 747, 746, 745, -1, -1, -1, -1, -1, 763, 760, 757, 754, -1, 756, -1, -1, 759, -1, -1, 762, -1, -1, 765, -1, -1, 806, 791, 782, 775, 772, -1, 774, -1, -1, 781, 778, -1, 780, -1, -1, -1, 786, 785, -1, -1, 788, -1, 790, -1, -1, 797, 794, -1, 796, -1, -1, 805, 804, 801, -1, 803, -1, -1, -1, -1, 814, 811, 810, -1, -1, 813, -1, -1, 816, -1, -1, 843, 842, 823, 822, -1, -1, 839, 836, 829, 828, -1, -1, 833, 832, -1, -1, 835, -1, -1, 838, -1, -1, 841, -1, -1, -1, 853, 848, 847, -1, -1, 850, -1, 852, -1, -1, -1 };
-static const float RF_WARM_PROB1[] = { 0, 0, 0.0, 0, 0, 1.0, 0, 1.0, 0.0, 0, 0, 0.0, 0, 0, 0.0, 1.0, 0, 1.0, 0.0, 0, 0, 1.0, 0.0, 1.0, 0, 1.0, 0, 0, 0, 0.0, 1.0, 1.0, 0, 0, 1.0, 0.0, 0.0, 0, 0, 0, 0, 0, 0.0, 1.0, 0, 0, 0, 0.0, 0, 1.0, 0.0, 1.0, 0, 1.0, 0, 0, 0.0, 1.0, 0.0, 0, 0.0, 0, 1.0, 0.0, 0, 0, 0, 0.0, 1.0, 0, 0, 0, 0, 0.0, 1.0, 0, 0.0, 0.6666666666666666, 1.0, 1.0, 1.0, 1.0, 0, 0, 0, 0, 0, 0, 0.0, 0, 0.0, 1.0, 1.0, 1.0, 0, 0.0, 0, 0, 0.0, 0, 0, 0.0, 1.0, 1.0, 0.0, 0, 0, 0, 0, 0, 0.0, 1.0, 1.0, 0.0, 0.0, 0, 0, 1.0, 0.0, 1.0, 0, 1.0, 0, 0, 0.0, 0, 0, 1.0, 0.0, 0.0, 0, 0, 1.0, 0.0, 1.0, 0, 0, 0, 0, 0.0, 1.0, 0, 0.0, 0, 1.0, 0.0, 0, 0, 0.0, 0, 0, 0, 0, 1.0, 0.0, 1.0, 0.0, 0, 0.0, 1.0, 0.0, 0, 0, 0, 0.0, 1.0, 1.0, 0, 0, 0, 0, 0.0, 0, 1.0, 0.0, 0.0, 1.0, 0, 0.0, 1.0, 0, 0, 0, 0.0, 1.0, 0, 0, 0, 0, 0, 0.0, 1.0, 0, 1.0, 0.0, 0, 0, 0, 1.0, 0.0, 0.0, 1.0, 1.0, 0, 1.0, 0, 0, 0.0, 1.0, 0.0, 0, 0, 0, 1.0, 0, 0.0, 1.0, 0.0, 0, 1.0, 0.0, 0, 0, 0, 1.0, 0.0, 0, 0, 0, 0, 0, 1.0, 0, 1.0, 0.0, 0, 1.0, 0.0, 1.0, 0, 1.0, 0, 0.0, 1.0, 0, 0, 0, 0, 1.0, 0, 1.0, 0.0, 1.0, 0, 1.0, 0, 0.0, 1.0, 0, 1.0, 0.0, 0, 0, 0, 0.0, 0, 0, 0.0, 1.0, 0, 1.0, 0, 1.0, 0.0, 0.0, 0.0, 0, 0, 0, 0, 0, 0, 0, 0, 0.6666666666666666, 0.030973451327433628, 1.0, 1.0, 0, 0.0, 0, 1.0, 0.0, 1.0, 0, 1.0, 0.0, 0, 0.0, 1.0, 0, 0, 0.0, 0, 0, 1.0, 0, 1.0, 0.0, 0, 0, 1.0, 0.0, 1.0, 0.0, 0, 0, 0, 0, 0, 0.0, 0, 0, 0.0, 1.0, 0.0, 0, 0, 1.0, 0, 0, 1.0, 0.015625, 1.0, 1.0, 1.0, 0, 1.0, 0.0, 0, 0, 1.0, 0.0, 0, 1.0, 0, 0, 0.0, 1.0, 0.0, 0, 0, 0, 0, 0.0, 0, 0.0, 1.0, 0, 0, 0, 0, 0, 1.0, 0.12, 0, 0.034482758620689655, 0.0, 0, 0.0, 1.0, 0, 1.0, 0.0, 0, 0.0, 1.0, 0, 0.0, 0, 1.0, 0, 1.0, 0.0, 0, 0.0, 0, 0, 1.0, 0.0, 1.0, 0, 0, 0, 0, 0, 0.0, 0, 0.0, 1.0, 0, 0, 0, 1.0, 0.0, 0.0, 0, 0, 0, 0.0, 1.0, 0, 0.009345794392523364, 0.6666666666666666, 1.0, 1.0, 0, 0, 1.0, 0.0, 0, 1.0, 0.0, 0, 0.0, 1.0, 0, 0, 0, 0, 0, 0.0, 1.0, 0, 0, 0, 0.0, 0, 1.0, 0.0, 1.0, 0, 0, 0, 0.0, 1.0, 0, 1.0, 0.0, 0.0, 0, 0.0, 0, 1.0, 0, 1.0, 0.0, 0, 0.0, 1.0, 0, 0, 0, 1.0, 0, 0.0, 1.0, 0.0, 0.0, 0, 0, 0, 1.0, 0, 0, 0, 0, 1.0, 0.0, 1.0, 0, 1.0, 0, 1.0, 0, 0.0, 0.25, 1.0, 0, 0, 0, 1.0, 0.0, 0, 0.0, 0, 0.0, 1.0, 1.0, 0, 0, 0, 0, 1.0, 0.0, 1.0, 0.0, 1.0, 0, 0, 0, 0, 0, 0, 0, 1.0, 0.0, 0.0, 0, 1.0, 0, 0.0, 0, 1.0, 0.0, 0, 1.0, 0.0, 0, 1.0, 0.0, 0, 0, 0.0, 1.0, 0, 0.0, 1.0, 0, 0, 0, 1.0, 0.0, 0, 1.0, 0.0, 1.0, 0, 0, 0, 0, 0, 1.0, 0.0, 0, 0.0, 1.0, 0, 0, 0.0, 0, 0.0, 1.0, 0, 0, 0, 0, 1.0, 0.8571428571428571, 0.0, 0.0, 0.0, 1.0, 0, 0, 1.0, 0, 0, 0, 1.0, 0.0, 1.0, 0, 0, 1.0, 0.0, 0, 0, 1.0, 0.0, 0.0, 0, 0, 1.0, 0.0, 0.0, 0, 0, 0, 0.0, 1.0, 0, 0, 0, 0, 1.0, 0, 0, 0.06060606060606061, 1.0, 0, 0.0, 0.16666666666666666, 0, 0.0, 1.0, 1.0, 0, 0.0, 1.0, 0, 0, 0, 0, 0, 0.0, 1.0, 0.0, 1.0, 1.0, 1.0, 0, 0, 0, 0, 1.0, 0, 0, 0, 0, 0.0, 0.3333333333333333, 0, 0.0, 1.0, 1.0, 0, 0, 0.0, 0, 0.0, 1.0, 0, 0, 1.0, 0.0, 0, 0.5, 0.0, 1.0, 0, 0, 0.0, 0, 1.0, 0, 1.0, 0.0, 0.0, 0, 0, 0.0, 0, 1.0, 0, 1.0, 0.0, 0.0, 0, 0, 0, 0.0, 0, 0, 0, 0.0, 1.0, 0.0, 0, 0.0, 1.0, 0, 0, 1.0, 0, 0, 0.0, 1.0, 1.0, 0.0, 0, 0, 1.0, 0, 0, 0.0, 1.0, 0, 0, 0, 0, 1.0, 0.0, 0.0, 1.0, 1.0, 1.0, 0, 0, 0, 0, 1.0, 0, 0, 0, 0, 0.0, 1.0, 0.0, 1.0, 0, 1.0, 0.0, 1.0, 1.0, 0, 0, 1.0, 0, 1.0, 0, 0, 0, 0, 0.0, 1.0, 0.0, 1.0, 1.0, 0, 0, 0, 0, 1.0, 0, 0.0, 1.0, 0, 0.0, 1.0, 0, 0.0, 1.0, 0, 1.0, 0.0, 0, 0, 0, 0, 0, 1.0, 0, 1.0, 0.0, 0, 0, 0.0, 0, 1.0, 0.0, 0.0, 0, 0, 1.0, 0.0, 0, 1.0, 0, 0.0, 1.0, 0, 0, 0.0, 0, 1.0, 0.0, 0, 0, 0, 1.0, 0, 0.0, 1.0, 0.0, 0.0, 0, 0, 0, 1.0, 0.0, 0, 1.0, 0.0, 0, 0.0, 1.0, 0, 0, 0, 0, 0.0, 1.0, 0, 0, 0, 0, 0.0, 1.0, 0, 0, 1.0, 0.0, 0, 0.010256410256410256, 0.07142857142857142, 0, 0.0, 1.0, 0, 1.0, 0.0, 1.0, 0, 0, 0, 1.0, 0.0, 0, 1.0, 0, 0.0, 1.0, 0.0 };
+static const int RF_WARM_FEATURE[] = { 33, 43, 82, 48, -2, 31, 50, 76, 21, -2, 34, 1, 88, 2, -2, -2, -2, 86, -2, -2, 33, -2, 32, -2, 64, -2, 6, -2, -2, -2, 64, -2, -2, -2, -2, -2, -2, 92, 87, 92, 42, 36, 78, 65, -2, 17, 49, 80, 38, 54, 84, -2, -2, 42, -2, 7, 7, -2, 52, 21, -2, -2, -2, 91, -2, -2, 59, -2, 65, -2, 81, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 90, 77, 66, 10, 86, 73, -2, 9, 68, 13, 12, 37, -2, 53, 61, 57, -2, 66, 64, 72, -2, 49, -2, 92, -2, -2, 10, -2, 51, -2, 25, -2, -2, 88, 58, -2, 75, -2, -2, 85, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 32, 73, 86, 1, 2, 82, 63, -2, 44, 78, 84, 23, -2, 60, 9, 69, -2, 37, -2, -2, 28, -2, 40, -2, 69, -2, -2, -2, 63, 47, -2, 76, -2, -2, -2, -2, -2, -2, 55, -2, -2, -2, -2, -2, -2, 14, 92, 68, 58, 50, 14, 2, -2, 25, 13, 25, -2, 64, -2, 81, 44, 39, -2, 55, 45, -2, 85, -2, -2, -2, -2, 44, -2, 18, -2, -2, -2, 68, -2, -2, -2, -2, -2, -2, -2, -2, 14, 3, 67, 54, 86, 15, 44, 92, -2, 24, 23, 3, 5, 21, -2, 5, 87, 59, 66, 47, -2, 15, -2, 89, 88, -2, 81, 28, -2, 23, -2, -2, -2, -2, -2, -2, -2, -2, 91, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 66, -2, -2, 8, -2, -2, 1, 47, 74, 41, 87, 63, 76, 24, -2, 25, 93, 26, 91, -2, 19, -2, 31, -2, 17, -2, -2, 54, 56, -2, -2, -2, -2, -2, -2, 56, -2, -2, 4, -2, -2, -2, -2, -2, -2, 85, 39, 20, 40, 50, -2, 2, 23, -2, 5, 86, 0, 70, -2, 49, -2, -2, 13, 36, -2, -2, 48, 16, -2, -2, -2, -2, 3, -2, -2, -2, -2, -2, -2, -2, 39, 86, 45, 67, 91, 72, 69, 78, -2, 51, 19, -2, 8, 63, -2, 47, -2, -2, -2, 59, -2, 26, -2, 4, 58, -2, 73, -2, 34, -2, -2, -2, -2, -2, -2, 57, -2, -2, -2, -2, -2, 42, 14, 43, 30, 7, 80, 44, 15, -2, 55, -2, 33, 11, -2, 72, 32, -2, 33, -2, -2, -2, -2, -2, -2, 49, -2, -2, -2, -2, -2, 34, 93, -2, -2, -2, 73, 2, 60, 49, 16, 43, 54, -2, 2, 20, 20, -2, 90, 66, -2, 90, 13, 10, -2, 27, -2, 74, -2, -2, 65, -2, 36, -2, -2, 44, -2, -2, 76, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 15, 91, 49, 39, 23, 31, 66, 12, -2, 30, -2, 89, 38, 16, -2, 56, 63, -2, -2, 88, 44, -2, 12, -2, -2, -2, 90, -2, 72, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 39, 20, 14, 67, 88, 22, -2, 87, -2, 8, 36, -2, 39, 63, -2, 52, 76, -2, 59, -2, 56, -2, 34, -2, 15, -2, 69, -2, -2, 33, -2, -2, -2, -2, -2, -2, -2, -2, -2, 76, 19, 33, 38, 45, 69, 12, 56, -2, 89, 27, 82, 69, 52, -2, -2, 74, -2, 27, 52, -2, 56, 75, -2, 34, -2, 49, -2, 59, 86, -2, 44, -2, -2, 90, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 39, 3, 73, 9, 91, 66, 86, 41, -2, 54, -2, 32, -2, 23, -2, 58, -2, 6, 30, 26, -2, -2, 48, -2, -2, -2, 90, -2, -2, -2, -2, -2, -2, -2, -2, 18, 68, 16, 87, 51, 67, 84, 39, -2, 74, 14, 2, -2, 17, 89, 42, -2, 86, 5, 81, -2, 36, -2, -2, 76, -2, -2, -2, -2, 5, 91, -2, -2, -2, 59, -2, -2, -2, -2, -2, -2, -2, -2, -2, 92, -2, -2, 33, 77, 82, 24, -2, 48, 30, 44, 80, 52, 63, -2, 60, 72, 23, -2, -2, 22, -2, -2, 43, -2, -2, -2, 86, -2, 88, -2, 7, -2, -2, -2, 7, -2, -2, -2, -2, -2, -2, 38, 30, 57, 44, 21, 13, -2, 86, 77, 49, 91, 63, 81, -2, 85, -2, 8, 85, 32, 52, 33, -2, -2, 14, -2, 88, -2, 6, -2, 4, -2, -2, -2, -2, -2, 78, -2, -2, -2, -2, -2, -2, 35, -2, -2, -2, -2, -2, -2, 85, 32, 58, 92, 37, -2, 45, 14, 74, -2, 43, 75, -2, 59, 46, -2, 72, 38, -2, 27, 25, -2, 61, -2, -2, 73, -2, -2, 87, -2, 62, -2, 73, -2, 23, -2, 40, -2, 13, -2, -2, -2, -2, -2, 91, -2, -2, -2, -2, -2, -2, 73, 40, 75, 13, 58, 45, 29, 89, -2, 74, 91, 25, -2, 8, -2, -2, -2, 17, -2, 64, -2, 88, -2, -2, 2, -2, 24, -2, -2, 65, -2, -2, -2, -2, -2, -2, -2 };
+static const float RF_WARM_THRESHOLD[] = { -0.14051274210214615, -0.33401428163051605, 1.2786325812339783, 1.319603979587555, -2.0, -1.2262781858444214, 1.263312578201294, 2.300637722015381, 1.4120129346847534, -2.0, 0.5140449404716492, -0.2991258352994919, -0.4214337319135666, 1.5787550806999207, -2.0, -2.0, -2.0, -1.0650091767311096, -2.0, -2.0, -0.6080500185489655, -2.0, -0.9990002810955048, -2.0, 0.1307280957698822, -2.0, 1.3334868550300598, -2.0, -2.0, -2.0, -0.5462418794631958, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -0.046884520910680294, -0.23880695551633835, -0.5427129566669464, -0.6899820566177368, -0.6274576187133789, -0.2164178378880024, -0.7349010407924652, -2.0, 0.6243102103471756, -1.2679535746574402, 2.3277745246887207, -0.12786583602428436, 1.815426230430603, 2.197554349899292, -2.0, -2.0, -1.1074110269546509, -2.0, -1.286668837070465, 1.4257227778434753, -2.0, 0.05104556679725647, 1.8723321557044983, -2.0, -2.0, -2.0, -1.1228126883506775, -2.0, -2.0, -0.590539425611496, -2.0, -0.843422919511795, -2.0, 0.10375341027975082, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, 0.13370151445269585, 0.04424947313964367, 1.4386390447616577, 0.802089661359787, 2.05394184589386, -0.13157334178686142, -2.0, -0.4861904978752136, -0.4305511713027954, 0.6729938685894012, -0.6123240888118744, -0.28121885657310486, -2.0, -0.8175400197505951, 1.400766670703888, 0.08062887191772461, -2.0, 1.4791808128356934, 1.0405369102954865, -0.5144117772579193, -2.0, -1.1735551357269287, -2.0, -0.5043004751205444, -2.0, -2.0, -0.7829737067222595, -2.0, -1.284926414489746, -2.0, -0.9415927827358246, -2.0, -2.0, 1.9574218392372131, -0.3745766580104828, -2.0, -0.843216061592102, -2.0, -2.0, 0.1143234632909298, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, 0.4665750414133072, -0.20580732077360153, 2.019630551338196, -0.617458313703537, 2.0391456484794617, 2.0249244570732117, -1.1344248056411743, -2.0, -1.3725827932357788, 0.19971086457371712, 2.2727746963500977, -0.6462664902210236, -2.0, -0.07395930867642164, -0.6710894703865051, 1.7808578312397003, -2.0, 0.11680194735527039, -2.0, -2.0, -0.5283567309379578, -2.0, -0.6900474280118942, -2.0, -0.0001838579773902893, -2.0, -2.0, -2.0, 0.2106807753443718, -0.6481185853481293, -2.0, 1.5403289794921875, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -1.2098968625068665, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -0.1344355307519436, -0.831036239862442, 0.7969556450843811, 1.3024972081184387, 1.2662191987037659, -0.32286348938941956, 1.5787550806999207, -2.0, 1.798553466796875, -0.03742183744907379, 1.637368381023407, -2.0, -0.8423791229724884, -2.0, -0.741600751876831, -0.301281301304698, -0.7048229575157166, -2.0, 0.9257409274578094, -1.0506765842437744, -2.0, -0.06608441099524498, -2.0, -2.0, -2.0, -2.0, 0.998725026845932, -2.0, -0.3507905378937721, -2.0, -2.0, -2.0, -0.17017095535993576, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -0.1905413642525673, -1.3842599987983704, 0.4164481908082962, 1.2848452925682068, 1.826284408569336, -0.2820975333452225, -1.3725827932357788, -0.8202227652072906, -2.0, 2.1492522954940796, 5.8888019323349, -1.7064767479896545, -3.1802268028259277, 1.7049433588981628, -2.0, 0.09852467477321625, 0.44495944678783417, 3.438042163848877, -1.9300159811973572, -0.5932821333408356, -2.0, -0.3505508601665497, -2.0, 0.5582208633422852, 1.534794807434082, -2.0, -0.9706209897994995, 0.38195110857486725, -2.0, 0.3064804933965206, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -0.3102526068687439, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, 0.12771948613226414, -2.0, -2.0, -0.6426584422588348, -2.0, -2.0, -0.1335388794541359, 1.274818778038025, 1.869572401046753, 1.7378901839256287, 1.3190427422523499, 3.313583731651306, 2.3131500482559204, -1.316170573234558, -2.0, 1.959738552570343, -1.8732531070709229, -1.4290636777877808, -0.1453162021934986, -2.0, -1.0531845092773438, -2.0, -1.5069878697395325, -2.0, 0.7273515909910202, -2.0, -2.0, 1.198790192604065, -0.008018707390874624, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -0.24058803729712963, -2.0, -2.0, -0.7852438166737556, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -0.14652647823095322, -0.228349469602108, 1.720915138721466, -0.48720696568489075, 1.248779535293579, -2.0, 1.7043161392211914, 4.601615905761719, -2.0, 1.8910083770751953, -1.0650091767311096, 2.071735203266144, -2.127960503101349, -2.0, 1.338178277015686, -2.0, -2.0, -0.994739294052124, -0.6367402374744415, -2.0, -2.0, -0.9600284099578857, -0.4869411438703537, -2.0, -2.0, -2.0, -2.0, -1.7064767479896545, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -0.20706536620855331, 1.5777102708816528, -1.3974905014038086, 2.1196902990341187, 0.762715756893158, 2.2776914834976196, -1.0218912065029144, -0.9654495418071747, -2.0, -1.4356189966201782, -0.4866928160190582, -2.0, -0.7206379771232605, 0.5167804956436157, -2.0, -0.7523896992206573, -2.0, -2.0, -2.0, 0.22035761922597885, -2.0, -0.6991862654685974, -2.0, -1.2047430872917175, 0.2592780292034149, -2.0, -0.6140941679477692, -2.0, 2.0099693536758423, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -0.18092080950737, -2.0, -2.0, -2.0, -2.0, -2.0, 0.07290541380643845, 0.10077610611915588, 0.38303281366825104, -1.2317311763763428, -2.0461385250091553, 2.3388748168945312, -1.3936477303504944, -0.2820975333452225, -2.0, -1.6539403200149536, -2.0, -0.8578616082668304, 0.3237573206424713, -2.0, -0.4509238451719284, -0.509372889995575, -2.0, -0.9143939018249512, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -1.425900936126709, -2.0, -2.0, -2.0, -2.0, -2.0, -0.056107254698872566, 0.6030827797949314, -2.0, -2.0, -2.0, -0.14102130383253098, 1.8717308640480042, 0.7505895793437958, -1.2679535746574402, 0.020673967897892, 0.4500465840101242, 1.815426230430603, -2.0, 2.0391456484794617, 2.024613618850708, 1.720915138721466, -2.0, -0.7084256410598755, -0.13994556106626987, -2.0, 1.5631779432296753, -0.4306306093931198, 1.9053967595100403, -2.0, -1.6714954376220703, -2.0, -0.8036074042320251, -2.0, -2.0, -0.8609647750854492, -2.0, -0.48151397705078125, -2.0, -2.0, 0.998725026845932, -2.0, -2.0, 1.532968819141388, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -0.18111193180084229, -0.47194039821624756, -1.425900936126709, -0.2747874893248081, -0.6462664902210236, -1.5069878697395325, -1.8458024859428406, 2.3473970890045166, -2.0, -1.148858904838562, -2.0, 1.4595184922218323, -0.7807995676994324, 0.3982817977666855, -2.0, 0.04988381452858448, -1.0113915801048279, -2.0, -2.0, 0.4693627655506134, -0.9904049932956696, -2.0, -0.6123240888118744, -2.0, -2.0, -2.0, -0.7420028448104858, -2.0, -0.8835764527320862, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -0.11322185397148132, 1.366600215435028, -0.30538254976272583, 2.0957614183425903, 0.4693627655506134, -1.359257996082306, -2.0, -1.2382457852363586, -2.0, -0.6074540615081787, -0.5433981865644455, -2.0, -0.8504255414009094, 2.4475890398025513, -2.0, -0.09466355480253696, -0.9032575786113739, -2.0, 0.46147336065769196, -2.0, -1.0261961817741394, -2.0, 0.058602139353752136, -2.0, -0.7910921275615692, -2.0, 0.03249260596930981, -2.0, -2.0, 2.1406415700912476, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, 0.14895667880773544, 0.5617494583129883, -0.8803766667842865, -0.6108681559562683, 1.9542552828788757, 2.1522228121757507, 0.14013370033353567, 1.391059696674347, -2.0, 1.8114010691642761, -1.4285789132118225, -1.2919283509254456, -1.1478251814842224, -1.3067906498908997, -2.0, -2.0, 0.7000562250614166, -2.0, -1.6455469131469727, 0.903474785387516, -2.0, 1.9245652556419373, 0.20253490284085274, -2.0, -0.19482864812016487, -2.0, -1.2679535746574402, -2.0, -0.48126401007175446, -1.4769704937934875, -2.0, 1.8262752890586853, -2.0, -2.0, 1.7600919604301453, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -0.11322185397148132, -1.3641214966773987, -0.14776984602212906, 2.305523991584778, 0.14724402874708176, -1.8458024859428406, -0.9304347634315491, 1.2441137433052063, -2.0, -1.3503103852272034, -2.0, -0.6832659840583801, -2.0, 0.06259267963469028, -2.0, 1.1770468354225159, -2.0, 0.5757616348564625, -1.0659865736961365, -1.6859479546546936, -2.0, -2.0, -0.7097028493881226, -2.0, -2.0, -2.0, -1.0319974422454834, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -0.165083110332489, 0.8713499903678894, 2.202229142189026, -1.5445613265037537, 1.2956704497337341, 2.2712520360946655, 2.197554349899292, -0.08719720738008618, -2.0, 2.0290709733963013, -0.15961654856801033, 1.7043161392211914, -2.0, 2.943875551223755, -0.6397214233875275, -0.6795862913131714, -2.0, -1.0650091767311096, -0.16287919878959656, -0.8594788014888763, -2.0, -0.6800592243671417, -2.0, -2.0, -0.859096348285675, -2.0, -2.0, -2.0, -2.0, -0.12553578289225698, -1.2450159788131714, -2.0, -2.0, -2.0, -0.009752638638019562, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -0.40086594223976135, -2.0, -2.0, -0.14051274210214615, -0.09057310223579407, 1.9699872136116028, 1.479720950126648, -2.0, 1.6934237480163574, -1.273167371749878, -1.369174599647522, 2.3388748168945312, 2.8292330503463745, -1.5142634510993958, -2.0, -0.4518234431743622, -0.6187021136283875, -0.5132535696029663, -2.0, -2.0, -0.6071235835552216, -2.0, -2.0, 0.06806821003556252, -2.0, -2.0, -2.0, -1.0650091767311096, -2.0, 0.4600246697664261, -2.0, -0.16745284851640463, -2.0, -2.0, -2.0, 0.12377479020506144, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -0.5177600681781769, -1.3843916058540344, 1.3233490586280823, 1.7751176357269287, 1.5794017314910889, 0.21580185741186142, -2.0, 1.4152988195419312, 0.04189573135226965, -1.425900936126709, 0.1269170306622982, 3.313583731651306, -0.8594788014888763, -2.0, -0.8589692413806915, -2.0, -0.9059099555015564, -0.6331115365028381, -0.3663315549492836, 0.16147403046488762, -0.9189776182174683, -2.0, -2.0, -0.2088062111288309, -2.0, -0.6535670757293701, -2.0, -0.5482983947731555, -2.0, -0.18569417297840118, -2.0, -2.0, -2.0, -2.0, -2.0, 2.0306772589683533, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, 0.05519714951515198, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, 0.030643719248473644, 0.5722092986106873, 0.23286741226911545, -0.8382451832294464, -0.2687133252620697, -2.0, 1.8993289470672607, 0.15157171338796616, 2.0366461277008057, -2.0, -0.7059405744075775, 1.4091706275939941, -2.0, 0.13880980014801025, -0.65741828083992, -2.0, -0.6600821763277054, -0.4179985225200653, -2.0, -0.9225027859210968, 0.7911467552185059, -2.0, 0.15494304616004229, -2.0, -2.0, 0.4081016182899475, -2.0, -2.0, -1.6240843534469604, -2.0, -1.2747618556022644, -2.0, -0.6849538683891296, -2.0, -0.018703259527683258, -2.0, 1.3707379400730133, -2.0, 1.370765745639801, -2.0, -2.0, -2.0, -2.0, -2.0, -0.8121901750564575, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -0.166280135512352, 1.7066449522972107, -1.3947043418884277, 2.044639468193054, 1.005377858877182, -1.3974905014038086, -0.6540099084377289, 1.7088106274604797, -2.0, 2.0290709733963013, -0.20861762762069702, 1.798553466796875, -2.0, -0.5073788166046143, -2.0, -2.0, -2.0, -0.48082301020622253, -2.0, -0.23625359684228897, -2.0, 0.491471990942955, -2.0, -2.0, -0.5139292031526566, -2.0, 2.0615200996398926, -2.0, -2.0, 3.9806076288223267, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0 };
+static const int RF_WARM_LEFT[] = { 1, 15, 3, 4, -1, 16, 7, 8, 9, -1, 11, 19, 22, 29, -1, -1, -1, 26, -1, -1, 30, -1, 34, -1, 25, -1, 27, -1, -1, -1, 35, -1, -1, -1, -1, -1, -1, 38, 39, 40, 53, 58, 77, 68, -1, 46, 66, 48, 49, 50, 51, -1, -1, 65, -1, 80, 57, -1, 59, 60, -1, -1, -1, 73, -1, -1, 75, -1, 69, -1, 71, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 83, 89, 85, 86, 87, 121, -1, 99, 107, 92, 120, 110, -1, 132, 97, 98, -1, 100, 101, 102, -1, 112, -1, 108, -1, -1, 126, -1, 134, -1, 113, -1, -1, 116, 133, -1, 119, -1, -1, 131, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 136, 148, 138, 171, 140, 141, 155, -1, 163, 145, 146, 157, -1, 152, 154, 151, -1, 153, -1, -1, 156, -1, 158, -1, 179, -1, -1, -1, 164, 177, -1, 167, -1, -1, -1, -1, -1, -1, 174, -1, -1, -1, -1, -1, -1, 181, 192, 183, 184, 185, 186, 187, -1, 189, 190, 191, -1, 203, -1, 204, 196, 197, -1, 199, 212, -1, 220, -1, -1, -1, -1, 216, -1, 218, -1, -1, -1, 213, -1, -1, -1, -1, -1, -1, -1, -1, 222, 242, 224, 225, 226, 227, 265, 257, -1, 231, 232, 258, 273, 235, -1, 237, 238, 239, 252, 267, -1, 243, -1, 254, 246, -1, 261, 249, -1, 251, -1, -1, -1, -1, -1, -1, -1, -1, 260, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 271, -1, -1, 274, -1, -1, 277, 278, 279, 280, 281, 282, 283, 301, -1, 286, 312, 292, 308, -1, 300, -1, 293, -1, 295, -1, -1, 302, 299, -1, -1, -1, -1, -1, -1, 313, -1, -1, 314, -1, -1, -1, -1, -1, -1, 316, 317, 318, 319, 320, -1, 322, 323, -1, 325, 346, 327, 339, -1, 330, -1, -1, 341, 342, -1, -1, 337, 344, -1, -1, -1, -1, 343, -1, -1, -1, -1, -1, -1, -1, 351, 352, 373, 354, 355, 356, 365, 368, -1, 367, 376, -1, 380, 364, -1, 384, -1, -1, -1, 370, -1, 381, -1, 390, 388, -1, 377, -1, 379, -1, -1, -1, -1, -1, -1, 386, -1, -1, -1, -1, -1, 392, 393, 394, 405, 421, 397, 415, 399, -1, 420, -1, 408, 404, -1, 411, 414, -1, 413, -1, -1, -1, -1, -1, -1, 416, -1, -1, -1, -1, -1, 422, 423, -1, -1, -1, 427, 428, 429, 450, 431, 432, 433, -1, 435, 436, 437, -1, 449, 440, -1, 442, 452, 444, -1, 461, -1, 463, -1, -1, 466, -1, 453, -1, -1, 468, -1, -1, 459, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 470, 471, 504, 473, 488, 506, 502, 477, -1, 484, -1, 481, 495, 483, -1, 485, 497, -1, -1, 489, 505, -1, 499, -1, -1, -1, 496, -1, 498, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 509, 510, 511, 512, 513, 528, -1, 523, -1, 530, 540, -1, 536, 522, -1, 524, 545, -1, 527, -1, 543, -1, 531, -1, 533, -1, 535, -1, -1, 538, -1, -1, -1, -1, -1, -1, -1, -1, -1, 548, 549, 565, 563, 552, 553, 554, 555, -1, 557, 586, 575, 573, 581, -1, -1, 564, -1, 578, 567, -1, 569, 570, -1, 588, -1, 593, -1, 576, 594, -1, 579, -1, -1, 595, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 597, 607, 599, 600, 601, 624, 609, 604, -1, 613, -1, 617, -1, 610, -1, 621, -1, 614, 615, 622, -1, -1, 628, -1, -1, -1, 623, -1, -1, -1, -1, -1, -1, -1, -1, 632, 633, 634, 657, 636, 637, 638, 639, -1, 641, 672, 643, -1, 645, 663, 647, -1, 660, 675, 668, -1, 669, -1, -1, 656, -1, -1, -1, -1, 674, 671, -1, -1, -1, 666, -1, -1, -1, -1, -1, -1, -1, -1, -1, 676, -1, -1, 679, 690, 681, 682, -1, 684, 697, 704, 687, 688, 702, -1, 694, 695, 712, -1, -1, 710, -1, -1, 706, -1, -1, -1, 713, -1, 705, -1, 716, -1, -1, -1, 711, -1, -1, -1, -1, -1, -1, 724, 733, 720, 721, 722, 723, -1, 725, 726, 756, 728, 729, 731, -1, 732, -1, 749, 757, 736, 737, 752, -1, -1, 750, -1, 743, -1, 765, -1, 764, -1, -1, -1, -1, -1, 753, -1, -1, -1, -1, -1, -1, 760, -1, -1, -1, -1, -1, -1, 767, 768, 769, 788, 785, -1, 773, 791, 775, -1, 777, 778, -1, 780, 798, -1, 796, 784, -1, 793, 787, -1, 789, -1, -1, 792, -1, -1, 808, -1, 813, -1, 799, -1, 801, -1, 814, -1, 809, -1, -1, -1, -1, -1, 811, -1, -1, -1, -1, -1, -1, 818, 819, 830, 821, 822, 838, 834, 825, -1, 827, 841, 829, -1, 845, -1, -1, -1, 849, -1, 837, -1, 839, -1, -1, 852, -1, 844, -1, -1, 847, -1, -1, -1, -1, -1, -1, -1 };
+static const int RF_WARM_RIGHT[] = { 5, 2, 10, 24, -1, 6, 17, 28, 32, -1, 20, 12, 13, 14, -1, -1, -1, 18, -1, -1, 21, -1, 23, -1, 33, -1, 36, -1, -1, -1, 31, -1, -1, -1, -1, -1, -1, 52, 45, 55, 41, 42, 43, 44, -1, 61, 47, 74, 79, 63, 78, -1, -1, 54, -1, 56, 81, -1, 62, 70, -1, -1, -1, 64, -1, -1, 67, -1, 72, -1, 76, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 95, 84, 105, 125, 123, 88, -1, 90, 91, 114, 93, 94, -1, 96, 115, 103, -1, 130, 129, 118, -1, 104, -1, 106, -1, -1, 109, -1, 111, -1, 127, -1, -1, 128, 117, -1, 124, -1, -1, 122, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 143, 137, 161, 139, 173, 172, 142, -1, 144, 159, 178, 147, -1, 149, 150, 168, -1, 162, -1, -1, 169, -1, 166, -1, 160, -1, -1, -1, 170, 165, -1, 175, -1, -1, -1, -1, -1, -1, 176, -1, -1, -1, -1, -1, -1, 188, 182, 194, 211, 198, 208, 217, -1, 201, 219, 206, -1, 193, -1, 195, 205, 214, -1, 210, 200, -1, 202, -1, -1, -1, -1, 207, -1, 209, -1, -1, -1, 215, -1, -1, -1, -1, -1, -1, -1, -1, 230, 223, 236, 247, 255, 259, 228, 229, -1, 253, 269, 233, 234, 250, -1, 270, 244, 263, 240, 241, -1, 256, -1, 245, 264, -1, 248, 262, -1, 268, -1, -1, -1, -1, -1, -1, -1, -1, 266, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 272, -1, -1, 275, -1, -1, 285, 290, 294, 296, 297, 310, 304, 284, -1, 303, 287, 288, 289, -1, 291, -1, 305, -1, 307, -1, -1, 298, 311, -1, -1, -1, -1, -1, -1, 306, -1, -1, 309, -1, -1, -1, -1, -1, -1, 321, 329, 331, 324, 336, -1, 332, 348, -1, 349, 326, 340, 328, -1, 335, -1, -1, 333, 334, -1, -1, 345, 338, -1, -1, -1, -1, 347, -1, -1, -1, -1, -1, -1, -1, 359, 362, 353, 371, 369, 378, 357, 358, -1, 360, 361, -1, 363, 385, -1, 366, -1, -1, -1, 383, -1, 372, -1, 374, 375, -1, 387, -1, 382, -1, -1, -1, -1, -1, -1, 389, -1, -1, -1, -1, -1, 400, 402, 410, 395, 396, 417, 398, 412, -1, 401, -1, 403, 419, -1, 406, 407, -1, 409, -1, -1, -1, -1, -1, -1, 418, -1, -1, -1, -1, -1, 425, 424, -1, -1, -1, 434, 445, 438, 430, 441, 464, 458, -1, 457, 465, 455, -1, 439, 447, -1, 454, 443, 460, -1, 446, -1, 448, -1, -1, 451, -1, 467, -1, -1, 456, -1, -1, 462, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 478, 480, 472, 494, 474, 475, 476, 500, -1, 479, -1, 487, 482, 491, -1, 493, 486, -1, -1, 501, 490, -1, 492, -1, -1, -1, 507, -1, 503, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 515, 517, 526, 532, 520, 514, -1, 516, -1, 518, 519, -1, 521, 537, -1, 534, 525, -1, 539, -1, 529, -1, 542, -1, 541, -1, 546, -1, -1, 544, -1, -1, -1, -1, -1, -1, -1, -1, -1, 556, 562, 550, 551, 580, 589, 591, 584, -1, 568, 558, 559, 560, 561, -1, -1, 571, -1, 566, 585, -1, 583, 590, -1, 572, -1, 574, -1, 592, 577, -1, 587, -1, -1, 582, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 605, 598, 611, 626, 618, 602, 603, 620, -1, 606, -1, 608, -1, 625, -1, 612, -1, 630, 629, 616, -1, -1, 619, -1, -1, -1, 627, -1, -1, -1, -1, -1, -1, -1, -1, 640, 644, 658, 635, 648, 667, 665, 654, -1, 659, 642, 655, -1, 664, 646, 652, -1, 649, 650, 651, -1, 653, -1, -1, 673, -1, -1, -1, -1, 661, 662, -1, -1, -1, 670, -1, -1, -1, -1, -1, -1, -1, -1, -1, 677, -1, -1, 683, 680, 701, 698, -1, 700, 685, 686, 709, 714, 689, -1, 691, 692, 693, -1, -1, 696, -1, -1, 699, -1, -1, -1, 703, -1, 708, -1, 707, -1, -1, -1, 715, -1, -1, -1, -1, -1, -1, 718, 719, 742, 740, 759, 744, -1, 739, 754, 727, 746, 761, 730, -1, 748, -1, 734, 735, 758, 755, 738, -1, -1, 741, -1, 751, -1, 745, -1, 747, -1, -1, -1, -1, -1, 762, -1, -1, -1, -1, -1, -1, 763, -1, -1, -1, -1, -1, -1, 772, 776, 782, 770, 771, -1, 800, 774, 806, -1, 779, 804, -1, 790, 781, -1, 783, 802, -1, 786, 812, -1, 794, -1, -1, 816, -1, -1, 795, -1, 797, -1, 810, -1, 807, -1, 803, -1, 805, -1, -1, -1, -1, -1, 815, -1, -1, -1, -1, -1, -1, 826, 832, 820, 846, 836, 823, 824, 833, -1, 840, 828, 843, -1, 831, -1, -1, -1, 835, -1, 850, -1, 848, -1, -1, 842, -1, 853, -1, -1, 851, -1, -1, -1, -1, -1, -1, -1 };
+static const float RF_WARM_PROB1[] = { 0, 0, 0, 0, 1.0, 0, 0, 0, 0, 0.0, 0, 0, 0, 0, 0.0, 0.0, 1.0, 0, 0.0, 0.0, 0, 1.0, 0, 1.0, 0, 1.0, 0, 1.0, 1.0, 1.0, 0, 0.0, 1.0, 0.0, 0.0, 1.0, 0.0, 0, 0, 0, 0, 0, 0, 0, 0.0, 0, 0, 0, 0, 0, 0, 0.0, 1.0, 0, 1.0, 0, 0, 1.0, 0, 0, 0.0, 1.0, 1.0, 0, 0.6666666666666666, 0.0, 0, 1.0, 0, 0.0, 0, 1.0, 1.0, 0.0, 1.0, 0.0, 0.0, 1.0, 1.0, 1.0, 0.0, 0.0, 0, 0, 0, 0, 0, 0, 1.0, 0, 0, 0, 0, 0, 1.0, 0, 0, 0, 0.0, 0, 0, 0, 0.0, 0, 0.0, 0, 1.0, 0.0, 0, 0.0, 0, 1.0, 0, 1.0, 0.0, 0, 0, 0.0, 0, 0.0, 0.0, 0, 1.0, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0, 1.0, 1.0, 0.0, 1.0, 1.0, 0.0, 0, 0, 0, 0, 0, 0, 0, 1.0, 0, 0, 0, 0, 0.0, 0, 0, 0, 1.0, 0, 0.0, 0.0, 0, 1.0, 0, 0.0, 0, 1.0, 0.0, 1.0, 0, 0, 1.0, 0, 1.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0, 0.0, 0.0, 1.0, 0.0, 1.0, 0.0, 0, 0, 0, 0, 0, 0, 0, 0.0, 0, 0, 0, 1.0, 0, 1.0, 0, 0, 0, 0.0, 0, 0, 0.0, 0, 0.0, 0.0, 1.0, 0.0, 0, 1.0, 0, 0.0, 1.0, 1.0, 0, 1.0, 1.0, 0.0, 0.0, 1.0, 1.0, 0.0, 1.0, 0, 0, 0, 0, 0, 0, 0, 0, 0.0, 0, 0, 0, 0, 0, 1.0, 0, 0, 0, 0, 0, 0.0, 0, 1.0, 0, 0, 0.0, 0, 0, 0.0, 0, 1.0, 1.0, 0.0, 1.0, 1.0, 0.0, 1.0, 0.0, 0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 0.0, 1.0, 0.0, 0.0, 0, 1.0, 0.0, 0, 0.0, 1.0, 0, 0, 0, 0, 0, 0, 0, 0, 0.030973451327433628, 0, 0, 0, 0, 1.0, 0, 1.0, 0, 1.0, 0, 1.0, 1.0, 0, 0, 1.0, 0.0, 0.6666666666666666, 0.0, 0.0, 1.0, 0, 0.0, 0.0, 0, 0.0, 1.0, 0.0, 0.0, 1.0, 1.0, 0, 0, 0, 0, 0, 0.0, 0, 0, 1.0, 0, 0, 0, 0, 0.015625, 0, 1.0, 1.0, 0, 0, 0.0, 0.0, 0, 0, 1.0, 1.0, 1.0, 1.0, 0, 0.0, 0.0, 0.0, 1.0, 1.0, 0.0, 1.0, 0, 0, 0, 0, 0, 0, 0, 0, 0.0, 0, 0, 1.0, 0, 0, 1.0, 0, 0.12, 0.0, 0.034482758620689655, 0, 1.0, 0, 1.0, 0, 0, 1.0, 0, 1.0, 0, 0.0, 0.0, 0.0, 1.0, 0.0, 1.0, 0, 1.0, 0.0, 0.0, 0.0, 0.0, 0, 0, 0, 0, 0, 0, 0, 0, 0.009345794392523364, 0, 1.0, 0, 0, 1.0, 0, 0, 1.0, 0, 0.0, 1.0, 0.0, 0.6666666666666666, 1.0, 0.0, 0, 0.0, 1.0, 1.0, 0.0, 0.0, 0, 0, 1.0, 0.0, 0.0, 0, 0, 0, 0, 0, 0, 0, 0.0, 0, 0, 0, 1.0, 0, 0, 1.0, 0, 0, 0, 1.0, 0, 1.0, 0, 0.0, 0.0, 0, 1.0, 0, 0.0, 0.0, 0, 1.0, 0.0, 0, 1.0, 0.0, 0.0, 0.0, 1.0, 1.0, 0.0, 0.0, 1.0, 0.0, 0, 0, 0, 0, 0, 0, 0, 0, 0.0, 0, 1.0, 0, 0, 0, 0.0, 0, 0, 1.0, 1.0, 0, 0, 0.0, 0, 1.0, 0.0, 1.0, 0, 1.0, 0, 1.0, 0.0, 0.25, 1.0, 1.0, 0.0, 1.0, 1.0, 1.0, 0.0, 0, 0, 0, 0, 0, 0, 0.0, 0, 1.0, 0, 0, 1.0, 0, 0, 0.0, 0, 0, 0.0, 0, 1.0, 0, 0.0, 0, 0.0, 0, 1.0, 0, 1.0, 1.0, 0, 1.0, 0.0, 0.0, 0.0, 1.0, 1.0, 0.0, 1.0, 0.0, 0, 0, 0, 0, 0, 0, 0, 0, 1.0, 0, 0, 0, 0, 0, 0.0, 1.0, 0, 0.0, 0, 0, 0.0, 0, 0, 1.0, 0, 1.0, 0, 0.0, 0, 0, 0.0, 0, 1.0, 0.0, 0, 0.0, 0.0, 0.8571428571428571, 1.0, 1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 1.0, 1.0, 1.0, 0, 0, 0, 0, 0, 0, 0, 0, 0.0, 0, 1.0, 0, 1.0, 0, 0.06060606060606061, 0, 1.0, 0, 0, 0, 0.0, 0.0, 0, 1.0, 0.16666666666666666, 0.0, 0, 0.0, 1.0, 1.0, 1.0, 1.0, 0.0, 1.0, 1.0, 0, 0, 0, 0, 0, 0, 0, 0, 0.0, 0, 0, 0, 1.0, 0, 0, 0, 1.0, 0, 0, 0, 0.0, 0, 0.0, 0.3333333333333333, 0, 1.0, 1.0, 1.0, 0.0, 0, 0, 1.0, 0.0, 0.0, 0, 0.0, 1.0, 0.5, 1.0, 1.0, 0.0, 0.0, 0.0, 0.0, 0, 1.0, 0.0, 0, 0, 0, 0, 1.0, 0, 0, 0, 0, 0, 0, 0.0, 0, 0, 0, 1.0, 0.0, 0, 0.0, 1.0, 0, 1.0, 1.0, 0.0, 0, 0.0, 0, 0.0, 0, 1.0, 1.0, 1.0, 0, 0.0, 0.0, 1.0, 1.0, 1.0, 0.0, 0, 0, 0, 0, 0, 0, 1.0, 0, 0, 0, 0, 0, 0, 0.0, 0, 0.0, 0, 0, 0, 0, 0, 0.0, 1.0, 0, 1.0, 0, 1.0, 0, 1.0, 0, 0.0, 1.0, 1.0, 0.0, 0.0, 0, 0.0, 1.0, 1.0, 1.0, 1.0, 1.0, 0, 0.0, 1.0, 1.0, 1.0, 1.0, 0.0, 0, 0, 0, 0, 0, 0.0, 0, 0, 0, 1.0, 0, 0, 0.0, 0, 0, 0.0, 0, 0, 1.0, 0, 0, 1.0, 0, 1.0, 0.0, 0, 1.0, 0.0, 0, 0.0, 0, 0.0, 0, 1.0, 0, 0.0, 0, 1.0, 0, 0.0, 0.0, 1.0, 1.0, 1.0, 0, 0.0, 0.0, 1.0, 0.0, 1.0, 0.0, 0, 0, 0, 0, 0, 0, 0, 0, 0.010256410256410256, 0, 0, 0, 1.0, 0, 1.0, 1.0, 0.07142857142857142, 0, 0.0, 0, 0.0, 0, 0.0, 0.0, 0, 0.0, 0, 0.0, 0.0, 0, 1.0, 1.0, 1.0, 1.0, 0.0, 1.0, 1.0 };
+static const int RF_WARM_TREE_ORDER[] = { 0, 12, 3, 16, 7, 11, 4, 18, 14, 13, 19, 1, 10, 2, 15, 9, 5, 17, 8, 6 };
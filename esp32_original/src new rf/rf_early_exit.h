@@ -0,0 +1,95 @@
+#pragma once
+#include <cmath>
+
+// ================= EARLY-EXIT VOTING =================
+// The forest label is (sum of leaf prob1) / n_trees >= 0.5. Once the trees that
+// are still unevaluated can no longer move the sum across n_trees / 2 the label
+// is fixed, so label-only callers can skip them.
+
+#define RF_EXIT_OFF    0   // walk every tree (reference behaviour)
+#define RF_EXIT_EXACT  1   // stop only when the label can no longer flip
+#define RF_EXIT_MARGIN 2   // stop once the running mean is >= margin away from 0.5
+
+struct RfExitConfig {
+    int policy;
+    float margin;     // RF_EXIT_MARGIN: distance from 0.5 needed to stop
+    int min_trees;    // RF_EXIT_MARGIN: never decide on fewer trees than this
+    bool ordered;     // evaluate trees in RF_*TREE_ORDER instead of export order
+};
+
+// rem_min[k] / rem_max[k] = smallest / largest total the trees at positions
+// k..n_trees-1 of the evaluation order can still add (0 at k == n_trees).
+struct RfExitTables {
+    const int* order;  // nullptr = export order
+    float* rem_min;
+    float* rem_max;
+};
+
+// Tree t owns nodes [roots[t], roots[t+1]), the last tree ends at n_nodes.
+void rf_exit_build_tables(int n_trees, int n_nodes, const int* roots,
+                          const int* left, const float* leaf, RfExitTables& tab)
+{
+    tab.rem_min[n_trees] = 0.0f;
+    tab.rem_max[n_trees] = 0.0f;
+    for(int k=n_trees-1; k>=0; k--) {
+        int t = tab.order ? tab.order[k] : k;
+        int end = (t + 1 < n_trees) ? roots[t+1] : n_nodes;
+        float lo = 1.0f, hi = 0.0f;
+        for(int i=roots[t]; i<end; i++) {
+            if(left[i] != -1) continue;
+            if(leaf[i] < lo) lo = leaf[i];
+            if(leaf[i] > hi) hi = leaf[i];
+        }
+        tab.rem_min[k] = tab.rem_min[k+1] + lo;
+        tab.rem_max[k] = tab.rem_max[k+1] + hi;
+    }
+}
+
+// z: scaled features. Returns the label; out_score gets the full average when
+// every tree ran, otherwise the running mean (clamped to the proven side of 0.5
+// for RF_EXIT_EXACT). out_trees gets the number of trees evaluated.
+int rf_vote_early_exit(const float* z, int n_trees, const int* roots,
+                       const int* feat_idx, const float* thresholds,
+                       const int* left, const int* right, const float* leaf,
+                       const RfExitTables& tab, const RfExitConfig& cfg,
+                       float* out_score, int* out_trees)
+{
+    // Slack for float summation order, so EXACT never decides on a tie.
+    const float eps = 1e-4f;
+    const float half = 0.5f * (float)n_trees;
+
+    float sum = 0.0f;
+    int k = 0;
+    while(k < n_trees) {
+        int idx = roots[tab.order ? tab.order[k] : k];
+        while(left[idx] != -1) {
+            if(z[feat_idx[idx]] <= thresholds[idx]) idx = left[idx];
+            else idx = right[idx];
+        }
+        sum += leaf[idx];
+        k++;
+
+        if(cfg.policy == RF_EXIT_EXACT) {
+            if(sum + tab.rem_min[k] >= half + eps) break;
+            if(sum + tab.rem_max[k] < half - eps) break;
+        } else if(cfg.policy == RF_EXIT_MARGIN && k >= cfg.min_trees) {
+            if(fabsf(sum / (float)k - 0.5f) >= cfg.margin) break;
+        }
+    }
+
+    float score;
+    if(k == n_trees) {
+        score = sum / (float)n_trees;
+    } else {
+        score = sum / (float)k;
+        if(cfg.policy == RF_EXIT_EXACT) {
+            float lo = (sum + tab.rem_min[k]) / (float)n_trees;
+            float hi = (sum + tab.rem_max[k]) / (float)n_trees;
+            if(score < lo) score = lo;
+            if(score > hi) score = hi;
+        }
+    }
+    if(out_score) *out_score = score;
+    if(out_trees) *out_trees = k;
+    return (score >= 0.5f) ? 1 : 0;
+}
@@ -0,0 +1,104 @@
+#pragma once
+#include <stdint.h>
+#include <cmath>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// ================= PADDED (OBLIVIOUS) FORESTS =================
+// Trees re-exported as perfect binary trees of a fixed depth (host/pad_forest.cpp
+// writes model_edge_padded.h). Internal node i of a tree has children 2i+1 and
+// 2i+2, so one step is i = 2i + 1 + !(x <= t) with no branch; a leaf shallower
+// than the depth is padded with pass-through nodes (threshold +inf) and its
+// value is copied into every padded leaf below it. Trees deeper than the cap
+// stay in the sparse arrays and are walked as usual.
+//
+// Per padded tree: (2^depth - 1) feature bytes + thresholds, then 2^depth leaves.
+// The feature array carries 3 slack bytes so 32-bit gathers can read it.
+
+struct RfPaddedForest {
+    int depth;
+    int n_padded;            // trees in the padded arrays
+    const int* padded_tree;  // original index of each padded tree
+    const uint8_t* feature;  // n_padded * (2^depth - 1)
+    const float* threshold;  // n_padded * (2^depth - 1)
+    const float* leaf;       // n_padded * 2^depth
+    int n_rest;              // trees deeper than the cap
+    const int* rest_tree;    // original index of each of them
+};
+
+// One tree at a time.
+void rf_padded_walk_scalar(const RfPaddedForest& pf, const float* z, int first, int count, float* tree_prob) {
+    const int n_int = (1 << pf.depth) - 1;
+    for(int k=first; k<first+count; k++) {
+        const uint8_t* feat = pf.feature + (size_t)k * n_int;
+        const float* thr = pf.threshold + (size_t)k * n_int;
+        int i = 0;
+        for(int d=0; d<pf.depth; d++) i = 2 * i + 1 + !(z[feat[i]] <= thr[i]);
+        tree_prob[pf.padded_tree[k]] = pf.leaf[(size_t)k * (n_int + 1) + (i - n_int)];
+    }
+}
+
+// Four trees in lockstep. The ESP32-S3 vector unit has no gather, so the four
+// lanes are independent scalar chains the core can overlap.
+void rf_padded_walk4(const RfPaddedForest& pf, const float* z, int first, int count, float* tree_prob) {
+    const int n_int = (1 << pf.depth) - 1;
+    int k = first;
+    for(; k + 4 <= first + count; k += 4) {
+        const uint8_t* f0 = pf.feature + (size_t)k * n_int;
+        const uint8_t* f1 = f0 + n_int; const uint8_t* f2 = f1 + n_int; const uint8_t* f3 = f2 + n_int;
+        const float* t0 = pf.threshold + (size_t)k * n_int;
+        const float* t1 = t0 + n_int; const float* t2 = t1 + n_int; const float* t3 = t2 + n_int;
+        int i0 = 0, i1 = 0, i2 = 0, i3 = 0;
+        for(int d=0; d<pf.depth; d++) {
+            i0 = 2 * i0 + 1 + !(z[f0[i0]] <= t0[i0]);
+            i1 = 2 * i1 + 1 + !(z[f1[i1]] <= t1[i1]);
+            i2 = 2 * i2 + 1 + !(z[f2[i2]] <= t2[i2]);
+            i3 = 2 * i3 + 1 + !(z[f3[i3]] <= t3[i3]);
+        }
+        const float* leaf = pf.leaf + (size_t)k * (n_int + 1) - n_int;
+        tree_prob[pf.padded_tree[k]]     = leaf[i0];
+        tree_prob[pf.padded_tree[k + 1]] = leaf[(n_int + 1) + i1];
+        tree_prob[pf.padded_tree[k + 2]] = leaf[2 * (n_int + 1) + i2];
+        tree_prob[pf.padded_tree[k + 3]] = leaf[3 * (n_int + 1) + i3];
+    }
+    rf_padded_walk_scalar(pf, z, k, first + count - k, tree_prob);
+}
+
+#if defined(__AVX2__)
+// Eight trees per __m256i, all nodes and features fetched with gathers.
+void rf_padded_walk_avx2(const RfPaddedForest& pf, const float* z, int first, int count, float* tree_prob) {
+    const int n_int = (1 << pf.depth) - 1;
+    const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i byte_mask = _mm256_set1_epi32(0xFF);
+    int k = first;
+    for(; k + 8 <= first + count; k += 8) {
+        __m256i base = _mm256_mullo_epi32(_mm256_add_epi32(_mm256_set1_epi32(k), lane), _mm256_set1_epi32(n_int));
+        __m256i i = _mm256_setzero_si256();
+        for(int d=0; d<pf.depth; d++) {
+            __m256i node = _mm256_add_epi32(base, i);
+            __m256i f = _mm256_and_si256(_mm256_i32gather_epi32((const int*)pf.feature, node, 1), byte_mask);
+            __m256 t = _mm256_i32gather_ps(pf.threshold, node, 4);
+            __m256 x = _mm256_i32gather_ps(z, f, 4);
+            // right = !(x <= t): 0 or -1 per lane, subtracted to add 1
+            __m256i right = _mm256_castps_si256(_mm256_cmp_ps(x, t, _CMP_NLE_UQ));
+            i = _mm256_sub_epi32(_mm256_add_epi32(_mm256_add_epi32(i, i), one), right);
+        }
+        __m256i leaf_base = _mm256_mullo_epi32(_mm256_add_epi32(_mm256_set1_epi32(k), lane), _mm256_set1_epi32(n_int + 1));
+        __m256i leaf_idx = _mm256_sub_epi32(_mm256_add_epi32(leaf_base, i), _mm256_set1_epi32(n_int));
+        float out[8];
+        _mm256_storeu_ps(out, _mm256_i32gather_ps(pf.leaf, leaf_idx, 4));
+        for(int l=0; l<8; l++) tree_prob[pf.padded_tree[k + l]] = out[l];
+    }
+    rf_padded_walk4(pf, z, k, first + count - k, tree_prob);
+}
+#endif
+
+// The 4-lane kernel is the default: on the host the AVX2 gathers measured no
+// faster than the scalar walk (host/bench_rf_padded.cpp), so they are opt-in.
+#if defined(__AVX2__) && defined(RF_PADDED_AVX2)
+#define rf_padded_walk rf_padded_walk_avx2
+#else
+#define rf_padded_walk rf_padded_walk4
+#endif
@@ -0,0 +1,111 @@
+#pragma once
+#include "rfe_settings.h"
+#include "model_edge_dual.h"
+// Generated by host/used_features.cpp from model_edge_dual.h: features no split
+// reads are dropped, node feature indices point into the reduced vectors.
+
+// ===== RF_COLD: 10 of 10 features =====
+#define RF_COLD_N_USED RF_COLD_N_FEATURES
+#define RF_COLD_USED_SPECS FEATURE_SPECS_COLD
+#define RF_COLD_USED_SCALE_MEAN RF_COLD_SCALE_MEAN
+#define RF_COLD_USED_SCALE_STD RF_COLD_SCALE_STD
+#define RF_COLD_USED_FEATURE RF_COLD_FEATURE
+
+// ===== RF_WARM: 91 of 94 features =====
+#define RF_WARM_N_USED 91
+static const FeatureSpec RF_WARM_USED_SPECS[] = {
+  { FEAT_RAW, -1, 0, 0, 0, -1 }, // FEATURE_SPECS_WARM[0]
+  { FEAT_RAW, -1, 0, 0, 1, -1 }, // FEATURE_SPECS_WARM[1]
+  { FEAT_RAW, -1, 0, 0, 2, -1 }, // FEATURE_SPECS_WARM[2]
+  { FEAT_RAW, -1, 0, 0, 3, -1 }, // FEATURE_SPECS_WARM[3]
+  { FEAT_DIFF, -1, 0, 0, 0, -1 }, // FEATURE_SPECS_WARM[4]
+  { FEAT_DIFF, -1, 0, 0, 1, -1 }, // FEATURE_SPECS_WARM[5]
+  { FEAT_DIFF, -1, 0, 0, 2, -1 }, // FEATURE_SPECS_WARM[6]
+  { FEAT_DIFF, -1, 0, 0, 3, -1 }, // FEATURE_SPECS_WARM[7]
+  { FEAT_ROLL_RAW, 0, 5, 0, 0, -1 }, // FEATURE_SPECS_WARM[8]
+  { FEAT_ROLL_RAW, 1, 5, 0, 0, -1 }, // FEATURE_SPECS_WARM[9]
+  { FEAT_ROLL_RAW, 2, 5, 0, 0, -1 }, // FEATURE_SPECS_WARM[10]
+  { FEAT_ROLL_RAW, 3, 5, 0, 0, -1 }, // FEATURE_SPECS_WARM[11]
+  { FEAT_ROLL_RAW, 4, 5, 0, 0, -1 }, // FEATURE_SPECS_WARM[12]
+  { FEAT_ROLL_RAW, 5, 5, 0, 0, -1 }, // FEATURE_SPECS_WARM[13]
+  { FEAT_ROLL_RAW, 0, 5, 0, 1, -1 }, // FEATURE_SPECS_WARM[14]
+  { FEAT_ROLL_RAW, 1, 5, 0, 1, -1 }, // FEATURE_SPECS_WARM[15]
+  { FEAT_ROLL_RAW, 2, 5, 0, 1, -1 }, // FEATURE_SPECS_WARM[16]
+  { FEAT_ROLL_RAW, 3, 5, 0, 1, -1 }, // FEATURE_SPECS_WARM[17]
+  { FEAT_ROLL_RAW, 4, 5, 0, 1, -1 }, // FEATURE_SPECS_WARM[18]
+  { FEAT_ROLL_RAW, 5, 5, 0, 1, -1 }, // FEATURE_SPECS_WARM[19]
+  { FEAT_ROLL_RAW, 0, 5, 0, 2, -1 }, // FEATURE_SPECS_WARM[20]
+  { FEAT_ROLL_RAW, 1, 5, 0, 2, -1 }, // FEATURE_SPECS_WARM[21]
+  { FEAT_ROLL_RAW, 2, 5, 0, 2, -1 }, // FEATURE_SPECS_WARM[22]
+  { FEAT_ROLL_RAW, 3, 5, 0, 2, -1 }, // FEATURE_SPECS_WARM[23]
+  { FEAT_ROLL_RAW, 4, 5, 0, 2, -1 }, // FEATURE_SPECS_WARM[24]
+  { FEAT_ROLL_RAW, 5, 5, 0, 2, -1 }, // FEATURE_SPECS_WARM[25]
+  { FEAT_ROLL_RAW, 0, 5, 0, 3, -1 }, // FEATURE_SPECS_WARM[26]
+  { FEAT_ROLL_RAW, 1, 5, 0, 3, -1 }, // FEATURE_SPECS_WARM[27]
+  { FEAT_ROLL_RAW, 2, 5, 0, 3, -1 }, // FEATURE_SPECS_WARM[28]
+  { FEAT_ROLL_RAW, 3, 5, 0, 3, -1 }, // FEATURE_SPECS_WARM[29]
+  { FEAT_ROLL_RAW, 4, 5, 0, 3, -1 }, // FEATURE_SPECS_WARM[30]
+  { FEAT_ROLL_RAW, 5, 5, 0, 3, -1 }, // FEATURE_SPECS_WARM[31]
+  { FEAT_ROLL_RAW, 0, 15, 0, 0, -1 }, // FEATURE_SPECS_WARM[32]
+  { FEAT_ROLL_RAW, 1, 15, 0, 0, -1 }, // FEATURE_SPECS_WARM[33]
+  { FEAT_ROLL_RAW, 2, 15, 0, 0, -1 }, // FEATURE_SPECS_WARM[34]
+  { FEAT_ROLL_RAW, 3, 15, 0, 0, -1 }, // FEATURE_SPECS_WARM[35]
+  { FEAT_ROLL_RAW, 4, 15, 0, 0, -1 }, // FEATURE_SPECS_WARM[36]
+  { FEAT_ROLL_RAW, 5, 15, 0, 0, -1 }, // FEATURE_SPECS_WARM[37]
+  { FEAT_ROLL_RAW, 0, 15, 0, 1, -1 }, // FEATURE_SPECS_WARM[38]
+  { FEAT_ROLL_RAW, 1, 15, 0, 1, -1 }, // FEATURE_SPECS_WARM[39]
+  { FEAT_ROLL_RAW, 2, 15, 0, 1, -1 }, // FEATURE_SPECS_WARM[40]
+  { FEAT_ROLL_RAW, 3, 15, 0, 1, -1 }, // FEATURE_SPECS_WARM[41]
+  { FEAT_ROLL_RAW, 4, 15, 0, 1, -1 }, // FEATURE_SPECS_WARM[42]
+  { FEAT_ROLL_RAW, 5, 15, 0, 1, -1 }, // FEATURE_SPECS_WARM[43]
+  { FEAT_ROLL_RAW, 0, 15, 0, 2, -1 }, // FEATURE_SPECS_WARM[44]
+  { FEAT_ROLL_RAW, 1, 15, 0, 2, -1 }, // FEATURE_SPECS_WARM[45]
+  { FEAT_ROLL_RAW, 2, 15, 0, 2, -1 }, // FEATURE_SPECS_WARM[46]
+  { FEAT_ROLL_RAW, 3, 15, 0, 2, -1 }, // FEATURE_SPECS_WARM[47]
+  { FEAT_ROLL_RAW, 4, 15, 0, 2, -1 }, // FEATURE_SPECS_WARM[48]
+  { FEAT_ROLL_RAW, 5, 15, 0, 2, -1 }, // FEATURE_SPECS_WARM[49]
+  { FEAT_ROLL_RAW, 0, 15, 0, 3, -1 }, // FEATURE_SPECS_WARM[50]
+  { FEAT_ROLL_RAW, 1, 15, 0, 3, -1 }, // FEATURE_SPECS_WARM[51]
+  { FEAT_ROLL_RAW, 2, 15, 0, 3, -1 }, // FEATURE_SPECS_WARM[52]
+  { FEAT_ROLL_RAW, 3, 15, 0, 3, -1 }, // FEATURE_SPECS_WARM[53]
+  { FEAT_ROLL_RAW, 4, 15, 0, 3, -1 }, // FEATURE_SPECS_WARM[54]
+  { FEAT_ROLL_RAW, 5, 15, 0, 3, -1 }, // FEATURE_SPECS_WARM[55]
+  { FEAT_ROLL_DIFF, 0, 5, 0, 0, -1 }, // FEATURE_SPECS_WARM[56]
+  { FEAT_ROLL_DIFF, 2, 5, 0, 0, -1 }, // FEATURE_SPECS_WARM[57]
+  { FEAT_ROLL_DIFF, 0, 5, 0, 1, -1 }, // FEATURE_SPECS_WARM[58]
+  { FEAT_ROLL_DIFF, 2, 5, 0, 1, -1 }, // FEATURE_SPECS_WARM[59]
+  { FEAT_ROLL_DIFF, 0, 5, 0, 2, -1 }, // FEATURE_SPECS_WARM[60]
+  { FEAT_ROLL_DIFF, 2, 5, 0, 2, -1 }, // FEATURE_SPECS_WARM[61]
+  { FEAT_ROLL_DIFF, 0, 5, 0, 3, -1 }, // FEATURE_SPECS_WARM[62]
+  { FEAT_ROLL_DIFF, 2, 5, 0, 3, -1 }, // FEATURE_SPECS_WARM[63]
+  { FEAT_ROLL_DIFF, 0, 15, 0, 0, -1 }, // FEATURE_SPECS_WARM[64]
+  { FEAT_ROLL_DIFF, 2, 15, 0, 0, -1 }, // FEATURE_SPECS_WARM[65]
+  { FEAT_ROLL_DIFF, 0, 15, 0, 1, -1 }, // FEATURE_SPECS_WARM[66]
+  { FEAT_ROLL_DIFF, 2, 15, 0, 1, -1 }, // FEATURE_SPECS_WARM[67]
+  { FEAT_ROLL_DIFF, 0, 15, 0, 2, -1 }, // FEATURE_SPECS_WARM[68]
+  { FEAT_ROLL_DIFF, 2, 15, 0, 2, -1 }, // FEATURE_SPECS_WARM[69]
+  { FEAT_ROLL_DIFF, 0, 15, 0, 3, -1 }, // FEATURE_SPECS_WARM[70]
+  { FEAT_LAG, -1, 0, 1, 0, -1 }, // FEATURE_SPECS_WARM[72]
+  { FEAT_LAG, -1, 0, 1, 1, -1 }, // FEATURE_SPECS_WARM[73]
+  { FEAT_LAG, -1, 0, 1, 2, -1 }, // FEATURE_SPECS_WARM[74]
+  { FEAT_LAG, -1, 0, 1, 3, -1 }, // FEATURE_SPECS_WARM[75]
+  { FEAT_LAG, -1, 0, 2, 0, -1 }, // FEATURE_SPECS_WARM[76]
+  { FEAT_LAG, -1, 0, 2, 1, -1 }, // FEATURE_SPECS_WARM[77]
+  { FEAT_LAG, -1, 0, 2, 2, -1 }, // FEATURE_SPECS_WARM[78]
+  { FEAT_LAG, -1, 0, 3, 0, -1 }, // FEATURE_SPECS_WARM[80]
+  { FEAT_LAG, -1, 0, 3, 1, -1 }, // FEATURE_SPECS_WARM[81]
+  { FEAT_LAG, -1, 0, 3, 2, -1 }, // FEATURE_SPECS_WARM[82]
+  { FEAT_EWMA, -1, 5, 0, 0, -1 }, // FEATURE_SPECS_WARM[84]
+  { FEAT_EWMA, -1, 5, 0, 1, -1 }, // FEATURE_SPECS_WARM[85]
+  { FEAT_EWMA, -1, 5, 0, 2, -1 }, // FEATURE_SPECS_WARM[86]
+  { FEAT_EWMA, -1, 5, 0, 3, -1 }, // FEATURE_SPECS_WARM[87]
+  { FEAT_INTER, -1, 0, 0, 0, 1 }, // FEATURE_SPECS_WARM[88]
+  { FEAT_INTER, -1, 0, 0, 0, 2 }, // FEATURE_SPECS_WARM[89]
+  { FEAT_INTER, -1, 0, 0, 0, 3 }, // FEATURE_SPECS_WARM[90]
+  { FEAT_INTER, -1, 0, 0, 1, 2 }, // FEATURE_SPECS_WARM[91]
+  { FEAT_INTER, -1, 0, 0, 1, 3 }, // FEATURE_SPECS_WARM[92]
+  { FEAT_INTER, -1, 0, 0, 2, 3 }, // FEATURE_SPECS_WARM[93]
+};
+static const float RF_WARM_USED_SCALE_MEAN[] = { 40.0228844, 40.1430359, 22.0237579, 61.8684196, -0.0913299993, -0.189723998, 0.0110010002, -0.0704139993, 40.0830231, 40.0238152, 3.37371397, 28.8768368, 36.0935936, 44.1144409, 40.5603561, 40.4537163, 3.34465098, 25.7692146, 36.6243095, 44.6853981, 22.0020428, 22.0178394, 0.984007001, 1.47802603, 20.8361855, 23.1592827, 62.0473099, 61.7856712, 4.20906115, 26.223135, 57.2260056, 67.0794525, 40.2687035, 40.1321526, 7.47900677, 98.1229477, 29.6225471, 51.2555542, 41.4578896, 41.0959549, 7.13045883, 87.2579575, 31.0805149, 52.723774, 22.0039387, 21.8993111, 2.26984501, 7.14606619, 18.6930542, 25.5883751, 62.1243248, 62.3350677, 8.84485531, 103.427757, 48.6346169, 75.1096268, 0.00189399999, 2.41941094, -0.221146002, 2.78843999, 0.0144840004, 0.775359988, -0.0774839967, 3.78437304, -0.0267629996, 3.17328095, -0.149345994, 3.44693804, -0.00787399989, 0.884647012, 0.00607000012, 40.114212, 40.3327599, 22.0127563, 61.9644737, 40.1203117, 40.5479317, 22.0019665, 40.0741196, 40.7661552, 21.9907436, 40.0862923, 40.5520592, 22.0047455, 62.0222893, 1260.89392, 849.784973, 2638.40039, 857.365601, 2634.47852, 1214.43176 };
+static const float RF_WARM_USED_SCALE_STD[] = { 22.6350288, 24.6597519, 6.63740778, 24.8280087, 4.48948002, 4.46308088, 1.03338003, 4.60847902, 22.0900478, 22.3996162, 4.17043781, 69.5443039, 20.6213112, 23.9906483, 24.2985668, 24.5909634, 3.80251098, 53.0466461, 23.8726768, 25.0371437, 6.58600616, 6.63843822, 0.710268974, 2.27827907, 6.3329072, 6.89393902, 24.5246658, 24.6998405, 2.901788, 39.9479179, 24.1335163, 24.9367981, 20.3509541, 21.8164406, 6.48261595, 152.093109, 16.1592026, 24.2100239, 23.1886234, 24.6103725, 6.03328609, 133.918289, 20.8418674, 24.8705196, 6.1543088, 6.42080402, 1.411129, 8.98009014, 5.20197296, 7.035254, 22.9362679, 24.2341385, 5.01597595, 122.317169, 21.5762386, 23.6463318, 2.73036909, 3.30858994, 2.52423811, 3.22680211, 0.646898985, 0.53153199, 2.52793598, 2.25873494, 1.59862602, 2.98085999, 1.51731002, 2.70239902, 0.497886986, 0.394434005, 1.819929, 22.6702271, 24.6966896, 6.65095615, 24.8625164, 22.6443119, 24.7138081, 6.67581892, 22.5218906, 24.7430801, 6.70032787, 21.7063618, 23.9966793, 6.47638178, 24.1227512, 404.556793, 468.549225, 2168.88257, 498.829254, 2358.17456, 283.932312 };
+static const int RF_WARM_USED_FEATURE[] = { 33, 43, 80, 48, -2, 31, 50, 75, 21, -2, 34, 1, 85, 2, -2, -2, -2, 83, -2, -2, 33, -2, 32, -2, 64, -2, 6, -2, -2, -2, 64, -2, -2, -2, -2, -2, -2, 89, 84, 89, 42, 36, 77, 65, -2, 17, 49, 78, 38, 54, 81, -2, -2, 42, -2, 7, 7, -2, 52, 21, -2, -2, -2, 88, -2, -2, 59, -2, 65, -2, 79, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 87, 76, 66, 10, 83, 72, -2, 9, 68, 13, 12, 37, -2, 53, 61, 57, -2, 66, 64, 71, -2, 49, -2, 89, -2, -2, 10, -2, 51, -2, 25, -2, -2, 85, 58, -2, 74, -2, -2, 82, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 32, 72, 83, 1, 2, 80, 63, -2, 44, 77, 81, 23, -2, 60, 9, 69, -2, 37, -2, -2, 28, -2, 40, -2, 69, -2, -2, -2, 63, 47, -2, 75, -2, -2, -2, -2, -2, -2, 55, -2, -2, -2, -2, -2, -2, 14, 89, 68, 58, 50, 14, 2, -2, 25, 13, 25, -2, 64, -2, 79, 44, 39, -2, 55, 45, -2, 82, -2, -2, -2, -2, 44, -2, 18, -2, -2, -2, 68, -2, -2, -2, -2, -2, -2, -2, -2, 14, 3, 67, 54, 83, 15, 44, 89, -2, 24, 23, 3, 5, 21, -2, 5, 84, 59, 66, 47, -2, 15, -2, 86, 85, -2, 79, 28, -2, 23, -2, -2, -2, -2, -2, -2, -2, -2, 88, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 66, -2, -2, 8, -2, -2, 1, 47, 73, 41, 84, 63, 75, 24, -2, 25, 90, 26, 88, -2, 19, -2, 31, -2, 17, -2, -2, 54, 56, -2, -2, -2, -2, -2, -2, 56, -2, -2, 4, -2, -2, -2, -2, -2, -2, 82, 39, 20, 40, 50, -2, 2, 23, -2, 5, 83, 0, 70, -2, 49, -2, -2, 13, 36, -2, -2, 48, 16, -2, -2, -2, -2, 3, -2, -2, -2, -2, -2, -2, -2, 39, 83, 45, 67, 88, 71, 69, 77, -2, 51, 19, -2, 8, 63, -2, 47, -2, -2, -2, 59, -2, 26, -2, 4, 58, -2, 72, -2, 34, -2, -2, -2, -2, -2, -2, 57, -2, -2, -2, -2, -2, 42, 14, 43, 30, 7, 78, 44, 15, -2, 55, -2, 33, 11, -2, 71, 32, -2, 33, -2, -2, -2, -2, -2, -2, 49, -2, -2, -2, -2, -2, 34, 90, -2, -2, -2, 72, 2, 60, 49, 16, 43, 54, -2, 2, 20, 20, -2, 87, 66, -2, 87, 13, 10, -2, 27, -2, 73, -2, -2, 65, -2, 36, -2, -2, 44, -2, -2, 75, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 15, 88, 49, 39, 23, 31, 66, 12, -2, 30, -2, 86, 38, 16, -2, 56, 63, -2, -2, 85, 44, -2, 12, -2, -2, -2, 87, -2, 71, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 39, 20, 14, 67, 85, 22, -2, 84, -2, 8, 36, -2, 39, 63, -2, 52, 75, -2, 59, -2, 56, -2, 34, -2, 15, -2, 69, -2, -2, 33, -2, -2, -2, -2, -2, -2, -2, -2, -2, 75, 19, 33, 38, 45, 69, 12, 56, -2, 86, 27, 80, 69, 52, -2, -2, 73, -2, 27, 52, -2, 56, 74, -2, 34, -2, 49, -2, 59, 83, -2, 44, -2, -2, 87, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 39, 3, 72, 9, 88, 66, 83, 41, -2, 54, -2, 32, -2, 23, -2, 58, -2, 6, 30, 26, -2, -2, 48, -2, -2, -2, 87, -2, -2, -2, -2, -2, -2, -2, -2, 18, 68, 16, 84, 51, 67, 81, 39, -2, 73, 14, 2, -2, 17, 86, 42, -2, 83, 5, 79, -2, 36, -2, -2, 75, -2, -2, -2, -2, 5, 88, -2, -2, -2, 59, -2, -2, -2, -2, -2, -2, -2, -2, -2, 89, -2, -2, 33, 76, 80, 24, -2, 48, 30, 44, 78, 52, 63, -2, 60, 71, 23, -2, -2, 22, -2, -2, 43, -2, -2, -2, 83, -2, 85, -2, 7, -2, -2, -2, 7, -2, -2, -2, -2, -2, -2, 38, 30, 57, 44, 21, 13, -2, 83, 76, 49, 88, 63, 79, -2, 82, -2, 8, 82, 32, 52, 33, -2, -2, 14, -2, 85, -2, 6, -2, 4, -2, -2, -2, -2, -2, 77, -2, -2, -2, -2, -2, -2, 35, -2, -2, -2, -2, -2, -2, 82, 32, 58, 89, 37, -2, 45, 14, 73, -2, 43, 74, -2, 59, 46, -2, 71, 38, -2, 27, 25, -2, 61, -2, -2, 72, -2, -2, 84, -2, 62, -2, 72, -2, 23, -2, 40, -2, 13, -2, -2, -2, -2, -2, 88, -2, -2, -2, -2, -2, -2, 72, 40, 74, 13, 58, 45, 29, 86, -2, 73, 88, 25, -2, 8, -2, -2, -2, 17, -2, 64, -2, 85, -2, -2, 2, -2, 24, -2, -2, 65, -2, -2, -2, -2, -2, -2, -2 };
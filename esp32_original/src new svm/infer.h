@@ -2,12 +2,17 @@
 #include <cmath>
 #include <vector>
 #include "model_edge_dual.h" 
+#include "model_edge_dual_q.h"
+#include "linear_q.h"
+#include "score_mode.h"
+#include "linear_simd.h"
 
 int predict_svm_generic(const float* features, float* out_score,
                        const int n_features,
                        const float* scale_mean, const float* scale_std,
                        const float* coef, const float bias,
-                       const float probA, const float probB) 
+                       const float probA, const float probB,
+                       int mode = SCORE_MODE_EXACT) 
 {
     float decision = 0.0f;
     for(int i=0; i<n_features; i++) {
@@ -17,23 +22,143 @@ int predict_svm_generic(const float* features, float* out_score,
         decision += val_norm * coef[i];
     }
     decision += bias;
-    float prob = 1.0f / (1.0f + expf(probA * decision + probB));
-    if(out_score) *out_score = prob;
-    return (prob >= 0.5f) ? 1 : 0;
+    return platt_label_score(decision, probA, probB, mode, out_score);
 }
 
-int predict_cold(const float* features, float* out_score) {
+int predict_cold(const float* features, float* out_score, int mode) {
     return predict_svm_generic(features, out_score, 
         SVM_COLD_N_FEATURES, 
         SVM_COLD_SCALE_MEAN, SVM_COLD_SCALE_STD,
         SVM_COLD_COEF, SVM_COLD_BIAS,
-        SVM_COLD_PROB_A, SVM_COLD_PROB_B);
+        SVM_COLD_PROB_A, SVM_COLD_PROB_B, mode);
 }
 
-int predict_warm(const float* features, float* out_score) {
+int predict_cold(const float* features, float* out_score) {
+    return predict_cold(features, out_score, SCORE_MODE_EXACT);
+}
+
+int predict_warm(const float* features, float* out_score, int mode) {
     return predict_svm_generic(features, out_score, 
         SVM_WARM_N_FEATURES, 
         SVM_WARM_SCALE_MEAN, SVM_WARM_SCALE_STD,
         SVM_WARM_COEF, SVM_WARM_BIAS,
-        SVM_WARM_PROB_A, SVM_WARM_PROB_B);
-}
\ No newline at end of file
+        SVM_WARM_PROB_A, SVM_WARM_PROB_B, mode);
+}
+
+int predict_warm(const float* features, float* out_score) {
+    return predict_warm(features, out_score, SCORE_MODE_EXACT);
+}
+
+// ================= SCORE MODE =================
+// How main.cpp fills the Score column (score_mode.h): SCORE_MODE_EXACT as
+// before, SCORE_MODE_FAST for the polynomial exp, SCORE_MODE_LABEL to leave
+// it empty and skip the exp. The Label column does not depend on it.
+#ifndef SCORE_MODE
+#define SCORE_MODE SCORE_MODE_EXACT
+#endif
+
+// ================= FIXED-POINT PATH =================
+// LINEAR_Q = 16 or 8 makes main.cpp use the int16 / int8 kernels of
+// linear_q.h (parameters in model_edge_dual_q.h); 0 keeps the float path.
+#ifndef LINEAR_Q
+#define LINEAR_Q 0
+#endif
+
+static const LinearQ<int16_t> SVM_COLD_Q16 = { SVM_COLD_N_FEATURES, SVM_COLD_Q_SHIFT, SVM_COLD_Q_MEAN, SVM_COLD_Q16_COEF,
+    SVM_COLD_Q16_ACC_FRAC, SVM_COLD_Q16_THRESHOLD, SVM_COLD_Q_POLARITY, SVM_COLD_Q_SCORE_MUL };
+static const LinearQ<int8_t> SVM_COLD_Q8 = { SVM_COLD_N_FEATURES, SVM_COLD_Q_SHIFT, SVM_COLD_Q_MEAN, SVM_COLD_Q8_COEF,
+    SVM_COLD_Q8_ACC_FRAC, SVM_COLD_Q8_THRESHOLD, SVM_COLD_Q_POLARITY, SVM_COLD_Q_SCORE_MUL };
+
+int predict_cold_q16(const float* features, float* out_score) {
+    return predict_linear_q(features, SVM_COLD_Q16, out_score);
+}
+
+int predict_cold_q8(const float* features, float* out_score) {
+    return predict_linear_q(features, SVM_COLD_Q8, out_score);
+}
+
+static const LinearQ<int16_t> SVM_WARM_Q16 = { SVM_WARM_N_FEATURES, SVM_WARM_Q_SHIFT, SVM_WARM_Q_MEAN, SVM_WARM_Q16_COEF,
+    SVM_WARM_Q16_ACC_FRAC, SVM_WARM_Q16_THRESHOLD, SVM_WARM_Q_POLARITY, SVM_WARM_Q_SCORE_MUL };
+static const LinearQ<int8_t> SVM_WARM_Q8 = { SVM_WARM_N_FEATURES, SVM_WARM_Q_SHIFT, SVM_WARM_Q_MEAN, SVM_WARM_Q8_COEF,
+    SVM_WARM_Q8_ACC_FRAC, SVM_WARM_Q8_THRESHOLD, SVM_WARM_Q_POLARITY, SVM_WARM_Q_SCORE_MUL };
+
+int predict_warm_q16(const float* features, float* out_score) {
+    return predict_linear_q(features, SVM_WARM_Q16, out_score);
+}
+
+int predict_warm_q8(const float* features, float* out_score) {
+    return predict_linear_q(features, SVM_WARM_Q8, out_score);
+}
+
+// ================= VECTORISED PATH =================
+// LINEAR_SIMD = 1 makes main.cpp score through linear_simd.h (coef / std
+// folded, widest kernel the target has). The batch form is for replay and
+// gateway use, where many rows meet the same model.
+#ifndef LINEAR_SIMD
+#define LINEAR_SIMD 0
+#endif
+
+int predict_svm_simd_generic(const LinearSimd& m, const float* features, float* out_score,
+                             const float probA, const float probB, int mode = SCORE_MODE_EXACT)
+{
+    return platt_label_score(linear_simd_dot(m, features), probA, probB, mode, out_score);
+}
+
+// labels / scores may be null.
+void predict_svm_simd_batch(const LinearSimd& m, const float* features, int n_rows, int stride,
+                            const float probA, const float probB, int* labels, float* scores)
+{
+    const int block = 64;
+    float decision[block];
+    for(int r=0; r<n_rows; r+=block) {
+        int n = (n_rows - r < block) ? n_rows - r : block;
+        linear_simd_batch(m, features + (size_t)r * stride, n, stride, decision);
+        for(int j=0; j<n; j++) {
+            float prob = 1.0f / (1.0f + expf(probA * decision[j] + probB));
+            if(scores) scores[r + j] = prob;
+            if(labels) labels[r + j] = (prob >= 0.5f) ? 1 : 0;
+        }
+    }
+}
+
+// Folded on first use.
+const LinearSimd& cold_simd() {
+    static LinearSimd m;
+    static bool ready = false;
+    if(!ready) {
+        linear_simd_init(m, SVM_COLD_N_FEATURES, SVM_COLD_SCALE_MEAN, SVM_COLD_SCALE_STD, SVM_COLD_COEF, SVM_COLD_BIAS);
+        ready = true;
+    }
+    return m;
+}
+
+// Folded on first use.
+const LinearSimd& warm_simd() {
+    static LinearSimd m;
+    static bool ready = false;
+    if(!ready) {
+        linear_simd_init(m, SVM_WARM_N_FEATURES, SVM_WARM_SCALE_MEAN, SVM_WARM_SCALE_STD, SVM_WARM_COEF, SVM_WARM_BIAS);
+        ready = true;
+    }
+    return m;
+}
+
+int predict_cold_simd(const float* features, float* out_score, int mode) {
+    return predict_svm_simd_generic(cold_simd(), features, out_score, SVM_COLD_PROB_A, SVM_COLD_PROB_B, mode);
+}
+
+int predict_cold_simd(const float* features, float* out_score) {
+    return predict_cold_simd(features, out_score, SCORE_MODE_EXACT);
+}
+
+int predict_warm_simd(const float* features, float* out_score, int mode) {
+    return predict_svm_simd_generic(warm_simd(), features, out_score, SVM_WARM_PROB_A, SVM_WARM_PROB_B, mode);
+}
+
+int predict_warm_simd(const float* features, float* out_score) {
+    return predict_warm_simd(features, out_score, SCORE_MODE_EXACT);
+}
+
+void predict_warm_simd_batch(const float* features, int n_rows, int stride, int* labels, float* scores) {
+    predict_svm_simd_batch(warm_simd(), features, n_rows, stride, SVM_WARM_PROB_A, SVM_WARM_PROB_B, labels, scores);
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include <stdint.h>
+// Generated by host/quantise_linear.cpp; parameters for linear_q.h.
+
+// ===== SVM_COLD: inputs have room for 2^19 std =====
+static const int8_t SVM_COLD_Q_SHIFT[] = { 5, 5, 7, 5, 1, 1, -2, 0, -2, 1 };
+static const int32_t SVM_COLD_Q_MEAN[] = { 1269, 1305, 2814, 1976, 2524, 1680, 654, 871, 665, 2423 };
+#define SVM_COLD_Q_POLARITY 1
+#define SVM_COLD_Q_SCORE_MUL 93300
+#define SVM_COLD_Q16_ACC_FRAC 23
+static const int16_t SVM_COLD_Q16_COEF[] = { -9272, 28760, 56, 10285, -4820, 15063, -1745, -9879, 30900, -18363 };
+static const int64_t SVM_COLD_Q16_THRESHOLD = -10148588LL;
+#define SVM_COLD_Q8_ACC_FRAC 15
+static const int8_t SVM_COLD_Q8_COEF[] = { -36, 112, 0, 40, -19, 59, -7, -39, 121, -72 };
+static const int64_t SVM_COLD_Q8_THRESHOLD = -39643LL;
+
+// ===== SVM_WARM: inputs have room for 2^20 std =====
+static const int8_t SVM_WARM_Q_SHIFT[] = { 4, 4, 6, 4, 6, 6, 8, 6, 4, 4, 6, 2, 4, 4, 4, 4, 7, 3, 4, 4, 6, 6, 9, 7, 6, 6, 4, 4, 7, 3, 4, 4, 4, 4, 6, 1, 4, 4, 4, 4, 6, 1, 4, 4, 6, 6, 8, 5, 6, 6, 4, 4, 6, 2, 4, 4, 7, 7, 7, 7, 9, 9, 7, 7, 8, 7, 8, 7, 10, 10, 8, 8, 4, 4, 6, 4, 4, 4, 6, 4, 4, 4, 6, 4, 4, 4, 6, 4, 0, 0, -3, 0, -3, 0 };
+static const int32_t SVM_WARM_Q_MEAN[] = { 640, 642, 1410, 990, -6, -12, 3, -5, 641, 640, 216, 116, 577, 706, 649, 647, 428, 206, 586, 715, 1408, 1409, 504, 189, 1334, 1482, 993, 989, 539, 210, 916, 1073, 644, 642, 479, 196, 474, 820, 663, 658, 456, 175, 497, 844, 1408, 1402, 581, 229, 1196, 1638, 994, 997, 566, 414, 778, 1202, 0, 310, -28, 357, 7, 397, -10, 484, -7, 406, -38, 441, -8, 906, 2, 1072, 642, 645, 1409, 991, 642, 649, 1408, 992, 641, 652, 1407, 994, 641, 649, 1408, 992, 1261, 850, 330, 857, 329, 1214 };
+#define SVM_WARM_Q_POLARITY 1
+#define SVM_WARM_Q_SCORE_MUL 111989
+#define SVM_WARM_Q16_ACC_FRAC 22
+static const int16_t SVM_WARM_Q16_COEF[] = { -1047, 8613, 1649, 2246, -3866, 707, -1348, 1226, -1320, -847, -6945, -774, 3043, -1499, 4012, 5682, 6663, -5937, -3484, 9345, -2463, -2759, 5205, -3346, -3960, 375, 274, -2752, 708, -3141, 3378, -2312, 4529, 18558, -925, -635, 6172, 1885, 14502, 3098, -12577, 23789, -4113, 12432, 3046, 3964, -4186, -7354, -7138, 7900, -10376, -7522, -17806, 12887, -6279, 7776, -4915, -5788, -1335, -1489, 9362, 1079, -2031, -8074, -3148, 5266, -6774, 1310, 331, -3957, -1669, -2358, -437, 8495, 1773, 1183, 2526, -2281, -4104, -3343, -598, -5992, -1672, -325, 1598, 6570, -745, -250, 9257, 9534, -12841, -11895, 27109, -17533 };
+static const int64_t SVM_WARM_Q16_THRESHOLD = -3198404LL;
+#define SVM_WARM_Q8_ACC_FRAC 14
+static const int8_t SVM_WARM_Q8_COEF[] = { -4, 34, 6, 9, -15, 3, -5, 5, -5, -3, -27, -3, 12, -6, 16, 22, 26, -23, -14, 37, -10, -11, 20, -13, -15, 1, 1, -11, 3, -12, 13, -9, 18, 72, -4, -2, 24, 7, 57, 12, -49, 93, -16, 49, 12, 15, -16, -29, -28, 31, -41, -29, -70, 50, -25, 30, -19, -23, -5, -6, 37, 4, -8, -32, -12, 21, -26, 5, 1, -15, -7, -9, -2, 33, 7, 5, 10, -9, -16, -13, -2, -23, -7, -1, 6, 26, -3, -1, 36, 37, -50, -46, 106, -68 };
+static const int64_t SVM_WARM_Q8_THRESHOLD = -12494LL;
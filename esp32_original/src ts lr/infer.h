@@ -2,13 +2,17 @@
 #include <cmath>
 #include <vector>
 #include "model_edge.h" 
+#include "model_edge_q.h"
+#include "linear_q.h"
+#include "score_mode.h"
 #include "tsassure_settings.h"
 
 inline float sigmoid(float x) {
     return 1.0f / (1.0f + expf(-x));
 }
 
-int predict_lr(const float* features, float* out_score) {
+// mode: SCORE_MODE_* (score_mode.h), how out_score is produced.
+int predict_lr(const float* features, float* out_score, int mode) {
     float decision = 0.0f;
     
     for(int i=0; i<LR_N_FEATURES; i++) {
@@ -20,7 +24,37 @@ int predict_lr(const float* features, float* out_score) {
     
     decision += LR_BIAS;
     
-    float prob = sigmoid(decision);
-    if(out_score) *out_score = prob;
-    return (prob >= 0.5f) ? 1 : 0;
-}
\ No newline at end of file
+    return lr_label_score(decision, mode, out_score);
+}
+
+int predict_lr(const float* features, float* out_score) {
+    return predict_lr(features, out_score, SCORE_MODE_EXACT);
+}
+
+// ================= SCORE MODE =================
+// How main.cpp fills the Score column (score_mode.h): SCORE_MODE_EXACT as
+// before, SCORE_MODE_FAST for the polynomial exp, SCORE_MODE_LABEL to leave
+// it empty and skip the exp. The Label column does not depend on it.
+#ifndef SCORE_MODE
+#define SCORE_MODE SCORE_MODE_EXACT
+#endif
+
+// ================= FIXED-POINT PATH =================
+// LINEAR_Q = 16 or 8 makes main.cpp use the int16 / int8 kernels of
+// linear_q.h (parameters in model_edge_q.h); 0 keeps the float path.
+#ifndef LINEAR_Q
+#define LINEAR_Q 0
+#endif
+
+static const LinearQ<int16_t> LR_Q16 = { LR_N_FEATURES, LR_Q_SHIFT, LR_Q_MEAN, LR_Q16_COEF,
+    LR_Q16_ACC_FRAC, LR_Q16_THRESHOLD, LR_Q_POLARITY, LR_Q_SCORE_MUL };
+static const LinearQ<int8_t> LR_Q8 = { LR_N_FEATURES, LR_Q_SHIFT, LR_Q_MEAN, LR_Q8_COEF,
+    LR_Q8_ACC_FRAC, LR_Q8_THRESHOLD, LR_Q_POLARITY, LR_Q_SCORE_MUL };
+
+int predict_lr_q16(const float* features, float* out_score) {
+    return predict_linear_q(features, LR_Q16, out_score);
+}
+
+int predict_lr_q8(const float* features, float* out_score) {
+    return predict_linear_q(features, LR_Q8, out_score);
+}
@@ -0,0 +1,15 @@
+#pragma once
+#include <stdint.h>
+// Generated by host/quantise_linear.cpp; parameters for linear_q.h.
+
+// ===== LR: inputs have room for 2^20 std =====
+static const int8_t LR_Q_SHIFT[] = { 4, 4, 3, 6, 4, 4, 4, 6, 6, 8, 6, 12 };
+static const int32_t LR_Q_MEAN[] = { 634, 652, -9, 1407, 283, 989, -355, -6, -7, -5, 5, 231 };
+#define LR_Q_POLARITY 1
+#define LR_Q_SCORE_MUL 65536
+#define LR_Q16_ACC_FRAC 22
+static const int16_t LR_Q16_COEF[] = { 2851, 22939, -14186, -3723, 3395, -5676, 6635, -2874, -4186, 1984, -2208, -805 };
+static const int64_t LR_Q16_THRESHOLD = -1303313LL;
+#define LR_Q8_ACC_FRAC 14
+static const int8_t LR_Q8_COEF[] = { 11, 90, -55, -15, 13, -22, 26, -11, -16, 8, -9, -3 };
+static const int64_t LR_Q8_THRESHOLD = -5091LL;
@@ -0,0 +1,154 @@
+#pragma once
+#include <cmath>
+#include "multi_models.h"
+#include "deadline.h"
+#include "tsassure_settings.h"
+
+// ================= MODELS =================
+// MULTI_MODELS picks the heads built in (multi_models.h), e.g.
+// -DMULTI_MODELS="(MULTI_LR|MULTI_RF)". Headers of the others are left out.
+#ifndef MULTI_MODELS
+#define MULTI_MODELS MULTI_ALL
+#endif
+
+// ================= SCORE MODE =================
+// How the LR / SVM scores are produced (score_mode.h); the RF score and the
+// labels do not depend on it.
+#ifndef SCORE_MODE
+#define SCORE_MODE SCORE_MODE_EXACT
+#endif
+// MULTI_SCORE_MODE_LR / MULTI_SCORE_MODE_SVM set the mode of one head, e.g.
+// exact LR scores next to a label-only SVM; both default to SCORE_MODE. The
+// deadline's LR level uses MULTI_SCORE_MODE_LR.
+#ifndef MULTI_SCORE_MODE_LR
+#define MULTI_SCORE_MODE_LR SCORE_MODE
+#endif
+#ifndef MULTI_SCORE_MODE_SVM
+#define MULTI_SCORE_MODE_SVM SCORE_MODE
+#endif
+
+// ================= CASCADE =================
+// MULTI_CASCADE = 1 makes main.cpp publish one decision per message: the
+// MULTI_CASCADE_LINEAR head, and the forest only when that head's probability
+// is within MULTI_CASCADE_BAND of 0.5 (multi_models.h). Both heads must be in
+// MULTI_MODELS.
+#ifndef MULTI_CASCADE
+#define MULTI_CASCADE 0
+#endif
+#ifndef MULTI_CASCADE_LINEAR
+#define MULTI_CASCADE_LINEAR MULTI_LR
+#endif
+#ifndef MULTI_CASCADE_BAND
+#define MULTI_CASCADE_BAND 0.3f
+#endif
+// The cascade's Score column follows the mode of its linear head.
+#define MULTI_CASCADE_SCORE_MODE ((MULTI_CASCADE_LINEAR == MULTI_SVM) ? MULTI_SCORE_MODE_SVM : MULTI_SCORE_MODE_LR)
+#if MULTI_CASCADE && !((MULTI_MODELS & MULTI_CASCADE_LINEAR) && (MULTI_MODELS & MULTI_RF))
+#error "MULTI_CASCADE needs MULTI_CASCADE_LINEAR and MULTI_RF in MULTI_MODELS"
+#endif
+
+// ================= DEADLINE =================
+// DEADLINE_US > 0 gives every message that many microseconds (deadline.h) and
+// makes main.cpp publish one decision per message, at the level picked for it:
+// the forest, the forest cut to DEADLINE_TREES trees, LR, or the previous
+// decision. DEADLINE_LEVEL_MASK leaves levels out. Needs MULTI_LR and MULTI_RF.
+#ifndef DEADLINE_US
+#define DEADLINE_US 0
+#endif
+#ifndef DEADLINE_LEVEL_MASK
+#define DEADLINE_LEVEL_MASK (DEADLINE_BIT(DEADLINE_TREES) | DEADLINE_BIT(DEADLINE_LINEAR) | DEADLINE_BIT(DEADLINE_SHED))
+#endif
+#if DEADLINE_US && !((MULTI_MODELS & MULTI_LR) && (MULTI_MODELS & MULTI_RF))
+#error "DEADLINE_US needs MULTI_LR and MULTI_RF in MULTI_MODELS"
+#endif
+#if DEADLINE_US && MULTI_CASCADE
+#error "DEADLINE_US and MULTI_CASCADE each pick one decision per message; use one of them"
+#endif
+
+#if MULTI_MODELS & MULTI_LR
+#include "model_edge_lr.h"
+static const MultiLinear LR_MODEL = { { LR_N_FEATURES, LR_SCALE_MEAN, LR_SCALE_STD },
+    LR_COEF, LR_BIAS, MULTI_SCORE_SIGMOID, 0.0f, 0.0f };
+#endif
+#if MULTI_MODELS & MULTI_SVM
+#include "model_edge_svm.h"
+static const MultiLinear SVM_MODEL = { { SVM_N_FEATURES, SVM_SCALE_MEAN, SVM_SCALE_STD },
+    SVM_COEF, SVM_BIAS, MULTI_SCORE_PLATT, SVM_PROB_A, SVM_PROB_B };
+#endif
+#if MULTI_MODELS & MULTI_RF
+#include "model_edge_rf.h"
+static const MultiForest RF_MODEL = { { RF_N_FEATURES, RF_SCALE_MEAN, RF_SCALE_STD },
+    RF_N_TREES, RF_TREE_OFFSETS, RF_FEATURE, RF_THRESHOLD, RF_LEFT, RF_RIGHT, RF_PROB1, RF_TREE_ORDER };
+#endif
+
+// The first model built in owns the shared scaling table.
+MultiSet multi_models = {
+#if MULTI_MODELS & MULTI_LR
+    LR_MODEL.scale,
+#elif MULTI_MODELS & MULTI_SVM
+    SVM_MODEL.scale,
+#else
+    RF_MODEL.scale,
+#endif
+#if MULTI_MODELS & MULTI_LR
+    &LR_MODEL,
+#else
+    nullptr,
+#endif
+#if MULTI_MODELS & MULTI_SVM
+    &SVM_MODEL,
+#else
+    nullptr,
+#endif
+#if MULTI_MODELS & MULTI_RF
+    &RF_MODEL,
+#else
+    nullptr,
+#endif
+    { false, false, false } };
+
+#if MULTI_MODELS & MULTI_LR
+int predict_lr(const float* features, const float* z, float* out_score, int mode) {
+    return multi_predict_linear(LR_MODEL, multi_models.own_scale[0], features, z, out_score, mode);
+}
+#endif
+
+#if MULTI_MODELS & MULTI_SVM
+int predict_svm(const float* features, const float* z, float* out_score, int mode) {
+    return multi_predict_linear(SVM_MODEL, multi_models.own_scale[1], features, z, out_score, mode);
+}
+#endif
+
+#if MULTI_MODELS & MULTI_RF
+int predict_rf(const float* features, const float* z, float* out_score) {
+    return multi_predict_forest(RF_MODEL, multi_models.own_scale[2], features, z, out_score);
+}
+#endif
+
+#if MULTI_CASCADE
+MultiCascade multi_cascade;
+
+void multi_cascade_setup() {
+    multi_cascade_init(multi_cascade, (MULTI_CASCADE_LINEAR == MULTI_SVM) ? 1 : 0, MULTI_CASCADE_BAND);
+}
+
+// out_stage: MULTI_STAGE_LINEAR or MULTI_STAGE_FOREST, whichever decided.
+int predict_cascade(const float* features, const float* z, float* out_score, int* out_stage, int mode) {
+    return multi_predict_cascade(multi_models, multi_cascade, features, z, out_score, out_stage, mode);
+}
+#endif
+
+#if DEADLINE_US
+DeadlineSched deadline_sched;
+
+void deadline_setup() {
+    deadline_init(deadline_sched, DEADLINE_US, DEADLINE_PERIOD_US, DEADLINE_LEVEL_MASK);
+}
+
+// Decision at DEADLINE_FULL, _TREES or _LINEAR.
+int predict_deadline(int level, const float* features, const float* z, float* out_score, int mode) {
+    if(level == DEADLINE_LINEAR) return predict_lr(features, z, out_score, mode);
+    int n_trees = (level == DEADLINE_TREES) ? DEADLINE_TREES : RF_MODEL.n_trees;
+    return multi_predict_forest_trees(RF_MODEL, multi_models.own_scale[2], features, z, n_trees, out_score);
+}
+#endif
@@ -0,0 +1,8 @@
+#pragma once
+#include <stdint.h>
+
+#define LR_N_FEATURES 12
+static const float LR_SCALE_MEAN[] = { 39.651942, 40.747360, -1.095418, 21.984636, 17.667306, 61.788168, -22.161624, -0.090752, -0.107015, -0.020891, 0.078363, 0.056352 };
+static const float LR_SCALE_STD[]  = { 22.750149, 25.360734, 43.266970, 6.570267, 24.979768, 24.680612, 28.259886, 4.328356, 4.405289, 1.040527, 4.596124, 0.120795 };
+static const float LR_COEF[] = { 0.247431, 2.219228, -1.170688, -0.373276, 0.323527, -0.534390, 0.715275, -0.189807, -0.281357, 0.125997, -0.154882, -0.094976 };
+static const float LR_BIAS = 0.310734;
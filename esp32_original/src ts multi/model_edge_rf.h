@@ -0,0 +1,13 @@
+#pragma once
+#include <stdint.h>
+#define RF_N_FEATURES 12
+#define RF_N_TREES 20
+static const float RF_SCALE_MEAN[] = { 39.651942, 40.747360, -1.095418, 21.984636, 17.667306, 61.788168, -22.161624, -0.090752, -0.107015, -0.020891, 0.078363, 0.056352 };
+static const float RF_SCALE_STD[]  = { 22.750149, 25.360734, 43.266970, 6.570267, 24.979768, 24.680612, 28.259886, 4.328356, 4.405289, 1.040527, 4.596124, 0.120795 };
+static const int RF_TREE_OFFSETS[] = { 0, 61, 122, 175, 234, 301, 366, 427, 504, 575, 644, 701, 760, 817, 880, 941, 1000, 1093, 1152, 1227, 1300 };
+static const int RF_FEATURE[] = { 2, 4, 2, 10, 0, -2, -2, -2, -2, 2, -2, 8, 2, -2, -2, 2, -2, -2, 5, 7, -2, 2, -2, -2, 11, 8, 0, 7, 5, -2, 4, -2, -2, 9, 1, -2, -2, -2, 0, -2, -2, 4, 4, 0, -2, 0, -2, -2, -2, 2, -2, 0, -2, -2, 5, -2, 4, 7, -2, -2, -2, 2, 9, 3, -2, 6, -2, -2, 1, -2, 4, 0, 2, -2, -2, -2, -2, 5, 1, -2, 3, -2, -2, 1, 8, 0, 11, -2, 2, -2, 3, -2, -2, 7, 1, -2, -2, -2, 9, 0, 4, 10, -2, -2, -2, 11, 11, -2, -2, -2, 8, 0, -2, 5, -2, -2, 6, 10, -2, -2, -2, -2, 2, 1, 6, -2, 7, -2, -2, 4, 8, 2, 3, -2, -2, -2, -2, 1, 0, -2, -2, -2, 4, 6, 11, -2, 0, 4, -2, 5, -2, 7, -2, -2, 1, -2, 10, 11, -2, -2, 8, -2, -2, -2, 7, 8, 7, -2, -2, -2, 4, -2, 9, -2, -2, 2, 5, 8, 0, -2, 1, -2, -2, 9, 5, -2, -2, -2, 1, -2, 9, 4, -2, -2, 4, -2, -2, 4, 6, 1, 3, 9, 4, 7, -2, -2, -2, 2, -2, 8, -2, -2, -2, -2, -2, 9, 0, 4, -2, 0, -2, 4, 6, -2, -2, -2, 11, -2, -2, 4, -2, 4, -2, -2, 1, 6, 7, 6, -2, 0, 8, 11, -2, -2, -2, 3, 1, -2, -2, -2, 3, 9, 10, 10, 10, -2, -2, 11, -2, -2, 5, 4, -2, -2, -2, 7, 2, -2, 2, -2, -2, 2, 8, -2, -2, -2, 2, 6, -2, -2, 4, -2, -2, 2, -2, 3, 8, -2, -2, -2, 1, 0, 3, 2, -2, -2, 8, -2, -2, -2, -2, 1, 5, 4, 5, -2, -2, -2, 0, 3, 6, -2, 4, -2, -2, 8, 4, 1, 4, -2, -2, 3, -2, -2, -2, 7, -2, -2, 4, 1, -2, -2, 7, 7, 5, 10, -2, -2, -2, 5, -2, 11, -2, -2, 3, 5, -2, -2, -2, 3, 5, 6, -2, -2, 10, 1, -2, -2, -2, 1, -2, 2, -2, 0, -2, -2, 2, 1, 8, 11, -2, -2, -2, 5, 6, 4, -2, 8, -2, -2, -2, 8, -2, 10, -2, -2, 4, 0, -2, 2, 6, 9, 1, 4, -2, -2, -2, -2, 3, 4, 11, -2, -2, -2, 10, -2, -2, -2, 9, -2, 2, -2, 10, 11, -2, -2, 10, 8, 2, -2, -2, -2, 10, 11, -2, -2, -2, 2, 11, 4, 7, -2, 8, -2, 9, -2, 6, 10, -2, -2, -2, 2, -2, 8, -2, 8, -2, -2, -2, 8, 8, 0, 0, 2, -2, -2, 1, -2, 6, -2, 0, -2, -2, -2, 11, 5, -2, 5, -2, 7, 11, -2, -2, 8, -2, -2, 10, 0, -2, 1, -2, -2, 9, 3, -2, -2, 6, 6, -2, -2, -2, 3, 1, 6, -2, 0, -2, -2, 10, 1, -2, -2, -2, -2, 1, 6, 8, 9, 9, -2, 1, 0, 9, -2, -2, -2, 7, 3, -2, -2, 9, -2, -2, 8, 7, -2, 10, -2, 6, -2, -2, 1, 6, -2, -2, -2, 10, 6, 11, -2, 0, 4, -2, -2, -2, 1, 9, 10, -2, -2, -2, -2, 9, -2, -2, 5, -2, 8, -2, 4, -2, 0, -2, -2, 2, -2, 8, -2, 4, -2, 0, 1, -2, -2, -2, 4, 4, 4, 10, 10, -2, -2, -2, 1, -2, 11, -2, -2, 0, 9, 2, 8, -2, 2, -2, -2, 11, 0, -2, -2, -2, 1, -2, 0, -2, -2, 1, -2, 2, 0, -2, -2, 8, 0, 2, -2, -2, -2, -2, 9, 11, 11, -2, -2, 10, 2, 11, 7, 8, -2, -2, 5, -2, -2, -2, 5, -2, -2, -2, 0, -2, 8, -2, -2, 1, 3, 11, 8, 1, 10, 6, 4, -2, -2, 10, -2, -2, 2, 3, -2, -2, 11, -2, -2, 5, -2, -2, 11, -2, 8, -2, -2, 4, -2, 2, -2, -2, 2, 1, -2, 5, -2, -2, 7, -2, -2, 3, 4, 2, -2, -2, 1, 1, -2, -2, -2, 5, 3, -2, -2, -2, 8, 1, 6, 8, 0, 11, -2, 9, -2, -2, 8, -2, -2, 5, -2, 8, 1, 1, -2, -2, -2, 11, 7, -2, -2, 1, -2, -2, 3, -2, -2, 5, 3, 9, -2, 1, -2, -2, -2, -2, 2, -2, 6, 2, -2, 2, 7, -2, -2, -2, 7, 2, -2, -2, 9, 10, -2, -2, -2, 2, 5, 1, 7, -2, -2, -2, 6, -2, 1, 3, -2, -2, -2, 8, 5, 8, -2, -2, 9, 0, 7, 8, 10, -2, -2, 7, -2, -2, 0, -2, -2, -2, 10, -2, 2, 7, 5, -2, -2, 4, -2, -2, -2, 4, 0, 9, -2, -2, 11, -2, -2, 6, -2, 6, -2, -2, 8, 1, 4, 5, 0, -2, -2, 1, 7, 0, -2, -2, -2, 10, 8, 10, -2, -2, -2, -2, 3, 11, 11, 5, -2, -2, 2, 2, -2, -2, -2, 8, -2, 10, -2, -2, -2, 2, -2, 1, -2, 3, -2, -2, 1, 6, 8, -2, 7, -2, -2, 9, -2, 8, 4, -2, 2, -2, -2, -2, 3, -2, -2, 7, 3, 2, 0, -2, 7, 7, -2, -2, -2, 8, 9, 6, -2, -2, -2, -2, -2, 4, 5, 1, 6, 6, 2, -2, -2, 8, -2, 4, -2, -2, -2, 4, -2, 10, -2, 7, -2, 4, -2, -2, 0, -2, 0, -2, -2, 9, -2, 4, 10, 2, -2, -2, 6, 6, -2, -2, -2, 5, -2, -2, 2, 4, 5, 0, -2, 1, -2, -2, 11, 7, -2, -2, -2, 1, 8, -2, -2, -2, 9, 2, 8, 8, 7, 7, -2, -2, -2, 3, -2, 0, -2, -2, 10, 3, 4, 1, -2, -2, -2, -2, -2, 11, 9, -2, -2, -2, 4, -2, 4, 6, -2, 10, -2, 11, -2, -2, 3, -2, -2, 1, 6, 10, 1, 7, 3, 0, -2, -2, -2, -2, 10, 0, 0, 4, -2, -2, -2, 9, -2, 3, -2, -2, -2, 6, 9, 11, 3, 11, -2, -2, -2, 7, 0, -2, -2, -2, 6, -2, -2, 0, -2, 4, 2, -2, 6, -2, -2, -2, 0, 2, 6, 8, -2, -2, -2, -2, -2, 9, 4, 1, -2, -2, 2, 5, -2, 7, -2, 3, -2, 3, -2, -2, -2, 7, 8, 4, 4, -2, -2, 11, -2, -2, 2, 8, 7, -2, -2, -2, -2, 8, -2, -2, 6, 4, -2, 0, 2, -2, -2, 7, -2, -2, 1, 6, 9, 10, 3, -2, 2, -2, -2, 4, 6, -2, -2, 7, 0, -2, -2, -2, 2, -2, 4, 10, 8, -2, -2, 9, -2, -2, -2, 2, -2, -2, 4, 3, 8, 3, -2, 8, -2, -2, 10, 2, -2, -2, -2, 2, -2, -2, -2, 1, 8, 2, 9, 5, -2, 11, -2, -2, 4, 8, -2, -2, -2, 9, -2, -2, 4, 0, 5, -2, 8, 3, -2, 9, -2, -2, 0, -2, 6, -2, -2, -2, 11, 8, -2, -2, 2, 3, 10, 0, -2, -2, 1, -2, -2, -2, 2, -2, -2, 6, 5, 3, -2, -2, 8, -2, 5, -2, -2, 6, 4, 11, 8, -2, -2, -2, 9, -2, 10, -2, 10, -2, -2, -2, 0, 5, 4, 7, 7, -2, -2, 8, 7, -2, -2, -2, 11, 1, 5, 3, 7, -2, -2, -2, 6, 11, -2, -2, -2, 4, 6, -2, 11, -2, -2, -2, -2, 0, 7, 1, -2, -2, -2, 0, -2, 11, -2, -2, 5, -2, 4, 2, -2, -2, 8, 0, 7, 8, 3, -2, -2, -2, -2, 6, -2, -2, 6, -2, 10, 5, 6, -2, -2, -2, 11, -2, -2 };
+static const float RF_THRESHOLD[] = { -0.28226880729198456, -1.2266822457313538, -0.4292246252298355, -0.5609863847494125, -0.8594203889369965, -2.0, -2.0, -2.0, -2.0, -0.5148172378540039, -2.0, 1.2160415053367615, -0.3017216622829437, -2.0, -2.0, -0.31520384550094604, -2.0, -2.0, -1.348757803440094, 0.40409915149211884, -2.0, 0.5351368635892868, -2.0, -2.0, 1.3044546246528625, 0.2709167003631592, 2.2204129695892334, 0.25816239416599274, 1.183594286441803, -2.0, 1.6860474348068237, -2.0, -2.0, 0.2870578020811081, -0.2299102582037449, -2.0, -2.0, -2.0, 2.3105220794677734, -2.0, -2.0, 0.27960337698459625, 0.021901476662606, -0.4850638508796692, -2.0, 0.11639737337827682, -2.0, -2.0, -2.0, 0.9864048957824707, -2.0, 1.2497232556343079, -2.0, -2.0, -1.3082401752471924, -2.0, 1.1645194590091705, -3.4068163633346558, -2.0, -2.0, -2.0, -0.2842274457216263, 0.7163709104061127, 1.896812379360199, -2.0, 0.7252314686775208, -2.0, -2.0, 0.017848076298832893, -2.0, -0.9748487770557404, -0.8594203889369965, -0.5678985416889191, -2.0, -2.0, -2.0, -2.0, -1.348757803440094, -0.4960697591304779, -2.0, 1.896812379360199, -2.0, -2.0, -0.188132144510746, -0.41457399725914, 0.3308386877179146, -0.08806290081702173, -2.0, -0.030537129379808903, -2.0, 1.1357474327087402, -2.0, -2.0, -0.14460791274905205, -0.7129404246807098, -2.0, -2.0, -2.0, 1.0407465696334839, 0.3032093346118927, 0.03214443288743496, -0.7986707985401154, -2.0, -2.0, -2.0, -0.4293016642332077, -0.42987160384655, -2.0, -2.0, -2.0, 0.38370877504348755, 0.01200246624648571, -2.0, -0.15348760038614273, -2.0, -2.0, 0.1779303401708603, -1.2137102484703064, -2.0, -2.0, -2.0, -2.0, -0.29594358801841736, -0.07641087472438812, 0.6544597744941711, -2.0, 0.2767551615834236, -2.0, -2.0, -1.241136610507965, 0.3647921234369278, -0.7605011761188507, 1.896812379360199, -2.0, -2.0, -2.0, -2.0, 0.017848076298832893, -0.7469668984413147, -2.0, -2.0, -2.0, 0.28158365190029144, 1.5217078924179077, -0.42140765488147736, -2.0, -0.38140153884887695, -1.2622683644294739, -2.0, -0.7409932911396027, -2.0, 0.02712780237197876, -2.0, -2.0, -0.7490855753421783, -2.0, -0.5609863847494125, 0.8015393316745758, -2.0, -2.0, 0.4253254234790802, -2.0, -2.0, -2.0, -1.0764474272727966, 0.4782920330762863, -1.15555739402771, -2.0, -2.0, -2.0, 2.165001153945923, -2.0, -2.3827430605888367, -2.0, -2.0, -0.3017216622829437, -1.348757803440094, 0.24200528860092163, -0.8594203889369965, -2.0, 0.20054519549012184, -2.0, -2.0, 0.05238289013504982, -1.5716047883033752, -2.0, -2.0, -2.0, -0.1181889995932579, -2.0, 1.888938307762146, -1.1466094851493835, -2.0, -2.0, -0.8457282781600952, -2.0, -2.0, 0.28158365190029144, 1.532618522644043, -0.15367692708969116, 1.896812379360199, 0.9892931282520294, 0.25624313950538635, -0.09455053880810738, -2.0, -2.0, -2.0, -0.07213930413126945, -2.0, -0.032457598485052586, -2.0, -2.0, -2.0, -2.0, -2.0, 0.8210179507732391, 2.2204129695892334, 1.0145690441131592, -2.0, 0.8980772197246552, -2.0, 1.6768354773521423, 0.1944437362253666, -2.0, -2.0, -2.0, -0.27388469129800797, -2.0, -2.0, 0.935120552778244, -2.0, 1.631238579750061, -2.0, -2.0, -0.15367692708969116, 1.662956416606903, -1.0764474272727966, -0.17179979383945465, -2.0, 1.2753670811653137, 0.11887563206255436, 0.4663427621126175, -2.0, -2.0, -2.0, -0.6823522001504898, -0.831233561038971, -2.0, -2.0, -2.0, 1.8006733059883118, 0.9892931282520294, -0.18620450794696808, -0.6898835003376007, -1.2137101888656616, -2.0, -2.0, 0.6482205837965012, -2.0, -2.0, -1.3082401752471924, -0.963020920753479, -2.0, -2.0, -2.0, 0.33478882908821106, 0.22755041997879744, -2.0, 0.46637772023677826, -2.0, -2.0, 1.128160446882248, -5.726370334625244, -2.0, -2.0, -2.0, -0.09467381983995438, 0.6308691948652267, -2.0, -2.0, -0.6368098556995392, -2.0, -2.0, 0.9869827330112457, -2.0, 0.20555691048502922, 0.21345888078212738, -2.0, -2.0, -2.0, 0.6310006976127625, -0.7678458988666534, 1.896812379360199, -0.5678985416889191, -2.0, -2.0, -1.75387305021286, -2.0, -2.0, -2.0, -2.0, -0.15367692708969116, -1.3892754316329956, -0.30649492889642715, -1.6728988885879517, -2.0, -2.0, -2.0, 0.3032093346118927, -0.21725694090127945, -0.1856592297554016, -2.0, 0.32824330031871796, -2.0, -2.0, 0.8418463468551636, 0.01990252558607608, -0.2374209389090538, -0.046810127794742584, -2.0, -2.0, 0.9666219018399715, -2.0, -2.0, -2.0, -0.23509640619158745, -2.0, -2.0, 0.20938388258218765, -0.7425137162208557, -2.0, -2.0, -0.08994535356760025, -0.11380330100655556, 0.8391944468021393, -2.0840086936950684, -2.0, -2.0, -2.0, 0.7176415026187897, -2.0, -0.41131310164928436, -2.0, -2.0, -1.4434171915054321, 1.4267001152038574, -2.0, -2.0, -2.0, 1.896812379360199, -1.4297930598258972, 0.5748416185379028, -2.0, -2.0, -1.5400721430778503, 0.21134180203080177, -2.0, -2.0, -2.0, -0.10927006974816322, -2.0, -0.6468656063079834, -2.0, -0.8444544970989227, -2.0, -2.0, -0.2842274457216263, 0.029677387326955795, 0.38370877504348755, 8.159808158874512, -2.0, -2.0, -2.0, -1.551345944404602, 0.8631182909011841, -1.3100884556770325, -2.0, -0.22162413597106934, -2.0, -2.0, -2.0, 1.4673627614974976, -2.0, -1.4312848448753357, -2.0, -2.0, 0.2823576033115387, -0.49228517711162567, -2.0, 0.6132155656814575, 0.363706037402153, 1.888938307762146, -0.6209346950054169, -0.050127480179071426, -2.0, -2.0, -2.0, -2.0, 1.6008427143096924, -0.40432342886924744, 0.391494874143973, -2.0, -2.0, -2.0, -0.2346244677901268, -2.0, -2.0, -2.0, -2.6497231125831604, -2.0, 0.8764724731445312, -2.0, -1.7576467394828796, -0.2958662807941437, -2.0, -2.0, -1.043573796749115, 0.09995897766202688, 1.0229994058609009, -2.0, -2.0, -2.0, 0.023225735872983932, -0.42772023379802704, -2.0, -2.0, -2.0, -0.2842274457216263, 4.371838688850403, -1.2077736258506775, -0.19631565548479557, -2.0, -1.526873230934143, -2.0, 0.5540378838777542, -2.0, 0.7842078804969788, -0.5609863847494125, -2.0, -2.0, -2.0, -0.3281467407941818, -2.0, 1.2160415053367615, -2.0, 1.4430413842201233, -2.0, -2.0, -2.0, 0.2433471381664276, -0.37295736372470856, 1.0129901468753815, -0.5993488132953644, -0.24432606995105743, -2.0, -2.0, -0.7490855753421783, -2.0, 0.262266606092453, -2.0, -0.06345490738749504, -2.0, -2.0, -2.0, -0.394628643989563, -1.4095342755317688, -2.0, 1.183594286441803, -2.0, -0.08866172656416893, -0.4112621396780014, -2.0, -2.0, 0.15670894086360931, -2.0, -2.0, -1.4312848448753357, 0.09075652435421944, -2.0, -0.7248336672782898, -2.0, -2.0, 0.760211855173111, 1.9813752174377441, -2.0, -2.0, 1.1071037352085114, 0.32153789699077606, -2.0, -2.0, -2.0, 1.4820605516433716, -0.6932249367237091, 0.07000351157330442, -2.0, 1.7559470534324646, -2.0, -2.0, -1.2137101888656616, -0.48292607069015503, -2.0, -2.0, -2.0, -2.0, -0.15367692708969116, 1.474453866481781, 0.3188629597425461, 1.0407465696334839, -3.2903599739074707, -2.0, -0.9068097174167633, 0.8687733933329582, -0.24690233170986176, -2.0, -2.0, -2.0, 1.6940422654151917, -0.97832190990448, -2.0, -2.0, -0.5138824433088303, -2.0, -2.0, -0.3918740153312683, -0.9994358867406845, -2.0, -2.301583230495453, -2.0, 0.28084418177604675, -2.0, -2.0, -0.8213758170604706, 0.19178979098796844, -2.0, -2.0, -2.0, 0.09173745289444923, 0.13782638311386108, -0.3562227636575699, -2.0, -0.3114386349916458, -0.25762607157230377, -2.0, -2.0, -2.0, -0.20362290740013123, 0.5540378838777542, -1.8664340376853943, -2.0, -2.0, -2.0, -2.0, -1.3148226737976074, -2.0, -2.0, -1.3082401752471924, -2.0, -0.047590918838977814, -2.0, 2.0524513721466064, -2.0, 2.3119874000549316, -2.0, -2.0, -0.8489058315753937, -2.0, -0.22162412106990814, -2.0, -1.271323323249817, -2.0, -0.8011790215969086, 0.31555238738656044, -2.0, -2.0, -2.0, 0.2823576033115387, -1.2199862003326416, -1.3100884556770325, -0.14562151208519936, -0.4521990865468979, -2.0, -2.0, -2.0, 0.22026072815060616, -2.0, -0.3637407571077347, -2.0, -2.0, -0.5517300665378571, 1.3341200947761536, -0.2910899966955185, 1.7305744886398315, -2.0, -0.4820747822523117, -2.0, -2.0, -0.11907167732715607, -0.6301178336143494, -2.0, -2.0, -2.0, -0.08861572295427322, -2.0, -0.8111213743686676, -2.0, -2.0, -0.7457996308803558, -2.0, 0.007983401417732239, -0.5293859243392944, -2.0, -2.0, 0.7242085337638855, 0.6599835604429245, 0.13972362130880356, -2.0, -2.0, -2.0, -2.0, 1.0407465696334839, -0.45069995522499084, -0.4572044610977173, -2.0, -2.0, 3.1377819776535034, 1.6015777587890625, -0.40532101690769196, 0.09772593528032303, 0.02429236378520727, -2.0, -2.0, 0.9607473015785217, -2.0, -2.0, -2.0, 0.5960886180400848, -2.0, -2.0, -2.0, 0.9273810684680939, -2.0, 0.1283339560031891, -2.0, -2.0, -0.18156030029058456, 1.6008427143096924, 1.3674057126045227, 0.8229296803474426, -0.36791887879371643, -0.778560996055603, 0.3153453767299652, 1.2197989225387573, -2.0, -2.0, -2.0840086936950684, -2.0, -2.0, 1.6046594381332397, -0.97832190990448, -2.0, -2.0, -0.43712736666202545, -2.0, -2.0, -0.9638402760028839, -2.0, -2.0, 0.5536748766899109, -2.0, 1.1176748871803284, -2.0, -2.0, -0.2053811177611351, -2.0, 0.7466530799865723, -2.0, -2.0, -0.08696971088647842, -0.31468698382377625, -2.0, -1.6728988885879517, -2.0, -2.0, 0.9624327421188354, -2.0, -2.0, 1.896812379360199, -1.0063409209251404, -0.5621204674243927, -2.0, -2.0, 0.026391467079520226, -0.009753648191690445, -2.0, -2.0, -2.0, -1.6323812007904053, 2.1505007147789, -2.0, -2.0, -2.0, 0.39406993985176086, -0.14447635039687157, 1.809512734413147, -0.43349064886569977, 0.3049047812819481, -0.01396606839261949, -2.0, 4.825719237327576, -2.0, -2.0, -0.45619063079357147, -2.0, -2.0, -1.6728988885879517, -2.0, 0.13719190657138824, -0.8213758170604706, -0.8279476463794708, -2.0, -2.0, -2.0, -0.30364614725112915, 0.009415140375494957, -2.0, -2.0, -0.7866905033588409, -2.0, -2.0, 1.2354666590690613, -2.0, -2.0, -1.2677225470542908, 2.0659379363059998, -0.5138824433088303, -2.0, 0.5334696471691132, -2.0, -2.0, -2.0, -2.0, -0.8475576043128967, -2.0, 0.12186061218380928, -0.5621204674243927, -2.0, 0.10447732917964458, -0.7407259792089462, -2.0, -2.0, -2.0, 0.07872551679611206, -0.7778354287147522, -2.0, -2.0, 1.3549781441688538, -0.34341177344322205, -2.0, -2.0, -2.0, -0.3309972584247589, -1.551345944404602, 0.47984836995601654, 0.23824939876794815, -2.0, -2.0, -2.0, 0.48047932982444763, -2.0, 0.41544434428215027, 1.516279935836792, -2.0, -2.0, -2.0, 0.22102555632591248, -1.5918635725975037, -0.032457590103149414, -2.0, -2.0, 0.49323177337646484, 2.236530065536499, 3.0763992071151733, -0.18379081785678864, -2.0840086936950684, -2.0, -2.0, -0.08299869298934937, -2.0, -2.0, 0.6273830682039261, -2.0, -2.0, -2.0, -1.779792308807373, -2.0, 1.2329362630844116, 0.17306473851203918, -1.348757803440094, -2.0, -2.0, -0.6959175169467926, -2.0, -2.0, -2.0, 0.25909342616796494, -0.5041113495826721, -0.24690237641334534, -2.0, -2.0, 2.550700604915619, -2.0, -2.0, 0.3566288650035858, -2.0, 0.4480423182249069, -2.0, -2.0, 0.41397543251514435, -0.15433410927653313, 0.32717521488666534, -1.3690165877342224, -0.35685958713293076, -2.0, -2.0, -0.7688010931015015, 0.12493239901959896, -0.9077716991305351, -2.0, -2.0, -2.0, 0.05102957412600517, -0.41079068183898926, -0.778560996055603, -2.0, -2.0, -2.0, -2.0, -0.7208919823169708, -0.2839422672986984, -0.4502520114183426, 1.4267001152038574, -2.0, -2.0, 1.2830129861831665, 1.1038925051689148, -2.0, -2.0, -2.0, -0.18379081785678864, -2.0, -0.5609863735735416, -2.0, -2.0, -2.0, -0.8489058315753937, -2.0, 0.4075581431388855, -2.0, 1.896812379360199, -2.0, -2.0, 0.0996205322444439, 0.2044697254896164, 1.9689242839813232, -2.0, 1.041369616985321, -2.0, -2.0, -1.3148226737976074, -2.0, 0.8701370060443878, -1.0025435388088226, -2.0, 1.2887910604476929, -2.0, -2.0, -2.0, 1.896812379360199, -2.0, -2.0, -0.3827935457229614, 1.2203102111816406, -0.01933866087347269, -0.7158315777778625, -2.0, -1.2400968670845032, -1.4307003617286682, -2.0, -2.0, -2.0, 0.780958503484726, -0.7808625102043152, 0.1938539668917656, -2.0, -2.0, -2.0, -2.0, -2.0, 0.2823576033115387, -0.21426405012607574, -0.09612639248371124, 1.5384037494659424, 0.5127190351486206, 0.341185986995697, -2.0, -2.0, -0.5621238797903061, -2.0, -0.6290893256664276, -2.0, -2.0, -2.0, -1.2789485454559326, -2.0, -1.5400721430778503, -2.0, 0.16536344587802887, -2.0, -1.0128318667411804, -2.0, -2.0, -0.12242888147011399, -2.0, 0.010170969646424055, -2.0, -2.0, -2.916703224182129, -2.0, 2.086046576499939, -1.7576467394828796, 0.8862515091896057, -2.0, -2.0, 0.09595312923192978, 0.08828619867563248, -2.0, -2.0, -2.0, 0.3935004472732544, -2.0, -2.0, -0.2910899966955185, -1.1855316162109375, -1.63238126039505, -0.8594203889369965, -2.0, -0.10927006974816322, -2.0, -2.0, -0.3891156017780304, -0.017538893967866898, -2.0, -2.0, -2.0, 0.10619236901402473, 0.8695965111255646, -2.0, -2.0, -2.0, 1.0407465696334839, 0.819996178150177, 0.22480888664722443, -0.6108378171920776, 1.0826258957386017, -0.6451829075813293, -2.0, -2.0, -2.0, 1.516279935836792, -2.0, -0.44477108865976334, -2.0, -2.0, 1.5999992489814758, 0.5860893875360489, 0.2829367369413376, -0.7556574046611786, -2.0, -2.0, -2.0, -2.0, -2.0, -0.45069995522499084, -0.5138824433088303, -2.0, -2.0, -2.0, -0.48282699286937714, -2.0, 0.28207529336214066, -0.841771811246872, -2.0, -2.192795991897583, -2.0, -0.4348424971103668, -2.0, -2.0, -0.8091963529586792, -2.0, -2.0, -0.32520192861557007, 1.3489069938659668, -0.14562151208519936, -0.7622292637825012, 0.03636917471885681, -0.6823522001504898, 1.4841539859771729, -2.0, -2.0, -2.0, -2.0, -0.778560996055603, -0.073344970587641, -0.24660389125347137, -0.1942467764019966, -2.0, -2.0, -2.0, 1.0407465696334839, -2.0, -0.760482668876648, -2.0, -2.0, -2.0, 1.002420574426651, 0.5606636926531792, -0.42600373923778534, -0.97832190990448, -0.4304448068141937, -2.0, -2.0, -2.0, -1.3113325834274292, 0.014566557481884956, -2.0, -2.0, -2.0, 0.19178979098796844, -2.0, -2.0, -0.17737357504665852, -2.0, 1.9792935848236084, 0.6965378820896149, -2.0, 1.1528103947639465, -2.0, -2.0, -2.0, 1.1329474449157715, 0.6572469770908356, 1.4332432746887207, 0.516125351190567, -2.0, -2.0, -2.0, -2.0, -2.0, 0.7163709104061127, -1.2976526618003845, 0.4299631863832474, -2.0, -2.0, 0.4342130720615387, -1.7134165167808533, -2.0, 0.13648398965597153, -2.0, 0.9666219018399715, -2.0, 1.896812379360199, -2.0, -2.0, -2.0, 0.1018289178609848, 0.4404587298631668, -1.3223093152046204, -1.368359625339508, -2.0, -2.0, 3.6711010187864304, -2.0, -2.0, -0.31520384550094604, 0.9512083828449249, 0.04021975211799145, -2.0, -2.0, -2.0, -2.0, 1.7457078099250793, -2.0, -2.0, -0.5927734076976776, -1.0519222021102905, -2.0, -0.2890944480895996, -0.27687592059373856, -2.0, -2.0, -1.1823381781578064, -2.0, -2.0, -0.2890011668205261, 1.7711780667304993, 0.49323177337646484, -1.2137101888656616, -1.189728856086731, -2.0, 0.8862515091896057, -2.0, -2.0, -0.7213102579116821, 0.7429243922233582, -2.0, -2.0, 3.0763992071151733, 2.2409255504608154, -2.0, -2.0, -2.0, 0.01706323493272066, -2.0, 1.631238579750061, -1.8191384077072144, 0.4404587149620056, -2.0, -2.0, 1.1123589277267456, -2.0, -2.0, -2.0, 1.0261911153793335, -2.0, -2.0, -0.34014083445072174, 1.896812379360199, 1.4389877915382385, 1.727686882019043, -2.0, -1.5647065490484238, -2.0, -2.0, 0.3093120604753494, -0.18770089745521545, -2.0, -2.0, -2.0, -0.37419529259204865, -2.0, -2.0, -2.0, -0.15367692708969116, -0.25945743173360825, 0.9869827330112457, 0.2870578020811081, -1.5918635725975037, -2.0, 2.398588001728058, -2.0, -2.0, -0.7612957656383514, -0.6756238043308258, -2.0, -2.0, -2.0, -2.3827430605888367, -2.0, -2.0, 0.23713167011737823, 0.5024754554033279, -1.4095342755317688, -2.0, 0.2660471200942993, 0.7129335403442383, -2.0, 0.5540378838777542, -2.0, -2.0, -0.4850638508796692, -2.0, -0.3959101364016533, -2.0, -2.0, -2.0, -0.45010142028331757, 0.2891255021095276, -2.0, -2.0, 1.5946440696716309, -0.6937848329544067, -0.5609863735735416, 0.8174916803836823, -2.0, -2.0, -0.8279476463794708, -2.0, -2.0, -2.0, 1.6189119815826416, -2.0, -2.0, 0.5683541893959045, -1.2677225470542908, 1.5162798762321472, -2.0, -2.0, 1.7608411312103271, -2.0, -0.07245233282446861, -2.0, -2.0, 0.8136960864067078, -1.2878464460372925, -0.39601196348667145, -0.5432072579860687, -2.0, -2.0, -2.0, 0.8210179507732391, -2.0, -0.5609863847494125, -2.0, -0.34341177344322205, -2.0, -2.0, -2.0, 0.10995055362582207, -0.21426405012607574, -1.2976526618003845, -0.19631565548479557, -0.9994358867406845, -2.0, -2.0, -0.5621238946914673, 0.04021975211799145, -2.0, -2.0, -2.0, 2.1938143968582153, -0.24305393546819687, -0.6396992206573486, 1.896812379360199, 0.355416938662529, -2.0, -2.0, -2.0, 0.03225860372185707, 1.5383304357528687, -2.0, -2.0, -2.0, -1.241136610507965, 0.6603574156761169, -2.0, -0.007794804871082306, -2.0, -2.0, -2.0, -2.0, -0.5700449645519257, -0.45457933843135834, 0.377984881401062, -2.0, -2.0, -2.0, -0.5363455712795258, -2.0, 3.0778807401657104, -2.0, -2.0, -1.3690165877342224, -2.0, 0.2823576033115387, 0.6318980157375336, -2.0, -2.0, 0.16270048916339874, 2.236530065536499, -0.3221428841352463, -0.18379081785678864, -0.766914963722229, -2.0, -2.0, -2.0, -2.0, 1.1911450624465942, -2.0, -2.0, 0.01751450076699257, -2.0, -0.7049763947725296, 0.7176415324211121, 0.3064989149570465, -2.0, -2.0, -2.0, -0.41048769652843475, -2.0, -2.0 };
+static const int RF_LEFT[] = { 1, 2, 3, 4, 5, -1, -1, -1, -1, 10, -1, 12, 13, -1, -1, 16, -1, -1, 19, 20, -1, 22, -1, -1, 25, 26, 27, 28, 29, -1, 31, -1, -1, 34, 35, -1, -1, -1, 39, -1, -1, 42, 43, 44, -1, 46, -1, -1, -1, 50, -1, 52, -1, -1, 55, -1, 57, 58, -1, -1, -1, 62, 63, 64, -1, 66, -1, -1, 69, -1, 71, 72, 73, -1, -1, -1, -1, 78, 79, -1, 81, -1, -1, 84, 85, 86, 87, -1, 89, -1, 91, -1, -1, 94, 95, -1, -1, -1, 99, 100, 101, 102, -1, -1, -1, 106, 107, -1, -1, -1, 111, 112, -1, 114, -1, -1, 117, 118, -1, -1, -1, -1, 123, 124, 125, -1, 127, -1, -1, 130, 131, 132, 133, -1, -1, -1, -1, 138, 139, -1, -1, -1, 143, 144, 145, -1, 147, 148, -1, 150, -1, 152, -1, -1, 155, -1, 157, 158, -1, -1, 161, -1, -1, -1, 165, 166, 167, -1, -1, -1, 171, -1, 173, -1, -1, 176, 177, 178, 179, -1, 181, -1, -1, 184, 185, -1, -1, -1, 189, -1, 191, 192, -1, -1, 195, -1, -1, 198, 199, 200, 201, 202, 203, 204, -1, -1, -1, 208, -1, 210, -1, -1, -1, -1, -1, 216, 217, 218, -1, 220, -1, 222, 223, -1, -1, -1, 227, -1, -1, 230, -1, 232, -1, -1, 235, 236, 237, 238, -1, 240, 241, 242, -1, -1, -1, 246, 247, -1, -1, -1, 251, 252, 253, 254, 255, -1, -1, 258, -1, -1, 261, 262, -1, -1, -1, 266, 267, -1, 269, -1, -1, 272, 273, -1, -1, -1, 277, 278, -1, -1, 281, -1, -1, 284, -1, 286, 287, -1, -1, -1, 291, 292, 293, 294, -1, -1, 297, -1, -1, -1, -1, 302, 303, 304, 305, -1, -1, -1, 309, 310, 311, -1, 313, -1, -1, 316, 317, 318, 319, -1, -1, 322, -1, -1, -1, 326, -1, -1, 329, 330, -1, -1, 333, 334, 335, 336, -1, -1, -1, 340, -1, 342, -1, -1, 345, 346, -1, -1, -1, 350, 351, 352, -1, -1, 355, 356, -1, -1, -1, 360, -1, 362, -1, 364, -1, -1, 367, 368, 369, 370, -1, -1, -1, 374, 375, 376, -1, 378, -1, -1, -1, 382, -1, 384, -1, -1, 387, 388, -1, 390, 391, 392, 393, 394, -1, -1, -1, -1, 399, 400, 401, -1, -1, -1, 405, -1, -1, -1, 409, -1, 411, -1, 413, 414, -1, -1, 417, 418, 419, -1, -1, -1, 423, 424, -1, -1, -1, 428, 429, 430, 431, -1, 433, -1, 435, -1, 437, 438, -1, -1, -1, 442, -1, 444, -1, 446, -1, -1, -1, 450, 451, 452, 453, 454, -1, -1, 457, -1, 459, -1, 461, -1, -1, -1, 465, 466, -1, 468, -1, 470, 471, -1, -1, 474, -1, -1, 477, 478, -1, 480, -1, -1, 483, 484, -1, -1, 487, 488, -1, -1, -1, 492, 493, 494, -1, 496, -1, -1, 499, 500, -1, -1, -1, -1, 505, 506, 507, 508, 509, -1, 511, 512, 513, -1, -1, -1, 517, 518, -1, -1, 521, -1, -1, 524, 525, -1, 527, -1, 529, -1, -1, 532, 533, -1, -1, -1, 537, 538, 539, -1, 541, 542, -1, -1, -1, 546, 547, 548, -1, -1, -1, -1, 553, -1, -1, 556, -1, 558, -1, 560, -1, 562, -1, -1, 565, -1, 567, -1, 569, -1, 571, 572, -1, -1, -1, 576, 577, 578, 579, 580, -1, -1, -1, 584, -1, 586, -1, -1, 589, 590, 591, 592, -1, 594, -1, -1, 597, 598, -1, -1, -1, 602, -1, 604, -1, -1, 607, -1, 609, 610, -1, -1, 613, 614, 615, -1, -1, -1, -1, 620, 621, 622, -1, -1, 625, 626, 627, 628, 629, -1, -1, 632, -1, -1, -1, 636, -1, -1, -1, 640, -1, 642, -1, -1, 645, 646, 647, 648, 649, 650, 651, 652, -1, -1, 655, -1, -1, 658, 659, -1, -1, 662, -1, -1, 665, -1, -1, 668, -1, 670, -1, -1, 673, -1, 675, -1, -1, 678, 679, -1, 681, -1, -1, 684, -1, -1, 687, 688, 689, -1, -1, 692, 693, -1, -1, -1, 697, 698, -1, -1, -1, 702, 703, 704, 705, 706, 707, -1, 709, -1, -1, 712, -1, -1, 715, -1, 717, 718, 719, -1, -1, -1, 723, 724, -1, -1, 727, -1, -1, 730, -1, -1, 733, 734, 735, -1, 737, -1, -1, -1, -1, 742, -1, 744, 745, -1, 747, 748, -1, -1, -1, 752, 753, -1, -1, 756, 757, -1, -1, -1, 761, 762, 763, 764, -1, -1, -1, 768, -1, 770, 771, -1, -1, -1, 775, 776, 777, -1, -1, 780, 781, 782, 783, 784, -1, -1, 787, -1, -1, 790, -1, -1, -1, 794, -1, 796, 797, 798, -1, -1, 801, -1, -1, -1, 805, 806, 807, -1, -1, 810, -1, -1, 813, -1, 815, -1, -1, 818, 819, 820, 821, 822, -1, -1, 825, 826, 827, -1, -1, -1, 831, 832, 833, -1, -1, -1, -1, 838, 839, 840, 841, -1, -1, 844, 845, -1, -1, -1, 849, -1, 851, -1, -1, -1, 855, -1, 857, -1, 859, -1, -1, 862, 863, 864, -1, 866, -1, -1, 869, -1, 871, 872, -1, 874, -1, -1, -1, 878, -1, -1, 881, 882, 883, 884, -1, 886, 887, -1, -1, -1, 891, 892, 893, -1, -1, -1, -1, -1, 899, 900, 901, 902, 903, 904, -1, -1, 907, -1, 909, -1, -1, -1, 913, -1, 915, -1, 917, -1, 919, -1, -1, 922, -1, 924, -1, -1, 927, -1, 929, 930, 931, -1, -1, 934, 935, -1, -1, -1, 939, -1, -1, 942, 943, 944, 945, -1, 947, -1, -1, 950, 951, -1, -1, -1, 955, 956, -1, -1, -1, 960, 961, 962, 963, 964, 965, -1, -1, -1, 969, -1, 971, -1, -1, 974, 975, 976, 977, -1, -1, -1, -1, -1, 983, 984, -1, -1, -1, 988, -1, 990, 991, -1, 993, -1, 995, -1, -1, 998, -1, -1, 1001, 1002, 1003, 1004, 1005, 1006, 1007, -1, -1, -1, -1, 1012, 1013, 1014, 1015, -1, -1, -1, 1019, -1, 1021, -1, -1, -1, 1025, 1026, 1027, 1028, 1029, -1, -1, -1, 1033, 1034, -1, -1, -1, 1038, -1, -1, 1041, -1, 1043, 1044, -1, 1046, -1, -1, -1, 1050, 1051, 1052, 1053, -1, -1, -1, -1, -1, 1059, 1060, 1061, -1, -1, 1064, 1065, -1, 1067, -1, 1069, -1, 1071, -1, -1, -1, 1075, 1076, 1077, 1078, -1, -1, 1081, -1, -1, 1084, 1085, 1086, -1, -1, -1, -1, 1091, -1, -1, 1094, 1095, -1, 1097, 1098, -1, -1, 1101, -1, -1, 1104, 1105, 1106, 1107, 1108, -1, 1110, -1, -1, 1113, 1114, -1, -1, 1117, 1118, -1, -1, -1, 1122, -1, 1124, 1125, 1126, -1, -1, 1129, -1, -1, -1, 1133, -1, -1, 1136, 1137, 1138, 1139, -1, 1141, -1, -1, 1144, 1145, -1, -1, -1, 1149, -1, -1, -1, 1153, 1154, 1155, 1156, 1157, -1, 1159, -1, -1, 1162, 1163, -1, -1, -1, 1167, -1, -1, 1170, 1171, 1172, -1, 1174, 1175, -1, 1177, -1, -1, 1180, -1, 1182, -1, -1, -1, 1186, 1187, -1, -1, 1190, 1191, 1192, 1193, -1, -1, 1196, -1, -1, -1, 1200, -1, -1, 1203, 1204, 1205, -1, -1, 1208, -1, 1210, -1, -1, 1213, 1214, 1215, 1216, -1, -1, -1, 1220, -1, 1222, -1, 1224, -1, -1, -1, 1228, 1229, 1230, 1231, 1232, -1, -1, 1235, 1236, -1, -1, -1, 1240, 1241, 1242, 1243, 1244, -1, -1, -1, 1248, 1249, -1, -1, -1, 1253, 1254, -1, 1256, -1, -1, -1, -1, 1261, 1262, 1263, -1, -1, -1, 1267, -1, 1269, -1, -1, 1272, -1, 1274, 1275, -1, -1, 1278, 1279, 1280, 1281, 1282, -1, -1, -1, -1, 1287, -1, -1, 1290, -1, 1292, 1293, 1294, -1, -1, -1, 1298, -1, -1 };
+static const int RF_RIGHT[] = { 18, 9, 8, 7, 6, -1, -1, -1, -1, 11, -1, 15, 14, -1, -1, 17, -1, -1, 24, 21, -1, 23, -1, -1, 54, 41, 38, 33, 30, -1, 32, -1, -1, 37, 36, -1, -1, -1, 40, -1, -1, 49, 48, 45, -1, 47, -1, -1, -1, 51, -1, 53, -1, -1, 56, -1, 60, 59, -1, -1, -1, 77, 68, 65, -1, 67, -1, -1, 70, -1, 76, 75, 74, -1, -1, -1, -1, 83, 80, -1, 82, -1, -1, 121, 98, 93, 88, -1, 90, -1, 92, -1, -1, 97, 96, -1, -1, -1, 110, 105, 104, 103, -1, -1, -1, 109, 108, -1, -1, -1, 116, 113, -1, 115, -1, -1, 120, 119, -1, -1, -1, -1, 142, 129, 126, -1, 128, -1, -1, 137, 136, 135, 134, -1, -1, -1, -1, 141, 140, -1, -1, -1, 164, 163, 146, -1, 154, 149, -1, 151, -1, 153, -1, -1, 156, -1, 160, 159, -1, -1, 162, -1, -1, -1, 170, 169, 168, -1, -1, -1, 172, -1, 174, -1, -1, 197, 188, 183, 180, -1, 182, -1, -1, 187, 186, -1, -1, -1, 190, -1, 194, 193, -1, -1, 196, -1, -1, 215, 214, 213, 212, 207, 206, 205, -1, -1, -1, 209, -1, 211, -1, -1, -1, -1, -1, 229, 226, 219, -1, 221, -1, 225, 224, -1, -1, -1, 228, -1, -1, 231, -1, 233, -1, -1, 290, 283, 250, 239, -1, 245, 244, 243, -1, -1, -1, 249, 248, -1, -1, -1, 276, 265, 260, 257, 256, -1, -1, 259, -1, -1, 264, 263, -1, -1, -1, 271, 268, -1, 270, -1, -1, 275, 274, -1, -1, -1, 280, 279, -1, -1, 282, -1, -1, 285, -1, 289, 288, -1, -1, -1, 300, 299, 296, 295, -1, -1, 298, -1, -1, -1, -1, 349, 308, 307, 306, -1, -1, -1, 328, 315, 312, -1, 314, -1, -1, 325, 324, 321, 320, -1, -1, 323, -1, -1, -1, 327, -1, -1, 332, 331, -1, -1, 344, 339, 338, 337, -1, -1, -1, 341, -1, 343, -1, -1, 348, 347, -1, -1, -1, 359, 354, 353, -1, -1, 358, 357, -1, -1, -1, 361, -1, 363, -1, 365, -1, -1, 386, 373, 372, 371, -1, -1, -1, 381, 380, 377, -1, 379, -1, -1, -1, 383, -1, 385, -1, -1, 408, 389, -1, 407, 398, 397, 396, 395, -1, -1, -1, -1, 404, 403, 402, -1, -1, -1, 406, -1, -1, -1, 410, -1, 412, -1, 416, 415, -1, -1, 422, 421, 420, -1, -1, -1, 426, 425, -1, -1, -1, 449, 448, 441, 432, -1, 434, -1, 436, -1, 440, 439, -1, -1, -1, 443, -1, 445, -1, 447, -1, -1, -1, 491, 464, 463, 456, 455, -1, -1, 458, -1, 460, -1, 462, -1, -1, -1, 476, 467, -1, 469, -1, 473, 472, -1, -1, 475, -1, -1, 482, 479, -1, 481, -1, -1, 486, 485, -1, -1, 490, 489, -1, -1, -1, 503, 498, 495, -1, 497, -1, -1, 502, 501, -1, -1, -1, -1, 564, 555, 536, 523, 510, -1, 516, 515, 514, -1, -1, -1, 520, 519, -1, -1, 522, -1, -1, 531, 526, -1, 528, -1, 530, -1, -1, 535, 534, -1, -1, -1, 552, 545, 540, -1, 544, 543, -1, -1, -1, 551, 550, 549, -1, -1, -1, -1, 554, -1, -1, 557, -1, 559, -1, 561, -1, 563, -1, -1, 566, -1, 568, -1, 570, -1, 574, 573, -1, -1, -1, 619, 588, 583, 582, 581, -1, -1, -1, 585, -1, 587, -1, -1, 606, 601, 596, 593, -1, 595, -1, -1, 600, 599, -1, -1, -1, 603, -1, 605, -1, -1, 608, -1, 612, 611, -1, -1, 618, 617, 616, -1, -1, -1, -1, 639, 624, 623, -1, -1, 638, 635, 634, 631, 630, -1, -1, 633, -1, -1, -1, 637, -1, -1, -1, 641, -1, 643, -1, -1, 686, 677, 672, 667, 664, 657, 654, 653, -1, -1, 656, -1, -1, 661, 660, -1, -1, 663, -1, -1, 666, -1, -1, 669, -1, 671, -1, -1, 674, -1, 676, -1, -1, 683, 680, -1, 682, -1, -1, 685, -1, -1, 696, 691, 690, -1, -1, 695, 694, -1, -1, -1, 700, 699, -1, -1, -1, 741, 732, 729, 714, 711, 708, -1, 710, -1, -1, 713, -1, -1, 716, -1, 722, 721, 720, -1, -1, -1, 726, 725, -1, -1, 728, -1, -1, 731, -1, -1, 740, 739, 736, -1, 738, -1, -1, -1, -1, 743, -1, 751, 746, -1, 750, 749, -1, -1, -1, 755, 754, -1, -1, 759, 758, -1, -1, -1, 774, 767, 766, 765, -1, -1, -1, 769, -1, 773, 772, -1, -1, -1, 804, 779, 778, -1, -1, 793, 792, 789, 786, 785, -1, -1, 788, -1, -1, 791, -1, -1, -1, 795, -1, 803, 800, 799, -1, -1, 802, -1, -1, -1, 812, 809, 808, -1, -1, 811, -1, -1, 814, -1, 816, -1, -1, 861, 854, 837, 824, 823, -1, -1, 830, 829, 828, -1, -1, -1, 836, 835, 834, -1, -1, -1, -1, 853, 848, 843, 842, -1, -1, 847, 846, -1, -1, -1, 850, -1, 852, -1, -1, -1, 856, -1, 858, -1, 860, -1, -1, 877, 868, 865, -1, 867, -1, -1, 870, -1, 876, 873, -1, 875, -1, -1, -1, 879, -1, -1, 898, 897, 890, 885, -1, 889, 888, -1, -1, -1, 896, 895, 894, -1, -1, -1, -1, -1, 926, 921, 912, 911, 906, 905, -1, -1, 908, -1, 910, -1, -1, -1, 914, -1, 916, -1, 918, -1, 920, -1, -1, 923, -1, 925, -1, -1, 928, -1, 938, 933, 932, -1, -1, 937, 936, -1, -1, -1, 940, -1, -1, 959, 954, 949, 946, -1, 948, -1, -1, 953, 952, -1, -1, -1, 958, 957, -1, -1, -1, 987, 982, 973, 968, 967, 966, -1, -1, -1, 970, -1, 972, -1, -1, 981, 980, 979, 978, -1, -1, -1, -1, -1, 986, 985, -1, -1, -1, 989, -1, 997, 992, -1, 994, -1, 996, -1, -1, 999, -1, -1, 1058, 1049, 1024, 1011, 1010, 1009, 1008, -1, -1, -1, -1, 1023, 1018, 1017, 1016, -1, -1, -1, 1020, -1, 1022, -1, -1, -1, 1040, 1037, 1032, 1031, 1030, -1, -1, -1, 1036, 1035, -1, -1, -1, 1039, -1, -1, 1042, -1, 1048, 1045, -1, 1047, -1, -1, -1, 1057, 1056, 1055, 1054, -1, -1, -1, -1, -1, 1074, 1063, 1062, -1, -1, 1073, 1066, -1, 1068, -1, 1070, -1, 1072, -1, -1, -1, 1090, 1083, 1080, 1079, -1, -1, 1082, -1, -1, 1089, 1088, 1087, -1, -1, -1, -1, 1092, -1, -1, 1103, 1096, -1, 1100, 1099, -1, -1, 1102, -1, -1, 1135, 1132, 1121, 1112, 1109, -1, 1111, -1, -1, 1116, 1115, -1, -1, 1120, 1119, -1, -1, -1, 1123, -1, 1131, 1128, 1127, -1, -1, 1130, -1, -1, -1, 1134, -1, -1, 1151, 1148, 1143, 1140, -1, 1142, -1, -1, 1147, 1146, -1, -1, -1, 1150, -1, -1, -1, 1202, 1169, 1166, 1161, 1158, -1, 1160, -1, -1, 1165, 1164, -1, -1, -1, 1168, -1, -1, 1185, 1184, 1173, -1, 1179, 1176, -1, 1178, -1, -1, 1181, -1, 1183, -1, -1, -1, 1189, 1188, -1, -1, 1199, 1198, 1195, 1194, -1, -1, 1197, -1, -1, -1, 1201, -1, -1, 1212, 1207, 1206, -1, -1, 1209, -1, 1211, -1, -1, 1226, 1219, 1218, 1217, -1, -1, -1, 1221, -1, 1223, -1, 1225, -1, -1, -1, 1271, 1260, 1239, 1234, 1233, -1, -1, 1238, 1237, -1, -1, -1, 1259, 1252, 1247, 1246, 1245, -1, -1, -1, 1251, 1250, -1, -1, -1, 1258, 1255, -1, 1257, -1, -1, -1, -1, 1266, 1265, 1264, -1, -1, -1, 1268, -1, 1270, -1, -1, 1273, -1, 1277, 1276, -1, -1, 1289, 1286, 1285, 1284, 1283, -1, -1, -1, -1, 1288, -1, -1, 1291, -1, 1297, 1296, 1295, -1, -1, -1, 1299, -1, -1 };
+static const float RF_PROB1[] = { 0, 0, 0, 0, 0, 1.0, 0.0, 0.0, 1.0, 0, 1.0, 0, 0, 1.0, 0.0, 0, 0.0, 1.0, 0, 0, 1.0, 0, 0.0, 1.0, 0, 0, 0, 0, 0, 0.0, 0, 0.16666666666666666, 0.0, 0, 0, 0.044444444444444446, 1.0, 1.0, 0, 1.0, 0.0, 0, 0, 0, 0.0, 0, 1.0, 0.0, 1.0, 0, 0.0, 0, 1.0, 0.0, 0, 0.0, 0, 0, 0.0, 1.0, 0.0, 0, 0, 0, 1.0, 0, 1.0, 0.0, 0, 0.0, 0, 0, 0, 1.0, 0.0, 0.0, 1.0, 0, 0, 1.0, 0, 0.0, 1.0, 0, 0, 0, 0, 0.0, 0, 0.0, 0, 1.0, 0.0, 0, 0, 1.0, 0.0, 0.0, 0, 0, 0, 0, 0.14285714285714285, 0.03125, 1.0, 0, 0, 0.0, 1.0, 0.0, 0, 0, 0.0, 0, 1.0, 0.16666666666666666, 0, 0, 1.0, 0.0, 1.0, 1.0, 0, 0, 0, 0.0, 0, 1.0, 0.0, 0, 0, 0, 0, 1.0, 0.0, 1.0, 0.0, 0, 0, 0.0, 1.0, 1.0, 0, 0, 0, 0.0, 0, 0, 1.0, 0, 0.0, 0, 0.0, 1.0, 0, 1.0, 0, 0, 1.0, 0.2, 0, 0.04, 1.0, 1.0, 0, 0, 0, 0.0, 1.0, 1.0, 0, 0.0, 0, 1.0, 0.0, 0, 0, 0, 0, 1.0, 0, 1.0, 0.0, 0, 0, 0.0, 1.0, 0.0, 0, 0.0, 0, 0, 0.0, 1.0, 0, 0.0, 1.0, 0, 0, 0, 0, 0, 0, 0, 0.2222222222222222, 0.0, 1.0, 0, 0.0, 0, 0.8888888888888888, 0.3, 1.0, 1.0, 1.0, 0, 0, 0, 0.0, 0, 1.0, 0, 0, 0.07142857142857142, 0.0, 0.0, 0, 1.0, 0.0, 0, 0.0, 0, 1.0, 0.0, 0, 0, 0, 0, 0.0, 0, 0, 0, 1.0, 0.0, 1.0, 0, 0, 0.0, 1.0, 0.0, 0, 0, 0, 0, 0, 0.2, 0.0, 0, 0.125, 1.0, 0, 0, 0.0, 0.5, 0.0, 0, 0, 0.0, 0, 1.0, 0.0, 0, 0, 0.0, 1.0, 0.0, 0, 0, 0.0, 1.0, 0, 1.0, 0.0, 0, 1.0, 0, 0, 0.0, 1.0, 0.0, 0, 0, 0, 0, 1.0, 0.0, 0, 1.0, 0.0, 1.0, 1.0, 0, 0, 0, 0, 1.0, 0.0, 1.0, 0, 0, 0, 0.0, 0, 1.0, 0.0, 0, 0, 0, 0, 0.01694915254237288, 0.25, 0, 1.0, 0.0, 1.0, 0, 1.0, 0.0, 0, 0, 1.0, 0.0, 0, 0, 0, 0, 1.0, 0.0, 0.0, 0, 0.0, 0, 0.0, 1.0, 0, 0, 1.0, 0.0, 0.0, 0, 0, 0, 0.0, 1.0, 0, 0, 0.0, 1.0, 1.0, 0, 1.0, 0, 0.0, 0, 1.0, 0.0, 0, 0, 0, 0, 1.0, 0.0, 0.0, 0, 0, 0, 0.0, 0, 1.0, 0.0, 1.0, 0, 1.0, 0, 0.0, 1.0, 0, 0, 0.0, 0, 0, 0, 0, 0, 0.0, 1.0, 1.0, 0.0, 0, 0, 0, 1.0, 0.0, 0.0, 0, 0.0, 1.0, 1.0, 0, 1.0, 0, 0.0, 0, 0, 0.0, 1.0, 0, 0, 0, 0.3333333333333333, 0.0, 1.0, 0, 0, 0.16666666666666666, 0.0196078431372549, 0.0, 0, 0, 0, 0, 1.0, 0, 1.0, 0, 0.0, 0, 0, 1.0, 0.0, 0.0, 0, 1.0, 0, 1.0, 0, 0.0, 1.0, 0.0, 0, 0, 0, 0, 0, 1.0, 0.0, 0, 1.0, 0, 1.0, 0, 1.0, 0.0, 0.0, 0, 0, 1.0, 0, 0.0, 0, 0, 0.0, 1.0, 0, 0.0, 1.0, 0, 0, 0.0, 0, 1.0, 0.0, 0, 0, 0.0, 1.0, 0, 0, 0.25, 0.0, 1.0, 0, 0, 0, 0.0, 0, 1.0, 0.0, 0, 0, 0.0, 1.0, 0.0, 1.0, 0, 0, 0, 0, 0, 1.0, 0, 0, 0, 0.5714285714285714, 0.0, 0.0, 0, 0, 0.125, 0.0, 0, 0.0, 1.0, 0, 0, 0.0, 0, 0.0, 0, 0.0, 1.0, 0, 0, 0.0, 1.0, 0.0, 0, 0, 0, 1.0, 0, 0, 0.0, 1.0, 0.0, 0, 0, 0, 0.0, 1.0, 1.0, 0.0, 0, 0.0, 1.0, 0, 1.0, 0, 0.0, 0, 1.0, 0, 0.0, 1.0, 0, 1.0, 0, 1.0, 0, 0.0, 0, 0, 0.0, 1.0, 1.0, 0, 0, 0, 0, 0, 0.0, 1.0, 0.0, 0, 0.0, 0, 1.0, 0.0, 0, 0, 0, 0, 1.0, 0, 1.0, 0.0, 0, 0, 0.0, 1.0, 0.0, 0, 0.0, 0, 0.0, 1.0, 0, 1.0, 0, 0, 0.0, 1.0, 0, 0, 0, 0.3333333333333333, 0.045454545454545456, 1.0, 1.0, 0, 0, 0, 0.0, 1.0, 0, 0, 0, 0, 0, 0.16666666666666666, 0.0, 0, 0.0, 1.0, 0.0, 0, 1.0, 0.0, 1.0, 0, 0.0, 0, 0.0, 1.0, 0, 0, 0, 0, 0, 0, 0, 0, 0.0, 0.5, 0, 1.0, 0.29411764705882354, 0, 0, 0.1388888888888889, 0.012578616352201259, 0, 1.0, 0.0, 0, 0.0, 1.0, 0, 1.0, 0, 1.0, 0.0, 0, 0.0, 0, 1.0, 0.0, 0, 0, 0.0, 0, 1.0, 0.0, 0, 1.0, 0.0, 0, 0, 0, 1.0, 0.0, 0, 0, 1.0, 0.0, 1.0, 0, 0, 1.0, 0.0, 0.0, 0, 0, 0, 0, 0, 0, 0.0, 0, 1.0, 0.0, 0, 0.0, 1.0, 0, 1.0, 0, 0, 0, 0.03571428571428571, 0.6666666666666666, 0.0, 0, 0, 0.0, 0.7272727272727273, 0, 1.0, 0.0, 0, 0.0, 1.0, 0, 0, 0, 0.0, 0, 1.0, 0.0, 0.0, 1.0, 0, 1.0, 0, 0, 1.0, 0, 0, 1.0, 0.0, 0.0, 0, 0, 0.0, 1.0, 0, 0, 1.0, 0.0, 1.0, 0, 0, 0, 0, 1.0, 0.0, 0.0, 0, 1.0, 0, 0, 1.0, 0.0, 1.0, 0, 0, 0, 1.0, 0.0, 0, 0, 0, 0, 0, 1.0, 0.024390243902439025, 0, 0.02631578947368421, 0.0, 0, 1.0, 0.0, 1.0, 0, 0.0, 0, 0, 0, 1.0, 0.0625, 0, 0.0, 1.0, 0.0, 0, 0, 0, 1.0, 0.0, 0, 1.0, 0.0, 0, 0.0, 0, 1.0, 0.0, 0, 0, 0, 0, 0, 0.0, 1.0, 0, 0, 0, 0.0, 1.0, 1.0, 0, 0, 0, 0.0, 1.0, 0.0, 0.0, 0, 0, 0, 0, 1.0, 0.0, 0, 0, 0.0, 1.0, 0.0, 0, 1.0, 0, 1.0, 0.0, 0.0, 0, 1.0, 0, 1.0, 0, 1.0, 0.0, 0, 0, 0, 0.0, 0, 1.0, 0.0, 0, 0.0, 0, 0, 0.0, 0, 1.0, 0.0, 1.0, 0, 1.0, 0.0, 0, 0, 0, 0, 0.0, 0, 0, 1.0, 0.0, 1.0, 0, 0, 0, 1.0, 0.0, 0.0, 1.0, 1.0, 0, 0, 0, 0, 0, 0, 0.0, 1.0, 0, 1.0, 0, 0.46153846153846156, 0.08333333333333333, 1.0, 0, 0.0, 0, 0.0, 0, 1.0, 0, 0.0, 1.0, 0, 1.0, 0, 0.0, 1.0, 0, 1.0, 0, 0, 0, 1.0, 0.0, 0, 0, 0.0, 1.0, 0.0, 0, 1.0, 0.0, 0, 0, 0, 0, 1.0, 0, 1.0, 0.0, 0, 0, 1.0, 0.0, 0.0, 0, 0, 1.0, 0.0, 1.0, 0, 0, 0, 0, 0, 0, 1.0, 0.0, 1.0, 0, 0.0, 0, 0.0, 1.0, 0, 0, 0, 0, 1.0, 0.0, 0.0, 1.0, 0.0, 0, 0, 1.0, 0.0, 0.0, 0, 0.0, 0, 0, 0.0, 0, 0.0, 0, 0.0, 1.0, 0, 1.0, 0.0, 0, 0, 0, 0, 0, 0, 0, 1.0, 0.0, 0.0, 1.0, 0, 0, 0, 0, 0.0, 1.0, 1.0, 0, 0.0, 0, 1.0, 0.1111111111111111, 0.0, 0, 0, 0, 0, 0, 0.0, 1.0, 0.0, 0, 0, 0.5, 0.0, 0.0, 0, 0.0, 1.0, 0, 1.0, 0, 0, 0.0, 0, 1.0, 0.0, 1.0, 0, 0, 0, 0, 0.0, 1.0, 1.0, 1.0, 0.0, 0, 0, 0, 1.0, 0.0, 0, 0, 0.0, 0, 1.0, 0, 1.0, 0, 0.0, 1.0, 0.0, 0, 0, 0, 0, 1.0, 0.0, 0, 1.0, 0.0, 0, 0, 0, 0.0, 1.0, 0.0, 1.0, 0, 1.0, 0.0, 0, 0, 0.0, 0, 0, 1.0, 0.0, 0, 0.0, 1.0, 0, 0, 0, 0, 0, 1.0, 0, 1.0, 0.0, 0, 0, 0.0, 1.0, 0, 0, 0.023255813953488372, 0.2, 1.0, 0, 0.0, 0, 0, 0, 0.0, 1.0, 0, 0.8571428571428571, 0.4, 0.0, 0, 1.0, 0.0, 0, 0, 0, 0, 1.0, 0, 0.0, 1.0, 0, 0, 0.0, 1.0, 1.0, 0, 0.0, 1.0, 0.0, 0, 0, 0, 0, 0, 1.0, 0, 0.0, 1.0, 0, 0, 0.0, 1.0, 1.0, 0, 1.0, 0.0, 0, 0, 0, 1.0, 0, 0, 0.0, 0, 0.0, 1.0, 0, 0.0, 0, 0.0, 0.9230769230769231, 1.0, 0, 0, 0.0, 1.0, 0, 0, 0, 0, 0.0, 1.0, 0, 0.0, 0.13333333333333333, 0.0, 0, 1.0, 0.0, 0, 0, 0, 1.0, 0.0, 0, 1.0, 0, 0.0, 1.0, 0, 0, 0, 0, 1.0, 0.0, 0.0, 0, 1.0, 0, 1.0, 0, 0.0, 1.0, 0.0, 0, 0, 0, 0, 0, 0.0, 1.0, 0, 0, 0.0, 1.0, 0.0, 0, 0, 0, 0, 0, 0.041666666666666664, 0.5, 1.0, 0, 0, 0.0, 1.0, 1.0, 0, 0, 0.0, 0, 1.0, 0.0, 1.0, 0.0, 0, 0, 0, 0.0, 1.0, 1.0, 0, 0.0, 0, 1.0, 0.0, 0, 1.0, 0, 0, 0.0, 1.0, 0, 0, 0, 0, 0, 1.0, 0.0, 0.0, 0.0, 0, 1.0, 0.0, 0, 0.0, 0, 0, 0, 0.0, 1.0, 1.0, 0, 1.0, 0.0 };
+static const int RF_TREE_ORDER[] = { 13, 18, 6, 5, 2, 0, 16, 9, 15, 1, 19, 4, 7, 8, 12, 11, 3, 14, 17, 10 };
@@ -0,0 +1,67 @@
+#pragma once
+#include <cmath>
+#include "tsassure_settings.h"
+#include "checkpoint.h"
+
+float prev_raw[NUM_RAW_INPUTS];
+bool first_run = true;
+
+// What a checkpoint saves (checkpoint.h): the previous reading.
+int tsassure_checkpoint_regions(CheckpointRegion* out) {
+    out[0] = { prev_raw, sizeof(prev_raw) };
+    out[1] = { &first_run, sizeof(first_run) };
+    return 2;
+}
+
+// Forgets the previous reading as a reboot would, for the reset command.
+void reset_tsassure_state() {
+    for(int i=0; i<NUM_RAW_INPUTS; i++) prev_raw[i] = 0.0f;
+    first_run = true;
+}
+
+// Makes raw the previous reading without computing features (the pre-filter
+// uses it for readings it decides on its own).
+void push_tsassure_sample(const float* raw) {
+    for(int i=0; i<NUM_RAW_INPUTS; i++) prev_raw[i] = raw[i];
+    first_run = false;
+}
+
+// ================= FEATURE EXTRACTION =================
+void extract_tsassure_features(float* raw, float* out) {
+    int f_idx = 0;
+    
+    // 1. Raw & DiffMain
+    out[f_idx++] = raw[IDX_MAIN_COL];
+    for(int i=0; i<NUM_RAW_INPUTS; i++) {
+        if(i == IDX_MAIN_COL) continue;
+        out[f_idx++] = raw[i];
+        out[f_idx++] = raw[IDX_MAIN_COL] - raw[i]; 
+    }
+
+    // 2. Speed
+    for(int i=0; i<NUM_RAW_INPUTS; i++) {
+        float diff = first_run ? 0.0f : (raw[i] - prev_raw[i]);
+        out[f_idx++] = diff;
+    }
+
+    // 3. PRD
+    float prd = 0.0f;
+    if (!first_run) {
+        float curr = raw[IDX_MAIN_COL];
+        float prev = prev_raw[IDX_MAIN_COL];
+        float denom = (curr + prev) * 0.5f;
+        if(std::abs(denom) > 1e-9f) prd = std::abs(curr - prev) / denom;
+    }
+    out[f_idx++] = prd;
+
+    // 4. Pairs
+    #if NUM_PAIRS > 0
+    for(int i=0; i<NUM_PAIRS; i++) {
+        int c1 = CORR_PAIRS[i][0];
+        int c2 = CORR_PAIRS[i][1];
+        out[f_idx++] = raw[c1] - raw[c2];
+    }
+    #endif
+    
+    push_tsassure_sample(raw);
+}
@@ -1,7 +1,8 @@
 #pragma once
 #include <cmath>
 #include <vector>
-#include "model_edge.h" 
+#include "model_edge.h"
+#include "rf_early_exit.h" 
 #include "tsassure_settings.h"
 
 int predict_rf(const float* features, float* out_score) {
@@ -32,4 +33,44 @@ int predict_rf(const float* features, float* out_score) {
     float avg_prob = total_prob1 / (float)RF_N_TREES;
     if(out_score) *out_score = avg_prob;
     return (avg_prob >= 0.5f) ? 1 : 0;
+}
+
+// ================= EARLY EXIT =================
+// Label-only prediction (see rf_early_exit.h). Defaults keep the reference
+// behaviour; override with build flags, e.g. -DRF_EXIT_POLICY=RF_EXIT_EXACT.
+#ifndef RF_EXIT_POLICY
+#define RF_EXIT_POLICY RF_EXIT_OFF
+#endif
+#ifndef RF_EXIT_CONF_MARGIN
+#define RF_EXIT_CONF_MARGIN 0.3f
+#endif
+#ifndef RF_EXIT_MIN_TREES
+#define RF_EXIT_MIN_TREES 3
+#endif
+#ifndef RF_EXIT_ORDERED
+#define RF_EXIT_ORDERED 1
+#endif
+
+RfExitConfig rf_exit_config = { RF_EXIT_POLICY, RF_EXIT_CONF_MARGIN, RF_EXIT_MIN_TREES, RF_EXIT_ORDERED };
+
+int predict_rf_early(const float* features, float* out_score, int* out_trees) {
+    static float rem[4][RF_N_TREES + 1];
+    static RfExitTables tables[2] = { { nullptr, rem[0], rem[1] }, { RF_TREE_ORDER, rem[2], rem[3] } };
+    static bool ready[2] = { false, false };
+    int which = rf_exit_config.ordered ? 1 : 0;
+    if(!ready[which]) {
+        rf_exit_build_tables(RF_N_TREES, RF_TREE_OFFSETS[RF_N_TREES], RF_TREE_OFFSETS, RF_LEFT, RF_PROB1, tables[which]);
+        ready[which] = true;
+    }
+
+    std::vector<float> z(TS_N_FEATURES);
+    for(int i=0; i<TS_N_FEATURES; i++) {
+        float s = RF_SCALE_STD[i];
+        if(s < 1e-9f) s = 1.0f;
+        z[i] = (features[i] - RF_SCALE_MEAN[i]) / s;
+    }
+
+    return rf_vote_early_exit(z.data(), RF_N_TREES, RF_TREE_OFFSETS, RF_FEATURE, RF_THRESHOLD,
+                              RF_LEFT, RF_RIGHT, RF_PROB1, tables[which], rf_exit_config,
+                              out_score, out_trees);
 }
\ No newline at end of file
@@ -10,3 +10,4 @@ static const float RF_THRESHOLD[] = { -0.28226880729198456, -1.2266822457313538,
 static const int RF_LEFT[] = { 1, 2, 3, 4, 5, -1, -1, -1, -1, 10, -1, 12, 13, -1, -1, 16, -1, -1, 19, 20, -1, 22, -1, -1, 25, 26, 27, 28, 29, -1, 31, -1, -1, 34, 35, -1, -1, -1, 39, -1, -1, 42, 43, 44, -1, 46, -1, -1, -1, 50, -1, 52, -1, -1, 55, -1, 57, 58, -1, -1, -1, 62, 63, 64, -1, 66, -1, -1, 69, -1, 71, 72, 73, -1, -1, -1, -1, 78, 79, -1, 81, -1, -1, 84, 85, 86, 87, -1, 89, -1, 91, -1, -1, 94, 95, -1, -1, -1, 99, 100, 101, 102, -1, -1, -1, 106, 107, -1, -1, -1, 111, 112, -1, 114, -1, -1, 117, 118, -1, -1, -1, -1, 123, 124, 125, -1, 127, -1, -1, 130, 131, 132, 133, -1, -1, -1, -1, 138, 139, -1, -1, -1, 143, 144, 145, -1, 147, 148, -1, 150, -1, 152, -1, -1, 155, -1, 157, 158, -1, -1, 161, -1, -1, -1, 165, 166, 167, -1, -1, -1, 171, -1, 173, -1, -1, 176, 177, 178, 179, -1, 181, -1, -1, 184, 185, -1, -1, -1, 189, -1, 191, 192, -1, -1, 195, -1, -1, 198, 199, 200, 201, 202, 203, 204, -1, -1, -1, 208, -1, 210, -1, -1, -1, -1, -1, 216, 217, 218, -1, 220, -1, 222, 223, -1, -1, -1, 227, -1, -1, 230, -1, 232, -1, -1, 235, 236, 237, 238, -1, 240, 241, 242, -1, -1, -1, 246, 247, -1, -1, -1, 251, 252, 253, 254, 255, -1, -1, 258, -1, -1, 261, 262, -1, -1, -1, 266, 267, -1, 269, -1, -1, 272, 273, -1, -1, -1, 277, 278, -1, -1, 281, -1, -1, 284, -1, 286, 287, -1, -1, -1, 291, 292, 293, 294, -1, -1, 297, -1, -1, -1, -1, 302, 303, 304, 305, -1, -1, -1, 309, 310, 311, -1, 313, -1, -1, 316, 317, 318, 319, -1, -1, 322, -1, -1, -1, 326, -1, -1, 329, 330, -1, -1, 333, 334, 335, 336, -1, -1, -1, 340, -1, 342, -1, -1, 345, 346, -1, -1, -1, 350, 351, 352, -1, -1, 355, 356, -1, -1, -1, 360, -1, 362, -1, 364, -1, -1, 367, 368, 369, 370, -1, -1, -1, 374, 375, 376, -1, 378, -1, -1, -1, 382, -1, 384, -1, -1, 387, 388, -1, 390, 391, 392, 393, 394, -1, -1, -1, -1, 399, 400, 401, -1, -1, -1, 405, -1, -1, -1, 409, -1, 411, -1, 413, 414, -1, -1, 417, 418, 419, -1, -1, -1, 423, 424, -1, -1, -1, 428, 429, 430, 431, -1, 433, -1, 435, -1, 437, 438, -1, -1, -1, 442, -1, 444, -1, 446, -1, -1, -1, 450, 451, 452, 453, 454, -1, -1, 457, -1, 459, -1, 461, -1, -1, -1, 465, 466, -1, 468, -1, 470, 471, -1, -1, 474, -1, -1, 477, 478, -1, 480, -1, -1, 483, 484, -1, -1, 487, 488, -1, -1, -1, 492, 493, 494, -1, 496, -1, -1, 499, 500, -1, -1, -1, -1, 505, 506, 507, 508, 509, -1, 511, 512, 513, -1, -1, -1, 517, 518, -1, -1, 521, -1, -1, 524, 525, -1, 527, -1, 529, -1, -1, 532, 533, -1, -1, -1, 537, 538, 539, -1, 541, 542, -1, -1, -1, 546, 547, 548, -1, -1, -1, -1, 553, -1, -1, 556, -1, 558, -1, 560, -1, 562, -1, -1, 565, -1, 567, -1, 569, -1, 571, 572, -1, -1, -1, 576, 577, 578, 579, 580, -1, -1, -1, 584, -1, 586, -1, -1, 589, 590, 591, 592, -1, 594, -1, -1, 597, 598, -1, -1, -1, 602, -1, 604, -1, -1, 607, -1, 609, 610, -1, -1, 613, 614, 615, -1, -1, -1, -1, 620, 621, 622, -1, -1, 625, 626, 627, 628, 629, -1, -1, 632, -1, -1, -1, 636, -1, -1, -1, 640, -1, 642, -1, -1, 645, 646, 647, 648, 649, 650, 651, 652, -1, -1, 655, -1, -1, 658, 659, -1, -1, 662, -1, -1, 665, -1, -1, 668, -1, 670, -1, -1, 673, -1, 675, -1, -1, 678, 679, -1, 681, -1, -1, 684, -1, -1, 687, 688, 689, -1, -1, 692, 693, -1, -1, -1, 697, 698, -1, -1, -1, 702, 703, 704, 705, 706, 707, -1, 709, -1, -1, 712, -1, -1, 715, -1, 717, 718, 719, -1, -1, -1, 723, 724, -1, -1, 727, -1, -1, 730, -1, -1, 733, 734, 735, -1, 737, -1, -1, -1, -1, 742, -1, 744, 745, -1, 747, 748, -1, -1, -1, 752, 753, -1, -1, 756, 757, -1, -1, -1, 761, 762, 763, 764, -1, -1, -1, 768, -1, 770, 771, -1, -1, -1, 775, 776, 777, -1, -1, 780, 781, 782, 783, 784, -1, -1, 787, -1, -1, 790, -1, -1, -1, 794, -1, 796, 797, 798, -1, -1, 801, -1, -1, -1, 805, 806, 807, -1, -1, 810, -1, -1, 813, -1, 815, -1, -1, 818, 819, 820, 821, 822, -1, -1, 825, 826, 827, -1, -1, -1, 831, 832, 833, -1, -1, -1, -1, 838, 839, 840, 841, -1, -1, 844, 845, -1, -1, -1, 849, -1, 851, -1, -1, -1, 855, -1, 857, -1, 859, -1, -1, 862, 863, 864, -1, 866, -1, -1, 869, -1, 871, 872, -1, 874, -1, -1, -1, 878, -1, -1, 881, 882, 883, 884, -1, 886, 887, -1, -1, -1, 891, 892, 893, -1, -1, -1, -1, -1, 899, 900, 901, 902, 903, 904, -1, -1, 907, -1, 909, -1, -1, -1, 913, -1, 915, -1, 917, -1, 919, -1, -1, 922, -1, 924, -1, -1, 927, -1, 929, 930, 931, -1, -1, 934, 935, -1, -1, -1, 939, -1, -1, 942, 943, 944, 945, -1, 947, -1, -1, 950, 951, -1, -1, -1, 955, 956, -1, -1, -1, 960, 961, 962, 963, 964, 965, -1, -1, -1, 969, -1, 971, -1, -1, 974, 975, 976, 977, -1, -1, -1, -1, -1, 983, 984, -1, -1, -1, 988, -1, 990, 991, -1, 993, -1, 995, -1, -1, 998, -1, -1, 1001, 1002, 1003, 1004, 1005, 1006, 1007, -1, -1, -1, -1, 1012, 1013, 1014, 1015, -1, -1, -1, 1019, -1, 1021, -1, -1, -1, 1025, 1026, 1027, 1028, 1029, -1, -1, -1, 1033, 1034, -1, -1, -1, 1038, -1, -1, 1041, -1, 1043, 1044, -1, 1046, -1, -1, -1, 1050, 1051, 1052, 1053, -1, -1, -1, -1, -1, 1059, 1060, 1061, -1, -1, 1064, 1065, -1, 1067, -1, 1069, -1, 1071, -1, -1, -1, 1075, 1076, 1077, 1078, -1, -1, 1081, -1, -1, 1084, 1085, 1086, -1, -1, -1, -1, 1091, -1, -1, 1094, 1095, -1, 1097, 1098, -1, -1, 1101, -1, -1, 1104, 1105, 1106, 1107, 1108, -1, 1110, -1, -1, 1113, 1114, -1, -1, 1117, 1118, -1, -1, -1, 1122, -1, 1124, 1125, 1126, -1, -1, 1129, -1, -1, -1, 1133, -1, -1, 1136, 1137, 1138, 1139, -1, 1141, -1, -1, 1144, 1145, -1, -1, -1, 1149, -1, -1, -1, 1153, 1154, 1155, 1156, 1157, -1, 1159, -1, -1, 1162, 1163, -1, -1, -1, 1167, -1, -1, 1170, 1171, 1172, -1, 1174, 1175, -1, 1177, -1, -1, 1180, -1, 1182, -1, -1, -1, 1186, 1187, -1, -1, 1190, 1191, 1192, 1193, -1, -1, 1196, -1, -1, -1, 1200, -1, -1, 1203, 1204, 1205, -1, -1, 1208, -1, 1210, -1, -1, 1213, 1214, 1215, 1216, -1, -1, -1, 1220, -1, 1222, -1, 1224, -1, -1, -1, 1228, 1229, 1230, 1231, 1232, -1, -1, 1235, 1236, -1, -1, -1, 1240, 1241, 1242, 1243, 1244, -1, -1, -1, 1248, 1249, -1, -1, -1, 1253, 1254, -1, 1256, -1, -1, -1, -1, 1261, 1262, 1263, -1, -1, -1, 1267, -1, 1269, -1, -1, 1272, -1, 1274, 1275, -1, -1, 1278, 1279, 1280, 1281, 1282, -1, -1, -1, -1, 1287, -1, -1, 1290, -1, 1292, 1293, 1294, -1, -1, -1, 1298, -1, -1 };
 static const int RF_RIGHT[] = { 18, 9, 8, 7, 6, -1, -1, -1, -1, 11, -1, 15, 14, -1, -1, 17, -1, -1, 24, 21, -1, 23, -1, -1, 54, 41, 38, 33, 30, -1, 32, -1, -1, 37, 36, -1, -1, -1, 40, -1, -1, 49, 48, 45, -1, 47, -1, -1, -1, 51, -1, 53, -1, -1, 56, -1, 60, 59, -1, -1, -1, 77, 68, 65, -1, 67, -1, -1, 70, -1, 76, 75, 74, -1, -1, -1, -1, 83, 80, -1, 82, -1, -1, 121, 98, 93, 88, -1, 90, -1, 92, -1, -1, 97, 96, -1, -1, -1, 110, 105, 104, 103, -1, -1, -1, 109, 108, -1, -1, -1, 116, 113, -1, 115, -1, -1, 120, 119, -1, -1, -1, -1, 142, 129, 126, -1, 128, -1, -1, 137, 136, 135, 134, -1, -1, -1, -1, 141, 140, -1, -1, -1, 164, 163, 146, -1, 154, 149, -1, 151, -1, 153, -1, -1, 156, -1, 160, 159, -1, -1, 162, -1, -1, -1, 170, 169, 168, -1, -1, -1, 172, -1, 174, -1, -1, 197, 188, 183, 180, -1, 182, -1, -1, 187, 186, -1, -1, -1, 190, -1, 194, 193, -1, -1, 196, -1, -1, 215, 214, 213, 212, 207, 206, 205, -1, -1, -1, 209, -1, 211, -1, -1, -1, -1, -1, 229, 226, 219, -1, 221, -1, 225, 224, -1, -1, -1, 228, -1, -1, 231, -1, 233, -1, -1, 290, 283, 250, 239, -1, 245, 244, 243, -1, -1, -1, 249, 248, -1, -1, -1, 276, 265, 260, 257, 256, -1, -1, 259, -1, -1, 264, 263, -1, -1, -1, 271, 268, -1, 270, -1, -1, 275, 274, -1, -1, -1, 280, 279, -1, -1, 282, -1, -1, 285, -1, 289, 288, -1, -1, -1, 300, 299, 296, 295, -1, -1, 298, -1, -1, -1, -1, 349, 308, 307, 306, -1, -1, -1, 328, 315, 312, -1, 314, -1, -1, 325, 324, 321, 320, -1, -1, 323, -1, -1, -1, 327, -1, -1, 332, 331, -1, -1, 344, 339, 338, 337, -1, -1, -1, 341, -1, 343, -1, -1, 348, 347, -1, -1, -1, 359, 354, 353, -1, -1, 358, 357, -1, -1, -1, 361, -1, 363, -1, 365, -1, -1, 386, 373, 372, 371, -1, -1, -1, 381, 380, 377, -1, 379, -1, -1, -1, 383, -1, 385, -1, -1, 408, 389, -1, 407, 398, 397, 396, 395, -1, -1, -1, -1, 404, 403, 402, -1, -1, -1, 406, -1, -1, -1, 410, -1, 412, -1, 416, 415, -1, -1, 422, 421, 420, -1, -1, -1, 426, 425, -1, -1, -1, 449, 448, 441, 432, -1, 434, -1, 436, -1, 440, 439, -1, -1, -1, 443, -1, 445, -1, 447, -1, -1, -1, 491, 464, 463, 456, 455, -1, -1, 458, -1, 460, -1, 462, -1, -1, -1, 476, 467, -1, 469, -1, 473, 472, -1, -1, 475, -1, -1, 482, 479, -1, 481, -1, -1, 486, 485, -1, -1, 490, 489, -1, -1, -1, 503, 498, 495, -1, 497, -1, -1, 502, 501, -1, -1, -1, -1, 564, 555, 536, 523, 510, -1, 516, 515, 514, -1, -1, -1, 520, 519, -1, -1, 522, -1, -1, 531, 526, -1, 528, -1, 530, -1, -1, 535, 534, -1, -1, -1, 552, 545, 540, -1, 544, 543, -1, -1, -1, 551, 550, 549, -1, -1, -1, -1, 554, -1, -1, 557, -1, 559, -1, 561, -1, 563, -1, -1, 566, -1, 568, -1, 570, -1, 574, 573, -1, -1, -1, 619, 588, 583, 582, 581, -1, -1, -1, 585, -1, 587, -1, -1, 606, 601, 596, 593, -1, 595, -1, -1, 600, 599, -1, -1, -1, 603, -1, 605, -1, -1, 608, -1, 612, 611, -1, -1, 618, 617, 616, -1, -1, -1, -1, 639, 624, 623, -1, -1, 638, 635, 634, 631, 630, -1, -1, 633, -1, -1, -1, 637, -1, -1, -1, 641, -1, 643, -1, -1, 686, 677, 672, 667, 664, 657, 654, 653, -1, -1, 656, -1, -1, 661, 660, -1, -1, 663, -1, -1, 666, -1, -1, 669, -1, 671, -1, -1, 674, -1, 676, -1, -1, 683, 680, -1, 682, -1, -1, 685, -1, -1, 696, 691, 690, -1, -1, 695, 694, -1, -1, -1, 700, 699, -1, -1, -1, 741, 732, 729, 714, 711, 708, -1, 710, -1, -1, 713, -1, -1, 716, -1, 722, 721, 720, -1, -1, -1, 726, 725, -1, -1, 728, -1, -1, 731, -1, -1, 740, 739, 736, -1, 738, -1, -1, -1, -1, 743, -1, 751, 746, -1, 750, 749, -1, -1, -1, 755, 754, -1, -1, 759, 758, -1, -1, -1, 774, 767, 766, 765, -1, -1, -1, 769, -1, 773, 772, -1, -1, -1, 804, 779, 778, -1, -1, 793, 792, 789, 786, 785, -1, -1, 788, -1, -1, 791, -1, -1, -1, 795, -1, 803, 800, 799, -1, -1, 802, -1, -1, -1, 812, 809, 808, -1, -1, 811, -1, -1, 814, -1, 816, -1, -1, 861, 854, 837, 824, 823, -1, -1, 830, 829, 828, -1, -1, -1, 836, 835, 834, -1, -1, -1, -1, 853, 848, 843, 842, -1, -1, 847, 846, -1, -1, -1, 850, -1, 852, -1, -1, -1, 856, -1, 858, -1, 860, -1, -1, 877, 868, 865, -1, 867, -1, -1, 870, -1, 876, 873, -1, 875, -1, -1, -1, 879, -1, -1, 898, 897, 890, 885, -1, 889, 888, -1, -1, -1, 896, 895, 894, -1, -1, -1, -1, -1, 926, 921, 912, 911, 906, 905, -1, -1, 908, -1, 910, -1, -1, -1, 914, -1, 916, -1, 918, -1, 920, -1, -1, 923, -1, 925, -1, -1, 928, -1, 938, 933, 932, -1, -1, 937, 936, -1, -1, -1, 940, -1, -1, 959, 954, 949, 946, -1, 948, -1, -1, 953, 952, -1, -1, -1, 958, 957, -1, -1, -1, 987, 982, 973, 968, 967, 966, -1, -1, -1, 970, -1, 972, -1, -1, 981, 980, 979, 978, -1, -1, -1, -1, -1, 986, 985, -1, -1, -1, 989, -1, 997, 992, -1, 994, -1, 996, -1, -1, 999, -1, -1, 1058, 1049, 1024, 1011, 1010, 1009, 1008, -1, -1, -1, -1, 1023, 1018, 1017, 1016, -1, -1, -1, 1020, -1, 1022, -1, -1, -1, 1040, 1037, 1032, 1031, 1030, -1, -1, -1, 1036, 1035, -1, -1, -1, 1039, -1, -1, 1042, -1, 1048, 1045, -1, 1047, -1, -1, -1, 1057, 1056, 1055, 1054, -1, -1, -1, -1, -1, 1074, 1063, 1062, -1, -1, 1073, 1066, -1, 1068, -1, 1070, -1, 1072, -1, -1, -1, 1090, 1083, 1080, 1079, -1, -1, 1082, -1, -1, 1089, 1088, 1087, -1, -1, -1, -1, 1092, -1, -1, 1103, 1096, -1, 1100, 1099, -1, -1, 1102, -1, -1, 1135, 1132, 1121, 1112, 1109, -1, 1111, -1, -1, 1116, 1115, -1, -1, 1120, 1119, -1, -1, -1, 1123, -1, 1131, 1128, 1127, -1, -1, 1130, -1, -1, -1, 1134, -1, -1, 1151, 1148, 1143, 1140, -1, 1142, -1, -1, 1147, 1146, -1, -1, -1, 1150, -1, -1, -1, 1202, 1169, 1166, 1161, 1158, -1, 1160, -1, -1, 1165, 1164, -1, -1, -1, 1168, -1, -1, 1185, 1184, 1173, -1, 1179, 1176, -1, 1178, -1, -1, 1181, -1, 1183, -1, -1, -1, 1189, 1188, -1, -1, 1199, 1198, 1195, 1194, -1, -1, 1197, -1, -1, -1, 1201, -1, -1, 1212, 1207, 1206, -1, -1, 1209, -1, 1211, -1, -1, 1226, 1219, 1218, 1217, -1, -1, -1, 1221, -1, 1223, -1, 1225, -1, -1, -1, 1271, 1260, 1239, 1234, 1233, -1, -1, 1238, 1237, -1, -1, -1, 1259, 1252, 1247, 1246, 1245, -1, -1, -1, 1251, 1250, -1, -1, -1, 1258, 1255, -1, 1257, -1, -1, -1, -1, 1266, 1265, 1264, -1, -1, -1, 1268, -1, 1270, -1, -1, 1273, -1, 1277, 1276, -1, -1, 1289, 1286, 1285, 1284, 1283, -1, -1, -1, -1, 1288, -1, -1, 1291, -1, 1297, 1296, 1295, -1, -1, -1, 1299, -1, -1 };
 static const float RF_PROB1[] = { 0, 0, 0, 0, 0, 1.0, 0.0, 0.0, 1.0, 0, 1.0, 0, 0, 1.0, 0.0, 0, 0.0, 1.0, 0, 0, 1.0, 0, 0.0, 1.0, 0, 0, 0, 0, 0, 0.0, 0, 0.16666666666666666, 0.0, 0, 0, 0.044444444444444446, 1.0, 1.0, 0, 1.0, 0.0, 0, 0, 0, 0.0, 0, 1.0, 0.0, 1.0, 0, 0.0, 0, 1.0, 0.0, 0, 0.0, 0, 0, 0.0, 1.0, 0.0, 0, 0, 0, 1.0, 0, 1.0, 0.0, 0, 0.0, 0, 0, 0, 1.0, 0.0, 0.0, 1.0, 0, 0, 1.0, 0, 0.0, 1.0, 0, 0, 0, 0, 0.0, 0, 0.0, 0, 1.0, 0.0, 0, 0, 1.0, 0.0, 0.0, 0, 0, 0, 0, 0.14285714285714285, 0.03125, 1.0, 0, 0, 0.0, 1.0, 0.0, 0, 0, 0.0, 0, 1.0, 0.16666666666666666, 0, 0, 1.0, 0.0, 1.0, 1.0, 0, 0, 0, 0.0, 0, 1.0, 0.0, 0, 0, 0, 0, 1.0, 0.0, 1.0, 0.0, 0, 0, 0.0, 1.0, 1.0, 0, 0, 0, 0.0, 0, 0, 1.0, 0, 0.0, 0, 0.0, 1.0, 0, 1.0, 0, 0, 1.0, 0.2, 0, 0.04, 1.0, 1.0, 0, 0, 0, 0.0, 1.0, 1.0, 0, 0.0, 0, 1.0, 0.0, 0, 0, 0, 0, 1.0, 0, 1.0, 0.0, 0, 0, 0.0, 1.0, 0.0, 0, 0.0, 0, 0, 0.0, 1.0, 0, 0.0, 1.0, 0, 0, 0, 0, 0, 0, 0, 0.2222222222222222, 0.0, 1.0, 0, 0.0, 0, 0.8888888888888888, 0.3, 1.0, 1.0, 1.0, 0, 0, 0, 0.0, 0, 1.0, 0, 0, 0.07142857142857142, 0.0, 0.0, 0, 1.0, 0.0, 0, 0.0, 0, 1.0, 0.0, 0, 0, 0, 0, 0.0, 0, 0, 0, 1.0, 0.0, 1.0, 0, 0, 0.0, 1.0, 0.0, 0, 0, 0, 0, 0, 0.2, 0.0, 0, 0.125, 1.0, 0, 0, 0.0, 0.5, 0.0, 0, 0, 0.0, 0, 1.0, 0.0, 0, 0, 0.0, 1.0, 0.0, 0, 0, 0.0, 1.0, 0, 1.0, 0.0, 0, 1.0, 0, 0, 0.0, 1.0, 0.0, 0, 0, 0, 0, 1.0, 0.0, 0, 1.0, 0.0, 1.0, 1.0, 0, 0, 0, 0, 1.0, 0.0, 1.0, 0, 0, 0, 0.0, 0, 1.0, 0.0, 0, 0, 0, 0, 0.01694915254237288, 0.25, 0, 1.0, 0.0, 1.0, 0, 1.0, 0.0, 0, 0, 1.0, 0.0, 0, 0, 0, 0, 1.0, 0.0, 0.0, 0, 0.0, 0, 0.0, 1.0, 0, 0, 1.0, 0.0, 0.0, 0, 0, 0, 0.0, 1.0, 0, 0, 0.0, 1.0, 1.0, 0, 1.0, 0, 0.0, 0, 1.0, 0.0, 0, 0, 0, 0, 1.0, 0.0, 0.0, 0, 0, 0, 0.0, 0, 1.0, 0.0, 1.0, 0, 1.0, 0, 0.0, 1.0, 0, 0, 0.0, 0, 0, 0, 0, 0, 0.0, 1.0, 1.0, 0.0, 0, 0, 0, 1.0, 0.0, 0.0, 0, 0.0, 1.0, 1.0, 0, 1.0, 0, 0.0, 0, 0, 0.0, 1.0, 0, 0, 0, 0.3333333333333333, 0.0, 1.0, 0, 0, 0.16666666666666666, 0.0196078431372549, 0.0, 0, 0, 0, 0, 1.0, 0, 1.0, 0, 0.0, 0, 0, 1.0, 0.0, 0.0, 0, 1.0, 0, 1.0, 0, 0.0, 1.0, 0.0, 0, 0, 0, 0, 0, 1.0, 0.0, 0, 1.0, 0, 1.0, 0, 1.0, 0.0, 0.0, 0, 0, 1.0, 0, 0.0, 0, 0, 0.0, 1.0, 0, 0.0, 1.0, 0, 0, 0.0, 0, 1.0, 0.0, 0, 0, 0.0, 1.0, 0, 0, 0.25, 0.0, 1.0, 0, 0, 0, 0.0, 0, 1.0, 0.0, 0, 0, 0.0, 1.0, 0.0, 1.0, 0, 0, 0, 0, 0, 1.0, 0, 0, 0, 0.5714285714285714, 0.0, 0.0, 0, 0, 0.125, 0.0, 0, 0.0, 1.0, 0, 0, 0.0, 0, 0.0, 0, 0.0, 1.0, 0, 0, 0.0, 1.0, 0.0, 0, 0, 0, 1.0, 0, 0, 0.0, 1.0, 0.0, 0, 0, 0, 0.0, 1.0, 1.0, 0.0, 0, 0.0, 1.0, 0, 1.0, 0, 0.0, 0, 1.0, 0, 0.0, 1.0, 0, 1.0, 0, 1.0, 0, 0.0, 0, 0, 0.0, 1.0, 1.0, 0, 0, 0, 0, 0, 0.0, 1.0, 0.0, 0, 0.0, 0, 1.0, 0.0, 0, 0, 0, 0, 1.0, 0, 1.0, 0.0, 0, 0, 0.0, 1.0, 0.0, 0, 0.0, 0, 0.0, 1.0, 0, 1.0, 0, 0, 0.0, 1.0, 0, 0, 0, 0.3333333333333333, 0.045454545454545456, 1.0, 1.0, 0, 0, 0, 0.0, 1.0, 0, 0, 0, 0, 0, 0.16666666666666666, 0.0, 0, 0.0, 1.0, 0.0, 0, 1.0, 0.0, 1.0, 0, 0.0, 0, 0.0, 1.0, 0, 0, 0, 0, 0, 0, 0, 0, 0.0, 0.5, 0, 1.0, 0.29411764705882354, 0, 0, 0.1388888888888889, 0.012578616352201259, 0, 1.0, 0.0, 0, 0.0, 1.0, 0, 1.0, 0, 1.0, 0.0, 0, 0.0, 0, 1.0, 0.0, 0, 0, 0.0, 0, 1.0, 0.0, 0, 1.0, 0.0, 0, 0, 0, 1.0, 0.0, 0, 0, 1.0, 0.0, 1.0, 0, 0, 1.0, 0.0, 0.0, 0, 0, 0, 0, 0, 0, 0.0, 0, 1.0, 0.0, 0, 0.0, 1.0, 0, 1.0, 0, 0, 0, 0.03571428571428571, 0.6666666666666666, 0.0, 0, 0, 0.0, 0.7272727272727273, 0, 1.0, 0.0, 0, 0.0, 1.0, 0, 0, 0, 0.0, 0, 1.0, 0.0, 0.0, 1.0, 0, 1.0, 0, 0, 1.0, 0, 0, 1.0, 0.0, 0.0, 0, 0, 0.0, 1.0, 0, 0, 1.0, 0.0, 1.0, 0, 0, 0, 0, 1.0, 0.0, 0.0, 0, 1.0, 0, 0, 1.0, 0.0, 1.0, 0, 0, 0, 1.0, 0.0, 0, 0, 0, 0, 0, 1.0, 0.024390243902439025, 0, 0.02631578947368421, 0.0, 0, 1.0, 0.0, 1.0, 0, 0.0, 0, 0, 0, 1.0, 0.0625, 0, 0.0, 1.0, 0.0, 0, 0, 0, 1.0, 0.0, 0, 1.0, 0.0, 0, 0.0, 0, 1.0, 0.0, 0, 0, 0, 0, 0, 0.0, 1.0, 0, 0, 0, 0.0, 1.0, 1.0, 0, 0, 0, 0.0, 1.0, 0.0, 0.0, 0, 0, 0, 0, 1.0, 0.0, 0, 0, 0.0, 1.0, 0.0, 0, 1.0, 0, 1.0, 0.0, 0.0, 0, 1.0, 0, 1.0, 0, 1.0, 0.0, 0, 0, 0, 0.0, 0, 1.0, 0.0, 0, 0.0, 0, 0, 0.0, 0, 1.0, 0.0, 1.0, 0, 1.0, 0.0, 0, 0, 0, 0, 0.0, 0, 0, 1.0, 0.0, 1.0, 0, 0, 0, 1.0, 0.0, 0.0, 1.0, 1.0, 0, 0, 0, 0, 0, 0, 0.0, 1.0, 0, 1.0, 0, 0.46153846153846156, 0.08333333333333333, 1.0, 0, 0.0, 0, 0.0, 0, 1.0, 0, 0.0, 1.0, 0, 1.0, 0, 0.0, 1.0, 0, 1.0, 0, 0, 0, 1.0, 0.0, 0, 0, 0.0, 1.0, 0.0, 0, 1.0, 0.0, 0, 0, 0, 0, 1.0, 0, 1.0, 0.0, 0, 0, 1.0, 0.0, 0.0, 0, 0, 1.0, 0.0, 1.0, 0, 0, 0, 0, 0, 0, 1.0, 0.0, 1.0, 0, 0.0, 0, 0.0, 1.0, 0, 0, 0, 0, 1.0, 0.0, 0.0, 1.0, 0.0, 0, 0, 1.0, 0.0, 0.0, 0, 0.0, 0, 0, 0.0, 0, 0.0, 0, 0.0, 1.0, 0, 1.0, 0.0, 0, 0, 0, 0, 0, 0, 0, 1.0, 0.0, 0.0, 1.0, 0, 0, 0, 0, 0.0, 1.0, 1.0, 0, 0.0, 0, 1.0, 0.1111111111111111, 0.0, 0, 0, 0, 0, 0, 0.0, 1.0, 0.0, 0, 0, 0.5, 0.0, 0.0, 0, 0.0, 1.0, 0, 1.0, 0, 0, 0.0, 0, 1.0, 0.0, 1.0, 0, 0, 0, 0, 0.0, 1.0, 1.0, 1.0, 0.0, 0, 0, 0, 1.0, 0.0, 0, 0, 0.0, 0, 1.0, 0, 1.0, 0, 0.0, 1.0, 0.0, 0, 0, 0, 0, 1.0, 0.0, 0, 1.0, 0.0, 0, 0, 0, 0.0, 1.0, 0.0, 1.0, 0, 1.0, 0.0, 0, 0, 0.0, 0, 0, 1.0, 0.0, 0, 0.0, 1.0, 0, 0, 0, 0, 0, 1.0, 0, 1.0, 0.0, 0, 0, 0.0, 1.0, 0, 0, 0.023255813953488372, 0.2, 1.0, 0, 0.0, 0, 0, 0, 0.0, 1.0, 0, 0.8571428571428571, 0.4, 0.0, 0, 1.0, 0.0, 0, 0, 0, 0, 1.0, 0, 0.0, 1.0, 0, 0, 0.0, 1.0, 1.0, 0, 0.0, 1.0, 0.0, 0, 0, 0, 0, 0, 1.0, 0, 0.0, 1.0, 0, 0, 0.0, 1.0, 1.0, 0, 1.0, 0.0, 0, 0, 0, 1.0, 0, 0, 0.0, 0, 0.0, 1.0, 0, 0.0, 0, 0.0, 0.9230769230769231, 1.0, 0, 0, 0.0, 1.0, 0, 0, 0, 0, 0.0, 1.0, 0, 0.0, 0.13333333333333333, 0.0, 0, 1.0, 0.0, 0, 0, 0, 1.0, 0.0, 0, 1.0, 0, 0.0, 1.0, 0, 0, 0, 0, 1.0, 0.0, 0.0, 0, 1.0, 0, 1.0, 0, 0.0, 1.0, 0.0, 0, 0, 0, 0, 0, 0.0, 1.0, 0, 0, 0.0, 1.0, 0.0, 0, 0, 0, 0, 0, 0.041666666666666664, 0.5, 1.0, 0, 0, 0.0, 1.0, 1.0, 0, 0, 0.0, 0, 1.0, 0.0, 1.0, 0.0, 0, 0, 0, 0.0, 1.0, 1.0, 0, 0.0, 0, 1.0, 0.0, 0, 1.0, 0, 0, 0.0, 1.0, 0, 0, 0, 0, 0, 1.0, 0.0, 0.0, 0.0, 0, 1.0, 0.0, 0, 0.0, 0, 0, 0, 0.0, 1.0, 1.0, 0, 1.0, 0.0 };
+static const int RF_TREE_ORDER[] = { 13, 18, 6, 5, 2, 0, 16, 9, 15, 1, 19, 4, 7, 8, 12, 11, 3, 14, 17, 10 };
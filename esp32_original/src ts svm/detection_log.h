@@ -0,0 +1,402 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cmath>
+#include "outbox.h"
+
+// ================= DETECTION LOG =================
+// With -DDETLOG=1 every detection row publish_detection is given is also
+// appended to flash as a 20-byte record, whether the broker is there or not:
+//   offset  size  field
+//   0       u32   seq, the record's position in the log
+//   4       u32   Time, seconds since 1970-01-01 (as sample frames carry it;
+//                 0 when the row's Time is not dd/mm/yyyy HH:MM[:SS])
+//   8       f32   Score (the first head's in the multi builds); NaN when none
+//   12      u16   FeatTime, us (saturated)
+//   14      u16   TestTime, us, the heads' summed
+//   16      u8    Label; multi builds: bit h is head h's
+//   17      u8    Stage / Level of a cascade or deadline row, 0xFF otherwise
+//   18      u16   CRC-16/CCITT of bytes 0-17
+// The record is read back from the row's text, so it holds what was published
+// (the row's 3 and 4 decimals).
+//
+// The flash is a ring of DETLOG_SECTOR sectors, written append-only: a sector
+// is erased when the log reaches it, then gets a header (its first seq) and
+// DETLOG_PER_SECTOR records. Record seq lives at a fixed place, sector
+// (seq / DETLOG_PER_SECTOR) % sectors, so:
+//   - every sector is erased once per lap of the ring, the same as the others,
+//     which is all the wear levelling an append-only log needs;
+//   - setup() finds the end again from the sector headers and the first
+//     erased slot of the newest sector; a record torn by a reset fails its CRC
+//     and is skipped, and its seq is not used again;
+//   - a read needs no index and no lock: a record whose seq or CRC does not
+//     match is gone (overwritten a lap later, or torn).
+//
+// {"log_from": a, "log_to": b} uploads records a..b (b left out: the latest)
+// on MQTT_TOPIC_LOG, from loop() one chunk per pass while the link is up:
+//   0  u32 DETLOG_CHUNK_MAGIC   4  u32 first seq asked   8  u32 last seq asked
+//   12 u16 records             14 u16 record size       16 the records
+// up to OUTBOX_FLUSH_BYTES a chunk, about 100 records. A gap of lost records
+// is passed over without a chunk, so the only chunk of no records is the last
+// one, which ends the upload. get.py --log-out writes them as CSV.
+//
+// The flash is reached through DetLogStore: a data partition on the ESP32
+// (DETLOG_PARTITION, the default table's "spiffs", unused by these builds), or
+// a file on Linux, which host/bench_detlog.cpp runs against.
+
+#ifndef DETLOG
+#define DETLOG 0
+#endif
+#ifndef DETLOG_PARTITION
+#define DETLOG_PARTITION "spiffs"
+#endif
+#define DETLOG_SECTOR 4096
+#define DETLOG_RECORD 20
+#define DETLOG_HEADER 16
+#define DETLOG_PER_SECTOR ((DETLOG_SECTOR - DETLOG_HEADER) / DETLOG_RECORD)
+#define DETLOG_SECTOR_MAGIC 0x31534C44u     // "DLS1"
+#define DETLOG_CHUNK_MAGIC 0x31474C44u      // "DLG1"
+#define DETLOG_CHUNK_HEADER 16
+#define DETLOG_CHUNK_RECORDS ((OUTBOX_FLUSH_BYTES - DETLOG_CHUNK_HEADER) / DETLOG_RECORD)
+
+struct DetLogRecord {
+    uint32_t seq;
+    uint32_t time;
+    float score;
+    uint16_t feat_us;
+    uint16_t test_us;
+    uint8_t labels;
+    uint8_t aux;
+    uint16_t crc;
+};
+static_assert(sizeof(DetLogRecord) == DETLOG_RECORD, "DetLogRecord is 20 bytes");
+
+struct DetLogStore {
+    bool (*read)(void* ctx, uint32_t addr, void* buf, size_t n);
+    bool (*write)(void* ctx, uint32_t addr, const void* buf, size_t n);   // onto erased bytes
+    bool (*erase)(void* ctx, uint32_t addr);                             // the sector at addr, to 0xFF
+    uint32_t size;
+    void* ctx;
+};
+
+struct DetLog {
+    DetLogStore store;
+    uint32_t sectors;
+    uint32_t next_seq;          // the next record's
+    uint32_t appended;
+    uint32_t failed;            // appends the store refused
+    uint32_t erases;
+    bool uploading;
+    uint32_t up_from, up_to;    // the range asked
+    uint32_t up_next;           // the next seq to send
+    uint32_t up_sent;           // records sent so far
+    uint8_t chunk[DETLOG_CHUNK_HEADER + DETLOG_CHUNK_RECORDS * DETLOG_RECORD];
+};
+
+uint16_t detlog_crc16(const void* p, size_t n) {
+    const uint8_t* b = (const uint8_t*)p;
+    uint16_t crc = 0xFFFF;
+    for(size_t i=0; i<n; i++) {
+        crc ^= (uint16_t)(b[i] << 8);
+        for(int k=0; k<8; k++) crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+    }
+    return crc;
+}
+
+static uint32_t dl_record_addr(const DetLog& l, uint32_t seq) {
+    uint32_t sector = (seq / DETLOG_PER_SECTOR) % l.sectors;
+    return sector * DETLOG_SECTOR + DETLOG_HEADER + (seq % DETLOG_PER_SECTOR) * DETLOG_RECORD;
+}
+
+static uint32_t dl_header_crc(const uint32_t* h) {
+    return detlog_crc16(h, 8);
+}
+
+static bool dl_erased(const void* p, size_t n) {
+    const uint8_t* b = (const uint8_t*)p;
+    for(size_t i=0; i<n; i++) {
+        if(b[i] != 0xFF) return false;
+    }
+    return true;
+}
+
+// Finds the end of the log. Returns false when the store holds fewer than two
+// sectors; a store with no valid sector header starts an empty log.
+bool detlog_begin(DetLog& l, const DetLogStore& store) {
+    memset(&l, 0, sizeof(l));
+    l.store = store;
+    l.sectors = store.size / DETLOG_SECTOR;
+    if(l.sectors < 2) return false;
+
+    bool found = false;
+    uint32_t base = 0;
+    for(uint32_t s=0; s<l.sectors; s++) {
+        uint32_t h[4];
+        if(!store.read(store.ctx, s * DETLOG_SECTOR, h, sizeof(h))) continue;
+        if(h[0] != DETLOG_SECTOR_MAGIC || h[2] != dl_header_crc(h) || h[1] % DETLOG_PER_SECTOR != 0) continue;
+        if((h[1] / DETLOG_PER_SECTOR) % l.sectors != s) continue;
+        if(!found || (int32_t)(h[1] - base) > 0) base = h[1];
+        found = true;
+    }
+    if(!found) return true;
+
+    l.next_seq = base + DETLOG_PER_SECTOR;
+    for(uint32_t i=0; i<DETLOG_PER_SECTOR; i++) {
+        DetLogRecord r;
+        if(!store.read(store.ctx, dl_record_addr(l, base + i), &r, sizeof(r))) continue;
+        if(dl_erased(&r, sizeof(r))) {
+            l.next_seq = base + i;
+            break;
+        }
+    }
+    return true;
+}
+
+// The oldest seq the ring can still hold.
+uint32_t detlog_oldest(const DetLog& l) {
+    uint32_t span = l.sectors * DETLOG_PER_SECTOR;
+    uint32_t end = (l.next_seq + DETLOG_PER_SECTOR - 1) / DETLOG_PER_SECTOR * DETLOG_PER_SECTOR;
+    return (end > span) ? end - span : 0;
+}
+
+// Writes r as the next record (its seq and crc are set here). A sector is
+// erased first when the log enters it. On the ESP32 the erase (about 45 ms,
+// hundreds at worst) turns the flash cache off on both cores, so it stalls
+// the PIPELINE inference task too, which runs from flash, not IRAM.
+bool detlog_append(DetLog& l, DetLogRecord& r) {
+    if(l.sectors < 2) return false;
+    uint32_t seq = l.next_seq++;
+    if(seq % DETLOG_PER_SECTOR == 0) {
+        uint32_t addr = (seq / DETLOG_PER_SECTOR) % l.sectors * DETLOG_SECTOR;
+        uint32_t h[4] = { DETLOG_SECTOR_MAGIC, seq, 0, 0xFFFFFFFFu };
+        h[2] = dl_header_crc(h);
+        l.erases++;
+        if(!l.store.erase(l.store.ctx, addr) || !l.store.write(l.store.ctx, addr, h, sizeof(h))) {
+            l.failed++;
+            return false;
+        }
+    }
+    r.seq = seq;
+    r.crc = detlog_crc16(&r, DETLOG_RECORD - 2);
+    if(!l.store.write(l.store.ctx, dl_record_addr(l, seq), &r, sizeof(r))) {
+        l.failed++;
+        return false;
+    }
+    l.appended++;
+    return true;
+}
+
+// Record seq, if it is still in the log and intact.
+bool detlog_read(const DetLog& l, uint32_t seq, DetLogRecord& r) {
+    if(l.sectors < 2 || (int32_t)(seq - l.next_seq) >= 0 || (int32_t)(seq - detlog_oldest(l)) < 0) return false;
+    if(!l.store.read(l.store.ctx, dl_record_addr(l, seq), &r, sizeof(r))) return false;
+    return r.seq == seq && r.crc == detlog_crc16(&r, DETLOG_RECORD - 2);
+}
+
+// ---- detection rows ----
+
+// "dd/mm/yyyy HH:MM[:SS]" as seconds since 1970-01-01, or 0.
+uint32_t detlog_epoch(const char* t, size_t n) {
+    char buf[32];
+    if(n >= sizeof(buf)) n = sizeof(buf) - 1;
+    memcpy(buf, t, n);
+    buf[n] = '\0';
+    int d, m, y, hh = 0, mm = 0, ss = 0;
+    if(sscanf(buf, "%d/%d/%d %d:%d:%d", &d, &m, &y, &hh, &mm, &ss) < 3 || y < 1970 || m < 1 || m > 12) return 0;
+    // days_from_civil (H. Hinnant)
+    y -= m <= 2;
+    int era = y / 400;
+    int yoe = y - era * 400;
+    int doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    long days = (long)era * 146097 + doe - 719468;
+    return (uint32_t)(days * 86400 + hh * 3600 + mm * 60 + ss);
+}
+
+static uint16_t dl_us(float ms) {
+    if(!(ms > 0.0f)) return 0;
+    float us = ms * 1000.0f + 0.5f;
+    return (us >= 65535.0f) ? 65535 : (uint16_t)us;
+}
+
+// The record of a row as detection_row.h writes it (seq and crc are left to
+// detlog_append).
+//   single model: Time,[4 raw],Label,FeatTime,TestTime,Score
+//   multi builds: Time,[4 raw],FeatTime, Label,TestTime,Score per head, then
+//                 the cascade's Stage or the deadline's Level, if any
+void detlog_row_record(const char* row, size_t n, DetLogRecord& r) {
+    const char* f[32];
+    int nf = 0;
+    f[nf++] = row;
+    for(size_t i=0; i<n && nf < 32; i++) {
+        if(row[i] == ',') f[nf++] = row + i + 1;
+    }
+    memset(&r, 0, sizeof(r));
+    r.time = detlog_epoch(row, (nf > 1 ? (size_t)(f[1] - row - 1) : n));
+    r.score = NAN;
+    r.aux = 0xFF;
+    int at = DETECTION_COMPACT ? 1 : 5;
+    // a number, NaN for an empty field
+    auto num = [&](int i) -> float {
+        if(i >= nf) return NAN;
+        char* end;
+        float v = strtof(f[i], &end);
+        return (end == f[i]) ? NAN : v;
+    };
+#if defined(MULTI_MODELS)
+    r.feat_us = dl_us(num(at));
+    int heads = (nf - at - 1) / 3;
+    float test_ms = 0.0f;
+    for(int h=0; h<heads && h<8; h++) {
+        if(num(at + 1 + 3 * h) == 1.0f) r.labels |= (uint8_t)(1u << h);
+        test_ms += num(at + 2 + 3 * h);
+        if(h == 0) r.score = num(at + 3);
+    }
+    r.test_us = dl_us(test_ms);
+    float aux = num(nf - 1);
+    if((nf - at - 1) % 3 == 1 && aux >= 0.0f && aux < 255.0f) r.aux = (uint8_t)aux;
+#else
+    r.labels = (num(at) == 1.0f) ? 1 : 0;
+    r.feat_us = dl_us(num(at + 1));
+    r.test_us = dl_us(num(at + 2));
+    r.score = num(at + 3);
+#endif
+}
+
+bool detlog_append_row(DetLog& l, const char* row, size_t n) {
+    DetLogRecord r;
+    detlog_row_record(row, n, r);
+    return detlog_append(l, r);
+}
+
+// ---- range upload ----
+
+// {"log_from": from, "log_to": to}: from the oldest record still there at
+// the earliest, to the latest at the most.
+void detlog_upload_begin(DetLog& l, uint32_t from, uint32_t to) {
+    if(to >= l.next_seq) to = l.next_seq - 1;     // 0xFFFFFFFF among others
+    l.uploading = true;
+    l.up_from = from;
+    l.up_to = to;
+    l.up_next = from;
+    l.up_sent = 0;
+}
+
+static void dl_put_u32(uint8_t* p, uint32_t v) { memcpy(p, &v, 4); }
+static void dl_put_u16(uint8_t* p, uint16_t v) { memcpy(p, &v, 2); }
+
+// The next chunk into l.chunk; returns its length, or 0 when a gap of lost
+// records came up empty short of the end: nothing to publish, detlog_sent
+// moves past it. *next is where the one after it starts, for detlog_sent once
+// this one is published.
+size_t detlog_pack(DetLog& l, uint32_t* next) {
+    uint32_t seq = l.up_next;
+    if((int32_t)(seq - detlog_oldest(l)) < 0) seq = detlog_oldest(l);
+    uint16_t count = 0;
+    uint8_t* p = l.chunk + DETLOG_CHUNK_HEADER;
+    // a bounded number of reads per pass, even across a gap of lost records
+    for(int reads=0; reads < 2 * DETLOG_CHUNK_RECORDS && count < DETLOG_CHUNK_RECORDS; reads++) {
+        if((int32_t)(seq - l.up_to) > 0) break;
+        DetLogRecord r;
+        if(detlog_read(l, seq, r)) {
+            memcpy(p, &r, sizeof(r));
+            p += sizeof(r);
+            count++;
+        }
+        seq++;
+    }
+    dl_put_u32(l.chunk, DETLOG_CHUNK_MAGIC);
+    dl_put_u32(l.chunk + 4, l.up_from);
+    dl_put_u32(l.chunk + 8, l.up_to);
+    dl_put_u16(l.chunk + 12, count);
+    dl_put_u16(l.chunk + 14, DETLOG_RECORD);
+    *next = seq;
+    if(count == 0 && (int32_t)(seq - l.up_to) <= 0) return 0;
+    return (size_t)(p - l.chunk);
+}
+
+// The chunk detlog_pack made is out (or was a gap, not sent). An empty one
+// past l.up_to ends the upload.
+void detlog_sent(DetLog& l, uint32_t next) {
+    uint16_t count;
+    memcpy(&count, l.chunk + 12, 2);
+    l.up_sent += count;
+    if(count == 0 && (int32_t)(next - l.up_to) > 0) l.uploading = false;
+    l.up_next = next;
+}
+
+int detlog_stats_json(const DetLog& l, char* buf, size_t n) {
+    return snprintf(buf, n,
+                    "{\"log_next\": %lu, \"log_oldest\": %lu, \"log_sectors\": %lu, \"log_appended\": %lu, "
+                    "\"log_failed\": %lu, \"log_erases\": %lu, \"log_uploading\": %s}",
+                    (unsigned long)l.next_seq, (unsigned long)detlog_oldest(l), (unsigned long)l.sectors,
+                    (unsigned long)l.appended, (unsigned long)l.failed, (unsigned long)l.erases,
+                    l.uploading ? "true" : "false");
+}
+
+// ---- stores ----
+
+struct DetLogFile {
+    FILE* f;
+};
+
+static bool dl_file_read(void* ctx, uint32_t addr, void* buf, size_t n) {
+    FILE* f = ((DetLogFile*)ctx)->f;
+    return fseek(f, (long)addr, SEEK_SET) == 0 && fread(buf, 1, n, f) == n;
+}
+
+// NOR flash semantics: a write can only clear bits.
+static bool dl_file_write(void* ctx, uint32_t addr, const void* buf, size_t n) {
+    FILE* f = ((DetLogFile*)ctx)->f;
+    uint8_t old[DETLOG_SECTOR];
+    if(n > sizeof(old) || !dl_file_read(ctx, addr, old, n)) return false;
+    for(size_t i=0; i<n; i++) old[i] &= ((const uint8_t*)buf)[i];
+    return fseek(f, (long)addr, SEEK_SET) == 0 && fwrite(old, 1, n, f) == n && fflush(f) == 0;
+}
+
+static bool dl_file_erase(void* ctx, uint32_t addr) {
+    FILE* f = ((DetLogFile*)ctx)->f;
+    uint8_t ff[DETLOG_SECTOR];
+    memset(ff, 0xFF, sizeof(ff));
+    return fseek(f, (long)addr, SEEK_SET) == 0 && fwrite(ff, 1, sizeof(ff), f) == sizeof(ff) && fflush(f) == 0;
+}
+
+// A file of `sectors` sectors standing in for the partition; created erased
+// when it does not exist.
+DetLogStore detlog_file_store(DetLogFile& df, const char* path, uint32_t sectors) {
+    DetLogStore s = { dl_file_read, dl_file_write, dl_file_erase, 0, &df };
+    df.f = fopen(path, "r+b");
+    if(!df.f) {
+        df.f = fopen(path, "w+b");
+        for(uint32_t i=0; df.f && i<sectors; i++) dl_file_erase(&df, i * DETLOG_SECTOR);
+    }
+    if(df.f) s.size = sectors * DETLOG_SECTOR;
+    return s;
+}
+
+#if defined(ARDUINO_ARCH_ESP32)
+#include <esp_partition.h>
+
+static bool dl_part_read(void* ctx, uint32_t addr, void* buf, size_t n) {
+    return esp_partition_read((const esp_partition_t*)ctx, addr, buf, n) == ESP_OK;
+}
+
+static bool dl_part_write(void* ctx, uint32_t addr, const void* buf, size_t n) {
+    return esp_partition_write((const esp_partition_t*)ctx, addr, buf, n) == ESP_OK;
+}
+
+static bool dl_part_erase(void* ctx, uint32_t addr) {
+    return esp_partition_erase_range((const esp_partition_t*)ctx, addr, DETLOG_SECTOR) == ESP_OK;
+}
+
+// The data partition called label; size 0 when there is none.
+DetLogStore detlog_partition_store(const char* label) {
+    const esp_partition_t* p = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+    DetLogStore s = { dl_part_read, dl_part_write, dl_part_erase, 0, (void*)p };
+    if(p) s.size = p->size / DETLOG_SECTOR * DETLOG_SECTOR;
+    return s;
+}
+#endif
@@ -2,9 +2,13 @@
 #include <cmath>
 #include <vector>
 #include "model_edge.h" 
+#include "model_edge_q.h"
+#include "linear_q.h"
+#include "score_mode.h"
 #include "tsassure_settings.h"
 
-int predict_svm(const float* features, float* out_score) {
+// mode: SCORE_MODE_* (score_mode.h), how out_score is produced.
+int predict_svm(const float* features, float* out_score, int mode) {
     float decision = 0.0f;
     
     for(int i=0; i<SVM_N_FEATURES; i++) {
@@ -15,8 +19,37 @@ int predict_svm(const float* features, float* out_score) {
     }
     
     decision += SVM_BIAS;
-    float prob = 1.0f / (1.0f + expf(SVM_PROB_A * decision + SVM_PROB_B));
-    
-    if(out_score) *out_score = prob;
-    return (prob >= 0.5f) ? 1 : 0;
-}
\ No newline at end of file
+    return platt_label_score(decision, SVM_PROB_A, SVM_PROB_B, mode, out_score);
+}
+
+int predict_svm(const float* features, float* out_score) {
+    return predict_svm(features, out_score, SCORE_MODE_EXACT);
+}
+
+// ================= SCORE MODE =================
+// How main.cpp fills the Score column (score_mode.h): SCORE_MODE_EXACT as
+// before, SCORE_MODE_FAST for the polynomial exp, SCORE_MODE_LABEL to leave
+// it empty and skip the exp. The Label column does not depend on it.
+#ifndef SCORE_MODE
+#define SCORE_MODE SCORE_MODE_EXACT
+#endif
+
+// ================= FIXED-POINT PATH =================
+// LINEAR_Q = 16 or 8 makes main.cpp use the int16 / int8 kernels of
+// linear_q.h (parameters in model_edge_q.h); 0 keeps the float path.
+#ifndef LINEAR_Q
+#define LINEAR_Q 0
+#endif
+
+static const LinearQ<int16_t> SVM_Q16 = { SVM_N_FEATURES, SVM_Q_SHIFT, SVM_Q_MEAN, SVM_Q16_COEF,
+    SVM_Q16_ACC_FRAC, SVM_Q16_THRESHOLD, SVM_Q_POLARITY, SVM_Q_SCORE_MUL };
+static const LinearQ<int8_t> SVM_Q8 = { SVM_N_FEATURES, SVM_Q_SHIFT, SVM_Q_MEAN, SVM_Q8_COEF,
+    SVM_Q8_ACC_FRAC, SVM_Q8_THRESHOLD, SVM_Q_POLARITY, SVM_Q_SCORE_MUL };
+
+int predict_svm_q16(const float* features, float* out_score) {
+    return predict_linear_q(features, SVM_Q16, out_score);
+}
+
+int predict_svm_q8(const float* features, float* out_score) {
+    return predict_linear_q(features, SVM_Q8, out_score);
+}
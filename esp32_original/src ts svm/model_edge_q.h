@@ -0,0 +1,15 @@
+#pragma once
+#include <stdint.h>
+// Generated by host/quantise_linear.cpp; parameters for linear_q.h.
+
+// ===== SVM: inputs have room for 2^20 std =====
+static const int8_t SVM_Q_SHIFT[] = { 4, 4, 3, 6, 4, 4, 4, 6, 6, 8, 6, 12 };
+static const int32_t SVM_Q_MEAN[] = { 634, 652, -9, 1407, 283, 989, -355, -6, -7, -5, 5, 231 };
+#define SVM_Q_POLARITY 1
+#define SVM_Q_SCORE_MUL 79527
+#define SVM_Q16_ACC_FRAC 22
+static const int16_t SVM_Q16_COEF[] = { 2238, 18088, -11191, -3285, 2766, -2398, 6179, -2197, -2530, 1863, 135, -695 };
+static const int64_t SVM_Q16_THRESHOLD = -3541LL;
+#define SVM_Q8_ACC_FRAC 14
+static const int8_t SVM_Q8_COEF[] = { 9, 71, -44, -13, 11, -9, 24, -9, -10, 7, 1, -3 };
+static const int64_t SVM_Q8_THRESHOLD = -14LL;
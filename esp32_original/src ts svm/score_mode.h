@@ -0,0 +1,59 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include <cmath>
+
+// ================= SCORING MODES =================
+// The label needs only the sign of the decision: sigmoid(d) >= 0.5 is d >= 0,
+// and the Platt prob 1 / (1 + exp(A d + B)) >= 0.5 is A d + B <= 0. The
+// probability is only for the Score column, so the mode picks how it is made:
+//   SCORE_MODE_LABEL  no probability, out_score is NaN, no exp
+//   SCORE_MODE_FAST   probability through fast_expf (relative error < 3e-6,
+//                     so a score is off by < 1e-6)
+//   SCORE_MODE_EXACT  expf and the label from prob >= 0.5, as before
+// In the first two modes the label comes from the decision directly; it can
+// only differ from EXACT within a few ulps of the boundary, where expf
+// rounds prob to exactly 0.5.
+
+#define SCORE_MODE_LABEL 0
+#define SCORE_MODE_FAST  1
+#define SCORE_MODE_EXACT 2
+
+// e^x as 2^n * p(f), p a degree-4 minimax fit of 2^f on [0, 1).
+inline float fast_expf(float x) {
+    if(x != x) return x;
+    float t = x * 1.44269504f;   // log2(e)
+    if(t < -126.0f) t = -126.0f;
+    if(t > 126.0f) t = 126.0f;
+    int n = (int)t;
+    if((float)n > t) n--;
+    float f = t - (float)n;
+    float p = 1.0f + f * (0.693044844f + f * (0.24128021f + f * (0.0522424664f + f * 0.0134266877f)));
+    uint32_t bits = (uint32_t)(n + 127) << 23;
+    float scale;
+    memcpy(&scale, &bits, sizeof(scale));
+    return p * scale;
+}
+
+// LR: prob = sigmoid(decision).
+inline int lr_label_score(float decision, int mode, float* out_score) {
+    if(mode == SCORE_MODE_EXACT) {
+        float prob = 1.0f / (1.0f + expf(-decision));
+        if(out_score) *out_score = prob;
+        return (prob >= 0.5f) ? 1 : 0;
+    }
+    if(out_score) *out_score = (mode == SCORE_MODE_FAST) ? 1.0f / (1.0f + fast_expf(-decision)) : NAN;
+    return (decision >= 0.0f) ? 1 : 0;
+}
+
+// Platt-scaled SVM: prob = 1 / (1 + exp(probA * decision + probB)).
+inline int platt_label_score(float decision, float probA, float probB, int mode, float* out_score) {
+    float arg = probA * decision + probB;
+    if(mode == SCORE_MODE_EXACT) {
+        float prob = 1.0f / (1.0f + expf(arg));
+        if(out_score) *out_score = prob;
+        return (prob >= 0.5f) ? 1 : 0;
+    }
+    if(out_score) *out_score = (mode == SCORE_MODE_FAST) ? 1.0f / (1.0f + fast_expf(arg)) : NAN;
+    return (arg <= 0.0f) ? 1 : 0;
+}
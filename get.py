@@ -1,5 +1,8 @@
 # subscriber_log.py
 import argparse
+import datetime
+import math
+import struct
 from pathlib import Path
 import paho.mqtt.client as mqtt
 import uuid
@@ -10,6 +13,7 @@ DEFAULT_USER = "abcsolution"
 DEFAULT_PASS = "CseLAbC5c6"
 DEFAULT_TOPIC = "duy/sensorDetection1"
 DEFAULT_OUT = "output/detections.csv"
+DEFAULT_CMD_TOPIC = "duy/sensorFault"
 
 CSV_HEADERS = [
     "Time",
@@ -23,16 +27,49 @@ CSV_HEADERS = [
     "Score",
 ]
 
-def ensure_header(out_path: Path):
+# DETECTION_COMPACT builds leave out the raw channels the publisher already has.
+RAW_HEADERS = ["Temperature", "Humidity", "Humidity_WeatherStation", "Temperature_WeatherStation"]
+CSV_HEADERS_COMPACT = [h for h in CSV_HEADERS if h not in RAW_HEADERS]
+
+# DETLOG=1 builds: the detection log's range upload on <topic>/log, in chunks of
+# 20-byte records (detection_log.h).
+LOG_HEADERS = ["Seq", "Time", "Label", "Feature Extraction Time (ms)", "Testing Time (ms)", "Score", "Aux"]
+LOG_CHUNK = struct.Struct("<IIIHH")
+LOG_RECORD = struct.Struct("<IIfHHBBH")
+LOG_MAGIC = 0x31474C44
+
+def decode_log_chunk(payload: bytes):
+    """CSV lines of a log chunk; None when it is not one, [] for the last."""
+    if len(payload) < LOG_CHUNK.size:
+        return None
+    magic, _first, _last, count, size = LOG_CHUNK.unpack_from(payload)
+    if magic != LOG_MAGIC or size != LOG_RECORD.size or len(payload) < LOG_CHUNK.size + count * size:
+        return None
+    lines = []
+    for i in range(count):
+        seq, t, score, feat_us, test_us, labels, aux, _crc = LOG_RECORD.unpack_from(payload, LOG_CHUNK.size + i * size)
+        when = datetime.datetime.fromtimestamp(t, datetime.timezone.utc).strftime("%d/%m/%Y %H:%M") if t else ""
+        lines.append(",".join([
+            str(seq), when, str(labels), f"{feat_us / 1000:.3f}", f"{test_us / 1000:.3f}",
+            "" if math.isnan(score) else f"{score:.4f}", "" if aux == 0xFF else str(aux),
+        ]))
+    return lines
+
+def ensure_header(out_path: Path, headers):
     if not out_path.exists() or out_path.stat().st_size == 0:
         with open(out_path, "w", encoding="utf-8", newline="") as f:
-            f.write(",".join(CSV_HEADERS) + "\n")
+            f.write(",".join(headers) + "\n")
 
 def on_connect(client, userdata, flags, reason_code, properties=None):
     if reason_code == 0:
         print(f"[MQTT] Connected to {userdata['host']}:{userdata['port']}")
         client.subscribe(userdata["topic"], qos=0)
         print(f"[MQTT] Subscribed: {userdata['topic']}")
+        if userdata["log_out"]:
+            client.subscribe(userdata["topic"] + "/log", qos=0)
+        if userdata["log_cmd"]:
+            client.publish(userdata["cmd_topic"], userdata["log_cmd"])
+            print(f"[MQTT] Log upload asked: {userdata['log_cmd']}")
     else:
         print(f"[MQTT] Connect failed, reason_code={reason_code}")
 
@@ -41,6 +78,17 @@ def on_disconnect(client, userdata, flags, reason_code, properties=None):
     print(f"[MQTT] Disconnected (rc={reason_code}). Reconnecting...")
 
 def on_message(client, userdata, msg):
+    if userdata["log_out"] and msg.topic == userdata["topic"] + "/log":
+        lines = decode_log_chunk(msg.payload)
+        if lines is None:
+            print(f"[ERR] Not a log chunk ({len(msg.payload)} bytes)")
+        elif not lines:
+            print("[LOG] Upload done.")
+        else:
+            with open(userdata["log_out"], "a", encoding="utf-8", newline="") as f:
+                f.write("\n".join(lines) + "\n")
+            print(f"[LOG] {len(lines)} records, up to seq {lines[-1].split(',')[0]}")
+        return
     line = msg.payload.decode("utf-8", errors="replace").strip()
     print(line)
     out_path: Path = userdata["out_path"]
@@ -52,7 +100,7 @@ def on_message(client, userdata, msg):
     except Exception as e:
         print(f"[ERR] Cannot write to {out_path}: {e}")
 
-def build_client(args, out_path: Path):
+def build_client(args, out_path: Path, log_out=None, log_cmd=None):
     # Use unique client ID to prevent conflicts
     unique_id = f"det_subscriber_{uuid.uuid4().hex[:8]}"
     client = mqtt.Client(mqtt.CallbackAPIVersion.VERSION2, client_id=unique_id)
@@ -62,6 +110,9 @@ def build_client(args, out_path: Path):
         "port": args.port,
         "topic": args.topic,
         "out_path": out_path,
+        "log_out": log_out,
+        "log_cmd": log_cmd,
+        "cmd_topic": args.cmd_topic,
     })
     client.on_connect = on_connect
     client.on_disconnect = on_disconnect
@@ -77,15 +128,28 @@ def parse_args():
     p.add_argument("--password", default=DEFAULT_PASS)
     p.add_argument("--topic", default=DEFAULT_TOPIC)
     p.add_argument("--out", default=DEFAULT_OUT, help="Output CSV path (default: detections.csv)")
+    p.add_argument("--compact", action="store_true", help="Rows from a DETECTION_COMPACT=1 build")
+    p.add_argument("--log-out", default=None, help="CSV for the detection log's records (DETLOG=1 builds)")
+    p.add_argument("--log-from", type=int, default=None, help="Ask for the log's records from this seq on")
+    p.add_argument("--log-to", type=int, default=None, help="... up to this one (default: the latest)")
+    p.add_argument("--cmd-topic", default=DEFAULT_CMD_TOPIC, help="Topic the board takes commands on")
     return p.parse_args()
 
 def main():
     args = parse_args()
     out_path = Path(args.out).expanduser().resolve()
     out_path.parent.mkdir(parents=True, exist_ok=True)
-    ensure_header(out_path)
+    ensure_header(out_path, CSV_HEADERS_COMPACT if args.compact else CSV_HEADERS)
+
+    log_out = log_cmd = None
+    if args.log_out:
+        log_out = Path(args.log_out).expanduser().resolve()
+        log_out.parent.mkdir(parents=True, exist_ok=True)
+        ensure_header(log_out, LOG_HEADERS)
+    if args.log_from is not None:
+        log_cmd = f'{{"log_from": {args.log_from}' + (f', "log_to": {args.log_to}' if args.log_to is not None else "") + "}"
 
-    client = build_client(args, out_path)
+    client = build_client(args, out_path, log_out, log_cmd)
     try:
         client.connect(args.host, args.port, keepalive=60)
         client.loop_forever(retry_first_connection=True)
@@ -0,0 +1,176 @@
+// Cost-aware cascade of the multi builds (multi_predict_cascade): the linear
+// head decides unless its probability is within band of 0.5, then the forest
+// decides. For a sweep of bands the bench reports, per dataset and phase:
+//   - the share of samples decided by each stage;
+//   - accuracy when the CSV has a Label column, and agreement with the forest;
+//   - mean and p95 ns per sample of the cascade, on the shared scaled vector
+//     (extraction and scaling are paid once either way and are left out).
+// Each sample is timed on its own (best of five runs of 20 calls), so the
+// p95 shows the forest-path cost, not an average over the set.
+//
+// Build from the repo root (-DHOST_CASCADE_SVM for the Platt SVM as first
+// stage, ts / new only):
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_C22 -I"esp32_original/src 22 multi"  host/bench_cascade.cpp -o /tmp/cascade_22
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_RFE -I"esp32_original/src new multi" host/bench_cascade.cpp -o /tmp/cascade_new
+// Run (one dataset per run for per-set figures: the extractors keep their
+// state from one dataset argument to the next):
+//   /tmp/cascade_22 [dataset.csv ...]
+#include "replay.h"
+#include <algorithm>
+
+#if defined(HOST_VARIANT_RFE)
+#include "rfe_settings.h"
+#include "infer.h"
+#include "rfe_features.h"
+#elif defined(HOST_VARIANT_C22)
+#include "catch22_settings.h"
+#include "infer.h"
+#include "catch22_features.h"
+#define HOST_N_FEATURES C22_N_FEATURES
+#elif defined(HOST_VARIANT_HJ)
+#include "hjorth_settings.h"
+#include "infer.h"
+#include "hjorth_features.h"
+#define HOST_N_FEATURES HJORTH_N_FEATURES
+#elif defined(HOST_VARIANT_TS)
+#include "tsassure_settings.h"
+#include "infer.h"
+#include "tsassure_features.h"
+#define HOST_N_FEATURES TS_N_FEATURES
+#else
+#error "define one of HOST_VARIANT_RFE / _C22 / _HJ / _TS"
+#endif
+
+#if defined(HOST_CASCADE_SVM)
+static const int linear_head = 1;
+static const char* linear_name = "SVM";
+#else
+static const int linear_head = 0;
+static const char* linear_name = "LR";
+#endif
+
+#if defined(HOST_VARIANT_RFE)
+static MultiSet* sets[2] = { &multi_cold, &multi_warm };
+static const char* set_names[2] = { "COLD", "WARM" };
+static const int n_sets = 2;
+#else
+static MultiSet* sets[1] = { &multi_models };
+static const char* set_names[1] = { "ALL" };
+static const int n_sets = 1;
+#endif
+
+static const float bands[] = { 0.0f, 0.05f, 0.1f, 0.15f, 0.2f, 0.25f, 0.3f, 0.4f, 0.5f };
+
+struct Sample { std::vector<float> f, z; int label; };
+
+static void extract(const std::vector<ReplayRow>& rows, std::vector<Sample> out[]) {
+    for(size_t i=0; i<rows.size(); i++) {
+        float raw[NUM_RAW_INPUTS];
+        for(int k=0; k<NUM_RAW_INPUTS; k++) raw[k] = rows[i].raw[k];
+        if(isnan(raw[0])) continue;
+#if defined(HOST_VARIANT_RFE)
+        update_state(raw, 1 + (uint32_t)(i / 4));
+        int k = (sample_count >= WARMUP_PERIOD) ? 1 : 0;
+        Sample s { std::vector<float>(k ? N_FEATURES_WARM : N_FEATURES_COLD), std::vector<float>(MULTI_MAX_FEATURES),
+                   rows[i].label };
+        extract_features_generic(raw, k ? FEATURE_SPECS_WARM : FEATURE_SPECS_COLD, (int)s.f.size(), s.f.data());
+#else
+        const int k = 0;
+        Sample s { std::vector<float>(HOST_N_FEATURES), std::vector<float>(MULTI_MAX_FEATURES), rows[i].label };
+#if defined(HOST_VARIANT_C22)
+        extract_catch22_features(raw, s.f.data());
+#elif defined(HOST_VARIANT_HJ)
+        extract_hjorth_features(raw, s.f.data());
+#else
+        extract_tsassure_features(raw, s.f.data());
+#endif
+#endif
+        multi_prepare(*sets[k], s.f.data(), s.z.data());
+        out[k].push_back(s);
+    }
+}
+
+// ns of one call on sample s, best of five runs of 20 calls.
+template<typename F>
+static double time_one(F fn) {
+    const int reps = 20;
+    double best = 1e30;
+    for(int pass=0; pass<5; pass++) {
+        uint64_t t0 = replay_now_ns();
+        for(int r=0; r<reps; r++) fn();
+        best = std::min(best, (double)(replay_now_ns() - t0) / reps);
+    }
+    return best;
+}
+
+static void print_row(const char* name, int n, int n_linear, int correct, int labelled, int agree,
+                      std::vector<double>& ns)
+{
+    std::sort(ns.begin(), ns.end());
+    double mean = 0.0;
+    for(double t : ns) mean += t;
+    mean /= ns.size();
+    double p95 = ns[std::min(ns.size() - 1, (size_t)(0.95 * ns.size()))];
+    printf("  %-10s %6.1f%% %6.1f%%", name, 100.0 * n_linear / n, 100.0 * (n - n_linear) / n);
+    if(labelled) printf("  %6.2f%%", 100.0 * correct / labelled);
+    else printf("  %7s", "-");
+    printf("  %6.2f%%  %7.1f  %7.1f\n", 100.0 * agree / n, mean, p95);
+}
+
+static void report(const MultiSet& set, const char* name, const std::vector<Sample>& samples) {
+    int n = (int)samples.size();
+    if(n == 0) return;
+    std::vector<int> rf_label(n);
+    for(int i=0; i<n; i++) rf_label[i] = multi_predict_forest(*set.rf, set.own_scale[2], samples[i].f.data(),
+                                                              samples[i].z.data(), nullptr);
+    printf("%s: %zu samples, first stage %s\n", name, samples.size(), linear_name);
+    printf("  %-10s %7s %7s  %7s  %7s  %7s  %7s\n", "band", linear_name, "RF", "acc", "=RF", "mean ns", "p95 ns");
+    volatile int sink = 0;
+    for(float band : bands) {
+        MultiCascade c;
+        multi_cascade_init(c, linear_head, band);
+        int n_linear = 0, correct = 0, labelled = 0, agree = 0;
+        std::vector<double> ns(n);
+        for(int i=0; i<n; i++) {
+            const Sample& s = samples[i];
+            float score;
+            int stage;
+            int label = multi_predict_cascade(set, c, s.f.data(), s.z.data(), &score, &stage, SCORE_MODE);
+            n_linear += (stage == MULTI_STAGE_LINEAR);
+            agree += (label == rf_label[i]);
+            if(s.label >= 0) { labelled++; correct += (label == s.label); }
+            ns[i] = time_one([&] { sink = sink + multi_predict_cascade(set, c, s.f.data(), s.z.data(), &score,
+                                                                       &stage, SCORE_MODE); });
+        }
+        char label[16];
+        snprintf(label, sizeof(label), "%.2f", band);
+        print_row(label, n, n_linear, correct, labelled, agree, ns);
+    }
+    // The forest on its own, for reference.
+    int correct = 0, labelled = 0;
+    std::vector<double> ns(n);
+    for(int i=0; i<n; i++) {
+        const Sample& s = samples[i];
+        if(s.label >= 0) { labelled++; correct += (rf_label[i] == s.label); }
+        ns[i] = time_one([&] { sink = sink + multi_predict_forest(*set.rf, set.own_scale[2], s.f.data(), s.z.data(),
+                                                                  nullptr); });
+    }
+    print_row("RF alone", n, 0, correct, labelled, n, ns);
+}
+
+int main(int argc, char** argv) {
+    std::vector<const char*> paths;
+    for(int i=1; i<argc; i++) paths.push_back(argv[i]);
+    if(paths.empty()) paths.push_back("dataset/Test-set_1.csv");
+
+    for(int k=0; k<n_sets; k++) multi_init(*sets[k]);
+    for(const char* path : paths) {
+        std::vector<ReplayRow> rows;
+        if(!replay_load(path, rows)) { fprintf(stderr, "cannot read %s\n", path); return 1; }
+        std::vector<Sample> samples[2];
+        extract(rows, samples);
+        printf("dataset: %s (%zu rows)\n", path, rows.size());
+        for(int k=0; k<n_sets; k++) report(*sets[k], set_names[k], samples[k]);
+    }
+    return 0;
+}
@@ -0,0 +1,306 @@
+// Warm-start checkpoint (checkpoint.h) of an LR build on the host:
+//   1. the first rows after a reboot: the dataset is replayed without a
+//      break (the reference), and again with a reboot at row k. The cold
+//      restart starts from empty windows, the warm one from the checkpoint
+//      the first process saved into a directory (the file store), every row
+//      or every 16 rows; in the latter case the rows between the last save
+//      and k are lost with the state, as on the board. Reported: the labels
+//      that differ from the reference in the 64 rows after the reboot;
+//   2. what the saves cost at one save every e rows: blocks, bytes and NVS
+//      entries per save with the delta, against writing the whole image, and
+//      the CPU time of a save (image, CRCs) with a store that writes nothing;
+//   3. what CHECKPOINT_EVERY and CHECKPOINT_MIN_MS do to the flash at a few
+//      sample periods: the default NVS partition rotates 4 of its 5 pages of
+//      126 entries, each good for about 100k erases;
+//   4. saves cut short: a save whose store fails after j of its writes, for
+//      every j. A restore must then read the previous checkpoint (j = 0), the
+//      new one (all writes done), or nothing.
+// Each run in 1 is a fork() of a fresh process, since the extractor keeps
+// state.
+//
+// Build from the repo root:
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_C22 -I"esp32_original/src 22 lr"  host/bench_checkpoint.cpp -o /tmp/ckpt_22
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_HJ  -I"esp32_original/src hj lr"  host/bench_checkpoint.cpp -o /tmp/ckpt_hj
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_TS  -I"esp32_original/src ts lr"  host/bench_checkpoint.cpp -o /tmp/ckpt_ts
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_RFE -I"esp32_original/src new lr" host/bench_checkpoint.cpp -o /tmp/ckpt_new
+// Run:
+//   /tmp/ckpt_22 [dataset.csv]
+#include "replay.h"
+#include <algorithm>
+#include <map>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#if defined(HOST_VARIANT_RFE)
+#include "rfe_settings.h"
+#include "infer.h"
+#include "rfe_features.h"
+#define state_regions rfe_checkpoint_regions
+#define reset_features reset_rfe_state
+#define NAME "rfe"
+#elif defined(HOST_VARIANT_C22)
+#include "catch22_settings.h"
+#include "infer.h"
+#include "catch22_features.h"
+#define state_regions catch22_checkpoint_regions
+#define reset_features reset_catch22_state
+#define NAME "catch22"
+#elif defined(HOST_VARIANT_HJ)
+#include "hjorth_settings.h"
+#include "infer.h"
+#include "hjorth_features.h"
+#define state_regions hjorth_checkpoint_regions
+#define reset_features reset_hjorth_state
+#define NAME "hjorth"
+#elif defined(HOST_VARIANT_TS)
+#include "tsassure_settings.h"
+#include "infer.h"
+#include "tsassure_features.h"
+#define state_regions tsassure_checkpoint_regions
+#define reset_features reset_tsassure_state
+#define NAME "tsassure"
+#else
+#error "define one of HOST_VARIANT_RFE / _C22 / _HJ / _TS"
+#endif
+
+#define AFTER 64            // rows compared after the reboot
+
+static CheckpointRegion regions[CHECKPOINT_MAX_REGIONS];
+
+// One reading through onMqtt's path; -1 for a row onMqtt drops.
+static int step(const ReplayRow& r, uint32_t ts) {
+    float raw[NUM_RAW_INPUTS];
+    for(int k=0; k<NUM_RAW_INPUTS; k++) raw[k] = r.raw[k];
+    if(isnan(raw[0])) return -1;
+    float score = 0.0f;
+#if defined(HOST_VARIANT_RFE)
+    update_state(raw, ts);
+    static float f[N_FEATURES_WARM];
+    if(sample_count < WARMUP_PERIOD) {
+        extract_features_generic(raw, FEATURE_SPECS_COLD, N_FEATURES_COLD, f);
+        return predict_cold(f, &score, SCORE_MODE);
+    }
+    extract_features_generic(raw, FEATURE_SPECS_WARM, N_FEATURES_WARM, f);
+    return predict_warm(f, &score, SCORE_MODE);
+#else
+    (void)ts;
+#if defined(HOST_VARIANT_C22)
+    static float f[C22_N_FEATURES];
+    extract_catch22_features(raw, f);
+#elif defined(HOST_VARIANT_HJ)
+    static float f[HJORTH_N_FEATURES];
+    extract_hjorth_features(raw, f);
+#else
+    static float f[TS_N_FEATURES];
+    extract_tsassure_features(raw, f);
+#endif
+    return predict_lr(f, &score, SCORE_MODE);
+#endif
+}
+
+static bool read_all(int fd, void* p, size_t n) {
+    char* c = (char*)p;
+    while(n > 0) {
+        ssize_t r = read(fd, c, n);
+        if(r <= 0) return false;
+        c += r; n -= (size_t)r;
+    }
+    return true;
+}
+
+// Rows [first, end) in a fresh process, restored from dir first when restore,
+// saving into dir every save_every rows (0: never). The rows' labels come
+// back in labels; the return value is whether the restore found a checkpoint.
+static bool run_forked(const std::vector<ReplayRow>& rows, size_t first, size_t end, const char* dir,
+                       bool restore, int save_every, std::vector<int>& labels) {
+    int fds[2];
+    if(pipe(fds) != 0) return false;
+    pid_t pid = fork();
+    if(pid == 0) {
+        close(fds[0]);
+        Checkpoint& cp = *new Checkpoint;
+        checkpoint_begin(cp, checkpoint_file_store(dir), NAME);
+        int restored = restore && checkpoint_restore(cp, regions, state_regions(regions));
+        write(fds[1], &restored, sizeof(restored));
+        // millis() / 1000 starts over after a reboot
+        for(size_t i=first; i<end; i++) {
+            int label = step(rows[i], (uint32_t)(i - first + 1));
+            write(fds[1], &label, sizeof(label));
+            if(save_every && (i - first + 1) % save_every == 0) checkpoint_save(cp, regions, state_regions(regions), 0);
+        }
+        _exit(0);
+    }
+    close(fds[1]);
+    int restored = 0;
+    labels.assign(end - first, -1);
+    bool ok = read_all(fds[0], &restored, sizeof(restored)) && read_all(fds[0], labels.data(), sizeof(int) * labels.size());
+    close(fds[0]);
+    waitpid(pid, nullptr, 0);
+    return ok && restored;
+}
+
+// A store in memory that takes `budget` more writes, then fails (a save cut
+// short by a reset); counts what it is given.
+struct MemStore {
+    std::map<std::string, std::vector<uint8_t>> keys;
+    long budget = -1;           // -1: no limit
+    bool keep = true;           // false: count only
+};
+
+static bool mem_read(void* ctx, const char* key, void* buf, size_t n) {
+    MemStore* m = (MemStore*)ctx;
+    auto it = m->keys.find(key);
+    if(it == m->keys.end() || it->second.size() != n) return false;
+    memcpy(buf, it->second.data(), n);
+    return true;
+}
+
+static bool mem_write(void* ctx, const char* key, const void* buf, size_t n) {
+    MemStore* m = (MemStore*)ctx;
+    if(m->budget == 0) return false;
+    if(m->budget > 0) m->budget--;
+    if(m->keep) m->keys[key].assign((const uint8_t*)buf, (const uint8_t*)buf + n);
+    return true;
+}
+
+static std::vector<uint8_t> capture() {
+    int n = state_regions(regions);
+    std::vector<uint8_t> img;
+    for(int i=0; i<n; i++) img.insert(img.end(), (uint8_t*)regions[i].p, (uint8_t*)regions[i].p + regions[i].n);
+    return img;
+}
+
+static void apply(const std::vector<uint8_t>& img) {
+    int n = state_regions(regions);
+    size_t off = 0;
+    for(int i=0; i<n; i++) { memcpy(regions[i].p, img.data() + off, regions[i].n); off += regions[i].n; }
+}
+
+int main(int argc, char** argv) {
+    const char* path = (argc > 1) ? argv[1] : "dataset/Test-set_1.csv";
+    std::vector<ReplayRow> rows;
+    if(!replay_load(path, rows) || rows.size() < 2 * AFTER) { fprintf(stderr, "cannot read %s\n", path); return 1; }
+    int n_regions = state_regions(regions);
+    size_t size = 0;
+    for(int i=0; i<n_regions; i++) size += regions[i].n;
+    size_t blocks = (size + CHECKPOINT_BLOCK - 1) / CHECKPOINT_BLOCK;
+    printf("dataset: %s (%zu rows); %s state %zu bytes in %d regions, %zu blocks of %d\n", path, rows.size(), NAME,
+           size, n_regions, blocks, CHECKPOINT_BLOCK);
+
+    // 1. the rows after a reboot
+    char dir[] = "/tmp/ckpt_XXXXXX";
+    if(!mkdtemp(dir)) { fprintf(stderr, "mkdtemp failed\n"); return 1; }
+    std::vector<int> ref, cold, warm, tmp;
+    run_forked(rows, 0, rows.size(), dir, false, 0, ref);
+#if defined(HOST_VARIANT_RFE)
+    printf("  a cold restart runs the cold model for %d rows\n", WARMUP_PERIOD);
+#elif defined(HOST_VARIANT_C22)
+    printf("  a cold restart computes from a partly empty window for %d rows\n", C22_WINDOW_SIZE - 1);
+#elif defined(HOST_VARIANT_HJ)
+    printf("  a cold restart computes from a partly empty window for %d rows\n", HJORTH_WINDOW_SIZE - 1);
+#else
+    printf("  a cold restart has no previous reading for 1 row\n");
+#endif
+    printf("  %-10s %11s %9s %14s %14s\n", "reboot at", "save every", "restored", "cold != ref", "warm != ref");
+    const size_t at[] = { 104, 504, 1504, rows.size() - AFTER };
+    for(size_t k : at) {
+        if(k + AFTER > rows.size()) continue;
+        for(int e : { 1, 16 }) {
+            char cmd[64];
+            snprintf(cmd, sizeof(cmd), "rm -f %s/*", dir);
+            if(system(cmd) != 0) return 1;
+            run_forked(rows, 0, k, dir, false, e, tmp);
+            bool restored = run_forked(rows, k, rows.size(), dir, true, 0, warm);
+            run_forked(rows, k, rows.size(), dir, false, 0, cold);
+            int d_cold = 0, d_warm = 0;
+            for(size_t i=0; i<AFTER; i++) {
+                d_cold += cold[i] != ref[k + i];
+                d_warm += warm[i] != ref[k + i];
+            }
+            printf("  %-10zu %11d %9s %8d / %d %8d / %d\n", k, e, restored ? "yes" : "NO", d_cold, AFTER, d_warm,
+                   AFTER);
+        }
+    }
+    char cmd[64];
+    snprintf(cmd, sizeof(cmd), "rm -rf %s", dir);
+    if(system(cmd) != 0) return 1;
+
+    // 2. what the saves cost
+    size_t full_entries = 2 + (size + 31) / 32 + 2 + (sizeof(CheckpointHeader) + 31) / 32;
+    printf("  %-6s %6s %12s %12s %12s %14s %10s\n", "every", "saves", "blocks/save", "bytes/save",
+           "entries/save", "full image", "us/save");
+    const int every[] = { 1, 4, 16, 64, 600 };
+    double entries_at[5];
+    for(int x=0; x<5; x++) {
+        int e = every[x];
+        reset_features();
+        MemStore m;
+        m.keep = false;
+        Checkpoint& cp = *new Checkpoint;
+        checkpoint_begin(cp, { mem_read, mem_write, &m }, NAME);
+        uint64_t ns = 0;
+        for(size_t i=0; i<rows.size(); i++) {
+            step(rows[i], (uint32_t)(i + 1));
+            if((i + 1) % e) continue;
+            uint64_t t0 = replay_now_ns();
+            checkpoint_save(cp, regions, n_regions, 0);
+            ns += replay_now_ns() - t0;
+        }
+        double saves = cp.saves ? cp.saves : 1;
+        entries_at[x] = cp.entries_written / saves;
+        printf("  %-6d %6u %12.1f %12.0f %12.1f %14zu %10.1f\n", e, cp.saves, cp.blocks_written / saves,
+               cp.bytes_written / saves, entries_at[x], full_entries, ns / 1e3 / saves);
+        delete &cp;
+    }
+
+    // 3. the flash at CHECKPOINT_EVERY / CHECKPOINT_MIN_MS; a save every e
+    // rows costs what part 2 measured for the nearest e at or above it
+    printf("  %-8s %10s %11s %12s %16s %12s\n", "period", "save every", "saves/day", "entries/day", "page erases/day",
+           "100k erases");
+    const double periods[] = { 1, 10, 60, 1800 };
+    for(double p : periods) {
+        double gap = std::max(p * CHECKPOINT_EVERY, CHECKPOINT_MIN_MS / 1000.0);
+        int e = (int)ceil(gap / p);
+        int x = 0;
+        while(x < 4 && every[x] < e) x++;
+        double saves_day = 86400.0 / gap;
+        double erases_day = saves_day * entries_at[x] / (126.0 * 4);
+        printf("  %-6.0f s %8d rows %11.0f %12.0f %16.2f %9.0f yr\n", p, e, saves_day, saves_day * entries_at[x],
+               erases_day, 100000.0 / erases_day / 365.0);
+    }
+
+    // 4. saves cut short
+    reset_features();
+    MemStore base;
+    Checkpoint& cp0 = *new Checkpoint;
+    checkpoint_begin(cp0, { mem_read, mem_write, &base }, NAME);
+    for(size_t i=0; i<200; i++) step(rows[i], (uint32_t)(i + 1));
+    checkpoint_save(cp0, regions, n_regions, 0);
+    std::vector<uint8_t> before = capture();
+    for(size_t i=200; i<216; i++) step(rows[i], (uint32_t)(i + 1));
+    std::vector<uint8_t> after = capture();
+    Checkpoint& cp = *new Checkpoint;
+    Checkpoint& probe = *new Checkpoint;
+    int cases = 0, good = 0;
+    for(long j=0; ; j++) {
+        MemStore m = base;
+        m.budget = j;
+        cp = cp0;
+        cp.store.ctx = &m;
+        apply(after);
+        bool done = checkpoint_save(cp, regions, n_regions, 0);
+        m.budget = -1;
+        checkpoint_begin(probe, { mem_read, mem_write, &m }, NAME);
+        bool restored = checkpoint_restore(probe, regions, n_regions);
+        std::vector<uint8_t> now = capture();
+        bool ok = done ? (restored && now == after)
+                       : (j == 0 ? (restored && now == before) : (!restored && now == after));
+        cases++;
+        good += ok;
+        if(!ok) printf("  cut after %ld writes: restore %s\n", j, restored ? "read a wrong state" : "refused a good one");
+        if(done) break;
+    }
+    printf("  saves cut short: %d of %d cases restored the old checkpoint, the new one or nothing, as due\n", good,
+           cases);
+    return good == cases ? 0 : 1;
+}
@@ -0,0 +1,244 @@
+// Deadline scheduler (deadline.h) of the multi builds under load. The dataset
+// is replayed on a virtual clock: readings arrive every `period` with a burst of
+// 32 at once every 256 readings, and one reading is served at a time, taking
+// the host time its work really took. For each policy the bench reports
+//   - the share of readings at each level, and how many missed the deadline;
+//   - latency (arrival to decision) p50 / p95 / p99 / max, in units of the
+//     mean full-model cost;
+//   - label agreement with the full model, and accuracy when the CSV has a
+//     Label column.
+// The extractors keep state, so every policy runs in a fork() of a fresh
+// process.
+//
+// Build from the repo root (DEADLINE_US only has to be non-zero; the budgets
+// are set below):
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_RFE -DDEADLINE_US=1 -I"esp32_original/src new multi" host/bench_deadline.cpp -o /tmp/deadline_new
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_C22 -DDEADLINE_US=1 -I"esp32_original/src 22 multi"  host/bench_deadline.cpp -o /tmp/deadline_22
+// Run:
+//   /tmp/deadline_new [dataset.csv] [period, in mean full costs (default 1.5)]
+#include "replay.h"
+#include <algorithm>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#if defined(HOST_VARIANT_RFE)
+#include "rfe_settings.h"
+#include "infer.h"
+#include "rfe_features.h"
+#elif defined(HOST_VARIANT_C22)
+#include "catch22_settings.h"
+#include "infer.h"
+#include "catch22_features.h"
+#elif defined(HOST_VARIANT_HJ)
+#include "hjorth_settings.h"
+#include "infer.h"
+#include "hjorth_features.h"
+#elif defined(HOST_VARIANT_TS)
+#include "tsassure_settings.h"
+#include "infer.h"
+#include "tsassure_features.h"
+#else
+#error "define one of HOST_VARIANT_RFE / _C22 / _HJ / _TS"
+#endif
+
+static const char* level_names[DEADLINE_LEVELS] = { "full", "trees", "cold", "linear", "shed" };
+
+struct Policy {
+    const char* name;
+    float budget;       // in mean full costs; 0 = no deadline
+    bool know_period;   // DEADLINE_PERIOD_US = the real period, else 0
+    uint32_t mask;
+};
+
+// One reading at level, as main.cpp does it. Returns the label.
+static int work(DeadlineSched& s, int level, float* raw, uint32_t ts, bool* measure) {
+    static float features[MULTI_MAX_FEATURES];
+    static float z[MULTI_MAX_FEATURES];
+    float score;
+    *measure = true;
+#if defined(HOST_VARIANT_RFE)
+    update_state(raw, ts);
+    if(level == DEADLINE_SHED) return s.label;
+    const MultiSet* set;
+    if(sample_count < WARMUP_PERIOD || level >= DEADLINE_COLD) {
+        extract_features_generic(raw, FEATURE_SPECS_COLD, N_FEATURES_COLD, features);
+        set = &multi_cold;
+    } else {
+        extract_features_generic(raw, FEATURE_SPECS_WARM, N_FEATURES_WARM, features);
+        set = &multi_warm;
+    }
+    *measure = sample_count >= WARMUP_PERIOD || level >= DEADLINE_COLD;
+    multi_prepare(*set, features, z);
+    return predict_deadline(*set, level, features, z, &score, SCORE_MODE);
+#else
+    (void)ts;
+    if(level == DEADLINE_SHED) {
+#if defined(HOST_VARIANT_C22)
+        push_catch22_sample(raw);
+#elif defined(HOST_VARIANT_HJ)
+        push_hjorth_sample(raw);
+#else
+        push_tsassure_sample(raw);
+#endif
+        return s.label;
+    }
+#if defined(HOST_VARIANT_C22)
+    extract_catch22_features(raw, features);
+#elif defined(HOST_VARIANT_HJ)
+    extract_hjorth_features(raw, features);
+#else
+    extract_tsassure_features(raw, features);
+#endif
+    multi_prepare(multi_models, features, z);
+    return predict_deadline(level, features, z, &score, SCORE_MODE);
+#endif
+}
+
+struct RunOut {
+    std::vector<int> labels, levels;
+    std::vector<uint32_t> latency;
+    uint32_t late;
+    double mean_work;
+};
+
+// Serves rows in arrival order on the virtual clock (ns, handed to the
+// scheduler as its microseconds).
+static void run_child(const Policy& pol, double unit, double period, const std::vector<ReplayRow>& rows,
+                      const std::vector<uint32_t>& arrival, int fd)
+{
+#if defined(HOST_VARIANT_RFE)
+    multi_init_all();
+#else
+    multi_init(multi_models);
+#endif
+    DeadlineSched s;
+    uint32_t budget = pol.budget > 0 ? (uint32_t)(pol.budget * unit) : 0xFFFFFFFFu;
+    deadline_init(s, budget, pol.know_period ? (uint32_t)period : 0, pol.budget > 0 ? pol.mask : 0);
+    s.idle_us = 1;    // back to back is a gap of exactly 0 on the virtual clock
+    size_t n = rows.size();
+    std::vector<int> labels(n), levels(n);
+    std::vector<uint32_t> latency(n);
+    uint32_t t_free = 0;
+    double total = 0.0;
+    for(size_t i=0; i<n; i++) {
+        float raw[NUM_RAW_INPUTS];
+        for(int k=0; k<NUM_RAW_INPUTS; k++) raw[k] = rows[i].raw[k];
+        uint32_t start = std::max(arrival[i], t_free);
+        deadline_arrive(s, start);
+        int level = deadline_pick(s, start);
+        bool measure;
+        uint64_t t0 = replay_now_ns();
+        int label = work(s, level, raw, 1 + (uint32_t)(i / 4), &measure);
+        uint32_t cost = (uint32_t)(replay_now_ns() - t0);
+        total += cost;
+        t_free = start + cost;
+        deadline_done(s, level, label, 0.0f, cost, measure, t_free);
+        labels[i] = label;
+        levels[i] = level;
+        latency[i] = t_free - arrival[i];
+    }
+    double mean_work = total / n;
+    write(fd, &s.late, sizeof(s.late));
+    write(fd, &mean_work, sizeof(mean_work));
+    write(fd, labels.data(), sizeof(int) * n);
+    write(fd, levels.data(), sizeof(int) * n);
+    write(fd, latency.data(), sizeof(uint32_t) * n);
+}
+
+static bool read_all(int fd, void* p, size_t n) {
+    char* c = (char*)p;
+    while(n > 0) {
+        ssize_t r = read(fd, c, n);
+        if(r <= 0) return false;
+        c += r; n -= (size_t)r;
+    }
+    return true;
+}
+
+static bool run_forked(const Policy& pol, double unit, double period, const std::vector<ReplayRow>& rows,
+                       const std::vector<uint32_t>& arrival, RunOut& out)
+{
+    int fds[2];
+    if(pipe(fds) != 0) return false;
+    pid_t pid = fork();
+    if(pid == 0) {
+        close(fds[0]);
+        run_child(pol, unit, period, rows, arrival, fds[1]);
+        _exit(0);
+    }
+    close(fds[1]);
+    size_t n = rows.size();
+    out.labels.resize(n); out.levels.resize(n); out.latency.resize(n);
+    bool ok = read_all(fds[0], &out.late, sizeof(out.late)) && read_all(fds[0], &out.mean_work, sizeof(double)) &&
+              read_all(fds[0], out.labels.data(), sizeof(int) * n) &&
+              read_all(fds[0], out.levels.data(), sizeof(int) * n) &&
+              read_all(fds[0], out.latency.data(), sizeof(uint32_t) * n);
+    close(fds[0]);
+    waitpid(pid, nullptr, 0);
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    const char* path = (argc > 1) ? argv[1] : "dataset/Test-set_1.csv";
+    double period_units = (argc > 2) ? atof(argv[2]) : 1.5;
+    std::vector<ReplayRow> rows;
+    if(!replay_load(path, rows)) { fprintf(stderr, "cannot read %s\n", path); return 1; }
+    rows.erase(std::remove_if(rows.begin(), rows.end(), [](const ReplayRow& r) { return isnan(r.raw[0]); }),
+               rows.end());
+    size_t n = rows.size();
+
+    // Mean full-model cost with no load, the unit of everything below.
+    std::vector<uint32_t> idle(n);
+    for(size_t i=0; i<n; i++) idle[i] = (uint32_t)(i * 1000000u);
+    RunOut ref;
+    const Policy full = { "full", 0.0f, false, 0 };
+    if(!run_forked(full, 1.0, 0.0, rows, idle, ref)) { fprintf(stderr, "reference run failed\n"); return 1; }
+    double unit = ref.mean_work;
+    double period = period_units * unit;
+
+    std::vector<uint32_t> arrival(n);
+    double t = 0.0;
+    for(size_t i=0; i<n; i++) {
+        if(i % 256 < 32) arrival[i] = (uint32_t)t;            // burst: 32 at once
+        else { t += period; arrival[i] = (uint32_t)t; }
+        if(i % 256 == 31) t += period;
+    }
+
+    const uint32_t all = DEADLINE_LEVEL_MASK;
+    const uint32_t no_shed = all & ~DEADLINE_BIT(DEADLINE_SHED);
+    const Policy policies[] = {
+        { "no deadline",          0.0f, false, 0 },
+        { "4x, period known",     4.0f, true,  all },
+        { "4x, period 0",         4.0f, false, all },
+        { "4x, no shed",          4.0f, true,  no_shed },
+        { "8x, period known",     8.0f, true,  all },
+        { "2x, period known",     2.0f, true,  all },
+    };
+
+    printf("dataset: %s (%zu rows), mean full cost %.0f ns, period %.2f x, bursts of 32 every 256\n", path, n,
+           unit, period_units);
+    printf("  %-18s", "policy");
+    for(int l=0; l<DEADLINE_LEVELS; l++) printf(" %6s", level_names[l]);
+    printf(" %6s  %6s %6s %6s %7s  %7s %7s\n", "late", "p50", "p95", "p99", "max", "=full", "acc");
+    for(const Policy& pol : policies) {
+        RunOut out;
+        if(!run_forked(pol, unit, period, rows, arrival, out)) { fprintf(stderr, "%s failed\n", pol.name); return 1; }
+        int count[DEADLINE_LEVELS] = { 0 };
+        int agree = 0, correct = 0, labelled = 0;
+        for(size_t i=0; i<n; i++) {
+            count[out.levels[i]]++;
+            agree += (out.labels[i] == ref.labels[i]);
+            if(rows[i].label >= 0) { labelled++; correct += (out.labels[i] == rows[i].label); }
+        }
+        std::vector<uint32_t> lat = out.latency;
+        std::sort(lat.begin(), lat.end());
+        auto q = [&](double p) { return lat[std::min(n - 1, (size_t)(p * n))] / unit; };
+        printf("  %-18s", pol.name);
+        for(int l=0; l<DEADLINE_LEVELS; l++) printf(" %5.1f%%", 100.0 * count[l] / n);
+        printf(" %5.1f%%  %6.2f %6.2f %6.2f %7.2f  %6.2f%%", 100.0 * out.late / n, q(0.5), q(0.95), q(0.99),
+               lat[n - 1] / unit, 100.0 * agree / n);
+        if(labelled) printf(" %6.2f%%\n", 100.0 * correct / labelled);
+        else printf(" %7s\n", "-");
+    }
+    return 0;
+}
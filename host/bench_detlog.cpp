@@ -0,0 +1,379 @@
+// Detection log (detection_log.h) on the host:
+//   1. what a record costs: the dataset's rows, as detection_row.h writes
+//      them with made-up timings and scores, parsed and appended, against a
+//      store in RAM (CPU alone) and the file store; the flash taken per
+//      record against the row's text, and a check that every record reads
+//      back with the row's Time, Label, timings and Score;
+//   2. wear: LAPS laps of a ring of RING_SECTORS sectors, counting the erases
+//      each sector got;
+//   3. power cuts: a store that dies after j writes, the last of them torn
+//      (half its bytes written), for every j over a few sectors' worth of
+//      appends. After detlog_begin on what is left, every record acked before
+//      the cut must read back, the torn one must not, no seq may be used
+//      twice, and appends must go on from there;
+//   4. the range upload: detlog_upload_begin / detlog_pack / detlog_sent as
+//      loop() drives them, decoded as get.py does, for the whole log, a range
+//      inside it and a range the ring has partly overwritten, and across a
+//      sector of lost records, which must not send the empty chunk get.py
+//      takes for the end; the bytes on the wire per record against
+//      publishing the rows' text.
+//
+// Build from the repo root:
+//   g++ -O2 -std=c++17 -I"esp32_original/src 22 lr" host/bench_detlog.cpp -o /tmp/detlog
+// Run:
+//   /tmp/detlog [dataset.csv]
+#include "replay.h"
+#include "catch22_settings.h"     // the IDX_* detection_row.h uses
+#include "detection_log.h"
+#include <algorithm>
+#include <unistd.h>
+
+#define RING_SECTORS 8
+#define LAPS 200
+
+// ---- a flash chip in RAM ----
+
+struct RamFlash {
+    std::vector<uint8_t> mem;
+    std::vector<uint32_t> erases;       // per sector
+    long writes;                        // writes and erases so far
+    long fail_at;                       // the one that is cut short, -1: none
+    bool dead;
+};
+
+static bool ram_read(void* ctx, uint32_t addr, void* buf, size_t n) {
+    RamFlash* f = (RamFlash*)ctx;
+    memcpy(buf, f->mem.data() + addr, n);
+    return true;
+}
+
+static bool ram_write(void* ctx, uint32_t addr, const void* buf, size_t n) {
+    RamFlash* f = (RamFlash*)ctx;
+    if(f->dead) return false;
+    size_t done = n;
+    if(f->writes++ == f->fail_at) {
+        f->dead = true;
+        done = n / 2;
+    }
+    for(size_t i=0; i<done; i++) f->mem[addr + i] &= ((const uint8_t*)buf)[i];
+    return !f->dead;
+}
+
+static bool ram_erase(void* ctx, uint32_t addr) {
+    RamFlash* f = (RamFlash*)ctx;
+    if(f->dead) return false;
+    size_t done = DETLOG_SECTOR;
+    if(f->writes++ == f->fail_at) {
+        f->dead = true;
+        done = DETLOG_SECTOR / 2;
+    }
+    memset(f->mem.data() + addr, 0xFF, done);
+    f->erases[addr / DETLOG_SECTOR]++;
+    return !f->dead;
+}
+
+static DetLogStore ram_store(RamFlash& f, uint32_t sectors) {
+    f.mem.assign((size_t)sectors * DETLOG_SECTOR, 0xFF);
+    f.erases.assign(sectors, 0);
+    f.writes = 0;
+    f.fail_at = -1;
+    f.dead = false;
+    DetLogStore s = { ram_read, ram_write, ram_erase, sectors * DETLOG_SECTOR, &f };
+    return s;
+}
+
+// The same chip after a reset: its contents kept.
+static DetLogStore ram_store_keep(RamFlash& f, uint32_t sectors) {
+    DetLogStore s = { ram_read, ram_write, ram_erase, sectors * DETLOG_SECTOR, &f };
+    return s;
+}
+
+// ---- rows ----
+
+struct Row {
+    std::string text;
+    int label;
+    float feat_ms, test_ms, score;
+};
+
+static std::vector<Row> make_rows(const std::vector<ReplayRow>& in) {
+    std::vector<Row> out;
+    uint32_t x = 12345;
+    for(const ReplayRow& r : in) {
+        x = x * 1664525u + 1013904223u;
+        Row row;
+        row.label = (x >> 8) & 1;
+        row.feat_ms = (float)((x >> 10) % 3000) / 1000.0f;
+        row.test_ms = (float)((x >> 20) % 200) / 1000.0f;
+        row.score = (float)((x >> 4) % 10000) / 10000.0f;
+        DetectionRow& d = detection_row;
+        row_begin(d, r.time.c_str(), r.time.size());
+        row_raw(d, r.raw);
+        row_int(d, row.label);
+        row_fixed(d, row.feat_ms, 3);
+        row_fixed(d, row.test_ms, 3);
+        row_score(d, row.score, true);
+        row.text = row_end(d);
+        out.push_back(row);
+    }
+    return out;
+}
+
+// Time checked against timegm, the rest against what the row was made from.
+static bool record_matches(const DetLogRecord& r, const Row& row, const std::string& time) {
+    struct tm tm = {};
+    if(sscanf(time.c_str(), "%d/%d/%d %d:%d", &tm.tm_mday, &tm.tm_mon, &tm.tm_year, &tm.tm_hour, &tm.tm_min) != 5) return false;
+    tm.tm_mon -= 1;
+    tm.tm_year -= 1900;
+    return r.time == (uint32_t)timegm(&tm) && r.labels == row.label &&
+           fabsf(r.feat_us / 1000.0f - row.feat_ms) < 0.0011f && fabsf(r.test_us / 1000.0f - row.test_ms) < 0.0011f &&
+           fabsf(r.score - row.score) < 0.00006f && r.aux == 0xFF;
+}
+
+static double now_us() {
+    return replay_now_ns() / 1000.0;
+}
+
+// ---- 4: the range upload, decoded as get.py does ----
+
+struct Upload {
+    std::vector<DetLogRecord> recs;
+    size_t bytes;
+    int chunks;
+    bool ok;            // well-formed, in order, one empty chunk at the end
+};
+
+static Upload upload(DetLog& l, uint32_t from, uint32_t to) {
+    Upload u = { {}, 0, 0, true };
+    bool ended = false;
+    detlog_upload_begin(l, from, to);
+    int passes = 0;
+    while(l.uploading && passes++ < 100000) {
+        uint32_t next;
+        size_t n = detlog_pack(l, &next);
+        if(n == 0) {
+            // a gap, passed over as upload_log() does: nothing on the wire
+            detlog_sent(l, next);
+            continue;
+        }
+        if(ended) u.ok = false;     // get.py stopped at the empty one
+        u.bytes += n + 5 + strlen("duy/sensorDetection/log");    // MQTT fixed header and topic
+        u.chunks++;
+        uint32_t magic, count_size;
+        memcpy(&magic, l.chunk, 4);
+        memcpy(&count_size, l.chunk + 12, 4);
+        uint16_t count = count_size & 0xFFFF;
+        if(count == 0) ended = true;
+        if(magic != DETLOG_CHUNK_MAGIC || (count_size >> 16) != DETLOG_RECORD || n != (size_t)(DETLOG_CHUNK_HEADER + count * DETLOG_RECORD)) u.ok = false;
+        for(int i=0; i<count; i++) {
+            DetLogRecord r;
+            memcpy(&r, l.chunk + DETLOG_CHUNK_HEADER + i * DETLOG_RECORD, sizeof(r));
+            if(!u.recs.empty() && r.seq <= u.recs.back().seq) u.ok = false;
+            u.recs.push_back(r);
+        }
+        detlog_sent(l, next);
+    }
+    if(!ended) u.ok = false;
+    return u;
+}
+
+int main(int argc, char** argv) {
+    const char* path = (argc > 1) ? argv[1] : "dataset/Test-set_1.csv";
+    std::vector<ReplayRow> data;
+    if(!replay_load(path, data)) {
+        fprintf(stderr, "cannot read %s\n", path);
+        return 1;
+    }
+    std::vector<Row> rows = make_rows(data);
+    const uint32_t N = (uint32_t)rows.size();
+
+    // ---- 1 ----
+    printf("== 1. cost per record, %u rows (%s)\n", N, path);
+    {
+        RamFlash f;
+        DetLog l;
+        const uint32_t sectors = (N + DETLOG_PER_SECTOR - 1) / DETLOG_PER_SECTOR + 2;
+        detlog_begin(l, ram_store(f, sectors));
+        double t0 = now_us();
+        for(const Row& row : rows) detlog_append_row(l, row.text.c_str(), row.text.size());
+        double t_ram = now_us() - t0;
+
+        DetLogRecord rec;
+        t0 = now_us();
+        for(int k=0; k<100; k++) {
+            for(const Row& row : rows) detlog_row_record(row.text.c_str(), row.text.size(), rec);
+        }
+        double t_parse = (now_us() - t0) / 100;
+
+        uint32_t good = 0;
+        for(uint32_t i=0; i<N; i++) {
+            if(detlog_read(l, i, rec) && rec.seq == i && record_matches(rec, rows[i], data[i].time)) good++;
+        }
+
+        char file[] = "/tmp/detlog_XXXXXX";
+        int fd = mkstemp(file);
+        close(fd);
+        unlink(file);
+        DetLogFile df;
+        DetLog lf;
+        detlog_begin(lf, detlog_file_store(df, file, sectors));
+        t0 = now_us();
+        for(const Row& row : rows) detlog_append_row(lf, row.text.c_str(), row.text.size());
+        double t_file = now_us() - t0;
+        DetLog lf2;                 // reopened: the end is found again
+        detlog_begin(lf2, lf.store);
+        uint32_t good_file = 0;
+        for(uint32_t i=0; i<N; i++) {
+            if(detlog_read(lf2, i, rec) && record_matches(rec, rows[i], data[i].time)) good_file++;
+        }
+        fclose(df.f);
+        unlink(file);
+
+        double text = 0;
+        for(const Row& row : rows) text += row.text.size() + 1;
+        printf("  parse a row                %.2f us\n", t_parse / N);
+        printf("  parse + append, RAM store  %.2f us   (%u erases)\n", t_ram / N, l.erases);
+        printf("  parse + append, file store %.2f us   (a write and fflush per record)\n", t_file / N);
+        printf("  read back, RAM store       %u / %u records match their row\n", good, N);
+        printf("  reopened file store        next seq %u, %u / %u match\n", lf2.next_seq, good_file, N);
+        printf("  flash per record           %.2f B (20 + the sector header's share), row text %.1f B\n",
+               (double)DETLOG_SECTOR / DETLOG_PER_SECTOR, text / N);
+    }
+
+    // ---- 2 ----
+    printf("== 2. wear: %d laps of a %d-sector ring\n", LAPS, RING_SECTORS);
+    {
+        RamFlash f;
+        DetLog l;
+        detlog_begin(l, ram_store(f, RING_SECTORS));
+        const uint32_t total = (uint32_t)LAPS * RING_SECTORS * DETLOG_PER_SECTOR;
+        for(uint32_t i=0; i<total; i++) {
+            const Row& row = rows[i % N];
+            detlog_append_row(l, row.text.c_str(), row.text.size());
+        }
+        uint32_t lo = *std::min_element(f.erases.begin(), f.erases.end());
+        uint32_t hi = *std::max_element(f.erases.begin(), f.erases.end());
+        printf("  %u records, erases per sector min %u max %u; oldest readable seq %u (ring holds %u)\n", total,
+               lo, hi, detlog_oldest(l), RING_SECTORS * DETLOG_PER_SECTOR);
+        printf("  the default table's spiffs partition, 0x160000 B = %d sectors: %d records; at 100k erases a sector\n",
+               0x160000 / DETLOG_SECTOR, 0x160000 / DETLOG_SECTOR * DETLOG_PER_SECTOR);
+        const double cap = 100000.0 * (0x160000 / DETLOG_SECTOR) * DETLOG_PER_SECTOR;
+        printf("    1 s period: %.0f years   60 s: %.0f years   1800 s: %.0f years\n", cap / 86400 / 365,
+               cap * 60 / 86400 / 365, cap * 1800 / 86400 / 365);
+    }
+
+    // ---- 3 ----
+    printf("== 3. power cuts\n");
+    {
+        const uint32_t APPENDS = 3 * DETLOG_PER_SECTOR + 17;
+        const uint32_t sectors = 3;     // so the run laps the ring
+        int cases = 0, passed = 0;
+        for(long j=0; ; j++) {
+            RamFlash f;
+            DetLog l;
+            detlog_begin(l, ram_store(f, sectors));
+            // a prefix the first run leaves behind, then the cut
+            f.fail_at = j;
+            std::vector<bool> acked;
+            for(uint32_t i=0; i<APPENDS && !f.dead; i++) {
+                const Row& row = rows[i % N];
+                acked.push_back(detlog_append_row(l, row.text.c_str(), row.text.size()));
+            }
+            if(!f.dead) break;      // j past the last write: done
+            cases++;
+            uint32_t cut = (uint32_t)acked.size() - 1;      // the append that was cut
+
+            f.dead = false;
+            f.fail_at = -1;
+            DetLog r;
+            detlog_begin(r, ram_store_keep(f, sectors));
+                    bool ok = true;
+            DetLogRecord rec;
+            // acked records still in the ring read back, but for those of a
+            // sector the cut append was erasing for itself; the cut one does not
+            uint32_t erasing = (cut % DETLOG_PER_SECTOR == 0 && cut >= sectors * DETLOG_PER_SECTOR)
+                             ? cut - sectors * DETLOG_PER_SECTOR : 0xFFFFFFFFu;
+            for(uint32_t i=0; i<cut; i++) {
+                if(i - erasing < DETLOG_PER_SECTOR) continue;
+                if(acked[i] && (int32_t)(i - detlog_oldest(r)) >= 0 &&
+                   !(detlog_read(r, i, rec) && record_matches(rec, rows[i % N], data[i % N].time)))
+                    ok = false;
+            }
+            if(detlog_read(r, cut, rec)) ok = false;
+            // no seq used twice: the next record goes after the cut one
+            if((int32_t)(r.next_seq - cut) < 0) ok = false;
+            // and the log goes on
+            uint32_t first = r.next_seq;
+            for(uint32_t i=0; i<2 * DETLOG_PER_SECTOR; i++) {
+                const Row& row = rows[i % N];
+                if(!detlog_append_row(r, row.text.c_str(), row.text.size())) ok = false;
+            }
+            for(uint32_t i=first; i<r.next_seq; i++) {
+                if(!(detlog_read(r, i, rec) && record_matches(rec, rows[(i - first) % N], data[(i - first) % N].time)))
+                    ok = false;
+            }
+            DetLog again;
+            detlog_begin(again, r.store);
+            if(again.next_seq != r.next_seq) ok = false;
+            if(ok) passed++;
+            else printf("  FAIL: cut at write %ld (append %u), reopened at %u\n", j, cut, r.next_seq);
+        }
+        printf("  %d of %d cut points recovered\n", passed, cases);
+    }
+
+    // ---- 4 ----
+    printf("== 4. range upload\n");
+    {
+        RamFlash f;
+        DetLog l;
+        const uint32_t sectors = 8;
+        detlog_begin(l, ram_store(f, sectors));
+        for(const Row& row : rows) detlog_append_row(l, row.text.c_str(), row.text.size());
+        const uint32_t held = std::min(N, l.next_seq - detlog_oldest(l));
+        struct Case {
+            const char* what;
+            uint32_t from, to;
+        } cases[] = {
+            { "everything (log_from 0)", 0, 0xFFFFFFFFu },
+            { "a range inside", l.next_seq - 300, l.next_seq - 101 },
+            { "the last record", l.next_seq - 1, 0xFFFFFFFFu },
+            { "past the end", l.next_seq + 5, 0xFFFFFFFFu },
+        };
+        for(const Case& c : cases) {
+            Upload u = upload(l, c.from, c.to);
+            uint32_t lo = std::max(c.from, detlog_oldest(l));
+            uint32_t hi = std::min(c.to, l.next_seq - 1);
+            uint32_t want = (c.from >= l.next_seq) ? 0 : hi - lo + 1;
+            bool match = u.ok && u.recs.size() == want;
+            for(size_t i=0; match && i<u.recs.size(); i++) {
+                uint32_t s = u.recs[i].seq;
+                match = s == lo + i && record_matches(u.recs[i], rows[s], data[s].time);
+            }
+            printf("  %-24s %5zu records in %3d chunks, %7zu B on the wire: %s\n", c.what, u.recs.size(), u.chunks,
+                   u.bytes, match ? "ok" : "MISMATCH");
+        }
+        double text = 0;
+        for(uint32_t s=detlog_oldest(l); s<l.next_seq; s++) text += rows[s].text.size() + 1;
+        Upload u = upload(l, 0, 0xFFFFFFFFu);
+        {
+            // a sector's worth of records lost (CRCs cleared), more than one
+            // pass reads, starting where the fourth chunk would
+            RamFlash g = f;
+            DetLog lost = l;
+            lost.store.ctx = &g;
+            uint32_t first = detlog_oldest(l) + 3 * DETLOG_CHUNK_RECORDS;
+            for(uint32_t s=first; s<first+DETLOG_PER_SECTOR; s++)
+                memset(g.mem.data() + dl_record_addr(lost, s), 0, DETLOG_RECORD);
+            Upload v = upload(lost, 0, 0xFFFFFFFFu);
+            bool match = v.ok && v.recs.size() == held - DETLOG_PER_SECTOR;
+            for(const DetLogRecord& r : v.recs) {
+                if(r.seq >= first && r.seq < first + DETLOG_PER_SECTOR) match = false;
+            }
+            printf("  %-24s %5zu records in %3d chunks, %7zu B on the wire: %s\n", "a gap of lost records", v.recs.size(),
+                   v.chunks, v.bytes, match ? "ok" : "MISMATCH");
+        }
+        printf("  the %u records the ring holds: %.1f B each on the wire, against %.1f B of row text "
+               "(and a row per message, or an outbox bulk message)\n", held, (double)u.bytes / held, text / held);
+    }
+    return 0;
+}
@@ -0,0 +1,155 @@
+// Binary sample frames (sample_frame.h) against data.py's JSON on a dataset:
+//   - bytes per message: payload, and on the wire with the MQTT PUBLISH header
+//     and topic (duy/sensorFault/bin for frames, duy/sensorFault for JSON);
+//   - firmware ns per message to read it into SensorJson: sample_frame_decode
+//     against sensor_json_parse (FAST_JSON=1) and, with -DBENCH_JSONCPP, a DOM
+//     parser standing in for ArduinoJson;
+//   - publisher ns per message to write it: sample_frame_encode against one
+//     snprintf of the JSON text;
+//   - a round trip: every frame decodes to the row's four channels bit for bit
+//     and to a Time that reads back as the row's.
+// Times are the best of five passes over all rows.
+//
+// Build from the repo root:
+//   g++ -O2 -std=c++17 -I"esp32_original/src 22 lr" host/bench_frame.cpp -o /tmp/frame
+//   g++ -O2 -std=c++17 -DBENCH_JSONCPP -I/usr/include/jsoncpp -I"esp32_original/src 22 lr" host/bench_frame.cpp -ljsoncpp -o /tmp/frame
+// Run:
+//   /tmp/frame [dataset.csv]
+#include "replay.h"
+#include <algorithm>
+#include "catch22_settings.h"
+#include "sensor_json.h"
+#include "sample_frame.h"
+#if defined(BENCH_JSONCPP)
+#include <json/json.h>
+#endif
+
+struct Message {
+    std::string json;
+    uint8_t frame[SAMPLE_FRAME_HEADER + 4 * NUM_RAW_INPUTS];
+    const ReplayRow* row;
+};
+
+// MQTT PUBLISH at QoS 0: fixed header, topic length, topic, payload.
+static size_t wire_size(const char* topic, size_t payload) {
+    size_t rem = 2 + strlen(topic) + payload;
+    return 1 + (rem < 128 ? 1 : rem < 16384 ? 2 : 3) + rem;
+}
+
+template <typename F>
+static double best_ns(size_t n, F f) {
+    double best = 1e30;
+    for(int pass=0; pass<5; pass++) {
+        uint64_t t0 = replay_now_ns();
+        f();
+        best = std::min(best, (double)(replay_now_ns() - t0) / n);
+    }
+    return best;
+}
+
+static volatile float sink;
+
+int main(int argc, char** argv) {
+    const char* path = (argc > 1) ? argv[1] : "dataset/Test-set_1.csv";
+    std::vector<ReplayRow> rows;
+    if(!replay_load(path, rows)) { fprintf(stderr, "cannot read %s\n", path); return 1; }
+    std::vector<Message> msgs;
+    for(const ReplayRow& r : rows) {
+        Message m;
+        if(!replay_json_payload(r, m.json)) continue;
+        sample_frame_encode(m.frame, sizeof(m.frame), (uint32_t)msgs.size(), replay_epoch(r.time), r.raw, NUM_RAW_INPUTS);
+        m.row = &r;
+        msgs.push_back(m);
+    }
+    if(msgs.empty()) { fprintf(stderr, "no rows in %s\n", path); return 1; }
+    size_t n = msgs.size();
+
+    // Round trip.
+    int bad_time = 0, bad_raw = 0;
+    for(const Message& m : msgs) {
+        SensorJson in;
+        if(!sample_frame_decode(m.frame, sizeof(m.frame), in)) { bad_time++; bad_raw += NUM_RAW_INPUTS; continue; }
+        bad_time += replay_epoch(std::string(in.time, in.time_len)) != replay_epoch(m.row->time);
+        bad_raw += memcmp(in.raw, m.row->raw, sizeof(in.raw)) != 0;
+    }
+
+    size_t json_bytes = 0, json_wire = 0;
+    for(const Message& m : msgs) {
+        json_bytes += m.json.size();
+        json_wire += wire_size("duy/sensorFault", m.json.size());
+    }
+    double frame_bytes = (double)sizeof(msgs[0].frame);
+    double frame_wire = (double)wire_size("duy/sensorFault/bin", sizeof(msgs[0].frame));
+
+    printf("dataset: %s (%zu messages)\n", path, n);
+    printf("  round trip: %d times, %d channel sets differ\n", bad_time, bad_raw);
+    printf("  %-22s %9s %9s %10s %10s\n", "", "payload", "wire", "decode ns", "encode ns");
+
+    double frame_dec = best_ns(n, [&] {
+        float s = 0.0f;
+        for(const Message& m : msgs) {
+            SensorJson in;
+            sample_frame_decode(m.frame, sizeof(m.frame), in);
+            s += in.raw[0] + in.time[0];
+        }
+        sink = s;
+    });
+    double frame_enc = best_ns(n, [&] {
+        uint8_t buf[64];
+        float s = 0.0f;
+        uint32_t seq = 0;
+        for(const Message& m : msgs) {
+            s += sample_frame_encode(buf, sizeof(buf), seq, 1658926800u + seq * 1800, m.row->raw, NUM_RAW_INPUTS);
+            seq++;
+            s += buf[13];
+        }
+        sink = s;
+    });
+    printf("  %-22s %9.1f %9.1f %10.0f %10.0f\n", "sample frame", frame_bytes, frame_wire, frame_dec, frame_enc);
+
+    double json_dec = best_ns(n, [&] {
+        float s = 0.0f;
+        for(const Message& m : msgs) {
+            SensorJson in;
+            sensor_json_parse(m.json.data(), m.json.size(), in);
+            s += in.raw[0] + in.time[0];
+        }
+        sink = s;
+    });
+    double json_enc = best_ns(n, [&] {
+        char buf[256];
+        float s = 0.0f;
+        for(const Message& m : msgs) {
+            const float* r = m.row->raw;
+            s += snprintf(buf, sizeof(buf), "{\"Time\": \"%s\", \"Temperature\": %.9g, \"Humidity\": %.9g, "
+                          "\"Humidity_WeatherStation\": %.9g, \"Temperature_WeatherStation\": %.9g}",
+                          m.row->time.c_str(), r[IDX_TEMPERATURE], r[IDX_HUMIDITY],
+                          r[IDX_HUMIDITY_WEATHERSTATION], r[IDX_TEMPERATURE_WEATHERSTATION]);
+        }
+        sink = s;
+    });
+    printf("  %-22s %9.1f %9.1f %10.0f %10.0f\n", "JSON, sensor_json", (double)json_bytes / n,
+           (double)json_wire / n, json_dec, json_enc);
+
+#if defined(BENCH_JSONCPP)
+    Json::CharReaderBuilder builder;
+    Json::CharReader* reader = builder.newCharReader();
+    double dom_dec = best_ns(n, [&] {
+        float s = 0.0f;
+        for(const Message& m : msgs) {
+            Json::Value doc;
+            reader->parse(m.json.data(), m.json.data() + m.json.size(), &doc, nullptr);
+            std::string time = doc["Time"].asString();
+            s += doc["Temperature"].asFloat() + time[0];
+        }
+        sink = s;
+    });
+    printf("  %-22s %9.1f %9.1f %10.0f %10s\n", "JSON, jsoncpp", (double)json_bytes / n,
+           (double)json_wire / n, dom_dec, "-");
+    delete reader;
+#endif
+
+    printf("  frame vs JSON: %.1fx fewer bytes on the wire, decode %.1fx faster than sensor_json\n",
+           (double)json_wire / n / frame_wire, json_dec / frame_dec);
+    return 0;
+}
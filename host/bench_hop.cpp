@@ -0,0 +1,153 @@
+// Hop scheduling (hop.h) of the catch22 / Hjorth LR builds: replays a dataset
+// with the features and the model recomputed every k readings, for a range of
+// k, and reports
+//   - mean ns per reading for the whole onMqtt work (push, extraction when
+//     due, inference when due), and the speed-up against k = 1;
+//   - accuracy when the CSV has a Label column, and label agreement with k = 1;
+//   - mean absolute score error against k = 1 for the held score and for the
+//     extrapolated one (HOP_SCORE_HOLD / HOP_SCORE_EXTRAPOLATE).
+// The extractors keep state, so every k runs in a fork() of a fresh process;
+// the time is the best of five such runs.
+//
+// Build from the repo root:
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_C22 -I"esp32_original/src 22 lr" host/bench_hop.cpp -o /tmp/hop_22
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_HJ  -I"esp32_original/src hj lr" host/bench_hop.cpp -o /tmp/hop_hj
+// Run:
+//   /tmp/hop_22 [dataset.csv ...]
+#include "replay.h"
+#include <algorithm>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#if defined(HOST_VARIANT_C22)
+#include "catch22_settings.h"
+#include "infer.h"
+#include "catch22_features.h"
+#define HOP_FEATURES C22_N_FEATURES
+#define hop_extract extract_catch22_features_hop
+#define hop_k catch22_hop
+#define hop_pending catch22_pending
+#define hop_gap catch22_gap
+#elif defined(HOST_VARIANT_HJ)
+#include "hjorth_settings.h"
+#include "infer.h"
+#include "hjorth_features.h"
+#define HOP_FEATURES HJORTH_N_FEATURES
+#define hop_extract extract_hjorth_features_hop
+#define hop_k hjorth_hop
+#define hop_pending hjorth_pending
+#define hop_gap hjorth_gap
+#else
+#error "define one of HOST_VARIANT_C22 / _HJ"
+#endif
+#include "hop.h"
+
+struct RowOut { int label; float held, extrapolated; };
+struct RunOut { std::vector<RowOut> rows; double ns; uint32_t computed; };
+
+// One reading through onMqtt's path with a hop of hop_k.
+static RowOut step(float* raw, bool* computed) {
+    static float f[HOP_FEATURES];
+    RowOut r;
+    *computed = hop_extract(raw, f);
+    if(*computed) {
+        float score = 0.0f;
+        r.label = predict_lr(f, &score, SCORE_MODE);
+        hop_decided(hop_state, 0, r.label, score, hop_gap);
+        r.held = r.extrapolated = score;
+    } else {
+        r.label = hop_result(hop_state, 0, hop_pending, &r.held);
+        r.extrapolated = r.held + hop_state.slope[0] * hop_pending;
+    }
+    return r;
+}
+
+static void run_child(int k, const std::vector<ReplayRow>& rows, int fd) {
+    hop_k = k;
+    RunOut out {};
+    uint64_t total = 0;
+    for(size_t i=0; i<rows.size(); i++) {
+        float raw[NUM_RAW_INPUTS];
+        for(int c=0; c<NUM_RAW_INPUTS; c++) raw[c] = rows[i].raw[c];
+        if(isnan(raw[0])) { out.rows.push_back({ -1, 0.0f, 0.0f }); continue; }
+        bool computed;
+        uint64_t t0 = replay_now_ns();
+        out.rows.push_back(step(raw, &computed));
+        total += replay_now_ns() - t0;
+        out.computed += computed;
+    }
+    out.ns = (double)total / rows.size();
+    write(fd, &out.ns, sizeof(out.ns));
+    write(fd, &out.computed, sizeof(out.computed));
+    write(fd, out.rows.data(), sizeof(RowOut) * out.rows.size());
+}
+
+static bool read_all(int fd, void* p, size_t n) {
+    char* c = (char*)p;
+    while(n > 0) {
+        ssize_t r = read(fd, c, n);
+        if(r <= 0) return false;
+        c += r; n -= (size_t)r;
+    }
+    return true;
+}
+
+static bool run_forked(int k, const std::vector<ReplayRow>& rows, RunOut& out) {
+    int fds[2];
+    if(pipe(fds) != 0) return false;
+    pid_t pid = fork();
+    if(pid == 0) {
+        close(fds[0]);
+        run_child(k, rows, fds[1]);
+        _exit(0);
+    }
+    close(fds[1]);
+    out.rows.resize(rows.size());
+    bool ok = read_all(fds[0], &out.ns, sizeof(out.ns)) && read_all(fds[0], &out.computed, sizeof(out.computed)) &&
+              read_all(fds[0], out.rows.data(), sizeof(RowOut) * rows.size());
+    close(fds[0]);
+    waitpid(pid, nullptr, 0);
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    std::vector<const char*> paths;
+    for(int i=1; i<argc; i++) paths.push_back(argv[i]);
+    if(paths.empty()) paths.push_back("dataset/Test-set_1.csv");
+
+    const int ks[] = { 1, 2, 3, 4, 6, 8, 12, 16 };
+
+    for(const char* path : paths) {
+        std::vector<ReplayRow> rows;
+        if(!replay_load(path, rows)) { fprintf(stderr, "cannot read %s\n", path); return 1; }
+        printf("dataset: %s (%zu rows)\n", path, rows.size());
+        printf("  %4s %9s %8s %7s  %7s  %7s  %9s %9s\n", "k", "computed", "ns/read", "speedup", "acc", "=k1",
+               "|d| hold", "|d| extr");
+        RunOut ref;
+        for(int k : ks) {
+            RunOut out;
+            double best = 1e30;
+            for(int pass=0; pass<5; pass++) {
+                if(!run_forked(k, rows, out)) { fprintf(stderr, "k = %d failed\n", k); return 1; }
+                best = std::min(best, out.ns);
+            }
+            out.ns = best;
+            if(k == 1) ref = out;
+            int n = 0, correct = 0, labelled = 0, agree = 0;
+            double d_hold = 0.0, d_extr = 0.0;
+            for(size_t i=0; i<rows.size(); i++) {
+                if(out.rows[i].label < 0) continue;
+                n++;
+                agree += (out.rows[i].label == ref.rows[i].label);
+                d_hold += fabs(out.rows[i].held - ref.rows[i].held);
+                d_extr += fabs(out.rows[i].extrapolated - ref.rows[i].held);
+                if(rows[i].label >= 0) { labelled++; correct += (out.rows[i].label == rows[i].label); }
+            }
+            printf("  %4d %8.2f%% %8.0f %6.2fx", k, 100.0 * out.computed / n, out.ns, ref.ns / out.ns);
+            if(labelled) printf("  %6.2f%%", 100.0 * correct / labelled);
+            else printf("  %7s", "-");
+            printf("  %6.2f%%  %9.4f %9.4f\n", 100.0 * agree / n, d_hold / n, d_extr / n);
+        }
+    }
+    return 0;
+}
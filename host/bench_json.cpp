@@ -0,0 +1,211 @@
+// Ingest parse time: sensor_json_parse (sensor_json.h, FAST_JSON=1) against a
+// DOM parser on the payloads data.py publishes for a dataset, i.e. each row
+// as json.dumps writes it:
+//   {"Time": "27/07/2022 13:00", "Temperature": 36.5, "Humidity": 8.833333333, ...}
+// For each parser the bench reports ns per message (best of five passes over
+// all rows, Time copied out and the four channels read, as onMqtt does),
+// heap allocations per message (malloc calls, counted by wrapping glibc's
+// malloc), and the channels that differ from strtof on the same text.
+//
+// The DOM parser is ArduinoJson, what onMqtt uses without FAST_JSON, when its
+// src/ directory is on the include path (-DBENCH_ARDUINOJSON). That is the
+// comparison the speed-up is quoted from. jsoncpp (-DBENCH_JSONCPP) is only
+// an allocating parser packaged for Linux, for when ArduinoJson is not to
+// hand: its figures say nothing about ArduinoJson's, which allocates one pool
+// per document, so no speed-up is printed for it. With neither only the fast
+// parser runs.
+//
+// Build from the repo root:
+//   git clone --depth 1 https://github.com/bblanchon/ArduinoJson /tmp/ArduinoJson
+//   g++ -O2 -std=c++17 -DBENCH_ARDUINOJSON -I/tmp/ArduinoJson/src -I"esp32_original/src 22 lr" host/bench_json.cpp -o /tmp/json
+//   g++ -O2 -std=c++17 -DBENCH_JSONCPP -I/usr/include/jsoncpp -I"esp32_original/src 22 lr" host/bench_json.cpp -ljsoncpp -o /tmp/json
+// Run:
+//   /tmp/json [dataset.csv]
+#include "replay.h"
+#include <algorithm>
+#include "catch22_settings.h"
+#include "sensor_json.h"
+#if defined(BENCH_ARDUINOJSON)
+#include <ArduinoJson.h>
+#elif defined(BENCH_JSONCPP)
+#include <json/json.h>
+#endif
+
+extern "C" void* __libc_malloc(size_t n);
+static uint64_t malloc_calls = 0;
+extern "C" void* malloc(size_t n) {
+    malloc_calls++;
+    return __libc_malloc(n);
+}
+
+struct Payload {
+    std::string json;
+    float expect[NUM_RAW_INPUTS];    // strtof of each channel's text in the payload
+};
+
+static bool load_payloads(const char* path, std::vector<Payload>& out) {
+    std::vector<ReplayRow> rows;
+    if(!replay_load(path, rows)) return false;
+    for(const ReplayRow& r : rows) {
+        Payload p;
+        if(!replay_json_payload(r, p.json)) continue;    // data.py skips these rows too
+        for(int i=0; i<NUM_RAW_INPUTS; i++) p.expect[i] = strtof(replay_py_float(r.raw_text[i]).c_str(), nullptr);
+        out.push_back(p);
+    }
+    return true;
+}
+
+struct Result { double ns; double allocs; int mismatched; };
+
+static bool same(float a, float b) { return memcmp(&a, &b, sizeof(float)) == 0; }
+
+static Result run_fast(const std::vector<Payload>& in) {
+    Result r { 1e30, 0.0, 0 };
+    std::string time;
+    time.reserve(64);
+    for(int pass=0; pass<5; pass++) {
+        uint64_t a0 = malloc_calls, t0 = replay_now_ns();
+        float sink = 0.0f;
+        int bad = 0;
+        for(const Payload& p : in) {
+            SensorJson j;
+            if(!sensor_json_parse(p.json.data(), p.json.size(), j)) { bad += NUM_RAW_INPUTS; continue; }
+            time.assign(j.time, j.time_len);
+            for(int i=0; i<NUM_RAW_INPUTS; i++) { sink += j.raw[i]; bad += !same(j.raw[i], p.expect[i]); }
+        }
+        double ns = (double)(replay_now_ns() - t0) / in.size();
+        r.allocs = (double)(malloc_calls - a0) / in.size();
+        r.ns = std::min(r.ns, ns);
+        r.mismatched = bad;
+        if(sink == 1234.5f) printf(" ");
+    }
+    return r;
+}
+
+#if defined(BENCH_ARDUINOJSON) || defined(BENCH_JSONCPP)
+static const char* KEYS[5] = { "Time", "Temperature", "Humidity", "Humidity_WeatherStation",
+                               "Temperature_WeatherStation" };
+static const int KEY_IDX[5] = { -1, IDX_TEMPERATURE, IDX_HUMIDITY, IDX_HUMIDITY_WEATHERSTATION,
+                                IDX_TEMPERATURE_WEATHERSTATION };
+
+static Result run_dom(const std::vector<Payload>& in) {
+    Result r { 1e30, 0.0, 0 };
+    std::string time;
+    time.reserve(64);
+    for(int pass=0; pass<5; pass++) {
+        uint64_t a0 = malloc_calls, t0 = replay_now_ns();
+        float sink = 0.0f;
+        int bad = 0;
+        for(const Payload& p : in) {
+            float raw[NUM_RAW_INPUTS];
+#if defined(BENCH_ARDUINOJSON)
+            JsonDocument doc;
+            if(deserializeJson(doc, p.json.data(), p.json.size())) { bad += NUM_RAW_INPUTS; continue; }
+            time.assign(doc["Time"] | "");
+            for(int k=1; k<5; k++) raw[KEY_IDX[k]] = doc[KEYS[k]];
+#else
+            static Json::CharReaderBuilder builder;
+            static Json::CharReader* reader = builder.newCharReader();
+            Json::Value doc;
+            if(!reader->parse(p.json.data(), p.json.data() + p.json.size(), &doc, nullptr)) {
+                bad += NUM_RAW_INPUTS;
+                continue;
+            }
+            time = doc["Time"].asString();
+            for(int k=1; k<5; k++) raw[KEY_IDX[k]] = doc[KEYS[k]].asFloat();
+#endif
+            for(int i=0; i<NUM_RAW_INPUTS; i++) { sink += raw[i]; bad += !same(raw[i], p.expect[i]); }
+        }
+        double ns = (double)(replay_now_ns() - t0) / in.size();
+        r.allocs = (double)(malloc_calls - a0) / in.size();
+        r.ns = std::min(r.ns, ns);
+        r.mismatched = bad;
+        if(sink == 1234.5f) printf(" ");
+    }
+    return r;
+}
+#endif
+
+// The commands and the edge cases the schema allows.
+static int self_check() {
+    struct Case { const char* json; bool ok, reset, reboot, stats; float t; };
+    const Case cases[] = {
+        { "{\"reset\": true}", true, true, false, false, NAN },
+        { "{\"reboot\": true}", true, false, true, false, NAN },
+        { "{\"stats\":true}", true, false, false, true, NAN },
+        { "{\"reset\": false, \"Temperature\": -1.5e1}", true, false, false, false, -15.0f },
+        { "{\"Temperature\": NaN, \"x\": {\"a\": [1, \"}\"]}}", true, false, false, false, NAN },
+        { "{\"Temperature\": null}", true, false, false, false, NAN },
+        { "{\"Temperature\": 0.000123456789012345678901}", true, false, false, false, 0.000123456789012345678901f },
+        { "{\"Temperature\": 36.5", false, false, false, false, NAN },
+        { "[1, 2]", false, false, false, false, NAN },
+    };
+    int failed = 0;
+    for(const Case& c : cases) {
+        SensorJson j;
+        bool ok = sensor_json_parse(c.json, strlen(c.json), j);
+        bool pass = ok == c.ok && (!ok || (j.reset == c.reset && j.reboot == c.reboot && j.stats == c.stats &&
+                    (isnan(c.t) ? isnan(j.raw[IDX_TEMPERATURE]) : j.raw[IDX_TEMPERATURE] == c.t)));
+        if(!pass) { printf("  self-check failed: %s\n", c.json); failed++; }
+    }
+    // {"log_from": a, "log_to": b}: b the latest when left out
+    struct LogCase { const char* json; bool log; uint32_t from, to; };
+    const LogCase log_cases[] = {
+        { "{\"log_from\": 0}", true, 0, 0xFFFFFFFFu },
+        { "{\"log_from\": 4000000000, \"log_to\": 4000000099}", true, 4000000000u, 4000000099u },
+        { "{\"log_to\": 7}", false, 0, 7 },
+        { "{\"Temperature\": 1}", false, 0, 0xFFFFFFFFu },
+    };
+    for(const LogCase& c : log_cases) {
+        SensorJson j;
+        bool ok = sensor_json_parse(c.json, strlen(c.json), j);
+        if(!ok || j.log != c.log || j.log_from != c.from || j.log_to != c.to) {
+            printf("  self-check failed: %s\n", c.json);
+            failed++;
+        }
+    }
+    // {"report_k": k, "report_n": n, "report_changes": b, "report_heartbeat_ms": ms}, any of them
+    struct ReportCase { const char* json; bool report; uint32_t k, n, hb; int changes; };
+    const ReportCase report_cases[] = {
+        { "{\"report_k\": 3, \"report_n\": 5}", true, 3, 5, 0xFFFFFFFFu, -1 },
+        { "{\"report_changes\": false}", true, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0 },
+        { "{\"report_changes\": true, \"report_heartbeat_ms\": 60000}", true, 0xFFFFFFFFu, 0xFFFFFFFFu, 60000, 1 },
+        { "{\"report_k\": \"3\"}", false, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, -1 },
+    };
+    for(const ReportCase& c : report_cases) {
+        SensorJson j;
+        bool ok = sensor_json_parse(c.json, strlen(c.json), j);
+        if(!ok || j.report != c.report || j.report_k != c.k || j.report_n != c.n || j.report_heartbeat_ms != c.hb ||
+           j.report_changes != c.changes) {
+            printf("  self-check failed: %s\n", c.json);
+            failed++;
+        }
+    }
+    return failed;
+}
+
+int main(int argc, char** argv) {
+    const char* path = (argc > 1) ? argv[1] : "dataset/Test-set_1.csv";
+    if(self_check()) return 1;
+    std::vector<Payload> payloads;
+    if(!load_payloads(path, payloads) || payloads.empty()) { fprintf(stderr, "cannot read %s\n", path); return 1; }
+    size_t bytes = 0;
+    for(const Payload& p : payloads) bytes += p.json.size();
+    printf("dataset: %s (%zu payloads, %.0f bytes each)\n", path, payloads.size(), (double)bytes / payloads.size());
+    printf("  %-12s %9s %10s %12s\n", "parser", "ns/msg", "mallocs", "!= strtof");
+    Result fast = run_fast(payloads);
+    printf("  %-12s %9.0f %10.2f %12d\n", "sensor_json", fast.ns, fast.allocs, fast.mismatched);
+#if defined(BENCH_ARDUINOJSON) || defined(BENCH_JSONCPP)
+    Result dom = run_dom(payloads);
+#if defined(BENCH_ARDUINOJSON)
+    const char* name = "ArduinoJson";
+#else
+    const char* name = "jsoncpp";
+#endif
+    printf("  %-12s %9.0f %10.2f %12d\n", name, dom.ns, dom.allocs, dom.mismatched);
+#if defined(BENCH_ARDUINOJSON)
+    printf("  speed-up %.1fx\n", dom.ns / fast.ns);
+#endif
+#endif
+    return 0;
+}
@@ -0,0 +1,168 @@
+// Fixed-point LR / SVM kernels (linear_q.h, LINEAR_Q = 16 / 8) against the
+// float predict_* path. For each dataset the features are extracted once, then
+// every model is scored by the float, int16 and int8 kernels. The bench reports
+// label agreement with the float path, accuracy when the CSV has a Label
+// column, the largest score difference, and cycles / ns per call.
+//
+// Host cycles come from an x86 core with an FPU, where float is the cheap
+// path. On the ESP32-C3 every float operation of predict_lr / predict_svm is a
+// soft-float library call, while the fixed-point feature loop is plain
+// integer code, so the bench also prints the float operation count per call.
+//
+// Build from the repo root, one binary per folder (same flags as
+// host/quantise_linear.cpp):
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_C22 -DHOST_MODEL_LR  -I"esp32_original/src 22 lr"  host/bench_linear_q.cpp -o /tmp/lq_22_lr
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_RFE -DHOST_MODEL_SVM -I"esp32_original/src new svm" host/bench_linear_q.cpp -o /tmp/lq_new_svm
+// Run:
+//   /tmp/lq_22_lr [dataset.csv ...]
+#include "replay.h"
+#include <algorithm>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#if defined(HOST_VARIANT_RFE)
+#include "rfe_settings.h"
+#include "infer.h"
+#include "rfe_features.h"
+#elif defined(HOST_VARIANT_C22)
+#include "catch22_settings.h"
+#include "infer.h"
+#include "catch22_features.h"
+#elif defined(HOST_VARIANT_HJ)
+#include "hjorth_settings.h"
+#include "infer.h"
+#include "hjorth_features.h"
+#elif defined(HOST_VARIANT_TS)
+#include "tsassure_settings.h"
+#include "infer.h"
+#include "tsassure_features.h"
+#else
+#error "define one of HOST_VARIANT_RFE / _C22 / _HJ / _TS"
+#endif
+
+static uint64_t now_cycles() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return replay_now_ns();
+#endif
+}
+
+typedef int (*PredictFn)(const float*, float*);
+
+struct Model {
+    const char* name;
+    int n_features;
+    PredictFn fn[3];   // float, int16, int8
+};
+
+#if defined(HOST_VARIANT_RFE) && defined(HOST_MODEL_LR)
+static const Model models[] = {
+    { "LR_COLD", N_FEATURES_COLD, { predict_cold, predict_cold_q16, predict_cold_q8 } },
+    { "LR_WARM", N_FEATURES_WARM, { predict_warm, predict_warm_q16, predict_warm_q8 } },
+};
+#elif defined(HOST_VARIANT_RFE) && defined(HOST_MODEL_SVM)
+static const Model models[] = {
+    { "SVM_COLD", N_FEATURES_COLD, { predict_cold, predict_cold_q16, predict_cold_q8 } },
+    { "SVM_WARM", N_FEATURES_WARM, { predict_warm, predict_warm_q16, predict_warm_q8 } },
+};
+#elif defined(HOST_MODEL_LR)
+static const Model models[] = { { "LR", LR_N_FEATURES, { predict_lr, predict_lr_q16, predict_lr_q8 } } };
+#elif defined(HOST_MODEL_SVM)
+static const Model models[] = { { "SVM", SVM_N_FEATURES, { predict_svm, predict_svm_q16, predict_svm_q8 } } };
+#else
+#error "define HOST_MODEL_LR or HOST_MODEL_SVM"
+#endif
+static const int n_models = sizeof(models) / sizeof(models[0]);
+static const char* kernel_names[3] = { "float", "int16", "int8" };
+
+// Feature vectors as main.cpp would score them; model k of the RFE pair gets
+// the rows of its own phase. Extractor state carries over from one dataset to
+// the next, as on a device that is not reset between runs.
+struct Sample { std::vector<float> f; int label; };
+
+static void extract(const std::vector<ReplayRow>& rows, std::vector<Sample> out[2]) {
+    for(size_t i=0; i<rows.size(); i++) {
+        float raw[NUM_RAW_INPUTS];
+        for(int k=0; k<NUM_RAW_INPUTS; k++) raw[k] = rows[i].raw[k];
+        if(isnan(raw[0])) continue;
+#if defined(HOST_VARIANT_RFE)
+        update_state(raw, 1 + (uint32_t)(i / 4));
+        bool warm = sample_count >= WARMUP_PERIOD;
+        Sample s { std::vector<float>(warm ? N_FEATURES_WARM : N_FEATURES_COLD), rows[i].label };
+        extract_features_generic(raw, warm ? FEATURE_SPECS_WARM : FEATURE_SPECS_COLD, (int)s.f.size(), s.f.data());
+        out[warm ? 1 : 0].push_back(s);
+#else
+        Sample s { std::vector<float>(models[0].n_features), rows[i].label };
+#if defined(HOST_VARIANT_C22)
+        extract_catch22_features(raw, s.f.data());
+#elif defined(HOST_VARIANT_HJ)
+        extract_hjorth_features(raw, s.f.data());
+#else
+        extract_tsassure_features(raw, s.f.data());
+#endif
+        out[0].push_back(s);
+#endif
+    }
+}
+
+// Best-of-five cycles and ns per call over the whole sample set.
+static void time_kernel(PredictFn fn, const std::vector<Sample>& samples, double& cycles, double& ns) {
+    const int reps = 200;
+    cycles = ns = 1e30;
+    volatile int sink = 0;
+    for(int pass=0; pass<5; pass++) {
+        uint64_t c0 = now_cycles(), t0 = replay_now_ns();
+        for(int r=0; r<reps; r++)
+            for(const Sample& s : samples) { float score; sink = sink + fn(s.f.data(), &score); }
+        uint64_t c1 = now_cycles(), t1 = replay_now_ns();
+        double calls = (double)reps * samples.size();
+        cycles = std::min(cycles, (c1 - c0) / calls);
+        ns = std::min(ns, (t1 - t0) / calls);
+    }
+}
+
+static void report(const Model& m, const std::vector<Sample>& samples) {
+    if(samples.empty()) return;
+    printf("%s: %zu samples, %d features\n", m.name, samples.size(), m.n_features);
+    // What the C3 runs through soft-float: sub, div, mul and add per input
+    // plus the bias add, against the one conversion for the fixed-point score.
+    printf("  float ops per call without an FPU: float %d + expf, fixed-point 1\n", 4 * m.n_features + 1);
+    double base_cycles = 0;
+    for(int k=0; k<3; k++) {
+        int agree = 0, correct = 0, labelled = 0;
+        float max_diff = 0;
+        for(const Sample& s : samples) {
+            float ref_score, score;
+            int ref = m.fn[0](s.f.data(), &ref_score);
+            int label = m.fn[k](s.f.data(), &score);
+            agree += (label == ref);
+            max_diff = std::max(max_diff, std::fabs(score - ref_score));
+            if(s.label >= 0) { labelled++; correct += (label == s.label); }
+        }
+        double cycles, ns;
+        time_kernel(m.fn[k], samples, cycles, ns);
+        if(k == 0) base_cycles = cycles;
+        printf("  %-5s  agree %4d/%zu", kernel_names[k], agree, samples.size());
+        if(labelled) printf("  accuracy %5.1f%%", 100.0 * correct / labelled);
+        printf("  max |score diff| %.4f  %6.1f cycles  %5.1f ns  (x%.2f)\n",
+               max_diff, cycles, ns, base_cycles / cycles);
+    }
+}
+
+int main(int argc, char** argv) {
+    std::vector<const char*> paths;
+    for(int i=1; i<argc; i++) paths.push_back(argv[i]);
+    if(paths.empty()) paths.push_back("dataset/Test-set_1.csv");
+
+    for(const char* path : paths) {
+        std::vector<ReplayRow> rows;
+        if(!replay_load(path, rows)) { fprintf(stderr, "cannot read %s\n", path); return 1; }
+        std::vector<Sample> samples[2];
+        extract(rows, samples);
+        printf("dataset: %s (%zu rows)\n", path, rows.size());
+        for(int k=0; k<n_models; k++) report(models[k], samples[k]);
+    }
+    return 0;
+}
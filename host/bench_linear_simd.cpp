@@ -0,0 +1,95 @@
+// Vectorised linear scoring (linear_simd.h) against the predict_*_generic
+// loop, for the 94-feature warm LR / SVM of the dual RFE variant. The warm
+// feature vectors of the dataset are extracted once into a row-major matrix.
+// Each kernel then scores every row: the current loop, the 4-accumulator
+// scalar kernel, SSE2, AVX2 + FMA when the build has it, and the 4-row
+// batched kernel. The bench reports ns per row, label mismatches against the
+// current loop and the largest score difference.
+//
+// Build from the repo root (add -mavx2 -mfma for the AVX2 kernels):
+//   g++ -O2 -std=c++17 -DHOST_MODEL_LR  -I"esp32_original/src new lr"  host/bench_linear_simd.cpp -o /tmp/simd_lr
+//   g++ -O2 -std=c++17 -DHOST_MODEL_SVM -I"esp32_original/src new svm" -mavx2 -mfma host/bench_linear_simd.cpp -o /tmp/simd_svm
+// Run:
+//   /tmp/simd_lr [dataset.csv]
+#include "replay.h"
+#include <algorithm>
+#include "rfe_settings.h"
+#include "infer.h"
+#include "rfe_features.h"
+
+#if defined(HOST_MODEL_LR)
+static float to_score(float d) { return sigmoid(d); }
+#elif defined(HOST_MODEL_SVM)
+static float to_score(float d) { return 1.0f / (1.0f + expf(SVM_WARM_PROB_A * d + SVM_WARM_PROB_B)); }
+#else
+#error "define HOST_MODEL_LR or HOST_MODEL_SVM"
+#endif
+
+typedef float (*DotFn)(const LinearSimd&, const float*);
+
+struct Result { double ns; int mismatch; float max_diff; };
+
+// Best of five passes over all rows; fn scores rows [0, n) into score[].
+template<typename F>
+static Result run(F fn, int n, const std::vector<float>& ref, std::vector<float>& score) {
+    const int reps = 200;
+    double best = 1e30;
+    for(int pass=0; pass<5; pass++) {
+        uint64_t t0 = replay_now_ns();
+        for(int r=0; r<reps; r++) fn(score.data());
+        best = std::min(best, (double)(replay_now_ns() - t0) / reps / n);
+    }
+    Result res { best, 0, 0.0f };
+    for(int i=0; i<n; i++) {
+        res.mismatch += ((score[i] >= 0.5f) != (ref[i] >= 0.5f));
+        res.max_diff = std::max(res.max_diff, std::fabs(score[i] - ref[i]));
+    }
+    return res;
+}
+
+static void print(const char* name, const Result& r, double base_ns) {
+    printf("  %-24s %6.1f ns/row  (x%.2f)  label mismatches %d  max |score diff| %.2e\n",
+           name, r.ns, base_ns / r.ns, r.mismatch, r.max_diff);
+}
+
+int main(int argc, char** argv) {
+    const char* data_path = (argc > 1) ? argv[1] : "dataset/Test-set_1.csv";
+    std::vector<ReplayRow> rows;
+    if(!replay_load(data_path, rows)) { fprintf(stderr, "cannot read %s\n", data_path); return 1; }
+
+    const int nf = N_FEATURES_WARM;
+    std::vector<float> x;
+    for(size_t i=0; i<rows.size(); i++) {
+        float raw[NUM_RAW_INPUTS];
+        for(int k=0; k<NUM_RAW_INPUTS; k++) raw[k] = rows[i].raw[k];
+        if(isnan(raw[0])) continue;
+        update_state(raw, 1 + (uint32_t)(i / 4));
+        if(sample_count < WARMUP_PERIOD) continue;
+        size_t at = x.size();
+        x.resize(at + nf);
+        extract_features_generic(raw, FEATURE_SPECS_WARM, nf, &x[at]);
+    }
+    const int n = (int)(x.size() / nf);
+    const LinearSimd& m = warm_simd();
+
+    std::vector<float> ref(n), score(n);
+    for(int i=0; i<n; i++) predict_warm(&x[(size_t)i * nf], &ref[i]);
+
+    auto single = [&](DotFn dot) {
+        return [&, dot](float* out) { for(int i=0; i<n; i++) out[i] = to_score(dot(m, &x[(size_t)i * nf])); };
+    };
+    printf("dataset: %s, %d warm rows, %d features\n", data_path, n, nf);
+    Result base = run([&](float* out) { for(int i=0; i<n; i++) predict_warm(&x[(size_t)i * nf], &out[i]); },
+                      n, ref, score);
+    print("predict_warm (current)", base, base.ns);
+    print("scalar, 4 accumulators", run(single(linear_simd_dot_scalar), n, ref, score), base.ns);
+#if defined(__SSE2__)
+    print("SSE2", run(single(linear_simd_dot_sse), n, ref, score), base.ns);
+#endif
+#if defined(__AVX2__) && defined(__FMA__)
+    print("AVX2 + FMA", run(single(linear_simd_dot_avx2), n, ref, score), base.ns);
+#endif
+    print("batch, 4 rows per block", run([&](float* out) { predict_warm_simd_batch(x.data(), n, nf, nullptr, out); },
+                                         n, ref, score), base.ns);
+    return 0;
+}
@@ -0,0 +1,317 @@
+// Connection state machine and outbox (link.h, outbox.h) against a broker
+// stand-in that is killed and restarted mid-stream:
+//   1. the backoff: when link_poll makes its connect attempts while the
+//      broker stays away, on a simulated clock;
+//   2. an outage: a local source hands the device a sample every PERIOD_MS
+//      through a receive buffer of RX_SAMPLES (a UART's FIFO, say), and the
+//      device publishes one row per sample to the stand-in over TCP. The
+//      stand-in is a child process that accepts one connection at a time and
+//      appends every message it reads to a file; it is killed with SIGKILL
+//      at KILL_MS and started again OUTAGE_MS later. Two devices run it:
+//        blocking  the old loop(): while(!connected) { connect, else sleep
+//                  2000 ms }, then publish, with nothing kept on failure;
+//        link      link_poll / publish_row / flush_outbox as in main.cpp.
+//      Reported, per outage length: the samples lost at the source (the
+//      buffer overflowed while loop() was away), dropped by the outbox (it
+//      overflowed), lost in flight (published into the socket as the broker
+//      died: QoS 0 has no acknowledgement), the rows the broker got, whether
+//      they came in order without duplicates, the longest loop() pass, and
+//      how long after the broker came back the device was connected.
+// A row carries its sample's sequence number, so the broker's file tells
+// which arrived.
+//
+// Build from the repo root:
+//   g++ -O2 -std=c++17 -pthread -I"esp32_original/src 22 lr" host/bench_link.cpp -o /tmp/link
+// Run:
+//   /tmp/link [dataset.csv]
+#include "replay.h"
+#include "catch22_settings.h"     // the IDX_* detection_row.h uses
+#include "link.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <signal.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+
+#define PERIOD_MS 20
+#define RX_SAMPLES 16
+#define KILL_MS 1000
+#define RUN_MS 7000         // samples are generated for this long
+#define DRAIN_MS 10000      // then the device gets this long to empty the outbox
+
+static uint64_t t_origin;
+
+static unsigned long now_ms() {
+    return (unsigned long)((replay_now_ns() - t_origin) / 1000000);
+}
+
+// ---- the broker stand-in ----
+
+static int broker_port;
+static char broker_log[64];
+
+static bool read_all(int fd, void* p, size_t n) {
+    char* c = (char*)p;
+    while(n > 0) {
+        ssize_t r = read(fd, c, n);
+        if(r <= 0) return false;
+        c += r; n -= (size_t)r;
+    }
+    return true;
+}
+
+// Child process: [u32 length][payload] messages in, one line each (a bulk
+// message stays several lines) appended to broker_log.
+static void broker_main() {
+    int log = open(broker_log, O_WRONLY | O_CREAT | O_APPEND, 0644);
+    int s = socket(AF_INET, SOCK_STREAM, 0);
+    int one = 1;
+    setsockopt(s, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    sockaddr_in a = {};
+    a.sin_family = AF_INET;
+    a.sin_port = htons(broker_port);
+    a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if(bind(s, (sockaddr*)&a, sizeof(a)) != 0 || listen(s, 1) != 0) _exit(1);
+    static char msg[OUTBOX_MQTT_BUFFER + 1];
+    while(true) {
+        int c = accept(s, nullptr, nullptr);
+        if(c < 0) continue;
+        uint32_t n;
+        while(read_all(c, &n, sizeof(n)) && n <= OUTBOX_MQTT_BUFFER && read_all(c, msg, n)) {
+            msg[n] = '\n';
+            if(write(log, msg, n + 1) != (ssize_t)(n + 1)) _exit(1);
+        }
+        close(c);
+    }
+}
+
+static pid_t broker_start() {
+    pid_t pid = fork();
+    if(pid == 0) broker_main();
+    usleep(20000);      // listening by then
+    return pid;
+}
+
+static void broker_kill(pid_t pid) {
+    kill(pid, SIGKILL);
+    waitpid(pid, nullptr, 0);
+}
+
+// ---- the device's client ----
+
+struct Client {
+    int fd = -1;
+};
+
+static void client_close(Client& c) {
+    if(c.fd >= 0) close(c.fd);
+    c.fd = -1;
+}
+
+// connected(): the socket is open and the peer has not closed it.
+static bool client_up(Client& c) {
+    if(c.fd < 0) return false;
+    char b;
+    ssize_t r = recv(c.fd, &b, 1, MSG_PEEK | MSG_DONTWAIT);
+    if(r == 0 || (r < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) client_close(c);
+    return c.fd >= 0;
+}
+
+static bool client_connect(Client& c) {
+    client_close(c);
+    c.fd = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in a = {};
+    a.sin_family = AF_INET;
+    a.sin_port = htons(broker_port);
+    a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if(connect(c.fd, (sockaddr*)&a, sizeof(a)) != 0) { client_close(c); return false; }
+    return true;
+}
+
+// publish(): false once the socket has failed.
+static bool client_publish(Client& c, const char* msg, size_t n) {
+    if(c.fd < 0) return false;
+    uint8_t frame[4 + OUTBOX_MQTT_BUFFER];
+    uint32_t len = (uint32_t)n;
+    memcpy(frame, &len, 4);
+    memcpy(frame + 4, msg, n);
+    if(send(c.fd, frame, 4 + n, MSG_NOSIGNAL) != (ssize_t)(4 + n)) { client_close(c); return false; }
+    return true;
+}
+
+// ---- the device ----
+
+static Client client;
+static std::atomic<unsigned long> broker_back_ms;     // when the broker came back
+static unsigned long connected_ms;                      // first connect after that
+
+static bool ops_wifi_up(void*) { return true; }
+static void ops_wifi_begin(void*) {}
+static bool ops_mqtt_up(void*) { return client_up(client); }
+static bool ops_mqtt_connect(void*) {
+    if(!client_connect(client)) return false;
+    if(broker_back_ms && !connected_ms) connected_ms = now_ms();
+    return client_publish(client, "{\"status\": \"READY\"}", 19);
+}
+
+static void publish_row(const char* row) {
+    if(link_up(net_link) && outbox_depth(outbox) == 0 && client_publish(client, row, strlen(row))) return;
+    outbox_put(outbox, row, strlen(row));
+}
+
+static void flush_outbox() {
+    int rows;
+    size_t n = outbox_pack(outbox, &rows);
+    if(rows > 0 && client_publish(client, outbox.msg, n)) outbox_pop(outbox, rows);
+}
+
+struct Result {
+    long generated = 0, lost_source = 0, processed = 0;
+    long dropped_outbox = 0, at_broker = 0, duplicates = 0, out_of_order = 0, lost_in_flight = 0;
+    unsigned long longest_pass = 0, reconnect = 0;
+};
+
+// The samples generated by now, one every PERIOD_MS for RUN_MS.
+static long generated(unsigned long now) {
+    return std::min<long>(now / PERIOD_MS, RUN_MS / PERIOD_MS);
+}
+
+static void make_row(const std::vector<ReplayRow>& rows, long seq, char* buf, size_t n) {
+    const ReplayRow& r = rows[seq % rows.size()];
+    snprintf(buf, n, "%ld,%s,%.2f,%.2f,%.2f,%.2f,0,0.031,0.004,0.0412", seq, r.time.c_str(), r.raw[0], r.raw[1],
+             r.raw[2], r.raw[3]);
+}
+
+static Result run(const std::vector<ReplayRow>& rows, bool blocking, unsigned long outage_ms) {
+    snprintf(broker_log, sizeof(broker_log), "/tmp/bench_link_%d.log", (int)getpid());
+    unlink(broker_log);
+    broker_back_ms = 0;
+    connected_ms = 0;
+    outbox = Outbox();
+    client = Client();
+    t_origin = replay_now_ns();
+    pid_t broker = broker_start();
+    std::atomic<pid_t> broker_pid(broker);
+    std::thread control([&] {
+        usleep(KILL_MS * 1000);
+        broker_kill(broker_pid);
+        usleep(outage_ms * 1000);
+        broker_pid = broker_start();
+        broker_back_ms = now_ms();
+    });
+
+    Result res;
+    long next = 0;          // the first sample loop() has not seen
+    link_begin(net_link, { ops_wifi_up, ops_wifi_begin, ops_mqtt_up, ops_mqtt_connect, nullptr }, now_ms());
+    unsigned long last = now_ms();
+    while(true) {
+        unsigned long t = now_ms();
+        res.longest_pass = std::max(res.longest_pass, t - last);
+        last = t;
+        if(t > RUN_MS + DRAIN_MS) break;
+        if(t > RUN_MS && next == generated(t) && outbox_depth(outbox) == 0) break;
+
+        if(blocking) {
+            // loop(): if (!client.connected()) mqttConnect();
+            while(!client_up(client)) {
+                if(client_connect(client)) {
+                    if(broker_back_ms && !connected_ms) connected_ms = now_ms();
+                    client_publish(client, "{\"status\": \"READY\"}", 19);
+                }
+                else usleep(2000 * 1000);
+            }
+        }
+        else {
+            link_poll(net_link, now_ms());
+        }
+
+        // The FIFO keeps the oldest RX_SAMPLES of what arrived while loop()
+        // was away; the rest is lost.
+        long end = generated(now_ms());
+        for(long s=next; s<std::min(end, next + RX_SAMPLES); s++) {
+            char row[DETECTION_ROW_MAX];
+            make_row(rows, s, row, sizeof(row));
+            res.processed++;
+            if(blocking) client_publish(client, row, strlen(row));
+            else publish_row(row);
+        }
+        next = end;
+        if(!blocking && link_up(net_link) && outbox_depth(outbox) > 0) flush_outbox();
+        usleep(1000);
+    }
+    control.join();
+    usleep(50000);
+    broker_kill(broker_pid);
+
+    res.generated = next;
+    res.lost_source = next - res.processed;
+    res.dropped_outbox = outbox.dropped;
+    res.reconnect = connected_ms ? connected_ms - broker_back_ms : 0;
+    std::vector<long> seen;
+    FILE* f = fopen(broker_log, "r");
+    char line[512];
+    while(f && fgets(line, sizeof(line), f)) {
+        if(line[0] == '{') continue;
+        seen.push_back(atol(line));
+    }
+    if(f) fclose(f);
+    unlink(broker_log);
+    for(size_t i=1; i<seen.size(); i++) {
+        if(seen[i] == seen[i - 1]) res.duplicates++;
+        else if(seen[i] < seen[i - 1]) res.out_of_order++;
+    }
+    std::sort(seen.begin(), seen.end());
+    res.at_broker = std::unique(seen.begin(), seen.end()) - seen.begin();
+    res.lost_in_flight = res.processed - res.dropped_outbox - (long)outbox_depth(outbox) - res.at_broker;
+    return res;
+}
+
+int main(int argc, char** argv) {
+    const char* path = (argc > 1) ? argv[1] : "dataset/Test-set_1.csv";
+    std::vector<ReplayRow> rows;
+    if(!replay_load(path, rows) || rows.empty()) { fprintf(stderr, "cannot read %s\n", path); return 1; }
+    broker_port = 20000 + (int)(getpid() % 20000);
+
+    // 1. the backoff
+    {
+        unsigned long sim = 0;
+        int attempts = 0;
+        static unsigned long at[16];
+        auto fail = [](void*) { return false; };
+        auto yes = [](void*) { return true; };
+        auto none = [](void*) {};
+        link_begin(net_link, { yes, none, fail, fail, nullptr }, 0);
+        for(sim = 0; sim <= 120000 && attempts < 16; sim += 10) {
+            uint32_t before = net_link.attempts;
+            link_poll(net_link, sim);
+            if(net_link.attempts != before) at[attempts++] = sim;
+        }
+        printf("connect attempts with the broker away (ms): ");
+        for(int i=0; i<attempts; i++) printf("%lu ", at[i]);
+        printf("\n");
+    }
+
+    // 2. outages
+    printf("a sample every %d ms, receive buffer %d samples, outbox %d rows, broker killed at %d ms\n", PERIOD_MS,
+           RX_SAMPLES, OUTBOX_ROWS, KILL_MS);
+    printf("  %-9s %7s %9s %11s %13s %15s %14s %10s %9s %12s %12s\n", "device", "outage", "samples", "lost src",
+           "outbox drop", "lost in flight", "at broker", "in order", "no dups", "longest pass", "reconnect");
+    int failed = 0;
+    const unsigned long outages[] = { 300, 3000 };
+    for(unsigned long o : outages) {
+        for(int blocking=1; blocking>=0; blocking--) {
+            Result r = run(rows, blocking, o);
+            printf("  %-9s %5lu ms %9ld %11ld %13ld %15ld %14ld %10s %9s %9lu ms %9lu ms\n",
+                   blocking ? "blocking" : "link", o, r.generated, r.lost_source, r.dropped_outbox,
+                   r.lost_in_flight, r.at_broker, r.out_of_order ? "NO" : "yes", r.duplicates ? "NO" : "yes",
+                   r.longest_pass, r.reconnect);
+            if(!blocking) failed += r.out_of_order || r.duplicates || r.lost_source || r.lost_in_flight > 1;
+        }
+    }
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,174 @@
+// Multi-model builds (esp32_original/src * multi): one extraction and one
+// shared scaling pass feed LR, SVM and RF. For each dataset the bench reports:
+//   - which heads share the scaling table (multi_init);
+//   - label and score differences between the shared-z path and each head
+//     scaling the raw features itself, which is what its single-model build
+//     does;
+//   - ns per sample for extraction, the shared scaling and each head;
+//   - the per-sample total of the combined build against the three
+//     single-model builds, which each extract and scale on their own.
+//
+// Build from the repo root (-DMULTI_MODELS=... to bench a subset):
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_C22 -I"esp32_original/src 22 multi"  host/bench_multi.cpp -o /tmp/multi_22
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_RFE -I"esp32_original/src new multi" host/bench_multi.cpp -o /tmp/multi_new
+// Run:
+//   /tmp/multi_22 [dataset.csv ...]
+#include "replay.h"
+#include <algorithm>
+
+#if defined(HOST_VARIANT_RFE)
+#include "rfe_settings.h"
+#include "infer.h"
+#include "rfe_features.h"
+#elif defined(HOST_VARIANT_C22)
+#include "catch22_settings.h"
+#include "infer.h"
+#include "catch22_features.h"
+#define HOST_N_FEATURES C22_N_FEATURES
+#elif defined(HOST_VARIANT_HJ)
+#include "hjorth_settings.h"
+#include "infer.h"
+#include "hjorth_features.h"
+#define HOST_N_FEATURES HJORTH_N_FEATURES
+#elif defined(HOST_VARIANT_TS)
+#include "tsassure_settings.h"
+#include "infer.h"
+#include "tsassure_features.h"
+#define HOST_N_FEATURES TS_N_FEATURES
+#else
+#error "define one of HOST_VARIANT_RFE / _C22 / _HJ / _TS"
+#endif
+
+#if defined(HOST_VARIANT_RFE)
+static MultiSet* sets[2] = { &multi_cold, &multi_warm };
+static const char* set_names[2] = { "COLD", "WARM" };
+static const int n_sets = 2;
+#else
+static MultiSet* sets[1] = { &multi_models };
+static const char* set_names[1] = { "ALL" };
+static const int n_sets = 1;
+#endif
+static const char* head_names[3] = { "LR", "SVM", "RF" };
+
+static bool has_head(const MultiSet& set, int h) {
+    return (h == 0) ? set.lr != nullptr : (h == 1) ? set.svm != nullptr : set.rf != nullptr;
+}
+
+static int predict_head(const MultiSet& set, int h, bool own_scale, const float* f, const float* z, float* score) {
+    if(h == 0) return multi_predict_linear(*set.lr, own_scale, f, z, score, SCORE_MODE);
+    if(h == 1) return multi_predict_linear(*set.svm, own_scale, f, z, score, SCORE_MODE);
+    return multi_predict_forest(*set.rf, own_scale, f, z, score);
+}
+
+struct Sample { std::vector<float> f; int label; };
+
+// Extracts every row as main.cpp would; out[k] gets the rows of set k and
+// t_extract[k] their ns per row for state update + extraction. One pass: the
+// extractor state cannot be rewound, so the timing is not best-of-five.
+static void extract(const std::vector<ReplayRow>& rows, std::vector<Sample> out[], double t_extract[]) {
+    uint64_t spent[2] = { 0, 0 };
+    for(size_t i=0; i<rows.size(); i++) {
+        float raw[NUM_RAW_INPUTS];
+        for(int k=0; k<NUM_RAW_INPUTS; k++) raw[k] = rows[i].raw[k];
+        if(isnan(raw[0])) continue;
+#if defined(HOST_VARIANT_RFE)
+        uint64_t t0 = replay_now_ns();
+        update_state(raw, 1 + (uint32_t)(i / 4));
+        int k = (sample_count >= WARMUP_PERIOD) ? 1 : 0;
+        Sample s { std::vector<float>(k ? N_FEATURES_WARM : N_FEATURES_COLD), rows[i].label };
+        extract_features_generic(raw, k ? FEATURE_SPECS_WARM : FEATURE_SPECS_COLD, (int)s.f.size(), s.f.data());
+#else
+        const int k = 0;
+        Sample s { std::vector<float>(HOST_N_FEATURES), rows[i].label };
+        uint64_t t0 = replay_now_ns();
+#if defined(HOST_VARIANT_C22)
+        extract_catch22_features(raw, s.f.data());
+#elif defined(HOST_VARIANT_HJ)
+        extract_hjorth_features(raw, s.f.data());
+#else
+        extract_tsassure_features(raw, s.f.data());
+#endif
+#endif
+        spent[k] += replay_now_ns() - t0;
+        out[k].push_back(s);
+    }
+    for(int k=0; k<n_sets; k++) t_extract[k] = out[k].empty() ? 0.0 : (double)spent[k] / out[k].size();
+}
+
+// Best of five passes of 200 reps, ns per sample.
+template<typename F>
+static double time_ns(F fn, size_t n) {
+    const int reps = 200;
+    double best = 1e30;
+    for(int pass=0; pass<5; pass++) {
+        uint64_t t0 = replay_now_ns();
+        for(int r=0; r<reps; r++) fn();
+        best = std::min(best, (double)(replay_now_ns() - t0) / reps / n);
+    }
+    return best;
+}
+
+static void report(const MultiSet& set, const char* name, const std::vector<Sample>& samples, double t_extract) {
+    size_t n = samples.size();
+    if(n == 0) return;
+    std::vector<std::vector<float>> z(n, std::vector<float>(MULTI_MAX_FEATURES));
+    for(size_t i=0; i<n; i++) multi_prepare(set, samples[i].f.data(), z[i].data());
+
+    printf("%s: %zu samples, %d features, extraction %.1f ns\n", name, n, set.shared.n_features, t_extract);
+    volatile float zsink = 0.0f;
+    double t_scale = time_ns([&] {
+        float zz[MULTI_MAX_FEATURES];
+        for(const Sample& s : samples) { multi_prepare(set, s.f.data(), zz); zsink = zsink + zz[s.f.size() - 1]; }
+    }, n);
+    printf("  shared scaling %.1f ns\n", t_scale);
+
+    double combined = t_extract + t_scale, separate = 0.0;
+    volatile int sink = 0;
+    for(int h=0; h<3; h++) {
+        if(!has_head(set, h)) continue;
+        int flips = 0, correct = 0, labelled = 0;
+        float max_diff = 0.0f;
+        for(size_t i=0; i<n; i++) {
+            float s_own, s_shared;
+            int l_own = predict_head(set, h, true, samples[i].f.data(), nullptr, &s_own);
+            int l_shared = predict_head(set, h, set.own_scale[h], samples[i].f.data(), z[i].data(), &s_shared);
+            flips += (l_own != l_shared);
+            if(!std::isnan(s_own)) max_diff = std::max(max_diff, std::fabs(s_own - s_shared));
+            if(samples[i].label >= 0) { labelled++; correct += (l_shared == samples[i].label); }
+        }
+        double t_shared = time_ns([&] {
+            float s;
+            for(size_t i=0; i<n; i++) sink = sink + predict_head(set, h, set.own_scale[h], samples[i].f.data(), z[i].data(), &s);
+        }, n);
+        double t_own = time_ns([&] {
+            float s;
+            for(size_t i=0; i<n; i++) sink = sink + predict_head(set, h, true, samples[i].f.data(), nullptr, &s);
+        }, n);
+        combined += t_shared;
+        separate += t_extract + t_own;
+        printf("  %-3s %s  %6.1f ns on shared z, %6.1f ns scaling itself  label diffs %d  max |score diff| %.2e",
+               head_names[h], set.own_scale[h] ? "own table   " : "shared table", t_shared, t_own, flips, max_diff);
+        if(labelled) printf("  accuracy %5.1f%%", 100.0 * correct / labelled);
+        printf("\n");
+    }
+    printf("  per sample: combined %.1f ns, single-model builds together %.1f ns (x%.2f)\n",
+           combined, separate, separate / combined);
+}
+
+int main(int argc, char** argv) {
+    std::vector<const char*> paths;
+    for(int i=1; i<argc; i++) paths.push_back(argv[i]);
+    if(paths.empty()) paths.push_back("dataset/Test-set_1.csv");
+
+    for(int k=0; k<n_sets; k++) multi_init(*sets[k]);
+    for(const char* path : paths) {
+        std::vector<ReplayRow> rows;
+        if(!replay_load(path, rows)) { fprintf(stderr, "cannot read %s\n", path); return 1; }
+        std::vector<Sample> samples[2];
+        double t_extract[2];
+        extract(rows, samples, t_extract);
+        printf("dataset: %s (%zu rows)\n", path, rows.size());
+        for(int k=0; k<n_sets; k++) report(*sets[k], set_names[k], samples[k], t_extract[k]);
+    }
+    return 0;
+}
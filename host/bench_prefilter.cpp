@@ -0,0 +1,206 @@
+// Rule pre-filter (prefilter.h) in front of an LR build: replays a dataset
+// once without the filter and once per filter config, and reports
+//   - rule hits and the share of readings that skipped extraction + inference;
+//   - accuracy when the CSV has a Label column, and label agreement with the
+//     unfiltered run;
+//   - mean ns per reading for the whole onMqtt work (filter, extraction,
+//     inference), against the unfiltered run.
+// The extractors keep state, so every run is a fork() of a fresh process; the
+// time is the best of five such runs.
+//
+// Build from the repo root:
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_C22 -I"esp32_original/src 22 lr"  host/bench_prefilter.cpp -o /tmp/prefilter_22
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_RFE -I"esp32_original/src new lr" host/bench_prefilter.cpp -o /tmp/prefilter_new
+// Run:
+//   /tmp/prefilter_22 [dataset.csv ...]
+#include "replay.h"
+#include <algorithm>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#if defined(HOST_VARIANT_RFE)
+#include "rfe_settings.h"
+#include "infer.h"
+#include "rfe_features.h"
+#elif defined(HOST_VARIANT_C22)
+#include "catch22_settings.h"
+#include "infer.h"
+#include "catch22_features.h"
+#elif defined(HOST_VARIANT_HJ)
+#include "hjorth_settings.h"
+#include "infer.h"
+#include "hjorth_features.h"
+#elif defined(HOST_VARIANT_TS)
+#include "tsassure_settings.h"
+#include "infer.h"
+#include "tsassure_features.h"
+#else
+#error "define one of HOST_VARIANT_RFE / _C22 / _HJ / _TS"
+#endif
+#include "prefilter.h"
+
+struct Run {
+    const char* name;
+    bool filter;
+    PrefilterConfig cfg;
+};
+
+static PrefilterConfig config(int on_stuck, int stuck_run) {
+    PrefilterConfig c = PREFILTER_DEFAULT;
+    c.on_identical = PREFILTER_REUSE;
+    c.on_stuck = on_stuck;
+    c.stuck_run = stuck_run;
+    return c;
+}
+
+struct RowOut { int label; int skipped; };
+struct RunOut { std::vector<RowOut> rows; double ns; uint32_t hits[4]; uint32_t skipped; };
+
+// One reading through onMqtt's path: filter (when on), then extraction and
+// inference unless the filter decided.
+static int step(const Run& run, float* raw, uint32_t ts, bool* skipped) {
+    float score = 0.0f;
+    *skipped = false;
+    if(run.filter) {
+        int rule;
+        int action = prefilter_check(run.cfg, prefilter_state, raw, &rule);
+        if(action != PREFILTER_PASS) {
+#if defined(HOST_VARIANT_RFE)
+            if(rule != PREFILTER_RULE_RANGE) update_state(raw, ts);
+#elif defined(HOST_VARIANT_C22)
+            if(rule != PREFILTER_RULE_RANGE) push_catch22_sample(raw);
+#elif defined(HOST_VARIANT_HJ)
+            if(rule != PREFILTER_RULE_RANGE) push_hjorth_sample(raw);
+#else
+            if(rule != PREFILTER_RULE_RANGE) push_tsassure_sample(raw);
+#endif
+            *skipped = true;
+            return prefilter_result(prefilter_state, action, 0, &score);
+        }
+    }
+    int label;
+#if defined(HOST_VARIANT_RFE)
+    update_state(raw, ts);
+    static float f[N_FEATURES_WARM];
+    if(sample_count < WARMUP_PERIOD) {
+        extract_features_generic(raw, FEATURE_SPECS_COLD, N_FEATURES_COLD, f);
+        label = predict_cold(f, &score, SCORE_MODE);
+    } else {
+        extract_features_generic(raw, FEATURE_SPECS_WARM, N_FEATURES_WARM, f);
+        label = predict_warm(f, &score, SCORE_MODE);
+    }
+#else
+    (void)ts;
+#if defined(HOST_VARIANT_C22)
+    static float f[C22_N_FEATURES];
+    extract_catch22_features(raw, f);
+#elif defined(HOST_VARIANT_HJ)
+    static float f[HJORTH_N_FEATURES];
+    extract_hjorth_features(raw, f);
+#else
+    static float f[TS_N_FEATURES];
+    extract_tsassure_features(raw, f);
+#endif
+    label = predict_lr(f, &score, SCORE_MODE);
+#endif
+    if(run.filter) prefilter_decided(prefilter_state, 0, label, score);
+    return label;
+}
+
+static void run_child(const Run& run, const std::vector<ReplayRow>& rows, int fd) {
+    RunOut out {};
+    uint64_t total = 0;
+    for(size_t i=0; i<rows.size(); i++) {
+        float raw[NUM_RAW_INPUTS];
+        for(int k=0; k<NUM_RAW_INPUTS; k++) raw[k] = rows[i].raw[k];
+        if(isnan(raw[0])) { out.rows.push_back({ -1, 0 }); continue; }
+        bool skipped;
+        uint64_t t0 = replay_now_ns();
+        int label = step(run, raw, 1 + (uint32_t)(i / 4), &skipped);
+        total += replay_now_ns() - t0;
+        out.rows.push_back({ label, skipped ? 1 : 0 });
+    }
+    out.ns = (double)total / rows.size();
+    write(fd, &out.ns, sizeof(out.ns));
+    for(int r=0; r<4; r++) out.hits[r] = prefilter_state.hits[r].load();
+    out.skipped = prefilter_state.skipped.load();
+    write(fd, out.hits, sizeof(out.hits));
+    write(fd, &out.skipped, sizeof(out.skipped));
+    write(fd, out.rows.data(), sizeof(RowOut) * out.rows.size());
+}
+
+static bool read_all(int fd, void* p, size_t n) {
+    char* c = (char*)p;
+    while(n > 0) {
+        ssize_t r = read(fd, c, n);
+        if(r <= 0) return false;
+        c += r; n -= (size_t)r;
+    }
+    return true;
+}
+
+static bool run_forked(const Run& run, const std::vector<ReplayRow>& rows, RunOut& out) {
+    int fds[2];
+    if(pipe(fds) != 0) return false;
+    pid_t pid = fork();
+    if(pid == 0) {
+        close(fds[0]);
+        run_child(run, rows, fds[1]);
+        _exit(0);
+    }
+    close(fds[1]);
+    out.rows.resize(rows.size());
+    bool ok = read_all(fds[0], &out.ns, sizeof(out.ns)) && read_all(fds[0], out.hits, sizeof(out.hits)) &&
+              read_all(fds[0], &out.skipped, sizeof(out.skipped)) &&
+              read_all(fds[0], out.rows.data(), sizeof(RowOut) * rows.size());
+    close(fds[0]);
+    waitpid(pid, nullptr, 0);
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    std::vector<const char*> paths;
+    for(int i=1; i<argc; i++) paths.push_back(argv[i]);
+    if(paths.empty()) paths.push_back("dataset/Test-set_1.csv");
+
+    const Run runs[] = {
+        { "off",               false, PREFILTER_DEFAULT },
+        { "identical",         true,  config(PREFILTER_PASS, PREFILTER_STUCK_RUN) },
+        { "+stuck 8 reuse",    true,  config(PREFILTER_REUSE, 8) },
+        { "+stuck 4 reuse",    true,  config(PREFILTER_REUSE, 4) },
+        { "+stuck 8 decide",   true,  config(PREFILTER_DECIDE, 8) },
+    };
+    const int n_runs = sizeof(runs) / sizeof(runs[0]);
+
+    for(const char* path : paths) {
+        std::vector<ReplayRow> rows;
+        if(!replay_load(path, rows)) { fprintf(stderr, "cannot read %s\n", path); return 1; }
+        printf("dataset: %s (%zu rows)\n", path, rows.size());
+        printf("  %-16s %6s %6s %6s %8s  %7s  %7s  %8s\n", "filter", "ident", "range", "stuck", "skipped", "acc",
+               "=off", "ns/read");
+        RunOut ref;
+        for(int r=0; r<n_runs; r++) {
+            RunOut out;
+            double best = 1e30;
+            for(int pass=0; pass<5; pass++) {
+                if(!run_forked(runs[r], rows, out)) { fprintf(stderr, "run %s failed\n", runs[r].name); return 1; }
+                best = std::min(best, out.ns);
+            }
+            out.ns = best;
+            if(r == 0) ref = out;
+            int n = 0, correct = 0, labelled = 0, agree = 0;
+            for(size_t i=0; i<rows.size(); i++) {
+                if(out.rows[i].label < 0) continue;
+                n++;
+                agree += (out.rows[i].label == ref.rows[i].label);
+                if(rows[i].label >= 0) { labelled++; correct += (out.rows[i].label == rows[i].label); }
+            }
+            printf("  %-16s %6u %6u %6u %7.2f%%", runs[r].name, out.hits[PREFILTER_RULE_IDENTICAL],
+                   out.hits[PREFILTER_RULE_RANGE], out.hits[PREFILTER_RULE_STUCK], 100.0 * out.skipped / n);
+            if(labelled) printf("  %6.2f%%", 100.0 * correct / labelled);
+            else printf("  %7s", "-");
+            printf("  %6.2f%%  %8.0f\n", 100.0 * agree / n, out.ns);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,326 @@
+// Reporting stage (report.h) behind a single-model build:
+//   1. the dataset replayed through extraction and inference once, each row
+//      written as main.cpp writes it (detection_row.h, the host's timings),
+//      then handed to report_row under each setting below, with a heartbeat
+//      every HB_ROWS rows (a day of the datasets' 30-minute samples) or none.
+//      Reported: the messages and bytes that would go out against publishing
+//      every row, the label transitions published, the rows whose label was
+//      overruled, and how many rows a published transition lags the start of
+//      the run of model labels it follows;
+//   2. the same settings on a synthetic stream closer to a deployed sensor:
+//      long steady runs (RUN_MEAN rows on average) with lone glitches (GLITCH
+//      per row), a heartbeat every SYNTH_HB_ROWS rows, counting the glitches
+//      that got through;
+//   3. the heartbeat's p95 latency, from the histogram, against the exact
+//      p95 of each interval's rows (both streams: the host's timings are a few
+//      us, the synthetic ones 0.5-3.2 ms), and the CPU time of report_row;
+//   4. the longest heartbeat (every counter at its widest, scores of 20
+//      characters) against REPORT_HEARTBEAT_MAX and the outbox slot, and a
+//      heartbeat queued while the link is down, as publish_row does in
+//      main.cpp, then flushed: it must come out whole, valid JSON.
+//
+// Build from the repo root:
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_C22 -I"esp32_original/src 22 lr"  host/bench_report.cpp -o /tmp/report_22
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_HJ  -I"esp32_original/src hj lr"  host/bench_report.cpp -o /tmp/report_hj
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_TS  -I"esp32_original/src ts lr"  host/bench_report.cpp -o /tmp/report_ts
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_RFE -I"esp32_original/src new lr" host/bench_report.cpp -o /tmp/report_new
+// Run:
+//   /tmp/report_22 [dataset.csv]
+#define REPORT 1              // as the firmware is built: the outbox sized for the heartbeat
+#include "replay.h"
+#include <algorithm>
+
+#if defined(HOST_VARIANT_RFE)
+#include "rfe_settings.h"
+#include "infer.h"
+#include "rfe_features.h"
+#elif defined(HOST_VARIANT_C22)
+#include "catch22_settings.h"
+#include "infer.h"
+#include "catch22_features.h"
+#elif defined(HOST_VARIANT_HJ)
+#include "hjorth_settings.h"
+#include "infer.h"
+#include "hjorth_features.h"
+#elif defined(HOST_VARIANT_TS)
+#include "tsassure_settings.h"
+#include "infer.h"
+#include "tsassure_features.h"
+#else
+#error "define one of HOST_VARIANT_RFE / _C22 / _HJ / _TS"
+#endif
+#include "report.h"
+
+#define HB_ROWS 48
+#define PERIOD_MS 1800000UL
+#define SYNTH_ROWS 1000000
+#define RUN_MEAN 2000
+#define GLITCH 0.01
+#define SYNTH_HB_ROWS 2000
+
+struct Row {
+    std::string text;
+    int label;
+};
+
+// One reading through extraction and inference, as process_sample does.
+static int step(float* raw, uint32_t ts, float* score, float* t_feat, float* t_infer) {
+    int label;
+    uint64_t t0 = replay_now_ns();
+#if defined(HOST_VARIANT_RFE)
+    update_state(raw, ts);
+    static float f[N_FEATURES_WARM];
+    bool warm = sample_count >= WARMUP_PERIOD;
+    if(!warm) extract_features_generic(raw, FEATURE_SPECS_COLD, N_FEATURES_COLD, f);
+    else extract_features_generic(raw, FEATURE_SPECS_WARM, N_FEATURES_WARM, f);
+    uint64_t t1 = replay_now_ns();
+    label = warm ? predict_warm(f, score, SCORE_MODE) : predict_cold(f, score, SCORE_MODE);
+#else
+    (void)ts;
+#if defined(HOST_VARIANT_C22)
+    static float f[C22_N_FEATURES];
+    extract_catch22_features(raw, f);
+#elif defined(HOST_VARIANT_HJ)
+    static float f[HJORTH_N_FEATURES];
+    extract_hjorth_features(raw, f);
+#else
+    static float f[TS_N_FEATURES];
+    extract_tsassure_features(raw, f);
+#endif
+    uint64_t t1 = replay_now_ns();
+    label = predict_lr(f, score, SCORE_MODE);
+#endif
+    *t_feat = (t1 - t0) / 1e6f;
+    *t_infer = (replay_now_ns() - t1) / 1e6f;
+    return label;
+}
+
+static std::string make_row(const std::string& time, const float* raw, int label, float t_feat, float t_infer, float score) {
+    DetectionRow& msg = detection_row;
+    row_begin(msg, time.c_str(), time.size());
+    row_raw(msg, raw);
+    row_int(msg, label);
+    row_fixed(msg, t_feat, 3);
+    row_fixed(msg, t_infer, 3);
+    row_score(msg, score, SCORE_MODE != SCORE_MODE_LABEL);
+    return row_end(msg);
+}
+
+struct Setting {
+    uint32_t k, n;
+    bool changes;
+};
+
+static const Setting SETTINGS[] = {
+    { 1, 1, false }, { 3, 5, false }, { 1, 1, true }, { 2, 3, true }, { 3, 5, true }, { 5, 9, true },
+};
+
+struct Out {
+    long messages, bytes, published, transitions, overruled, heartbeats;
+    double lag_sum;
+    long lag_max;
+    long glitches_out;      // synthetic stream: lone glitches published as a transition
+};
+
+// The rows through one setting. glitch[i] marks a lone glitch of the
+// synthetic stream (null for the dataset).
+static Out run(const Setting& s, int hb_rows, const std::vector<Row>& rows, const std::vector<char>* glitch) {
+    Out o {};
+    report_begin(report, 0);
+    report_configure(report, s.k, s.n, s.changes, (uint32_t)(hb_rows * PERIOD_MS), 0);
+    long run_start = 0;
+    int last = -1;
+    for(size_t i=0; i<rows.size(); i++) {
+        unsigned long now = (unsigned long)(i * PERIOD_MS);
+        const Row& r = rows[i];
+        if(r.label != last) {
+            run_start = (long)i;
+            last = r.label;
+        }
+        uint32_t before = report.transitions;
+        uint8_t state = report.state;
+        const char* out = report_row(report, r.text.c_str(), r.text.size());
+        if(out) {
+            o.messages++;
+            o.bytes += (long)strlen(out);
+        }
+        if(report.transitions != before && i > 0 && report.state != state) {
+            long lag = (long)i - run_start;
+            o.lag_sum += lag;
+            o.lag_max = std::max(o.lag_max, lag);
+            if(glitch && (*glitch)[i]) o.glitches_out++;
+        }
+        if(report_due(report, now + PERIOD_MS - 1)) {
+            char hb[256];
+            o.bytes += report_heartbeat_json(report, hb, sizeof(hb), now);
+            o.messages++;
+            o.heartbeats++;
+        }
+    }
+    o.published = report.published;
+    o.transitions = report.transitions;
+    o.overruled = report.flips;
+    return o;
+}
+
+static void print_runs(const std::vector<Row>& rows, int hb_rows, const std::vector<char>* glitch) {
+    Out base = run(SETTINGS[0], 0, rows, glitch);
+    printf("  %-14s %-9s %10s %12s %9s %11s %10s %10s %s\n", "k-of-n", "publish", "messages", "bytes", "vs all",
+           "transitions", "overruled", "lag mean", glitch ? "glitches out" : "lag max");
+    for(const Setting& s : SETTINGS) {
+        for(int hb=0; hb<2; hb++) {
+            if(hb && !s.changes) continue;
+            Out o = run(s, hb ? hb_rows : 0, rows, glitch);
+            char kn[16], pub[16], tail[24];
+            snprintf(kn, sizeof(kn), "%u of %u", s.k, s.n);
+            snprintf(pub, sizeof(pub), "%s%s", s.changes ? "changes" : "all", hb ? "+hb" : "");
+            if(glitch) snprintf(tail, sizeof(tail), "%ld", o.glitches_out);
+            else snprintf(tail, sizeof(tail), "%ld", o.lag_max);
+            printf("  %-14s %-9s %10ld %12ld %8.1fx %11ld %10ld %10.2f %s\n", kn, pub, o.messages, o.bytes,
+                   (double)base.messages / o.messages, o.transitions, o.overruled,
+                   o.transitions > 1 ? o.lag_sum / (o.transitions - 1) : 0.0, tail);
+        }
+    }
+}
+
+// Each interval's p95 latency from the heartbeat against the exact one.
+static void check_p95(const char* what, const std::vector<Row>& rows) {
+    report_begin(report, 0);
+    report_configure(report, 3, 5, 1, HB_ROWS * PERIOD_MS, 0);
+    double worst = 0.0, sum = 0.0;
+    int intervals = 0, below = 0;
+    std::vector<uint32_t> interval;
+    for(size_t i=0; i<rows.size(); i++) {
+        DetLogRecord rec;
+        detlog_row_record(rows[i].text.c_str(), rows[i].text.size(), rec);
+        interval.push_back((uint32_t)rec.feat_us + rec.test_us);
+        report_row(report, rows[i].text.c_str(), rows[i].text.size());
+        if(interval.size() == HB_ROWS) {
+            char hb[256];
+            report_heartbeat_json(report, hb, sizeof(hb), 0);
+            const char* p = strstr(hb, "\"latency_p95_ms\": ");
+            double got = p ? atof(p + 18) * 1000.0 : -1.0;
+            std::sort(interval.begin(), interval.end());
+            double exact = interval[(interval.size() * 95 + 99) / 100 - 1];
+            double err = exact > 0 ? (got - exact) / exact : 0.0;
+            worst = std::max(worst, fabs(err));
+            sum += fabs(err);
+            if(got < exact) below++;
+            intervals++;
+            interval.clear();
+        }
+    }
+    printf("  %-9s %6d intervals: p95 within %.1f%% of the exact one (mean %.1f%%), below it %d times\n", what,
+           intervals, worst * 100, intervals ? sum / intervals * 100 : 0.0, below);
+}
+
+int main(int argc, char** argv) {
+    const char* path = (argc > 1) ? argv[1] : "dataset/Test-set_1.csv";
+    std::vector<ReplayRow> data;
+    if(!replay_load(path, data)) {
+        fprintf(stderr, "cannot read %s\n", path);
+        return 1;
+    }
+
+    // ---- 1 ----
+    std::vector<Row> rows;
+    for(size_t i=0; i<data.size(); i++) {
+        float raw[NUM_RAW_INPUTS];
+        for(int k=0; k<NUM_RAW_INPUTS; k++) raw[k] = data[i].raw[k];
+        if(isnan(raw[0])) continue;
+        float score = 0.0f, t_feat, t_infer;
+        int label = step(raw, 1 + (uint32_t)(i / 4), &score, &t_feat, &t_infer);
+        Row r = { make_row(data[i].time, raw, label, t_feat, t_infer, score), label };
+        rows.push_back(r);
+    }
+    printf("== 1. %s: %zu rows, a heartbeat every %d rows (+hb)\n", path, rows.size(), HB_ROWS);
+    print_runs(rows, HB_ROWS, nullptr);
+
+    // ---- 2 ----
+    std::vector<Row> synth;
+    std::vector<char> glitch;
+    uint32_t x = 2024;
+    auto rnd = [&]() {
+        x = x * 1664525u + 1013904223u;
+        return (x >> 8) / 16777216.0;
+    };
+    int state = 0;
+    for(int i=0; i<SYNTH_ROWS; i++) {
+        if(rnd() < 1.0 / RUN_MEAN) state ^= 1;
+        bool g = rnd() < GLITCH;
+        int label = state ^ (g ? 1 : 0);
+        const ReplayRow& d = data[(size_t)i % data.size()];
+        float raw[NUM_RAW_INPUTS];
+        for(int k=0; k<NUM_RAW_INPUTS; k++) raw[k] = d.raw[k];
+        float t_feat = 0.5f + 2.5f * (float)rnd(), t_infer = 0.01f + 0.2f * (float)rnd();
+        Row r = { make_row(d.time, raw, label, t_feat, t_infer, label ? 0.9f : 0.1f), label };
+        synth.push_back(r);
+        glitch.push_back(g && (i == 0 || synth[(size_t)i - 1].label != label) ? 1 : 0);
+    }
+    printf("== 2. synthetic: %d rows, runs of %d rows on average, glitches %.0f%% of rows, a heartbeat every %d rows\n",
+           SYNTH_ROWS, RUN_MEAN, GLITCH * 100, SYNTH_HB_ROWS);
+    print_runs(synth, SYNTH_HB_ROWS, &glitch);
+
+    // ---- 3 ----
+    printf("== 3. heartbeat p95 and cost\n");
+    check_p95("dataset", rows);
+    check_p95("synthetic", synth);
+    const int REPS = 50;
+    uint64_t t0 = replay_now_ns();
+    for(int r=0; r<REPS; r++) {
+        for(const Row& row : rows) report_row(report, row.text.c_str(), row.text.size());
+    }
+    double ns = (double)(replay_now_ns() - t0) / REPS / rows.size();
+    char hb[256];
+    t0 = replay_now_ns();
+    for(int r=0; r<1000; r++) report_heartbeat_json(report, hb, sizeof(hb), 0);
+    printf("  report_row %.0f ns a row; a heartbeat %.0f ns\n", ns, (double)(replay_now_ns() - t0) / 1000);
+
+    // ---- 4 ----
+    printf("== 4. the heartbeat through the outbox\n");
+    {
+        report_begin(report, 0);
+        report.hb_rows = report.hb_published = report.hb_flips = report.hb_scored = 0xFFFFFFFFu;
+        report.state = 0xFF;
+        report.hb_min = -9.9e13f;
+        report.hb_max = -9.9e13f;
+        report.hb_sum = -9.9e13 * report.hb_scored;
+        report.hb_lat[REPORT_LAT_BUCKETS - 1] = report.hb_rows;
+        char longest[REPORT_HEARTBEAT_MAX + 64];
+        int len = report_heartbeat_json(report, longest, sizeof(longest), 0xFFFFFFFFul);
+        printf("  longest heartbeat %d chars, buffer %d, outbox slot %d: %s\n", len, REPORT_HEARTBEAT_MAX,
+               (int)OUTBOX_SLOT, len < REPORT_HEARTBEAT_MAX && len < (int)OUTBOX_SLOT ? "fits" : "TOO LONG");
+
+        // link down: publish_row parks it behind the rows already waiting
+        outbox = Outbox();
+        report_begin(report, 0);
+        report_configure(report, 3, 5, 1, HB_ROWS * PERIOD_MS, 0);
+        for(int i=0; i<HB_ROWS; i++) {
+            const Row& row = rows[(size_t)i % rows.size()];
+            const char* out = report_row(report, row.text.c_str(), row.text.size());
+            if(out) outbox_put(outbox, out, strlen(out));
+        }
+        char hb[REPORT_HEARTBEAT_MAX];
+        report_heartbeat_json(report, hb, sizeof(hb), 86400000ul);
+        outbox_put(outbox, hb, strlen(hb));
+        outbox_put(outbox, longest, strlen(longest));
+        // link back: flush_outbox, message by message
+        int found = 0;
+        while(outbox_depth(outbox) > 0) {
+            int n;
+            size_t bytes = outbox_pack(outbox, &n);
+            std::string msg(outbox.msg, bytes);
+            for(size_t at=0; at<=msg.size(); ) {
+                size_t end = msg.find('\n', at);
+                if(end == std::string::npos) end = msg.size();
+                std::string line = msg.substr(at, end - at);
+                if(line == hb || line == longest) found++;
+                at = end + 1;
+            }
+            outbox_pop(outbox, n);
+        }
+        printf("  %zu-char heartbeat and the longest, queued behind %lu rows: %d of 2 flushed whole\n", strlen(hb),
+               (unsigned long)outbox.queued - 2, found);
+    }
+    return 0;
+}
@@ -0,0 +1,105 @@
+// In-place reset (reset_*_state in the extractor headers) against a fresh
+// process: {"reset": true} used to reboot the board, it now clears the
+// extractor's history and answers READY.
+//   1. equivalence: the dataset's feature vectors from a fresh process, then
+//      again after a partial replay (each of a few lengths, so the reset
+//      meets a window that is empty, partly and fully filled) and the reset.
+//      Every vector must match the fresh run's bit for bit;
+//   2. what the reset itself costs, best of many calls, against the seconds a
+//      reboot, Wi-Fi association and MQTT reconnect take on the board.
+// The pre-filter, hop and multi-model state main.cpp's reset_state also
+// clears are plain value resets and are not timed here.
+//
+// Build from the repo root:
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_C22 -I"esp32_original/src 22 lr"  host/bench_reset.cpp -o /tmp/reset_22
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_HJ  -I"esp32_original/src hj lr"  host/bench_reset.cpp -o /tmp/reset_hj
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_TS  -I"esp32_original/src ts lr"  host/bench_reset.cpp -o /tmp/reset_ts
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_RFE -I"esp32_original/src new lr" host/bench_reset.cpp -o /tmp/reset_new
+// Run:
+//   /tmp/reset_22 [dataset.csv]
+#include "replay.h"
+#include <algorithm>
+
+#if defined(HOST_VARIANT_RFE)
+#include "rfe_settings.h"
+#include "rfe_features.h"
+#define N_FEATURES N_FEATURES_WARM
+#define reset_features reset_rfe_state
+#elif defined(HOST_VARIANT_C22)
+#include "catch22_settings.h"
+#include "catch22_features.h"
+#define N_FEATURES C22_N_FEATURES
+#define reset_features reset_catch22_state
+#elif defined(HOST_VARIANT_HJ)
+#include "hjorth_settings.h"
+#include "hjorth_features.h"
+#define N_FEATURES HJORTH_N_FEATURES
+#define reset_features reset_hjorth_state
+#elif defined(HOST_VARIANT_TS)
+#include "tsassure_settings.h"
+#include "tsassure_features.h"
+#define N_FEATURES TS_N_FEATURES
+#define reset_features reset_tsassure_state
+#else
+#error "define one of HOST_VARIANT_RFE / _C22 / _HJ / _TS"
+#endif
+
+// One reading's feature vector, as onMqtt extracts it.
+static void features(const ReplayRow& r, uint32_t ts, float* out) {
+    float raw[NUM_RAW_INPUTS];
+    for(int i=0; i<NUM_RAW_INPUTS; i++) raw[i] = r.raw[i];
+#if defined(HOST_VARIANT_RFE)
+    update_state(raw, ts);
+    extract_features_generic(raw, FEATURE_SPECS_WARM, N_FEATURES, out);
+#else
+    (void)ts;
+#if defined(HOST_VARIANT_C22)
+    extract_catch22_features(raw, out);
+#elif defined(HOST_VARIANT_HJ)
+    extract_hjorth_features(raw, out);
+#else
+    extract_tsassure_features(raw, out);
+#endif
+#endif
+}
+
+// The whole dataset; ts as main.cpp's millis() / 1000 would be at 1 s a row.
+static std::vector<float> replay(const std::vector<ReplayRow>& rows, size_t n) {
+    std::vector<float> out(n * N_FEATURES);
+    for(size_t i=0; i<n; i++) features(rows[i], (uint32_t)(i + 1), &out[i * N_FEATURES]);
+    return out;
+}
+
+int main(int argc, char** argv) {
+    const char* path = (argc > 1) ? argv[1] : "dataset/Test-set_1.csv";
+    std::vector<ReplayRow> rows;
+    if(!replay_load(path, rows) || rows.empty()) { fprintf(stderr, "cannot read %s\n", path); return 1; }
+    printf("dataset: %s (%zu rows, %d features)\n", path, rows.size(), N_FEATURES);
+
+    // This process has not extracted anything yet: its state is the boot state.
+    std::vector<float> fresh = replay(rows, rows.size());
+    int failed = 0;
+    const size_t partial[] = { 0, 1, 7, 64, rows.size() / 2, rows.size() };
+    for(size_t k : partial) {
+        replay(rows, std::min(k, rows.size()));
+        reset_features();
+        std::vector<float> again = replay(rows, rows.size());
+        bool same = memcmp(again.data(), fresh.data(), fresh.size() * sizeof(float)) == 0;
+        printf("  reset after %5zu rows: %s\n", k, same ? "identical to a fresh process" : "DIFFERS");
+        failed += !same;
+    }
+
+    double best = 1e30;
+    for(int pass=0; pass<5; pass++) {
+        replay(rows, std::min<size_t>(rows.size(), 256));
+        const int calls = 10000;
+        uint64_t t0 = replay_now_ns();
+        for(int i=0; i<calls; i++) {
+            reset_features();
+            asm volatile("" ::: "memory");    // each call's stores happen
+        }
+        best = std::min(best, (double)(replay_now_ns() - t0) / calls);
+    }
+    printf("  reset: %.0f ns per call\n", best);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,70 @@
+// Tree-major batch scoring (predict_cold_batch / predict_warm_batch) against the
+// per-sample predict_cold / predict_warm loop on the replayed dataset.
+//
+// Build from the repo root:
+//   g++ -O2 -std=c++17 -I"esp32_original/src new rf" host/bench_rf_batch.cpp -o /tmp/rf_batch
+//   (add -march=native to let the compiler vectorise the inner loop)
+// Run:
+//   /tmp/rf_batch [dataset.csv]
+#include "replay.h"
+#include "rfe_settings.h"
+#include "infer.h"
+#include "rfe_features.h"
+
+typedef int (*PredictOne)(const float*, float*);
+typedef void (*PredictBatch)(const float*, int, int*, float*);
+
+static void bench(const char* name, int n_features, const std::vector<float>& feats,
+                  PredictOne one, PredictBatch batch)
+{
+    int n = (int)(feats.size() / n_features);
+    const int reps = 50;
+    std::vector<int> ref_label(n), label(n);
+    std::vector<float> ref_score(n), score(n);
+
+    uint64_t t0 = replay_now_ns();
+    for(int r=0; r<reps; r++)
+        for(int i=0; i<n; i++) ref_label[i] = one(&feats[(size_t)i * n_features], &ref_score[i]);
+    double one_ns = (double)(replay_now_ns() - t0) / reps;
+
+    uint64_t t1 = replay_now_ns();
+    for(int r=0; r<reps; r++) batch(feats.data(), n, label.data(), score.data());
+    double batch_ns = (double)(replay_now_ns() - t1) / reps;
+
+    int mismatch = 0;
+    for(int i=0; i<n; i++) mismatch += (label[i] != ref_label[i] || score[i] != ref_score[i]);
+
+    printf("%s: %d samples, block %d\n", name, n, RF_BATCH_BLOCK);
+    printf("  per-sample loop: %8.0f ns/sample  %10.0f samples/s\n", one_ns / n, 1e9 * n / one_ns);
+    printf("  tree-major batch:%8.0f ns/sample  %10.0f samples/s  (x%.2f)\n",
+           batch_ns / n, 1e9 * n / batch_ns, one_ns / batch_ns);
+    printf("  mismatching label/score: %d\n", mismatch);
+}
+
+int main(int argc, char** argv) {
+    const char* data_path = (argc > 1) ? argv[1] : "dataset/Test-set_1.csv";
+    std::vector<ReplayRow> rows;
+    if(!replay_load(data_path, rows)) { fprintf(stderr, "cannot read %s\n", data_path); return 1; }
+
+    // Backfill view: every row through both feature sets, once warm-up is over
+    // for the warm forest.
+    std::vector<float> cold, warm;
+    for(size_t i=0; i<rows.size(); i++) {
+        float raw[NUM_RAW_INPUTS];
+        for(int k=0; k<NUM_RAW_INPUTS; k++) raw[k] = rows[i].raw[k];
+        if(isnan(raw[0])) continue;
+        update_state(raw, 1 + (uint32_t)(i / 4));
+        float f[N_FEATURES_WARM];
+        extract_features_generic(raw, FEATURE_SPECS_COLD, N_FEATURES_COLD, f);
+        cold.insert(cold.end(), f, f + N_FEATURES_COLD);
+        if(sample_count >= WARMUP_PERIOD) {
+            extract_features_generic(raw, FEATURE_SPECS_WARM, N_FEATURES_WARM, f);
+            warm.insert(warm.end(), f, f + N_FEATURES_WARM);
+        }
+    }
+
+    printf("dataset: %s (%zu rows)\n", data_path, rows.size());
+    bench("RF_COLD", N_FEATURES_COLD, cold, predict_cold, predict_cold_batch);
+    bench("RF_WARM", N_FEATURES_WARM, warm, predict_warm, predict_warm_batch);
+    return 0;
+}
@@ -0,0 +1,207 @@
+// Early-exit forest voting: trees evaluated per sample, label agreement with the
+// full forest and time per prediction, replaying the dataset through the real
+// extractor of one RF variant.
+//
+// Build from the repo root, one binary per variant:
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_RFE -I"esp32_original/src new rf" host/bench_rf_early_exit.cpp -o /tmp/ee_new
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_C22 -I"esp32_original/src 22 rf"  host/bench_rf_early_exit.cpp -o /tmp/ee_22
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_HJ  -I"esp32_original/src hj rf"  host/bench_rf_early_exit.cpp -o /tmp/ee_hj
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_TS  -I"esp32_original/src ts rf"  host/bench_rf_early_exit.cpp -o /tmp/ee_ts
+// Run:
+//   /tmp/ee_new [dataset.csv] [--order train.csv]
+// --order replays the given CSV and prints RF_*TREE_ORDER arrays (trees sorted
+// by how strongly they vote with the forest) for the model header.
+#include "replay.h"
+#include <algorithm>
+
+#if defined(HOST_VARIANT_RFE)
+#include "rfe_settings.h"
+#include "infer.h"
+#include "rfe_features.h"
+#elif defined(HOST_VARIANT_C22)
+#include "catch22_settings.h"
+#include "infer.h"
+#include "catch22_features.h"
+#elif defined(HOST_VARIANT_HJ)
+#include "hjorth_settings.h"
+#include "infer.h"
+#include "hjorth_features.h"
+#elif defined(HOST_VARIANT_TS)
+#include "tsassure_settings.h"
+#include "infer.h"
+#include "tsassure_features.h"
+#else
+#error "define one of HOST_VARIANT_RFE / _C22 / _HJ / _TS"
+#endif
+
+struct Forest {
+    const char* name;
+    int n_trees, n_nodes, n_features;
+    const float* mean; const float* std;
+    const int* roots; const int* feat; const float* thr;
+    const int* left; const int* right; const float* leaf;
+    int (*predict)(const float*, float*);
+    int (*predict_early)(const float*, float*, int*);
+};
+
+#if defined(HOST_VARIANT_RFE)
+static Forest forests[2] = {
+    { "RF_COLD", RF_COLD_N_TREES, RF_COLD_TREE_OFFSETS[RF_COLD_N_TREES], RF_COLD_N_FEATURES,
+      RF_COLD_SCALE_MEAN, RF_COLD_SCALE_STD, RF_COLD_TREE_OFFSETS, RF_COLD_FEATURE, RF_COLD_THRESHOLD,
+      RF_COLD_LEFT, RF_COLD_RIGHT, RF_COLD_PROB1, predict_cold, predict_cold_early },
+    { "RF_WARM", RF_WARM_N_TREES, RF_WARM_TREE_OFFSETS[RF_WARM_N_TREES], RF_WARM_N_FEATURES,
+      RF_WARM_SCALE_MEAN, RF_WARM_SCALE_STD, RF_WARM_TREE_OFFSETS, RF_WARM_FEATURE, RF_WARM_THRESHOLD,
+      RF_WARM_LEFT, RF_WARM_RIGHT, RF_WARM_PROB1, predict_warm, predict_warm_early },
+};
+static const int n_forests = 2;
+#elif defined(HOST_VARIANT_TS)
+static Forest forests[1] = {
+    { "RF", RF_N_TREES, RF_TREE_OFFSETS[RF_N_TREES], RF_N_FEATURES,
+      RF_SCALE_MEAN, RF_SCALE_STD, RF_TREE_OFFSETS, RF_FEATURE, RF_THRESHOLD,
+      RF_LEFT, RF_RIGHT, RF_PROB1, predict_rf, predict_rf_early },
+};
+static const int n_forests = 1;
+#else
+static Forest forests[1] = {
+    { "RF", RF_NUM_TREES, (int)(sizeof(RF_LEFT) / sizeof(RF_LEFT[0])), RF_N_FEATURES,
+      RF_SCALE_MEAN, RF_SCALE_STD, RF_TREE_ROOTS, RF_FEATURE, RF_THRESHOLD,
+      RF_LEFT, RF_RIGHT, RF_VALUE, predict_rf, predict_rf_early },
+};
+static const int n_forests = 1;
+#endif
+
+// Feature vectors of one replay, grouped by the forest that scores them.
+struct Replay {
+    std::vector<std::vector<float>> feats[2];
+};
+
+// every_cold: also score every warm-phase sample with the cold forest (used for
+// --order, where the 14 warm-up samples alone say little about the cold trees).
+static void run_extractor(const std::vector<ReplayRow>& rows, Replay& out, bool every_cold) {
+    for(size_t i=0; i<rows.size(); i++) {
+        float raw[NUM_RAW_INPUTS];
+        for(int k=0; k<NUM_RAW_INPUTS; k++) raw[k] = rows[i].raw[k];
+        if(isnan(raw[0])) continue;
+#if defined(HOST_VARIANT_RFE)
+        // Firmware uses millis()/1000 at a 0.25 s publish interval.
+        update_state(raw, 1 + (uint32_t)(i / 4));
+        if(sample_count < WARMUP_PERIOD || every_cold) {
+            std::vector<float> f(N_FEATURES_COLD);
+            extract_features_generic(raw, FEATURE_SPECS_COLD, N_FEATURES_COLD, f.data());
+            out.feats[0].push_back(f);
+        }
+        if(sample_count >= WARMUP_PERIOD) {
+            std::vector<float> f(N_FEATURES_WARM);
+            extract_features_generic(raw, FEATURE_SPECS_WARM, N_FEATURES_WARM, f.data());
+            out.feats[1].push_back(f);
+        }
+#else
+        (void)every_cold;
+        std::vector<float> f(forests[0].n_features);
+#if defined(HOST_VARIANT_C22)
+        extract_catch22_features(raw, f.data());
+#elif defined(HOST_VARIANT_HJ)
+        extract_hjorth_features(raw, f.data());
+#else
+        extract_tsassure_features(raw, f.data());
+#endif
+        out.feats[0].push_back(f);
+#endif
+    }
+}
+
+static float tree_prob(const Forest& fr, const float* z, int t) {
+    int idx = fr.roots[t];
+    while(fr.left[idx] != -1) idx = (z[fr.feat[idx]] <= fr.thr[idx]) ? fr.left[idx] : fr.right[idx];
+    return fr.leaf[idx];
+}
+
+// Mean signed vote of each tree in the direction of the full-forest label.
+static void print_order(const Forest& fr, const std::vector<std::vector<float>>& feats) {
+    std::vector<double> power(fr.n_trees, 0.0);
+    std::vector<float> z(fr.n_features), p(fr.n_trees);
+    for(const auto& f : feats) {
+        for(int i=0; i<fr.n_features; i++) {
+            float s = fr.std[i];
+            if(s < 1e-9f) s = 1.0f;
+            z[i] = (f[i] - fr.mean[i]) / s;
+        }
+        float sum = 0.0f;
+        for(int t=0; t<fr.n_trees; t++) { p[t] = tree_prob(fr, z.data(), t); sum += p[t]; }
+        float dir = (sum / fr.n_trees >= 0.5f) ? 1.0f : -1.0f;
+        for(int t=0; t<fr.n_trees; t++) power[t] += dir * (p[t] - 0.5f);
+    }
+    std::vector<int> order(fr.n_trees);
+    for(int t=0; t<fr.n_trees; t++) order[t] = t;
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return power[a] > power[b]; });
+    printf("static const int %s_TREE_ORDER[] = { ", fr.name);
+    for(int t=0; t<fr.n_trees; t++) printf("%d%s", order[t], (t + 1 < fr.n_trees) ? ", " : " };\n");
+}
+
+struct Policy { const char* name; RfExitConfig cfg; };
+
+int main(int argc, char** argv) {
+    const char* data_path = "dataset/Test-set_1.csv";
+    const char* order_path = nullptr;
+    for(int i=1; i<argc; i++) {
+        if(strcmp(argv[i], "--order") == 0 && i + 1 < argc) order_path = argv[++i];
+        else data_path = argv[i];
+    }
+
+    if(order_path) {
+        std::vector<ReplayRow> rows;
+        if(!replay_load(order_path, rows)) { fprintf(stderr, "cannot read %s\n", order_path); return 1; }
+        Replay rp;
+        run_extractor(rows, rp, true);
+        for(int f=0; f<n_forests; f++) print_order(forests[f], rp.feats[f]);
+        return 0;
+    }
+
+    std::vector<ReplayRow> rows;
+    if(!replay_load(data_path, rows)) { fprintf(stderr, "cannot read %s\n", data_path); return 1; }
+    Replay rp;
+    run_extractor(rows, rp, false);
+
+    const Policy policies[] = {
+        { "off (all trees)",       { RF_EXIT_OFF,    0.0f, 0, false } },
+        { "exact",                 { RF_EXIT_EXACT,  0.0f, 0, false } },
+        { "exact + ordered",       { RF_EXIT_EXACT,  0.0f, 0, true  } },
+        { "margin 0.2 + ordered",  { RF_EXIT_MARGIN, 0.2f, 3, true  } },
+        { "margin 0.3 + ordered",  { RF_EXIT_MARGIN, 0.3f, 3, true  } },
+        { "margin 0.4 + ordered",  { RF_EXIT_MARGIN, 0.4f, 3, true  } },
+    };
+    const int reps = 20;
+
+    printf("dataset: %s (%zu rows)\n", data_path, rows.size());
+    for(int f=0; f<n_forests; f++) {
+        const Forest& fr = forests[f];
+        const auto& feats = rp.feats[f];
+        if(feats.empty()) continue;
+
+        std::vector<int> ref(feats.size());
+        uint64_t t0 = replay_now_ns();
+        for(int r=0; r<reps; r++)
+            for(size_t i=0; i<feats.size(); i++) ref[i] = fr.predict(feats[i].data(), nullptr);
+        double ref_ns = (double)(replay_now_ns() - t0) / (reps * feats.size());
+
+        printf("\n%s: %d trees, %zu samples, reference predict %.0f ns/sample\n", fr.name, fr.n_trees, feats.size(), ref_ns);
+        printf("  %-22s %12s %10s %12s\n", "policy", "trees/sample", "agree", "ns/sample");
+        for(const Policy& p : policies) {
+            rf_exit_config = p.cfg;
+            long trees = 0, agree = 0;
+            for(size_t i=0; i<feats.size(); i++) {
+                int n = 0;
+                int label = fr.predict_early(feats[i].data(), nullptr, &n);
+                trees += n;
+                agree += (label == ref[i]);
+            }
+            uint64_t t1 = replay_now_ns();
+            for(int r=0; r<reps; r++)
+                for(size_t i=0; i<feats.size(); i++) fr.predict_early(feats[i].data(), nullptr, nullptr);
+            double ns = (double)(replay_now_ns() - t1) / (reps * feats.size());
+            printf("  %-22s %12.2f %9.2f%% %12.0f\n", p.name, (double)trees / feats.size(),
+                   100.0 * agree / feats.size(), ns);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,88 @@
+// Lazy split-driven feature evaluation (LazyFeatures + predict_*_lazy) against
+// extracting every feature before predict_cold / predict_warm. Both paths run
+// on the same extractor state for each replayed sample. The bench reports the
+// features actually computed per sample and end-to-end extraction plus
+// prediction time.
+//
+// Build from the repo root:
+//   g++ -O2 -std=c++17 -I"esp32_original/src new rf" host/bench_rf_lazy.cpp -o /tmp/rf_lazy
+// Run:
+//   /tmp/rf_lazy [dataset.csv]
+#include "replay.h"
+#include <algorithm>
+#include "rfe_settings.h"
+#include "infer.h"
+#include "rfe_features.h"
+
+struct Phase {
+    const char* name;
+    int n_features;
+    std::vector<int> materialised;
+    uint64_t eager_ns = 0, lazy_ns = 0;
+    int mismatch = 0;
+};
+
+static void print_phase(const Phase& p) {
+    size_t n = p.materialised.size();
+    if(n == 0) return;
+    std::vector<int> m = p.materialised;
+    std::sort(m.begin(), m.end());
+    double mean = 0;
+    for(int v : m) mean += v;
+    mean /= n;
+    printf("%s: %zu samples, %d features in the spec\n", p.name, n, p.n_features);
+    printf("  materialised per sample: mean %.1f, p50 %d, p95 %d, max %d\n",
+           mean, m[n / 2], m[(n * 95) / 100], m.back());
+    printf("  eager extract + predict: %6.0f ns/sample\n", (double)p.eager_ns / n);
+    printf("  lazy predict:            %6.0f ns/sample  (x%.2f)\n",
+           (double)p.lazy_ns / n, (double)p.eager_ns / p.lazy_ns);
+    printf("  mismatching label/score: %d\n", p.mismatch);
+}
+
+int main(int argc, char** argv) {
+    const char* data_path = (argc > 1) ? argv[1] : "dataset/Test-set_1.csv";
+    std::vector<ReplayRow> rows;
+    if(!replay_load(data_path, rows)) { fprintf(stderr, "cannot read %s\n", data_path); return 1; }
+
+    Phase phases[2] = { { "RF_COLD", N_FEATURES_COLD, {} }, { "RF_WARM", N_FEATURES_WARM, {} } };
+    LazyFeatures lazy;
+    const int reps = 20;
+    int n = 0;
+    for(size_t i=0; i<rows.size(); i++) {
+        float raw[NUM_RAW_INPUTS];
+        for(int k=0; k<NUM_RAW_INPUTS; k++) raw[k] = rows[i].raw[k];
+        if(isnan(raw[0])) continue;
+        update_state(raw, 1 + (uint32_t)(i / 4));
+        bool warm = sample_count >= WARMUP_PERIOD;
+        Phase& ph = phases[warm ? 1 : 0];
+        const FeatureSpec* specs = warm ? FEATURE_SPECS_WARM : FEATURE_SPECS_COLD;
+
+        float f[N_FEATURES_WARM], ref_score = 0, score = 0;
+        int ref_label = 0, label = 0;
+        // Alternate which path runs first so neither always gets the warmer cache.
+        for(int k=0; k<2; k++) {
+            bool run_lazy = ((k + n) & 1) != 0;
+            uint64_t t0 = replay_now_ns();
+            for(int r=0; r<reps; r++) {
+                if(run_lazy) {
+                    lazy.begin(raw, specs);
+                    label = warm ? predict_warm_lazy(lazy, &score) : predict_cold_lazy(lazy, &score);
+                } else {
+                    extract_features_generic(raw, specs, ph.n_features, f);
+                    ref_label = warm ? predict_warm(f, &ref_score) : predict_cold(f, &ref_score);
+                }
+            }
+            uint64_t dt = (replay_now_ns() - t0) / reps;
+            if(run_lazy) ph.lazy_ns += dt;
+            else ph.eager_ns += dt;
+        }
+        ph.materialised.push_back(lazy.materialised);
+        ph.mismatch += (label != ref_label || score != ref_score);
+        n++;
+    }
+
+    printf("dataset: %s (%zu rows)\n", data_path, rows.size());
+    print_phase(phases[0]);
+    print_phase(phases[1]);
+    return 0;
+}
@@ -0,0 +1,105 @@
+// Padded-tree traversal (rf_padded.h, model_edge_padded.h) against the sparse
+// walk of predict_cold / predict_warm on the replayed dataset: agreement of
+// labels and scores, and ns per sample for each kernel.
+//
+// Build from the repo root:
+//   g++ -O2 -std=c++17 -mavx2 -I"esp32_original/src new rf" host/bench_rf_padded.cpp -o /tmp/rf_padded
+//   (without -mavx2 only the scalar and 4-lane kernels are built; predict_*_padded
+//   uses the 4-lane kernel unless -DRF_PADDED_AVX2 is also given)
+// Run:
+//   /tmp/rf_padded [dataset.csv]
+#include "replay.h"
+#include "rfe_settings.h"
+#include "infer.h"
+#include "rfe_features.h"
+
+typedef int (*PredictOne)(const float*, float*);
+typedef void (*PaddedWalk)(const RfPaddedForest&, const float*, int, int, float*);
+
+struct Kernel { const char* name; PaddedWalk walk; };
+
+static const Kernel kernels[] = {
+    { "scalar", rf_padded_walk_scalar },
+    { "4-lane", rf_padded_walk4 },
+#if defined(__AVX2__)
+    { "avx2",   rf_padded_walk_avx2 },
+#endif
+};
+
+static void bench(const char* name, int n_features, int n_trees, const float* mean, const float* sd,
+                  const RfPaddedForest& pf, const std::vector<float>& feats,
+                  PredictOne sparse, PredictOne padded)
+{
+    int n = (int)(feats.size() / n_features);
+    const int reps = 50;
+    std::vector<int> ref_label(n);
+    std::vector<float> ref_score(n);
+
+    uint64_t t0 = replay_now_ns();
+    for(int r=0; r<reps; r++)
+        for(int i=0; i<n; i++) ref_label[i] = sparse(&feats[(size_t)i * n_features], &ref_score[i]);
+    double sparse_ns = (double)(replay_now_ns() - t0) / reps / n;
+
+    int mismatch = 0;
+    for(int i=0; i<n; i++) {
+        float s;
+        int l = padded(&feats[(size_t)i * n_features], &s);
+        mismatch += (l != ref_label[i] || s != ref_score[i]);
+    }
+    uint64_t t1 = replay_now_ns();
+    for(int r=0; r<reps; r++)
+        for(int i=0; i<n; i++) padded(&feats[(size_t)i * n_features], nullptr);
+    double padded_ns = (double)(replay_now_ns() - t1) / reps / n;
+
+    printf("%s: %d samples, %d padded trees of depth %d, %d sparse\n", name, n, pf.n_padded, pf.depth, pf.n_rest);
+    printf("  sparse predict:  %6.0f ns/sample\n", sparse_ns);
+    printf("  padded predict:  %6.0f ns/sample  (x%.2f)  mismatching label/score: %d\n",
+           padded_ns, sparse_ns / padded_ns, mismatch);
+
+    // Traversal only, on pre-scaled inputs.
+    std::vector<float> z((size_t)n * n_features), tree_prob(n_trees);
+    for(int i=0; i<n; i++)
+        for(int k=0; k<n_features; k++) {
+            float s = sd[k];
+            if(s < 1e-9f) s = 1.0f;
+            z[(size_t)i * n_features + k] = (feats[(size_t)i * n_features + k] - mean[k]) / s;
+        }
+    volatile float sink = 0.0f;
+    for(const Kernel& kn : kernels) {
+        uint64_t t2 = replay_now_ns();
+        for(int r=0; r<reps; r++)
+            for(int i=0; i<n; i++) {
+                kn.walk(pf, &z[(size_t)i * n_features], 0, pf.n_padded, tree_prob.data());
+                sink = sink + tree_prob[0];
+            }
+        printf("  walk %-7s      %6.0f ns/sample\n", kn.name, (double)(replay_now_ns() - t2) / reps / n);
+    }
+}
+
+int main(int argc, char** argv) {
+    const char* data_path = (argc > 1) ? argv[1] : "dataset/Test-set_1.csv";
+    std::vector<ReplayRow> rows;
+    if(!replay_load(data_path, rows)) { fprintf(stderr, "cannot read %s\n", data_path); return 1; }
+
+    std::vector<float> cold, warm;
+    for(size_t i=0; i<rows.size(); i++) {
+        float raw[NUM_RAW_INPUTS];
+        for(int k=0; k<NUM_RAW_INPUTS; k++) raw[k] = rows[i].raw[k];
+        if(isnan(raw[0])) continue;
+        update_state(raw, 1 + (uint32_t)(i / 4));
+        float f[N_FEATURES_WARM];
+        extract_features_generic(raw, FEATURE_SPECS_COLD, N_FEATURES_COLD, f);
+        cold.insert(cold.end(), f, f + N_FEATURES_COLD);
+        if(sample_count >= WARMUP_PERIOD) {
+            extract_features_generic(raw, FEATURE_SPECS_WARM, N_FEATURES_WARM, f);
+            warm.insert(warm.end(), f, f + N_FEATURES_WARM);
+        }
+    }
+
+    printf("dataset: %s (%zu rows)\n", data_path, rows.size());
+    bench("RF_COLD", N_FEATURES_COLD, RF_COLD_N_TREES, RF_COLD_SCALE_MEAN, RF_COLD_SCALE_STD,
+          RF_COLD_PADDED, cold, predict_cold, predict_cold_padded);
+    bench("RF_WARM", N_FEATURES_WARM, RF_WARM_N_TREES, RF_WARM_SCALE_MEAN, RF_WARM_SCALE_STD,
+          RF_WARM_PADDED, warm, predict_warm, predict_warm_padded);
+    return 0;
+}
@@ -0,0 +1,330 @@
+// Detection row formatting: detection_row.h against the String code it
+// replaces and against snprintf, on the rows onMqtt publishes for a dataset.
+// Two row shapes are built per reading:
+//   lr     Time,Temp,Hum,HumWS,TempWS,Label,FeatTime,TestTime,Score
+//   multi  Time,Temp,Hum,HumWS,TempWS,FeatTime, then Label,TestTime,Score x3
+// with the reading's channels and fixed pseudo-random labels, times and scores.
+// For each formatter the bench reports ns per row (best of five passes), heap
+// calls and bytes requested per row (malloc / realloc / free, counted by
+// wrapping glibc's), and the rows whose text differs from the String one.
+// The compact rows (DETECTION_COMPACT) are measured the same way. Before
+// that, row_fixed is checked against dtostrf and "%.*f" on the special values
+// and a million random floats below 2^49.
+//
+// Arduino's String is not available on the host, so String here is a
+// stand-in that allocates as the ESP32 core's WString does: an 11-byte
+// small-string buffer, then a heap buffer realloc'd to the exact length on
+// each growth; a + b copies a into a temporary (StringSumHelper) and appends;
+// String(float, d) formats with the core's dtostrf into a malloc'd d + 42
+// byte buffer. The glibc allocator is faster than the ESP32's, so the heap
+// share of the String time is, if anything, understated.
+//
+// Build from the repo root:
+//   g++ -O2 -std=c++17 -I"esp32_original/src 22 lr" host/bench_row.cpp -o /tmp/row
+// Run:
+//   /tmp/row [dataset.csv]
+#include "replay.h"
+#include <algorithm>
+#include "catch22_settings.h"
+#include "detection_row.h"
+
+extern "C" void* __libc_malloc(size_t n);
+extern "C" void* __libc_realloc(void* p, size_t n);
+extern "C" void __libc_free(void* p);
+static uint64_t heap_calls = 0, heap_bytes = 0;
+extern "C" void* malloc(size_t n) { heap_calls++; heap_bytes += n; return __libc_malloc(n); }
+extern "C" void* realloc(void* p, size_t n) { heap_calls++; heap_bytes += n; return __libc_realloc(p, n); }
+extern "C" void free(void* p) { if(p) heap_calls++; __libc_free(p); }
+
+// ---- the ESP32 core's String, as far as allocation goes ----
+
+// dtostrf from the core's stdlib_noniso.c.
+static char* dtostrf(double number, signed int width, unsigned int prec, char* s) {
+    bool negative = false;
+    if(isnan(number)) { strcpy(s, "nan"); return s; }
+    if(std::isinf(number)) { strcpy(s, "inf"); return s; }
+    char* out = s;
+    int fillme = width;
+    if(prec > 0) fillme -= (prec + 1);
+    if(number < 0.0) { negative = true; fillme--; number = -number; }
+    double rounding = 2.0;
+    for(unsigned i=0; i<prec; ++i) rounding *= 10.0;
+    rounding = 1.0 / rounding;
+    number += rounding;
+    double tenpow = 1.0;
+    int digitcount = 1;
+    while(number >= 10.0 * tenpow) { tenpow *= 10.0; digitcount++; }
+    number /= tenpow;
+    fillme -= digitcount;
+    while(fillme-- > 0) *out++ = ' ';
+    if(negative) *out++ = '-';
+    digitcount += prec;
+    int8_t digit = 0;
+    while(digitcount-- > 0) {
+        digit = (int8_t)number;
+        if(digit > 9) digit = 9;
+        *out++ = (char)('0' | digit);
+        if((digitcount == (int)prec) && (prec > 0)) *out++ = '.';
+        number -= digit;
+        number *= 10.0;
+    }
+    *out = 0;
+    return s;
+}
+
+#define SSO_SIZE 11
+
+class String {
+public:
+    String(const char* s = "") { assign(s, strlen(s)); }
+    String(const String& o) { assign(o.c_str(), o.len_); }
+    explicit String(int v) { char t[12]; snprintf(t, sizeof(t), "%d", v); assign(t, strlen(t)); }
+    String(float v, unsigned d) {
+        char* t = (char*)malloc(d + 42);
+        dtostrf(v, d + 2, d, t);
+        assign(t, strlen(t));
+        free(t);
+    }
+    ~String() { if(heap_) free(heap_); }
+    String& operator=(const String&) = delete;
+    const char* c_str() const { return heap_ ? heap_ : sso_; }
+    size_t length() const { return len_; }
+    void concat(const char* s, size_t n) {
+        reserve(len_ + n);
+        memcpy(buf() + len_, s, n);
+        len_ += n;
+        buf()[len_] = '\0';
+    }
+    String& operator+=(const String& o) { concat(o.c_str(), o.len_); return *this; }
+    String& operator+=(const char* s) { concat(s, strlen(s)); return *this; }
+protected:
+    char* buf() { return heap_ ? heap_ : sso_; }
+    void reserve(size_t n) {
+        if(n < SSO_SIZE && !heap_) return;
+        if(heap_ && n <= cap_) return;
+        char* nb = (char*)realloc(heap_, n + 1);
+        if(!heap_) memcpy(nb, sso_, len_ + 1);
+        heap_ = nb;
+        cap_ = n;
+    }
+    void assign(const char* s, size_t n) { len_ = 0; sso_[0] = '\0'; concat(s, n); }
+    char sso_[SSO_SIZE] = {0};
+    char* heap_ = nullptr;
+    size_t cap_ = 0, len_ = 0;
+};
+
+// a + b: a copied into the helper, b appended (WString's StringSumHelper).
+class StringSumHelper : public String {
+public:
+    StringSumHelper(const String& s) : String(s) {}
+    StringSumHelper(const char* s) : String(s) {}
+};
+static StringSumHelper& operator+(const StringSumHelper& a, const String& b) {
+    StringSumHelper& m = const_cast<StringSumHelper&>(a);
+    m += b;
+    return m;
+}
+static StringSumHelper& operator+(const StringSumHelper& a, const char* b) {
+    StringSumHelper& m = const_cast<StringSumHelper&>(a);
+    m += b;
+    return m;
+}
+
+// ---- the rows ----
+
+struct Reading {
+    std::string time;
+    float raw[NUM_RAW_INPUTS];
+    int label[3];
+    float t_feat, t_infer[3], score[3];
+};
+
+// The String code of the 22 lr / 22 multi builds before detection_row.h.
+static void string_lr(const Reading& r, std::string& out) {
+    String timeStr;
+    timeStr.concat(r.time.data(), r.time.size());
+    String msg = timeStr + ",";
+    msg += String(r.raw[IDX_TEMPERATURE],2)+","+String(r.raw[IDX_HUMIDITY],2)+","+
+           String(r.raw[IDX_HUMIDITY_WEATHERSTATION],2)+","+String(r.raw[IDX_TEMPERATURE_WEATHERSTATION],2)+",";
+    msg += String(r.label[0]) + "," + String(r.t_feat, 3) + "," + String(r.t_infer[0], 3) + ",";
+    msg += String(r.score[0], 4);
+    out.assign(msg.c_str(), msg.length());
+}
+
+static void string_multi(const Reading& r, std::string& out) {
+    String timeStr;
+    timeStr.concat(r.time.data(), r.time.size());
+    String msg = timeStr + ",";
+    msg += String(r.raw[IDX_TEMPERATURE],2)+","+String(r.raw[IDX_HUMIDITY],2)+","+
+           String(r.raw[IDX_HUMIDITY_WEATHERSTATION],2)+","+String(r.raw[IDX_TEMPERATURE_WEATHERSTATION],2)+",";
+    msg += String(r.t_feat, 3);
+    for(int h=0; h<3; h++) {
+        msg += "," + String(r.label[h]) + "," + String(r.t_infer[h], 3) + ",";
+        msg += String(r.score[h], 4);
+    }
+    out.assign(msg.c_str(), msg.length());
+}
+
+static void printf_lr(const Reading& r, std::string& out) {
+    char buf[DETECTION_ROW_MAX];
+    int n = snprintf(buf, sizeof(buf), "%s,%.2f,%.2f,%.2f,%.2f,%d,%.3f,%.3f,%.4f", r.time.c_str(),
+                     r.raw[IDX_TEMPERATURE], r.raw[IDX_HUMIDITY], r.raw[IDX_HUMIDITY_WEATHERSTATION],
+                     r.raw[IDX_TEMPERATURE_WEATHERSTATION], r.label[0], r.t_feat, r.t_infer[0], r.score[0]);
+    out.assign(buf, n);
+}
+
+static void printf_multi(const Reading& r, std::string& out) {
+    char buf[DETECTION_ROW_MAX];
+    int n = snprintf(buf, sizeof(buf), "%s,%.2f,%.2f,%.2f,%.2f,%.3f,%d,%.3f,%.4f,%d,%.3f,%.4f,%d,%.3f,%.4f",
+                     r.time.c_str(), r.raw[IDX_TEMPERATURE], r.raw[IDX_HUMIDITY],
+                     r.raw[IDX_HUMIDITY_WEATHERSTATION], r.raw[IDX_TEMPERATURE_WEATHERSTATION], r.t_feat,
+                     r.label[0], r.t_infer[0], r.score[0], r.label[1], r.t_infer[1], r.score[1],
+                     r.label[2], r.t_infer[2], r.score[2]);
+    out.assign(buf, n);
+}
+
+// The rows as onMqtt now builds them; compact skips row_raw, as
+// DETECTION_COMPACT=1 compiles it.
+template <bool compact>
+static void row_lr(const Reading& r, std::string& out) {
+    DetectionRow& msg = detection_row;
+    row_begin(msg, r.time.data(), r.time.size());
+    if(!compact) row_raw(msg, r.raw);
+    row_int(msg, r.label[0]);
+    row_fixed(msg, r.t_feat, 3);
+    row_fixed(msg, r.t_infer[0], 3);
+    row_score(msg, r.score[0], true);
+    out.assign(row_end(msg), msg.len);
+}
+
+template <bool compact>
+static void row_multi(const Reading& r, std::string& out) {
+    DetectionRow& msg = detection_row;
+    row_begin(msg, r.time.data(), r.time.size());
+    if(!compact) row_raw(msg, r.raw);
+    row_fixed(msg, r.t_feat, 3);
+    for(int h=0; h<3; h++) {
+        row_int(msg, r.label[h]);
+        row_fixed(msg, r.t_infer[h], 3);
+        row_score(msg, r.score[h], true);
+    }
+    out.assign(row_end(msg), msg.len);
+}
+
+struct Result { double ns, calls, bytes, row_bytes; };
+
+template <typename F>
+static Result run(const std::vector<Reading>& in, std::vector<std::string>& rows, F format) {
+    Result res { 1e30, 0.0, 0.0, 0.0 };
+    rows.assign(in.size(), std::string());
+    for(std::string& s : rows) s.reserve(DETECTION_ROW_MAX);    // keep the copy-out off the heap counters
+    for(int pass=0; pass<5; pass++) {
+        uint64_t c0 = heap_calls, b0 = heap_bytes, t0 = replay_now_ns();
+        for(size_t i=0; i<in.size(); i++) format(in[i], rows[i]);
+        res.ns = std::min(res.ns, (double)(replay_now_ns() - t0) / in.size());
+        res.calls = (double)(heap_calls - c0) / in.size();
+        res.bytes = (double)(heap_bytes - b0) / in.size();
+    }
+    size_t total = 0;
+    for(const std::string& s : rows) total += s.size();
+    res.row_bytes = (double)total / in.size();
+    return res;
+}
+
+static int differ(const std::vector<std::string>& a, const std::vector<std::string>& b) {
+    int n = 0;
+    for(size_t i=0; i<a.size(); i++) n += (a[i] != b[i]);
+    return n;
+}
+
+static void print(const char* name, const Result& r, int diff) {
+    printf("  %-16s %8.0f %10.1f %10.0f %9.1f", name, r.ns, r.calls, r.bytes, r.row_bytes);
+    if(diff >= 0) printf(" %10d\n", diff);
+    else printf(" %10s\n", "-");
+}
+
+// row_fixed against dtostrf (String(v, d)) and glibc's "%.*f" at the
+// decimals onMqtt uses (1..4; dtostrf pads 0 decimals with a space), by
+// magnitude. Returns the special values that differ from dtostrf.
+static int check_fixed() {
+    const float special[] = { NAN, INFINITY, -INFINITY, 0.0f, -0.0f, -0.001f, 0.125f, 2.5f, -2.5f, 835.40625f,
+                              1e-45f, 9.99995f };
+    const unsigned n_special = sizeof(special) / sizeof(special[0]);
+    const char* range[3] = { "|v| < 2^8", "2^8 .. 2^24", "2^24 .. 2^49" };
+    uint64_t n[3] = { 0 }, vs_dtostrf[3] = { 0 }, vs_printf[3] = { 0 };
+    int bad_special = 0;
+    uint32_t seed = 1;
+    char ref[400];
+    for(unsigned i=0; i<1000000 + n_special; i++) {
+        float v;
+        if(i < n_special) {
+            v = special[i];
+        } else {
+            seed = seed * 1664525u + 1013904223u;
+            uint32_t bits = (seed & 0x807FFFFFu) | ((seed >> 8) % (127 + 49) << 23);    // below 2^49
+            memcpy(&v, &bits, sizeof(v));
+        }
+        int k = (fabsf(v) < 256.0f || isnan(v)) ? 0 : (fabsf(v) < 16777216.0f) ? 1 : 2;
+        for(int d=1; d<=ROW_MAX_DECIMALS; d++) {
+            DetectionRow r;
+            row_begin(r, "", 0);
+            row_fixed(r, v, d);
+            const char* mine = row_end(r) + 1;
+            dtostrf(v, d + 2, d, ref);
+            bool differs = strcmp(mine, ref) != 0;
+            vs_dtostrf[k] += differs;
+            if(i < n_special && differs) { printf("  %.9g, %d decimals: %s, dtostrf %s\n", v, d, mine, ref); bad_special++; }
+            snprintf(ref, sizeof(ref), "%.*f", d, v);
+            vs_printf[k] += strcmp(mine, ref) != 0;
+            n[k]++;
+        }
+    }
+    printf("row_fixed, 1..4 decimals, values differing from   dtostrf     %%.*f\n");
+    for(int k=0; k<3; k++) {
+        printf("  %-14s %9llu                       %9llu %9llu\n", range[k], (unsigned long long)n[k],
+               (unsigned long long)vs_dtostrf[k], (unsigned long long)vs_printf[k]);
+    }
+    return bad_special;
+}
+
+int main(int argc, char** argv) {
+    const char* path = (argc > 1) ? argv[1] : "dataset/Test-set_1.csv";
+    std::vector<ReplayRow> rows;
+    if(!replay_load(path, rows)) { fprintf(stderr, "cannot read %s\n", path); return 1; }
+    std::vector<Reading> in;
+    uint32_t seed = 12345;
+    auto rnd = [&] { seed = seed * 1664525u + 1013904223u; return (seed >> 8) / 16777216.0f; };
+    for(const ReplayRow& row : rows) {
+        if(isnan(row.raw[0])) continue;
+        Reading r;
+        r.time = row.time;
+        for(int i=0; i<NUM_RAW_INPUTS; i++) r.raw[i] = row.raw[i];
+        r.t_feat = 0.05f + 20.0f * rnd();
+        for(int h=0; h<3; h++) {
+            r.score[h] = (h == 1) ? 4.0f * rnd() - 2.0f : rnd();    // an SVM margin, probabilities
+            r.label[h] = r.score[h] > ((h == 1) ? 0.0f : 0.5f);
+            r.t_infer[h] = 0.01f + 2.0f * rnd();
+        }
+        in.push_back(r);
+    }
+    if(in.empty()) { fprintf(stderr, "no rows in %s\n", path); return 1; }
+    if(check_fixed()) return 1;
+
+    printf("dataset: %s (%zu rows)\n", path, in.size());
+    printf("  %-16s %8s %10s %10s %9s %10s\n", "", "ns/row", "heap/row", "B req/row", "row B", "!= String");
+    std::vector<std::string> ref, out;
+    for(int shape=0; shape<2; shape++) {
+        bool lr = (shape == 0);
+        printf(" %s row\n", lr ? "lr" : "multi");
+        Result s = lr ? run(in, ref, string_lr) : run(in, ref, string_multi);
+        print("String", s, -1);
+        Result p = lr ? run(in, out, printf_lr) : run(in, out, printf_multi);
+        print("snprintf", p, differ(ref, out));
+        Result d = lr ? run(in, out, row_lr<false>) : run(in, out, row_multi<false>);
+        print("detection_row", d, differ(ref, out));
+        Result c = lr ? run(in, out, row_lr<true>) : run(in, out, row_multi<true>);
+        print("  compact", c, -1);
+        printf("  detection_row %.1fx faster than String, %.1fx than snprintf\n", s.ns / d.ns, p.ns / d.ns);
+    }
+    return 0;
+}
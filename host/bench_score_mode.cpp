@@ -0,0 +1,113 @@
+// Scoring modes (score_mode.h) for the dual RFE linear models: label only,
+// fast polynomial exp and exact expf. The bench reports four things:
+//   - the score error of FAST against EXACT, on a dense sweep of decisions
+//     and on the replayed dataset;
+//   - label mismatches of LABEL / FAST against EXACT;
+//   - ns for the score step alone (decision -> label and score);
+//   - ns per predict_cold / predict_warm call in each mode, on the same
+//     extracted feature vectors.
+//
+// Build from the repo root:
+//   g++ -O2 -std=c++17 -DHOST_MODEL_LR  -I"esp32_original/src new lr"  host/bench_score_mode.cpp -o /tmp/score_lr
+//   g++ -O2 -std=c++17 -DHOST_MODEL_SVM -I"esp32_original/src new svm" host/bench_score_mode.cpp -o /tmp/score_svm
+// Run:
+//   /tmp/score_lr [dataset.csv]
+#include "replay.h"
+#include <algorithm>
+#include "rfe_settings.h"
+#include "infer.h"
+#include "rfe_features.h"
+
+#if defined(HOST_MODEL_LR)
+static int sweep_score(float d, int mode, float* score) { return lr_label_score(d, mode, score); }
+#elif defined(HOST_MODEL_SVM)
+static int sweep_score(float d, int mode, float* score) {
+    return platt_label_score(d, SVM_WARM_PROB_A, SVM_WARM_PROB_B, mode, score);
+}
+#else
+#error "define HOST_MODEL_LR or HOST_MODEL_SVM"
+#endif
+
+static const char* mode_names[3] = { "label", "fast", "exact" };
+
+struct Phase {
+    const char* name;
+    int (*predict)(const float*, float*, int);
+    std::vector<std::vector<float>> rows;
+};
+
+int main(int argc, char** argv) {
+    const char* data_path = (argc > 1) ? argv[1] : "dataset/Test-set_1.csv";
+    std::vector<ReplayRow> rows;
+    if(!replay_load(data_path, rows)) { fprintf(stderr, "cannot read %s\n", data_path); return 1; }
+
+    // Sweep: every decision in [-40, 40] at 1e-4 steps.
+    float max_err = 0.0f, at = 0.0f;
+    int sweep_flips = 0;
+    for(int i=-400000; i<=400000; i++) {
+        float d = i * 1e-4f, exact, fast, none;
+        int le = sweep_score(d, SCORE_MODE_EXACT, &exact);
+        int lf = sweep_score(d, SCORE_MODE_FAST, &fast);
+        int ll = sweep_score(d, SCORE_MODE_LABEL, &none);
+        sweep_flips += (le != lf) + (le != ll);
+        if(std::fabs(fast - exact) > max_err) { max_err = std::fabs(fast - exact); at = d; }
+    }
+    printf("sweep of decisions in [-40, 40]: max |fast - exact| %.2e (at %.4f), label flips %d\n",
+           max_err, at, sweep_flips);
+    // The score step alone, over the same sweep.
+    for(int mode=SCORE_MODE_LABEL; mode<=SCORE_MODE_EXACT; mode++) {
+        double best = 1e30;
+        volatile float sink = 0.0f;
+        for(int pass=0; pass<5; pass++) {
+            uint64_t t0 = replay_now_ns();
+            float acc = 0.0f;
+            for(int i=-400000; i<=400000; i++) { float s; acc += sweep_score(i * 1e-4f, mode, &s); acc += s; }
+            sink = sink + acc;
+            best = std::min(best, (double)(replay_now_ns() - t0) / 800001.0);
+        }
+        printf("  score step, %-5s %5.2f ns\n", mode_names[mode], best);
+    }
+
+    Phase phases[2] = { { "COLD", predict_cold, {} }, { "WARM", predict_warm, {} } };
+    for(size_t i=0; i<rows.size(); i++) {
+        float raw[NUM_RAW_INPUTS];
+        for(int k=0; k<NUM_RAW_INPUTS; k++) raw[k] = rows[i].raw[k];
+        if(isnan(raw[0])) continue;
+        update_state(raw, 1 + (uint32_t)(i / 4));
+        bool warm = sample_count >= WARMUP_PERIOD;
+        std::vector<float> f(warm ? N_FEATURES_WARM : N_FEATURES_COLD);
+        extract_features_generic(raw, warm ? FEATURE_SPECS_WARM : FEATURE_SPECS_COLD, (int)f.size(), f.data());
+        phases[warm ? 1 : 0].rows.push_back(f);
+    }
+
+    printf("dataset: %s\n", data_path);
+    for(const Phase& ph : phases) {
+        size_t n = ph.rows.size();
+        if(n == 0) continue;
+        printf("%s: %zu samples\n", ph.name, n);
+        for(int mode=SCORE_MODE_LABEL; mode<=SCORE_MODE_EXACT; mode++) {
+            int flips = 0;
+            float err = 0.0f;
+            for(const auto& f : ph.rows) {
+                float s_exact, s;
+                int le = ph.predict(f.data(), &s_exact, SCORE_MODE_EXACT);
+                int l = ph.predict(f.data(), &s, mode);
+                flips += (l != le);
+                if(mode != SCORE_MODE_LABEL) err = std::max(err, std::fabs(s - s_exact));
+            }
+            // Best of five passes of 200 reps over all rows.
+            double best = 1e30;
+            volatile int sink = 0;
+            for(int pass=0; pass<5; pass++) {
+                uint64_t t0 = replay_now_ns();
+                for(int r=0; r<200; r++)
+                    for(const auto& f : ph.rows) { float s; sink = sink + ph.predict(f.data(), &s, mode); }
+                best = std::min(best, (double)(replay_now_ns() - t0) / (200.0 * n));
+            }
+            printf("  %-5s  %6.1f ns/call  label flips vs exact %d", mode_names[mode], best, flips);
+            if(mode != SCORE_MODE_LABEL) printf("  max |score - exact| %.2e", err);
+            printf("\n");
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,480 @@
+// Transports (transport.h) end to end on Linux: a hub sends the dataset one
+// sample at a time and waits for the row before sending the next, and the
+// device, a child process, runs what main.cpp's on_payload does (a sample
+// frame or a JSON sample decoded, catch22 + LR, the row written) and sends the
+// row back the same way:
+//   1. latency, sample sent to row received, per transport and payload:
+//        in-process    on_payload called directly, no transport: the floor;
+//        uart (pty)    the framed stream over a pseudo-terminal in raw mode,
+//                      the device on the slave as it would be on the UART;
+//        udp           one datagram each way over loopback;
+//        mqtt (relay)  the framed stream over TCP through a broker stand-in,
+//                      a third process relaying each side's bytes to the
+//                      other, as a broker forwards a publish to its
+//                      subscriber (two TCP legs, two process switches; MQTT's
+//                      own encoding, a few bytes, is not modelled).
+//      Every device waits in poll() on its descriptor and then runs
+//      transport_poll, so each run pays the same wake-up. Also reported: the
+//      bytes each way a sample as the transport puts them on the wire (MQTT:
+//      the PUBLISH header and topic; UDP and TCP/IP headers not counted), and
+//      whether the rows match the in-process ones (timings aside). A pty has
+//      no baud rate, so the time a real UART takes to clock the bytes out is
+//      printed beside it, modelled at 10 bits a byte; Wi-Fi and a remote
+//      broker add their own round trips on top of the udp and mqtt figures.
+//   2. resync: the framed stream read in random-sized pieces with noise bytes
+//      between frames and one frame in RESYNC_BAD with a flipped byte;
+//      reported, the frames delivered against those sent intact, the bad
+//      frames counted and whether any corrupt payload got through.
+//
+// Build from the repo root:
+//   g++ -O2 -std=c++17 -I"esp32_original/src 22 lr" host/bench_transport.cpp -o /tmp/transport
+// Run:
+//   /tmp/transport [dataset.csv]
+#include "replay.h"
+#include "catch22_settings.h"
+#include "infer.h"
+#include "catch22_features.h"
+#include "sensor_json.h"
+#include "sample_frame.h"
+#include "transport.h"
+#include <algorithm>
+#include <fcntl.h>
+#include <signal.h>
+#include <termios.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <sys/wait.h>
+
+#define REPLY_TIMEOUT_MS 1000
+#define RESYNC_FRAMES 200000
+#define RESYNC_BAD 50
+
+// ---- the device ----
+
+// One sample through extraction and inference, written as process_sample
+// writes its row.
+static const char* process(const SensorJson& in) {
+    float raw[NUM_RAW_INPUTS];
+    for(int i=0; i<NUM_RAW_INPUTS; i++) raw[i] = in.raw[i];
+    static float f[C22_N_FEATURES];
+    uint64_t t0 = replay_now_ns();
+    extract_catch22_features(raw, f);
+    uint64_t t1 = replay_now_ns();
+    float score = 0.0f;
+    int label = predict_lr(f, &score, SCORE_MODE);
+    uint64_t t2 = replay_now_ns();
+    DetectionRow& msg = detection_row;
+    row_begin(msg, in.time, in.time_len);
+    row_raw(msg, raw);
+    row_int(msg, label);
+    row_fixed(msg, (t1 - t0) / 1e6f, 3);
+    row_fixed(msg, (t2 - t1) / 1e6f, 3);
+    row_score(msg, score, SCORE_MODE != SCORE_MODE_LABEL);
+    return row_end(msg);
+}
+
+// main.cpp's on_payload, the row sent back on the transport.
+static void device_payload(uint8_t* p, size_t n) {
+    SensorJson in;
+    if(sample_frame_is(p, n)) {
+        if(sample_frame_decode(p, n, in) == 0) return;
+    } else if(!sensor_json_parse((const char*)p, n, in)) {
+        return;
+    }
+    if(isnan(in.raw[0])) return;
+    const char* row = process(in);
+    transport_send(transport, row, strlen(row));
+}
+
+// Child process: loop() reduced to the transport, until killed.
+static void device_main(const TransportOps& ops, int fd) {
+    reset_catch22_state();
+    transport_begin(transport, ops);
+    for(;;) {
+        pollfd pf = { fd, POLLIN, 0 };
+        if(poll(&pf, 1, 1000) > 0) transport_poll(transport, device_payload);
+    }
+}
+
+static pid_t device_start(const TransportOps& ops, int fd) {
+    pid_t pid = fork();
+    if(pid == 0) device_main(ops, fd);
+    return pid;
+}
+
+static void child_kill(pid_t pid) {
+    kill(pid, SIGKILL);
+    waitpid(pid, nullptr, 0);
+}
+
+// ---- the hub ----
+
+struct Sample {
+    std::string json;
+    uint8_t frame[SAMPLE_FRAME_HEADER + 4 * NUM_RAW_INPUTS];
+    size_t frame_len;
+};
+
+struct Result {
+    std::vector<double> us;
+    std::vector<std::string> rows;
+    double in_bytes, out_bytes;     // on the wire, a sample
+    long lost;
+};
+
+static Transport hub;
+static std::string reply;
+static bool replied;
+
+static void hub_payload(uint8_t* p, size_t n) {
+    reply.assign((const char*)p, n);
+    replied = true;
+}
+
+// The samples one at a time over the hub's transport; fd is what it polls.
+static Result run_hub(const TransportOps& ops, int fd, const std::vector<Sample>& samples, bool json) {
+    Result r {};
+    transport_begin(hub, ops);
+    for(const Sample& s : samples) {
+        const void* p = json ? (const void*)s.json.data() : (const void*)s.frame;
+        size_t n = json ? s.json.size() : s.frame_len;
+        replied = false;
+        uint64_t t0 = replay_now_ns();
+        if(!transport_send(hub, p, n)) {
+            r.lost++;
+            continue;
+        }
+        while(!replied) {
+            pollfd pf = { fd, POLLIN, 0 };
+            if(poll(&pf, 1, REPLY_TIMEOUT_MS) <= 0) break;
+            transport_poll(hub, hub_payload);
+        }
+        if(!replied) {
+            r.lost++;
+            continue;
+        }
+        r.us.push_back((replay_now_ns() - t0) / 1e3);
+        r.rows.push_back(reply);
+    }
+    return r;
+}
+
+static void set_nonblock(int fd) {
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+}
+
+static Result run_pty(const std::vector<Sample>& samples, bool json) {
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+    if(master < 0 || grantpt(master) != 0 || unlockpt(master) != 0) {
+        fprintf(stderr, "no pty\n");
+        exit(1);
+    }
+    int slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+    termios t;
+    tcgetattr(slave, &t);
+    cfmakeraw(&t);
+    tcsetattr(slave, TCSANOW, &t);
+    set_nonblock(master);
+    set_nonblock(slave);
+    static TransportFd dev, h;
+    dev.fd = slave;
+    h.fd = master;
+    pid_t pid = device_start(transport_fd_ops(dev), slave);
+    Result r = run_hub(transport_fd_ops(h), master, samples, json);
+    child_kill(pid);
+    close(slave);
+    close(master);
+    return r;
+}
+
+static int udp_socket(sockaddr_in& a) {
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    a = {};
+    a.sin_family = AF_INET;
+    a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t len = sizeof(a);
+    bind(fd, (sockaddr*)&a, sizeof(a));
+    getsockname(fd, (sockaddr*)&a, &len);
+    set_nonblock(fd);
+    return fd;
+}
+
+static Result run_udp(const std::vector<Sample>& samples, bool json) {
+    sockaddr_in da, ha;
+    int dfd = udp_socket(da), hfd = udp_socket(ha);
+    static TransportSock dev, h;
+    dev = {};
+    dev.fd = dfd;
+    h = {};
+    h.fd = hfd;
+    memcpy(&h.peer, &da, sizeof(da));
+    h.peer_len = sizeof(da);
+    pid_t pid = device_start(transport_sock_ops(dev), dfd);
+    Result r = run_hub(transport_sock_ops(h), hfd, samples, json);
+    child_kill(pid);
+    close(dfd);
+    close(hfd);
+    return r;
+}
+
+static int tcp_connect(int port) {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in a = {};
+    a.sin_family = AF_INET;
+    a.sin_port = htons(port);
+    a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if(connect(fd, (sockaddr*)&a, sizeof(a)) != 0) {
+        fprintf(stderr, "cannot reach the relay\n");
+        exit(1);
+    }
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    set_nonblock(fd);
+    return fd;
+}
+
+// Child process: the device's connection, then the hub's, each one's bytes
+// written to the other as they come.
+static void relay_main(int ls) {
+    int c[2];
+    for(int i=0; i<2; i++) {
+        c[i] = accept(ls, nullptr, nullptr);
+        int one = 1;
+        setsockopt(c[i], IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    }
+    static char buf[65536];
+    for(;;) {
+        pollfd pf[2] = { { c[0], POLLIN, 0 }, { c[1], POLLIN, 0 } };
+        if(poll(pf, 2, 1000) <= 0) continue;
+        for(int i=0; i<2; i++) {
+            if(!(pf[i].revents & (POLLIN | POLLHUP))) continue;
+            ssize_t n = read(c[i], buf, sizeof(buf));
+            if(n <= 0) _exit(0);
+            for(ssize_t off=0; off<n;) {
+                ssize_t w = write(c[1 - i], buf + off, (size_t)(n - off));
+                if(w <= 0) _exit(0);
+                off += w;
+            }
+        }
+    }
+}
+
+static Result run_relay(const std::vector<Sample>& samples, bool json) {
+    int ls = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in a = {};
+    a.sin_family = AF_INET;
+    a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t len = sizeof(a);
+    bind(ls, (sockaddr*)&a, sizeof(a));
+    listen(ls, 2);
+    getsockname(ls, (sockaddr*)&a, &len);
+    pid_t relay = fork();
+    if(relay == 0) relay_main(ls);
+    close(ls);
+    int port = ntohs(a.sin_port);
+    static TransportFd dev, h;
+    dev.fd = tcp_connect(port);
+    usleep(20000);      // the device's connection accepted first
+    h.fd = tcp_connect(port);
+    pid_t pid = device_start(transport_fd_ops(dev), dev.fd);
+    Result r = run_hub(transport_fd_ops(h), h.fd, samples, json);
+    child_kill(pid);
+    child_kill(relay);
+    close(dev.fd);
+    close(h.fd);
+    return r;
+}
+
+// ---- in-process ----
+
+static std::vector<std::string> direct_rows;
+
+static bool direct_send(void*, const uint8_t* p, size_t n) {
+    direct_rows.push_back(std::string((const char*)p, n));
+    return true;
+}
+
+static bool direct_ready(void*) { return true; }
+
+static Result run_direct(const std::vector<Sample>& samples, bool json) {
+    Result r {};
+    reset_catch22_state();
+    transport_begin(transport, { direct_ready, direct_send, nullptr, false, nullptr });
+    direct_rows.clear();
+    static uint8_t buf[TRANSPORT_PAYLOAD_MAX];
+    for(const Sample& s : samples) {
+        size_t n = json ? s.json.size() : s.frame_len;
+        memcpy(buf, json ? (const void*)s.json.data() : (const void*)s.frame, n);
+        uint64_t t0 = replay_now_ns();
+        device_payload(buf, n);
+        r.us.push_back((replay_now_ns() - t0) / 1e3);
+    }
+    r.rows = direct_rows;
+    return r;
+}
+
+// ---- report ----
+
+// MQTT PUBLISH at QoS 0: fixed header, topic length, topic, payload.
+static size_t mqtt_wire(const char* topic, size_t payload) {
+    size_t rem = 2 + strlen(topic) + payload;
+    return 1 + (rem < 128 ? 1 : rem < 16384 ? 2 : 3) + rem;
+}
+
+// The row without FeatTime and TestTime (fields 6 and 7).
+static std::string untimed(const std::string& row) {
+    std::string out;
+    int field = 0;
+    for(char c : row) {
+        if(c == ',') field++;
+        if(field != 6 && field != 7) out += c;
+    }
+    return out;
+}
+
+static double pct(std::vector<double> v, double p) {
+    if(v.empty()) return 0.0;
+    std::sort(v.begin(), v.end());
+    return v[std::min(v.size() - 1, (size_t)(p / 100.0 * v.size()))];
+}
+
+static void print_result(const char* name, const char* payload, const Result& r, const Result& ref) {
+    double mean = 0.0;
+    for(double u : r.us) mean += u;
+    if(!r.us.empty()) mean /= r.us.size();
+    long differ = 0;
+    for(size_t i=0; i<r.rows.size(); i++) {
+        if(i >= ref.rows.size() || untimed(r.rows[i]) != untimed(ref.rows[i])) differ++;
+    }
+    differ += (long)(ref.rows.size() > r.rows.size() ? ref.rows.size() - r.rows.size() : 0);
+    char in[16] = "-", out[16] = "-";
+    if(r.in_bytes > 0) {
+        snprintf(in, sizeof(in), "%.1f", r.in_bytes);
+        snprintf(out, sizeof(out), "%.1f", r.out_bytes);
+    }
+    printf("  %-13s %-7s %7s %7s %8.1f %8.1f %8.1f %8.1f %9.1f %6ld %7ld\n", name, payload, in, out, mean,
+           pct(r.us, 50), pct(r.us, 95), pct(r.us, 99), pct(r.us, 100), r.lost, differ);
+}
+
+// ---- 2 ----
+
+struct Feed {
+    std::vector<uint8_t> bytes;
+    size_t at;
+    uint32_t rnd;
+};
+
+static int feed_recv(void* ctx, uint8_t* buf, size_t cap) {
+    Feed* f = (Feed*)ctx;
+    f->rnd = f->rnd * 1664525u + 1013904223u;
+    size_t n = std::min(std::min(cap, (size_t)(1 + (f->rnd >> 8) % 300)), f->bytes.size() - f->at);
+    memcpy(buf, f->bytes.data() + f->at, n);
+    f->at += n;
+    return (int)n;
+}
+
+static long resync_good, resync_corrupt;
+
+static void resync_payload(uint8_t* p, size_t n) {
+    SensorJson in;
+    if(sample_frame_is(p, n) && sample_frame_decode(p, n, in) > 0 && in.raw[0] == 20.0f) resync_good++;
+    else resync_corrupt++;
+}
+
+static void run_resync() {
+    static Feed f;
+    f = {};
+    f.rnd = 7;
+    uint32_t x = 99;
+    long intact = 0, noise = 0;
+    float ch[NUM_RAW_INPUTS] = { 20.0f, 50.0f, 21.0f, 55.0f };
+    for(int i=0; i<RESYNC_FRAMES; i++) {
+        uint8_t frame[64], out[64 + TRANSPORT_FRAMING];
+        size_t n = sample_frame_encode(frame, sizeof(frame), (uint32_t)i, 1658926800u, ch, NUM_RAW_INPUTS);
+        size_t len = transport_frame(frame, n, out, sizeof(out));
+        x = x * 1664525u + 1013904223u;
+        if(x % RESYNC_BAD == 0) out[2 + (x >> 8) % (len - 2)] ^= (uint8_t)(1u << ((x >> 16) % 8));
+        else intact++;
+        f.bytes.insert(f.bytes.end(), out, out + len);
+        x = x * 1664525u + 1013904223u;
+        int junk = (x >> 8) % 4 == 0 ? (int)((x >> 12) % 5) : 0;     // a quarter of the gaps
+        for(int k=0; k<junk; k++) {
+            x = x * 1664525u + 1013904223u;
+            f.bytes.push_back((uint8_t)(x >> 24));
+            noise++;
+        }
+    }
+    transport_begin(transport, { direct_ready, direct_send, feed_recv, true, &f });
+    resync_good = resync_corrupt = 0;
+    while(f.at < f.bytes.size()) transport_poll(transport, resync_payload);
+    printf("  %d frames, %ld intact, %ld noise bytes: %ld delivered (%.2f%% of the intact), %lu dropped as bad, "
+           "%ld corrupt payloads through\n",
+           RESYNC_FRAMES, intact, noise, resync_good, 100.0 * resync_good / intact,
+           (unsigned long)transport.rx_bad, resync_corrupt);
+}
+
+int main(int argc, char** argv) {
+    const char* path = (argc > 1) ? argv[1] : "dataset/Test-set_1.csv";
+    std::vector<ReplayRow> data;
+    if(!replay_load(path, data)) {
+        fprintf(stderr, "cannot read %s\n", path);
+        return 1;
+    }
+    signal(SIGPIPE, SIG_IGN);
+    std::vector<Sample> samples;
+    for(const ReplayRow& r : data) {
+        Sample s;
+        if(!replay_json_payload(r, s.json)) continue;
+        s.frame_len = sample_frame_encode(s.frame, sizeof(s.frame), (uint32_t)samples.size(), replay_epoch(r.time),
+                                          r.raw, NUM_RAW_INPUTS);
+        samples.push_back(s);
+    }
+
+    printf("== 1. %s: %zu samples, each sent once the last row is back; us\n", path, samples.size());
+    printf("  %-13s %-7s %7s %7s %8s %8s %8s %8s %9s %6s %7s\n", "transport", "payload", "in B", "out B", "mean",
+           "p50", "p95", "p99", "max", "lost", "differ");
+    Result res[2][3], direct[2];
+    for(int json=0; json<2; json++) {
+        direct[json] = run_direct(samples, json);
+        res[json][0] = run_pty(samples, json);
+        res[json][1] = run_udp(samples, json);
+        res[json][2] = run_relay(samples, json);
+    }
+
+    const char* names[3] = { "uart (pty)", "udp", "mqtt (relay)" };
+    for(int json=0; json<2; json++) {
+        // a JSON sample's row keeps its Time text, a frame's is written from
+        // the timestamp: each is checked against its own in-process run
+        double in = 0.0, rows_out = 0.0;
+        for(const Sample& s : samples) in += json ? s.json.size() : s.frame_len;
+        in /= samples.size();
+        for(const std::string& row : direct[json].rows) rows_out += row.size();
+        rows_out /= std::max<size_t>(1, direct[json].rows.size());
+        const char* kind = json ? "json" : "frame";
+        print_result("in-process", kind, direct[json], direct[json]);
+        for(int t=0; t<3; t++) {
+            Result& r = res[json][t];
+            if(t == 0) {
+                r.in_bytes = in + TRANSPORT_FRAMING;
+                r.out_bytes = rows_out + TRANSPORT_FRAMING;
+            } else if(t == 1) {
+                r.in_bytes = in;
+                r.out_bytes = rows_out;
+            } else {
+                r.in_bytes = (double)mqtt_wire(json ? "duy/sensorFault" : "duy/sensorFault/bin", (size_t)(in + 0.5));
+                r.out_bytes = (double)mqtt_wire("duy/sensorDetection", (size_t)(rows_out + 0.5));
+            }
+            print_result(names[t], kind, r, direct[json]);
+        }
+    }
+    for(int json=0; json<2; json++) {
+        double bytes = res[json][0].in_bytes + res[json][0].out_bytes;
+        printf("  uart wire time a sample, %s (modelled): %.0f us at 115200 baud, %.0f us at 921600\n",
+               json ? "json" : "frame", bytes * 10 / 115200 * 1e6, bytes * 10 / 921600 * 1e6);
+    }
+
+    printf("== 2. resync\n");
+    run_resync();
+    return 0;
+}
@@ -0,0 +1,148 @@
+// Re-exports the forests of "src new rf/model_edge_dual.h" as padded perfect
+// trees (see rf_padded.h) and reports the flash cost of each depth cap.
+//
+// Build from the repo root:
+//   g++ -O2 -std=c++17 -I"esp32_original/src new rf" host/pad_forest.cpp -o /tmp/pad_forest
+// Run:
+//   /tmp/pad_forest --report                 flash size per depth cap
+//   /tmp/pad_forest 8 > "esp32_original/src new rf/model_edge_padded.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "model_edge_dual.h"
+
+struct Sparse {
+    const char* name;
+    int n_trees;
+    const int* offsets; const int* feat; const float* thr;
+    const int* left; const int* right; const float* prob;
+};
+
+static const Sparse forests[2] = {
+    { "RF_COLD", RF_COLD_N_TREES, RF_COLD_TREE_OFFSETS, RF_COLD_FEATURE, RF_COLD_THRESHOLD,
+      RF_COLD_LEFT, RF_COLD_RIGHT, RF_COLD_PROB1 },
+    { "RF_WARM", RF_WARM_N_TREES, RF_WARM_TREE_OFFSETS, RF_WARM_FEATURE, RF_WARM_THRESHOLD,
+      RF_WARM_LEFT, RF_WARM_RIGHT, RF_WARM_PROB1 },
+};
+
+static int node_depth(const Sparse& f, int i) {
+    if(f.left[i] == -1) return 0;
+    int l = node_depth(f, f.left[i]), r = node_depth(f, f.right[i]);
+    return 1 + (l > r ? l : r);
+}
+
+struct Layout {
+    int depth = 0;
+    std::vector<int> padded, rest;
+};
+
+static Layout layout_for(const Sparse& f, int cap) {
+    Layout lay;
+    for(int t=0; t<f.n_trees; t++) {
+        int d = node_depth(f, f.offsets[t]);
+        if(d <= cap) { lay.padded.push_back(t); if(d > lay.depth) lay.depth = d; }
+        else lay.rest.push_back(t);
+    }
+    if(lay.depth < 1) lay.depth = 1;
+    return lay;
+}
+
+static size_t sparse_bytes(const Sparse& f, const std::vector<int>& trees) {
+    size_t nodes = 0;
+    for(int t : trees) nodes += f.offsets[t + 1] - f.offsets[t];
+    return nodes * (4 + 4 + 4 + 4 + 4);   // feature, threshold, left, right, prob1
+}
+
+static size_t padded_bytes(const Layout& lay) {
+    size_t n_int = (1u << lay.depth) - 1;
+    return lay.padded.size() * (n_int * (1 + 4) + (n_int + 1) * 4) + 3 + lay.padded.size() * 4;
+}
+
+static void fill(const Sparse& f, int orig, int i, int level, int depth,
+                 int* feat, float* thr, float* leaf, char* pass)
+{
+    int n_int = (1 << depth) - 1;
+    if(level == depth) { leaf[i - n_int] = f.prob[orig]; return; }
+    if(f.left[orig] == -1) {
+        feat[i] = 0; pass[i] = 1;
+        fill(f, orig, 2 * i + 1, level + 1, depth, feat, thr, leaf, pass);
+        fill(f, orig, 2 * i + 2, level + 1, depth, feat, thr, leaf, pass);
+    } else {
+        feat[i] = f.feat[orig]; thr[i] = f.thr[orig];
+        fill(f, f.left[orig], 2 * i + 1, level + 1, depth, feat, thr, leaf, pass);
+        fill(f, f.right[orig], 2 * i + 2, level + 1, depth, feat, thr, leaf, pass);
+    }
+}
+
+static void print_ints(const char* type, const char* name, const std::vector<int>& v) {
+    printf("static const %s %s[] = { ", type, name);
+    if(v.empty()) printf("-1");
+    for(size_t i=0; i<v.size(); i++) printf("%d%s", v[i], (i + 1 < v.size()) ? ", " : "");
+    printf(" };\n");
+}
+
+static void emit(const Sparse& f, int cap) {
+    Layout lay = layout_for(f, cap);
+    int n_int = (1 << lay.depth) - 1;
+    std::vector<int> feat; std::vector<float> thr, leaf; std::vector<char> pass;
+    for(int t : lay.padded) {
+        std::vector<int> tf(n_int, 0); std::vector<float> tt(n_int, 0.0f), tl(n_int + 1, 0.0f);
+        std::vector<char> tp(n_int, 0);
+        fill(f, f.offsets[t], 0, 0, lay.depth, tf.data(), tt.data(), tl.data(), tp.data());
+        for(int i=0; i<n_int; i++) { feat.push_back(tf[i]); thr.push_back(tt[i]); pass.push_back(tp[i]); }
+        leaf.insert(leaf.end(), tl.begin(), tl.end());
+    }
+
+    printf("\n// ===== MODEL: %s (padded, depth cap %d) =====\n", f.name, cap);
+    printf("#define %s_PAD_DEPTH %d\n", f.name, lay.depth);
+    printf("#define %s_PAD_N_TREES %d\n", f.name, (int)lay.padded.size());
+    char name[64];
+    snprintf(name, sizeof(name), "%s_PAD_TREES", f.name);
+    print_ints("int", name, lay.padded);
+    printf("static const uint8_t %s_PAD_FEATURE[] = { ", f.name);
+    for(size_t i=0; i<feat.size(); i++) printf("%d, ", feat[i]);
+    printf("0, 0, 0 };\n");
+    if(thr.empty()) { thr.push_back(0.0f); pass.push_back(0); leaf.push_back(0.0f); }   // no padded tree
+    printf("static const float %s_PAD_THRESHOLD[] = { ", f.name);
+    for(size_t i=0; i<thr.size(); i++) {
+        if(pass[i]) printf("INFINITY");
+        else printf("%.9g", thr[i]);
+        printf("%s", (i + 1 < thr.size()) ? ", " : "");
+    }
+    printf(" };\n");
+    printf("static const float %s_PAD_LEAF[] = { ", f.name);
+    for(size_t i=0; i<leaf.size(); i++) printf("%.9g%s", leaf[i], (i + 1 < leaf.size()) ? ", " : "");
+    printf(" };\n");
+    printf("#define %s_PAD_N_REST %d\n", f.name, (int)lay.rest.size());
+    snprintf(name, sizeof(name), "%s_PAD_REST", f.name);
+    print_ints("int", name, lay.rest);
+}
+
+static void report() {
+    for(const Sparse& f : forests) {
+        std::vector<int> all;
+        for(int t=0; t<f.n_trees; t++) all.push_back(t);
+        size_t orig = sparse_bytes(f, all);
+        int max_depth = layout_for(f, 1 << 20).depth;
+        printf("%s: %d trees, max depth %d, sparse arrays %zu bytes\n", f.name, f.n_trees, max_depth, orig);
+        printf("  %4s %6s %6s %6s %14s %14s %8s\n", "cap", "depth", "padded", "rest", "padded bytes", "total bytes", "vs now");
+        for(int cap=1; cap<=max_depth; cap++) {
+            Layout lay = layout_for(f, cap);
+            size_t pb = lay.padded.empty() ? 0 : padded_bytes(lay);
+            size_t total = pb + sparse_bytes(f, lay.rest);
+            printf("  %4d %6d %6zu %6zu %14zu %14zu %7.2fx\n", cap, lay.depth, lay.padded.size(),
+                   lay.rest.size(), pb, total, (double)total / orig);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    if(argc < 2) { fprintf(stderr, "usage: %s --report | <depth cap>\n", argv[0]); return 1; }
+    if(strcmp(argv[1], "--report") == 0) { report(); return 0; }
+    int cap = atoi(argv[1]);
+    printf("#pragma once\n#include <stdint.h>\n#include <math.h>\n");
+    printf("// Generated by host/pad_forest.cpp from model_edge_dual.h; see rf_padded.h.\n");
+    for(const Sparse& f : forests) emit(f, cap);
+    return 0;
+}
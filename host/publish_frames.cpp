@@ -0,0 +1,196 @@
+// Publishes a dataset to the broker the way data.py does, as binary sample
+// frames (sample_frame.h) by default or as data.py's JSON with --json: one
+// message per row, QoS 0, every --interval ms. The MQTT client is the few
+// packets that takes (CONNECT, PUBLISH, DISCONNECT over a TCP socket), so the
+// tool needs no library. At the end it prints messages sent, payload bytes and
+// bytes on the wire (MQTT fixed header, topic and payload; TCP/IP not counted).
+//
+// Frames carry the row index as the sequence number and the Time cell as
+// seconds since 1970 (read as UTC, replay_epoch), so the firmware publishes
+// the same date and time it would from the JSON. The firmware must be built with
+// -DSAMPLE_FRAME=1; it takes frames on <data topic>/bin, or on the data topic
+// itself.
+//
+// --batch N puts N frames back to back in each message (batch.h); the
+// firmware's MQTT buffer must hold them (BATCH_MQTT_BUFFER). --dry-run encodes
+// every message without connecting, for the byte counts alone.
+//
+// Build from the repo root:
+//   g++ -O2 -std=c++17 -I"esp32_original/src 22 lr" host/publish_frames.cpp -o /tmp/publish_frames
+// Run:
+//   /tmp/publish_frames dataset/Test-set_1.csv --pass <password>
+//   /tmp/publish_frames dataset/Test-set_1.csv --json --topic duy/sensorFault --pass <password>
+#include "replay.h"
+#include "catch22_settings.h"
+#include "sensor_json.h"
+#include "sample_frame.h"
+#include <unistd.h>
+#include <netdb.h>
+#include <sys/socket.h>
+
+struct Options {
+    const char* path = nullptr;
+    bool json = false, dry_run = false;
+    const char* host = "mqtt.abcsolutions.com.vn";
+    const char* port = "1883";
+    const char* topic = nullptr;
+    const char* user = "abcsolution";
+    const char* pass = "";
+    int interval_ms = 1000;
+    int batch = 1;
+};
+
+// ---- MQTT 3.1.1, QoS 0 ----
+
+static void put_u16(std::string& s, size_t v) { s += (char)(v >> 8); s += (char)(v & 0xFF); }
+
+static void put_str(std::string& s, const char* str) {
+    put_u16(s, strlen(str));
+    s += str;
+}
+
+// Fixed header (type and remaining length) in front of body.
+static std::string mqtt_packet(uint8_t type, const std::string& body) {
+    std::string s(1, (char)type);
+    size_t n = body.size();
+    do {
+        uint8_t b = n % 128;
+        n /= 128;
+        s += (char)(n ? b | 0x80 : b);
+    } while(n);
+    return s + body;
+}
+
+static std::string mqtt_connect(const char* client_id, const char* user, const char* pass) {
+    std::string b;
+    put_str(b, "MQTT");
+    b += (char)4;                                       // protocol level 3.1.1
+    b += (char)(0x02 | (*user ? 0x80 : 0) | (*pass ? 0x40 : 0));    // clean session
+    put_u16(b, 60);                                     // keep-alive, s
+    put_str(b, client_id);
+    if(*user) put_str(b, user);
+    if(*pass) put_str(b, pass);
+    return mqtt_packet(0x10, b);
+}
+
+static std::string mqtt_publish(const char* topic, const uint8_t* payload, size_t n) {
+    std::string b;
+    put_str(b, topic);
+    b.append((const char*)payload, n);
+    return mqtt_packet(0x30, b);
+}
+
+static bool send_all(int fd, const std::string& s) {
+    size_t off = 0;
+    while(off < s.size()) {
+        ssize_t w = send(fd, s.data() + off, s.size() - off, MSG_NOSIGNAL);
+        if(w <= 0) return false;
+        off += (size_t)w;
+    }
+    return true;
+}
+
+static int mqtt_open(const Options& o) {
+    addrinfo hints {}, *res = nullptr;
+    hints.ai_socktype = SOCK_STREAM;
+    if(getaddrinfo(o.host, o.port, &hints, &res) != 0) { fprintf(stderr, "cannot resolve %s\n", o.host); return -1; }
+    int fd = -1;
+    for(addrinfo* a = res; a; a = a->ai_next) {
+        fd = socket(a->ai_family, a->ai_socktype, a->ai_protocol);
+        if(fd >= 0 && connect(fd, a->ai_addr, a->ai_addrlen) == 0) break;
+        if(fd >= 0) close(fd);
+        fd = -1;
+    }
+    freeaddrinfo(res);
+    if(fd < 0) { fprintf(stderr, "cannot connect to %s:%s\n", o.host, o.port); return -1; }
+
+    char client_id[32];
+    snprintf(client_id, sizeof(client_id), "publish_frames-%d", (int)getpid());
+    uint8_t ack[4];
+    if(!send_all(fd, mqtt_connect(client_id, o.user, o.pass)) || recv(fd, ack, 4, MSG_WAITALL) != 4 ||
+       ack[0] != 0x20 || ack[3] != 0) {
+        fprintf(stderr, "broker refused the connection\n");
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// ---- messages ----
+
+// Row i as the payload the firmware reads; false for a row data.py would skip.
+static bool encode_row(const ReplayRow& r, size_t i, bool json, std::vector<uint8_t>& out) {
+    if(json) {
+        std::string s;
+        if(!replay_json_payload(r, s)) return false;
+        out.assign(s.begin(), s.end());
+        return true;
+    }
+    for(int k=0; k<NUM_RAW_INPUTS; k++) if(isnan(r.raw[k]) || r.raw_text[k].empty()) return false;
+    out.resize(sample_frame_size(NUM_RAW_INPUTS));
+    return sample_frame_encode(out.data(), out.size(), (uint32_t)i, replay_epoch(r.time), r.raw, NUM_RAW_INPUTS) > 0;
+}
+
+static int usage() {
+    fprintf(stderr, "usage: publish_frames <dataset.csv> [--json] [--host H] [--port P] [--topic T]\n"
+                    "                      [--user U] [--pass P] [--interval ms] [--batch N] [--dry-run]\n");
+    return 2;
+}
+
+int main(int argc, char** argv) {
+    Options o;
+    for(int i=1; i<argc; i++) {
+        std::string a = argv[i];
+        bool has_value = i + 1 < argc;
+        if(a == "--json") o.json = true;
+        else if(a == "--dry-run") o.dry_run = true;
+        else if(a == "--host" && has_value) o.host = argv[++i];
+        else if(a == "--port" && has_value) o.port = argv[++i];
+        else if(a == "--topic" && has_value) o.topic = argv[++i];
+        else if(a == "--user" && has_value) o.user = argv[++i];
+        else if(a == "--pass" && has_value) o.pass = argv[++i];
+        else if(a == "--interval" && has_value) o.interval_ms = atoi(argv[++i]);
+        else if(a == "--batch" && has_value) o.batch = atoi(argv[++i]);
+        else if(a[0] != '-' && !o.path) o.path = argv[i];
+        else return usage();
+    }
+    if(!o.path || o.batch < 1 || (o.json && o.batch > 1)) return usage();
+    if(!o.topic) o.topic = o.json ? "duy/sensorFault" : "duy/sensorFault/bin";
+
+    std::vector<ReplayRow> rows;
+    if(!replay_load(o.path, rows)) { fprintf(stderr, "cannot read %s\n", o.path); return 1; }
+
+    int fd = -1;
+    if(!o.dry_run && (fd = mqtt_open(o)) < 0) return 1;
+
+    size_t sent = 0, samples = 0, skipped = 0, payload_bytes = 0, wire_bytes = 0;
+    std::vector<uint8_t> payload, row;
+    int in_batch = 0;
+    for(size_t i=0; i<rows.size(); i++) {
+        bool ok = encode_row(rows[i], i, o.json, row);
+        if(ok) { payload.insert(payload.end(), row.begin(), row.end()); in_batch++; }
+        else skipped++;
+        if(in_batch == 0 || (in_batch < o.batch && i + 1 < rows.size())) continue;
+        std::string pkt = mqtt_publish(o.topic, payload.data(), payload.size());
+        if(fd >= 0) {
+            if(!send_all(fd, pkt)) { fprintf(stderr, "connection lost after %zu messages\n", sent); return 1; }
+            if(o.interval_ms > 0) usleep((useconds_t)o.interval_ms * 1000);
+        }
+        sent++;
+        samples += in_batch;
+        payload_bytes += payload.size();
+        wire_bytes += pkt.size();
+        payload.clear();
+        in_batch = 0;
+    }
+    if(fd >= 0) {
+        send_all(fd, mqtt_packet(0xE0, ""));
+        close(fd);
+    }
+
+    printf("%s: %zu samples in %zu messages on %s (%zu rows skipped), %s\n", o.path, samples, sent, o.topic,
+           skipped, o.json ? "JSON" : "sample frames");
+    if(sent) printf("  payload %zu bytes (%.1f / sample), on the wire %zu bytes (%.1f / sample)\n",
+                    payload_bytes, (double)payload_bytes / samples, wire_bytes, (double)wire_bytes / samples);
+    return 0;
+}
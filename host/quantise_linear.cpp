@@ -0,0 +1,264 @@
+// Quantises the LR / SVM models of one variant for linear_q.h and writes the
+// *_q.h header next to the float model. Each input gets a power-of-two shift
+// that leaves room for `headroom` standard deviations around the mean in
+// int32; the headroom is calibrated on replayed training data (the widest one
+// that reproduces the most float labels with int16 weights). The weight scale
+// is the largest that fits int16 / int8. Thresholds fold in the bias, plus the
+// Platt prob >= 0.5 boundary where there is one.
+//
+// Build from the repo root, one binary per folder (HOST_MODEL_LR or _SVM, and
+// the extractor variant):
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_C22 -DHOST_MODEL_LR  -I"esp32_original/src 22 lr"  host/quantise_linear.cpp -o /tmp/q_22_lr
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_RFE -DHOST_MODEL_SVM -I"esp32_original/src new svm" host/quantise_linear.cpp -o /tmp/q_new_svm
+//   (AD_FE/src is a 22 lr build: -DHOST_VARIANT_C22 -DHOST_MODEL_LR -IAD_FE/src)
+// Run:
+//   /tmp/q_22_lr train.csv > "esp32_original/src 22 lr/model_edge_q.h"
+#include "replay.h"
+
+#if defined(HOST_VARIANT_RFE)
+#include "rfe_settings.h"
+#include "model_edge_dual.h"
+#include "rfe_features.h"
+#elif defined(HOST_VARIANT_C22)
+#include "catch22_settings.h"
+#include "model_edge.h"
+#include "catch22_features.h"
+#elif defined(HOST_VARIANT_HJ)
+#include "hjorth_settings.h"
+#include "model_edge.h"
+#include "hjorth_features.h"
+#elif defined(HOST_VARIANT_TS)
+#include "tsassure_settings.h"
+#include "model_edge.h"
+#include "tsassure_features.h"
+#else
+#error "define one of HOST_VARIANT_RFE / _C22 / _HJ / _TS"
+#endif
+#include "linear_q.h"
+
+// SCORE_PROB: sigmoid(decision) (LR); SCORE_PLATT: 1 / (1 + exp(A d + B));
+// SCORE_DECISION: the decision itself.
+enum ScoreKind { SCORE_PROB, SCORE_PLATT, SCORE_DECISION };
+
+struct FloatModel {
+    const char* prefix;
+    int n;
+    const float* mean; const float* std; const float* coef;
+    float bias;
+    ScoreKind score;
+    float prob_a, prob_b;
+};
+
+#if defined(HOST_VARIANT_RFE) && defined(HOST_MODEL_LR)
+static const FloatModel models[] = {
+    { "LR_COLD", LR_COLD_N_FEATURES, LR_COLD_SCALE_MEAN, LR_COLD_SCALE_STD, LR_COLD_COEF, LR_COLD_BIAS, SCORE_PROB, 0, 0 },
+    { "LR_WARM", LR_WARM_N_FEATURES, LR_WARM_SCALE_MEAN, LR_WARM_SCALE_STD, LR_WARM_COEF, LR_WARM_BIAS, SCORE_PROB, 0, 0 },
+};
+#elif defined(HOST_VARIANT_RFE) && defined(HOST_MODEL_SVM)
+static const FloatModel models[] = {
+    { "SVM_COLD", SVM_COLD_N_FEATURES, SVM_COLD_SCALE_MEAN, SVM_COLD_SCALE_STD, SVM_COLD_COEF, SVM_COLD_BIAS,
+      SCORE_PLATT, SVM_COLD_PROB_A, SVM_COLD_PROB_B },
+    { "SVM_WARM", SVM_WARM_N_FEATURES, SVM_WARM_SCALE_MEAN, SVM_WARM_SCALE_STD, SVM_WARM_COEF, SVM_WARM_BIAS,
+      SCORE_PLATT, SVM_WARM_PROB_A, SVM_WARM_PROB_B },
+};
+#elif defined(HOST_MODEL_LR)
+static const FloatModel models[] = {
+    { "LR", LR_N_FEATURES, LR_SCALE_MEAN, LR_SCALE_STD, LR_COEF, LR_BIAS, SCORE_PROB, 0, 0 },
+};
+#elif defined(HOST_MODEL_SVM) && defined(HOST_VARIANT_TS)
+static const FloatModel models[] = {
+    { "SVM", SVM_N_FEATURES, SVM_SCALE_MEAN, SVM_SCALE_STD, SVM_COEF, SVM_BIAS, SCORE_PLATT, SVM_PROB_A, SVM_PROB_B },
+};
+#elif defined(HOST_MODEL_SVM)
+static const FloatModel models[] = {
+    { "SVM", SVM_N_FEATURES, SVM_SCALE_MEAN, SVM_SCALE_STD, SVM_COEF, SVM_BIAS, SCORE_DECISION, 0, 0 },
+};
+#else
+#error "define HOST_MODEL_LR or HOST_MODEL_SVM"
+#endif
+static const int n_models = sizeof(models) / sizeof(models[0]);
+
+// Reference label, as infer.h computes it.
+static int float_label(const FloatModel& m, const float* x) {
+    float d = 0.0f;
+    for(int i=0; i<m.n; i++) {
+        float s = m.std[i];
+        if(s < 1e-9f) s = 1.0f;
+        d += (x[i] - m.mean[i]) / s * m.coef[i];
+    }
+    d += m.bias;
+    if(m.score == SCORE_PROB) return (1.0f / (1.0f + expf(-d)) >= 0.5f) ? 1 : 0;
+    if(m.score == SCORE_PLATT) return (1.0f / (1.0f + expf(m.prob_a * d + m.prob_b)) >= 0.5f) ? 1 : 0;
+    return (d >= 0.0f) ? 1 : 0;
+}
+
+// Per-input shifts and fixed-point means, shared by both weight widths.
+struct Inputs {
+    int headroom_log2 = 0;
+    std::vector<int8_t> shift;
+    std::vector<int32_t> mean_q;
+};
+
+// Quantised parameters for one weight width.
+template<typename W>
+struct Quant {
+    int acc_frac = 0;
+    std::vector<W> coef;
+    int64_t threshold = 0;
+    int polarity = 1;
+    int32_t score_mul = 0;
+    LinearQ<W> view(const FloatModel& m, const Inputs& in) const {
+        return { m.n, in.shift.data(), in.mean_q.data(), coef.data(), acc_frac, threshold, polarity, score_mul };
+    }
+};
+
+static float clamped_std(float s) { return (s < 1e-9f) ? 1.0f : s; }
+
+// shift_i: the largest with (|mean_i| + 2^headroom_log2 * std_i) * 2^shift_i
+// <= 2^29, so fix(x) - mean_q stays inside int32.
+static Inputs make_inputs(const FloatModel& m, int headroom_log2) {
+    Inputs in;
+    in.headroom_log2 = headroom_log2;
+    for(int i=0; i<m.n; i++) {
+        double span = std::fabs((double)m.mean[i]) + std::ldexp((double)clamped_std(m.std[i]), headroom_log2);
+        int sh = (int)std::floor(29.0 - std::log2(span));
+        sh = std::max(-100, std::min(100, sh));
+        in.shift.push_back((int8_t)sh);
+        in.mean_q.push_back((int32_t)std::llround(std::ldexp((double)m.mean[i], sh)));
+    }
+    return in;
+}
+
+// Boundary in decision units: label 1 when decision >= boundary (or <= for
+// a Platt slope A > 0).
+static double boundary(const FloatModel& m) {
+    if(m.score == SCORE_PLATT) return -(double)m.prob_b / m.prob_a;
+    return 0.0;
+}
+
+template<typename W>
+static bool quantise(const FloatModel& m, const Inputs& in, int w_max, Quant<W>& q) {
+    // w_i = coef_i / std_i * 2^(acc_frac - shift_i); the largest acc_frac that fits W
+    double max_w = 0.0;
+    for(int i=0; i<m.n; i++)
+        max_w = std::max(max_w, std::fabs(m.coef[i] / clamped_std(m.std[i]) * std::ldexp(1.0, -in.shift[i])));
+    if(max_w == 0.0) return false;
+    int acc_frac = (int)std::floor(std::log2(w_max / max_w));
+    acc_frac = std::min(acc_frac, 40);
+    q.acc_frac = acc_frac;
+    q.coef.resize(m.n);
+    for(int i=0; i<m.n; i++)
+        q.coef[i] = (W)std::lround(m.coef[i] / clamped_std(m.std[i]) * std::ldexp(1.0, acc_frac - in.shift[i]));
+    double t = boundary(m) - m.bias;   // sum(coef * z) >= t
+    q.threshold = (int64_t)std::llround(t * std::ldexp(1.0, acc_frac));
+    q.polarity = (m.score == SCORE_PLATT && m.prob_a > 0) ? -1 : 1;
+    if(m.score == SCORE_PROB) q.score_mul = 65536;
+    else if(m.score == SCORE_PLATT) q.score_mul = (int32_t)std::lround(-m.prob_a * 65536.0);
+    else q.score_mul = 0;
+    return true;
+}
+
+template<typename W>
+static int agreement(const FloatModel& m, const Inputs& in, const Quant<W>& q,
+                     const std::vector<std::vector<float>>& feats) {
+    LinearQ<W> lq = q.view(m, in);
+    int agree = 0;
+    for(const auto& f : feats) agree += (predict_linear_q(f.data(), lq, nullptr) == float_label(m, f.data()));
+    return agree;
+}
+
+// Headroom 2^8 .. 2^20 std with the best int16 agreement; ties go to the
+// larger headroom, since the calibration set rarely has the far outliers.
+static Inputs calibrate(const FloatModel& m, const std::vector<std::vector<float>>& feats, int& agree) {
+    Inputs best;
+    agree = -1;
+    for(int h=8; h<=20; h++) {
+        Inputs in = make_inputs(m, h);
+        Quant<int16_t> q;
+        if(!quantise(m, in, 32767, q)) continue;
+        int a = agreement(m, in, q, feats);
+        if(a >= agree) { agree = a; best = in; }
+    }
+    return best;
+}
+
+static void replay(const std::vector<ReplayRow>& rows, std::vector<std::vector<float>> feats[2]) {
+    for(size_t i=0; i<rows.size(); i++) {
+        float raw[NUM_RAW_INPUTS];
+        for(int k=0; k<NUM_RAW_INPUTS; k++) raw[k] = rows[i].raw[k];
+        if(isnan(raw[0])) continue;
+#if defined(HOST_VARIANT_RFE)
+        // Cold features for every row, so the cold model is calibrated on more
+        // than the 14 warm-up samples.
+        update_state(raw, 1 + (uint32_t)(i / 4));
+        std::vector<float> f(N_FEATURES_WARM);
+        extract_features_generic(raw, FEATURE_SPECS_COLD, N_FEATURES_COLD, f.data());
+        feats[0].push_back(std::vector<float>(f.begin(), f.begin() + N_FEATURES_COLD));
+        if(sample_count >= WARMUP_PERIOD) {
+            extract_features_generic(raw, FEATURE_SPECS_WARM, N_FEATURES_WARM, f.data());
+            feats[1].push_back(f);
+        }
+#else
+        std::vector<float> f(models[0].n);
+#if defined(HOST_VARIANT_C22)
+        extract_catch22_features(raw, f.data());
+#elif defined(HOST_VARIANT_HJ)
+        extract_hjorth_features(raw, f.data());
+#else
+        extract_tsassure_features(raw, f.data());
+#endif
+        feats[0].push_back(f);
+#endif
+    }
+}
+
+template<typename T>
+static void print_ints(const char* type, const char* name, const std::vector<T>& v) {
+    printf("static const %s %s[] = { ", type, name);
+    for(size_t i=0; i<v.size(); i++) printf("%d%s", (int)v[i], (i + 1 < v.size()) ? ", " : " };\n");
+}
+
+template<typename W>
+static void print_width(const char* prefix, int bits, const Quant<W>& q) {
+    char name[64], type[16];
+    printf("#define %s_Q%d_ACC_FRAC %d\n", prefix, bits, q.acc_frac);
+    snprintf(name, sizeof(name), "%s_Q%d_COEF", prefix, bits);
+    snprintf(type, sizeof(type), "int%d_t", bits);
+    print_ints(type, name, q.coef);
+    printf("static const int64_t %s_Q%d_THRESHOLD = %lldLL;\n", prefix, bits, (long long)q.threshold);
+}
+
+int main(int argc, char** argv) {
+    if(argc < 2) { fprintf(stderr, "usage: %s calibration.csv > model_edge_q.h\n", argv[0]); return 1; }
+    std::vector<ReplayRow> rows;
+    if(!replay_load(argv[1], rows)) { fprintf(stderr, "cannot read %s\n", argv[1]); return 1; }
+    std::vector<std::vector<float>> feats[2];
+    replay(rows, feats);
+
+    printf("#pragma once\n#include <stdint.h>\n");
+    printf("// Generated by host/quantise_linear.cpp; parameters for linear_q.h.\n");
+    for(int k=0; k<n_models; k++) {
+        const FloatModel& m = models[k];
+        int a16;
+        Inputs in = calibrate(m, feats[k], a16);
+        Quant<int16_t> q16;
+        Quant<int8_t> q8;
+        quantise(m, in, 32767, q16);
+        quantise(m, in, 127, q8);
+        fprintf(stderr, "%s: %zu calibration samples, headroom 2^%d std, int16 agree %d (acc_frac %d), int8 agree %d (acc_frac %d)\n",
+                m.prefix, feats[k].size(), in.headroom_log2, a16, q16.acc_frac,
+                agreement(m, in, q8, feats[k]), q8.acc_frac);
+
+        printf("\n// ===== %s: inputs have room for 2^%d std =====\n", m.prefix, in.headroom_log2);
+        char name[64];
+        snprintf(name, sizeof(name), "%s_Q_SHIFT", m.prefix);
+        print_ints("int8_t", name, in.shift);
+        snprintf(name, sizeof(name), "%s_Q_MEAN", m.prefix);
+        print_ints("int32_t", name, in.mean_q);
+        printf("#define %s_Q_POLARITY %d\n", m.prefix, q16.polarity);
+        printf("#define %s_Q_SCORE_MUL %d\n", m.prefix, (int)q16.score_mul);
+        print_width(m.prefix, 16, q16);
+        print_width(m.prefix, 8, q8);
+    }
+    return 0;
+}
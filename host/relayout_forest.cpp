@@ -0,0 +1,293 @@
+// Profile-guided node layout for the dual forests of "src new rf".
+// Replays training traffic through predict_cold / predict_warm built with
+// -DRF_PROFILE=1 to count node hits. It then renumbers the nodes of every tree
+// so that the hotter child of each node is stored right after it, and the
+// hottest root-to-leaf chains come first.
+// Tree roots and offsets do not move; only the order inside each tree changes,
+// so the rewritten model_edge_dual.h gives bit-identical scores.
+//
+// Build from the repo root:
+//   g++ -O2 -std=c++17 -DRF_PROFILE=1 -I"esp32_original/src new rf" host/relayout_forest.cpp -o /tmp/relayout
+// Run:
+//   /tmp/relayout [--profile train.csv]... [--bench dataset.csv] [--write "esp32_original/src new rf/model_edge_dual.h"]
+// Without --profile, dataset/Test-set_1.csv is used for both. --write replaces the
+// FEATURE / THRESHOLD / LEFT / RIGHT / PROB1 lines of the header in place.
+#include "replay.h"
+#include <algorithm>
+#include <fstream>
+#include <queue>
+#include <sstream>
+#include "rfe_settings.h"
+#include "infer.h"
+#include "rfe_features.h"
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#if !RF_PROFILE
+#error "build with -DRF_PROFILE=1"
+#endif
+
+static uint64_t now_cycles() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return replay_now_ns();
+#endif
+}
+
+struct Forest {
+    const char* name;
+    int n_trees, n_nodes, n_features;
+    const float* mean; const float* std;
+    const int* offsets; const int* feat; const float* thr;
+    const int* left; const int* right; const float* prob;
+    uint32_t* hits;
+};
+
+static Forest forests[2] = {
+    { "RF_COLD", RF_COLD_N_TREES, RF_COLD_N_NODES, RF_COLD_N_FEATURES, RF_COLD_SCALE_MEAN, RF_COLD_SCALE_STD,
+      RF_COLD_TREE_OFFSETS, RF_COLD_FEATURE, RF_COLD_THRESHOLD, RF_COLD_LEFT, RF_COLD_RIGHT, RF_COLD_PROB1,
+      rf_cold_hits },
+    { "RF_WARM", RF_WARM_N_TREES, RF_WARM_N_NODES, RF_WARM_N_FEATURES, RF_WARM_SCALE_MEAN, RF_WARM_SCALE_STD,
+      RF_WARM_TREE_OFFSETS, RF_WARM_FEATURE, RF_WARM_THRESHOLD, RF_WARM_LEFT, RF_WARM_RIGHT, RF_WARM_PROB1,
+      rf_warm_hits },
+};
+
+// Same arrays after renumbering; pos[old] is the new index of node old.
+struct Layout {
+    std::vector<int> pos, feat, left, right;
+    std::vector<float> thr, prob;
+};
+
+// Cold features for every row, warm features once warm-up is over, as the
+// firmware would compute them.
+static void extract(const std::vector<ReplayRow>& rows, std::vector<float> feats[2]) {
+    for(size_t i=0; i<rows.size(); i++) {
+        float raw[NUM_RAW_INPUTS];
+        for(int k=0; k<NUM_RAW_INPUTS; k++) raw[k] = rows[i].raw[k];
+        if(isnan(raw[0])) continue;
+        update_state(raw, 1 + (uint32_t)(i / 4));
+        float f[N_FEATURES_WARM];
+        extract_features_generic(raw, FEATURE_SPECS_COLD, N_FEATURES_COLD, f);
+        feats[0].insert(feats[0].end(), f, f + N_FEATURES_COLD);
+        if(sample_count >= WARMUP_PERIOD) {
+            extract_features_generic(raw, FEATURE_SPECS_WARM, N_FEATURES_WARM, f);
+            feats[1].insert(feats[1].end(), f, f + N_FEATURES_WARM);
+        }
+    }
+}
+
+// Chains first: follow the hotter child from a subtree root down to a leaf,
+// queue each colder sibling, then continue with the hottest queued subtree.
+static Layout relayout(const Forest& fr) {
+    Layout lay;
+    lay.pos.assign(fr.n_nodes, -1);
+    int next = 0;
+    for(int t=0; t<fr.n_trees; t++) {
+        auto colder = [&](int a, int b) { return fr.hits[a] != fr.hits[b] ? fr.hits[a] < fr.hits[b] : a > b; };
+        std::priority_queue<int, std::vector<int>, decltype(colder)> pending(colder);
+        pending.push(fr.offsets[t]);
+        while(!pending.empty()) {
+            int n = pending.top(); pending.pop();
+            while(true) {
+                lay.pos[n] = next++;
+                if(fr.left[n] == -1) break;
+                int l = fr.left[n], r = fr.right[n];
+                int hot = (fr.hits[r] > fr.hits[l]) ? r : l;
+                pending.push(hot == l ? r : l);
+                n = hot;
+            }
+        }
+    }
+    lay.feat.resize(fr.n_nodes); lay.thr.resize(fr.n_nodes); lay.prob.resize(fr.n_nodes);
+    lay.left.resize(fr.n_nodes); lay.right.resize(fr.n_nodes);
+    for(int o=0; o<fr.n_nodes; o++) {
+        int n = lay.pos[o];
+        lay.feat[n] = fr.feat[o]; lay.thr[n] = fr.thr[o]; lay.prob[n] = fr.prob[o];
+        lay.left[n] = (fr.left[o] == -1) ? -1 : lay.pos[fr.left[o]];
+        lay.right[n] = (fr.right[o] == -1) ? -1 : lay.pos[fr.right[o]];
+    }
+    return lay;
+}
+
+// Per sample: nodes visited, steps that land on the next node in memory, and
+// 64-byte lines of the threshold array touched.
+struct PathStats { double nodes, fall_through, lines; };
+
+static PathStats path_stats(const Forest& fr, const int* feat, const float* thr, const int* left,
+                            const int* right, const std::vector<float>& feats)
+{
+    int n = (int)(feats.size() / fr.n_features);
+    std::vector<float> z(fr.n_features);
+    long nodes = 0, fall = 0, lines = 0;
+    for(int s=0; s<n; s++) {
+        const float* x = &feats[(size_t)s * fr.n_features];
+        for(int i=0; i<fr.n_features; i++) {
+            float sd = fr.std[i];
+            if(sd < 1e-9f) sd = 1.0f;
+            z[i] = (x[i] - fr.mean[i]) / sd;
+        }
+        for(int t=0; t<fr.n_trees; t++) {
+            int idx = fr.offsets[t], line = -1;
+            while(true) {
+                nodes++;
+                if(idx / 16 != line) { lines++; line = idx / 16; }
+                if(left[idx] == -1) break;
+                int nxt = (z[feat[idx]] <= thr[idx]) ? left[idx] : right[idx];
+                fall += (nxt == idx + 1);
+                idx = nxt;
+            }
+        }
+    }
+    return { (double)nodes / n, (double)fall / n, (double)lines / n };
+}
+
+// Best of several alternating rounds, so both layouts see the same machine state.
+static void time_layouts(const Forest& fr, const Layout& lay, const std::vector<float>& feats,
+                         double& before, double& after)
+{
+    int n = (int)(feats.size() / fr.n_features);
+    before = after = 1e30;
+    for(int round=0; round<15; round++) {
+        uint64_t t0 = now_cycles();
+        for(int s=0; s<n; s++)
+            predict_rf_generic(&feats[(size_t)s * fr.n_features], nullptr, fr.n_features, fr.n_trees, fr.mean, fr.std,
+                               fr.offsets, fr.feat, fr.thr, fr.left, fr.right, fr.prob);
+        uint64_t t1 = now_cycles();
+        for(int s=0; s<n; s++)
+            predict_rf_generic(&feats[(size_t)s * fr.n_features], nullptr, fr.n_features, fr.n_trees, fr.mean, fr.std,
+                               fr.offsets, lay.feat.data(), lay.thr.data(), lay.left.data(), lay.right.data(), lay.prob.data());
+        uint64_t t2 = now_cycles();
+        before = std::min(before, (double)(t1 - t0) / n);
+        after = std::min(after, (double)(t2 - t1) / n);
+    }
+}
+
+static int mismatches(const Forest& fr, const Layout& lay, const std::vector<float>& feats) {
+    int n = (int)(feats.size() / fr.n_features), bad = 0;
+    for(int s=0; s<n; s++) {
+        const float* x = &feats[(size_t)s * fr.n_features];
+        float a, b;
+        int la = predict_rf_generic(x, &a, fr.n_features, fr.n_trees, fr.mean, fr.std,
+                                    fr.offsets, fr.feat, fr.thr, fr.left, fr.right, fr.prob);
+        int lb = predict_rf_generic(x, &b, fr.n_features, fr.n_trees, fr.mean, fr.std,
+                                    fr.offsets, lay.feat.data(), lay.thr.data(), lay.left.data(), lay.right.data(), lay.prob.data());
+        bad += (la != lb || a != b);
+    }
+    return bad;
+}
+
+// Splits "static const T NAME[] = { a, b, ... };" into its literal tokens.
+static bool split_array(const std::string& line, std::string& head, std::vector<std::string>& tok) {
+    size_t lb = line.find('{'), rb = line.rfind('}');
+    if(lb == std::string::npos || rb == std::string::npos) return false;
+    head = line.substr(0, lb + 1);
+    std::stringstream ss(line.substr(lb + 1, rb - lb - 1));
+    std::string item;
+    tok.clear();
+    while(std::getline(ss, item, ',')) {
+        size_t a = item.find_first_not_of(" \t"), b = item.find_last_not_of(" \t");
+        if(a != std::string::npos) tok.push_back(item.substr(a, b - a + 1));
+    }
+    return true;
+}
+
+static std::string join_array(const std::string& head, const std::vector<std::string>& tok) {
+    std::string out = head + " ";
+    for(size_t i=0; i<tok.size(); i++) out += tok[i] + ((i + 1 < tok.size()) ? ", " : " };");
+    return out;
+}
+
+// Permutes the literals as written, so thresholds keep their exported digits.
+static bool write_header(const char* path, const Layout lays[2]) {
+    std::ifstream in(path);
+    if(!in) return false;
+    std::vector<std::string> lines;
+    for(std::string l; std::getline(in, l); ) lines.push_back(l);
+    in.close();
+
+    static const char* arrays[] = { "FEATURE", "THRESHOLD", "LEFT", "RIGHT", "PROB1" };
+    int replaced = 0;
+    for(std::string& line : lines) {
+        for(int f=0; f<2; f++) {
+            for(const char* a : arrays) {
+                std::string decl = std::string(forests[f].name) + "_" + a + "[]";
+                if(line.find(decl) == std::string::npos) continue;
+                std::string head;
+                std::vector<std::string> tok;
+                if(!split_array(line, head, tok) || (int)tok.size() != forests[f].n_nodes) {
+                    fprintf(stderr, "%s: unexpected %s\n", path, decl.c_str());
+                    return false;
+                }
+                std::vector<std::string> out(tok.size());
+                for(size_t o=0; o<tok.size(); o++) out[lays[f].pos[o]] = tok[o];
+                if(strcmp(a, "LEFT") == 0 || strcmp(a, "RIGHT") == 0) {
+                    const std::vector<int>& v = (strcmp(a, "LEFT") == 0) ? lays[f].left : lays[f].right;
+                    for(size_t i=0; i<out.size(); i++) out[i] = std::to_string(v[i]);
+                }
+                line = join_array(head, out);
+                replaced++;
+            }
+        }
+    }
+    if(replaced != 10) { fprintf(stderr, "%s: found %d of 10 node arrays\n", path, replaced); return false; }
+    std::ofstream out(path);
+    for(const std::string& l : lines) out << l << "\n";
+    return true;
+}
+
+int main(int argc, char** argv) {
+    std::vector<const char*> profile_paths;
+    const char* bench_path = "dataset/Test-set_1.csv";
+    const char* write_path = nullptr;
+    for(int i=1; i<argc; i++) {
+        if(strcmp(argv[i], "--profile") == 0 && i + 1 < argc) profile_paths.push_back(argv[++i]);
+        else if(strcmp(argv[i], "--bench") == 0 && i + 1 < argc) bench_path = argv[++i];
+        else if(strcmp(argv[i], "--write") == 0 && i + 1 < argc) write_path = argv[++i];
+        else { fprintf(stderr, "unknown argument %s\n", argv[i]); return 1; }
+    }
+    if(profile_paths.empty()) profile_paths.push_back(bench_path);
+
+    // Profile through the firmware entry points.
+    for(const char* p : profile_paths) {
+        std::vector<ReplayRow> rows;
+        if(!replay_load(p, rows)) { fprintf(stderr, "cannot read %s\n", p); return 1; }
+        std::vector<float> feats[2];
+        extract(rows, feats);
+        for(size_t s=0; s<feats[0].size() / N_FEATURES_COLD; s++) predict_cold(&feats[0][s * N_FEATURES_COLD], nullptr);
+        for(size_t s=0; s<feats[1].size() / N_FEATURES_WARM; s++) predict_warm(&feats[1][s * N_FEATURES_WARM], nullptr);
+        printf("profiled %s: %zu cold, %zu warm samples\n", p,
+               feats[0].size() / N_FEATURES_COLD, feats[1].size() / N_FEATURES_WARM);
+    }
+    rf_profile_hits = nullptr;
+
+    Layout lays[2] = { relayout(forests[0]), relayout(forests[1]) };
+
+    std::vector<ReplayRow> rows;
+    if(!replay_load(bench_path, rows)) { fprintf(stderr, "cannot read %s\n", bench_path); return 1; }
+    std::vector<float> feats[2];
+    extract(rows, feats);
+    printf("bench: %s\n", bench_path);
+    for(int f=0; f<2; f++) {
+        const Forest& fr = forests[f];
+        const Layout& lay = lays[f];
+        PathStats a = path_stats(fr, fr.feat, fr.thr, fr.left, fr.right, feats[f]);
+        PathStats b = path_stats(fr, lay.feat.data(), lay.thr.data(), lay.left.data(), lay.right.data(), feats[f]);
+        double before, after;
+        time_layouts(fr, lay, feats[f], before, after);
+        printf("\n%s: %d nodes, %zu samples, %.1f nodes visited per sample\n",
+               fr.name, fr.n_nodes, feats[f].size() / fr.n_features, a.nodes);
+        printf("  %-10s %14s %16s %18s\n", "layout", "fall-through", "64B lines/sample", "cycles/prediction");
+        printf("  %-10s %13.1f%% %16.1f %18.0f\n", "current", 100.0 * a.fall_through / a.nodes, a.lines, before);
+        printf("  %-10s %13.1f%% %16.1f %18.0f  (%+.1f%%)\n", "hot-first", 100.0 * b.fall_through / b.nodes, b.lines,
+               after, 100.0 * (after - before) / before);
+        printf("  mismatching label/score: %d\n", mismatches(fr, lay, feats[f]));
+    }
+
+    if(write_path) {
+        if(!write_header(write_path, lays)) return 1;
+        printf("\nwrote %s\n", write_path);
+    }
+    return 0;
+}
@@ -0,0 +1,133 @@
+#pragma once
+// Host-side replay helpers for the firmware sources under esp32_original/.
+// Include this BEFORE a variant's headers: it provides the unqualified math
+// helpers Arduino.h normally exposes.
+#include <stdint.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <chrono>
+#include <string>
+#include <vector>
+
+using std::abs;
+using std::isnan;
+
+// One dataset row, raw[] in the firmware's IDX_* order
+// (Temperature, Humidity, Temperature_WeatherStation, Humidity_WeatherStation).
+struct ReplayRow {
+    std::string time;
+    float raw[4];
+    std::string raw_text[4];    // the CSV cells raw[] was read from
+    int label;   // -1 when the CSV has no Label column
+};
+
+static std::vector<std::string> replay_split(const std::string& line) {
+    std::vector<std::string> out;
+    std::string cur;
+    for(char c : line) {
+        if(c == ',') { out.push_back(cur); cur.clear(); }
+        else if(c != '\r' && c != '\n') cur += c;
+    }
+    out.push_back(cur);
+    return out;
+}
+
+// Loads a dataset CSV (dataset/Test-set_1.csv layout; an optional Label column
+// is picked up when present). Returns false if the file cannot be read.
+bool replay_load(const char* path, std::vector<ReplayRow>& rows) {
+    FILE* f = fopen(path, "r");
+    if(!f) return false;
+
+    static const char* names[4] = { "Temperature", "Humidity", "Temperature_WeatherStation", "Humidity_WeatherStation" };
+    int col[4] = { -1, -1, -1, -1 };
+    int col_time = -1, col_label = -1;
+
+    char buf[512];
+    bool header = true;
+    while(fgets(buf, sizeof(buf), f)) {
+        std::string line(buf);
+        if(header && line.compare(0, 3, "\xEF\xBB\xBF") == 0) line = line.substr(3);
+        std::vector<std::string> cells = replay_split(line);
+        if(header) {
+            for(size_t i=0; i<cells.size(); i++) {
+                if(cells[i] == "Time") col_time = (int)i;
+                if(cells[i] == "Label") col_label = (int)i;
+                for(int k=0; k<4; k++) if(cells[i] == names[k]) col[k] = (int)i;
+            }
+            header = false;
+            continue;
+        }
+        if(cells.size() < 5) continue;
+        ReplayRow r;
+        r.time = (col_time >= 0) ? cells[col_time] : "";
+        for(int k=0; k<4; k++) {
+            r.raw_text[k] = (col[k] >= 0) ? cells[col[k]] : "";
+            r.raw[k] = (col[k] >= 0) ? strtof(cells[col[k]].c_str(), nullptr) : NAN;
+        }
+        r.label = (col_label >= 0) ? atoi(cells[col_label].c_str()) : -1;
+        rows.push_back(r);
+    }
+    fclose(f);
+    return true;
+}
+
+inline uint64_t replay_now_ns() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Python's repr() of float(text), the way json.dumps writes it: the shortest
+// digits that read back to the same double, ".0" on integers. Exponent
+// placement follows %g, which matches Python for the sensor ranges.
+inline std::string replay_py_float(const std::string& text) {
+    double v = strtod(text.c_str(), nullptr);
+    char buf[40];
+    for(int prec=1; prec<=17; prec++) {
+        snprintf(buf, sizeof(buf), "%.*g", prec, v);
+        if(strtod(buf, nullptr) == v) break;
+    }
+    std::string s = buf;
+    if(s.find_first_of(".eni") == std::string::npos) s += ".0";
+    return s;
+}
+
+// A row as data.py publishes it, or false for a row data.py skips (a
+// channel that is not a number).
+inline bool replay_json_payload(const ReplayRow& r, std::string& out) {
+    static const char* keys[4] = { "Temperature", "Humidity", "Humidity_WeatherStation",
+                                   "Temperature_WeatherStation" };
+    static const int idx[4] = { 0, 1, 3, 2 };    // data.py order -> raw[] order
+    out = "{\"Time\": \"" + r.time + "\"";
+    for(int k=0; k<4; k++) {
+        const std::string& text = r.raw_text[idx[k]];
+        char* end;
+        strtod(text.c_str(), &end);
+        if(text.empty() || *end != '\0') return false;
+        out += std::string(", \"") + keys[k] + "\": " + replay_py_float(text);
+    }
+    out += "}";
+    return true;
+}
+
+// Seconds since 1970 of a dataset Time cell: "dd/mm/yyyy HH:MM[:SS]" (as in
+// dataset/Test-set_1.csv) or an Excel serial day (the .xlsx exports), both
+// read as UTC. 0 when it is neither.
+inline uint32_t replay_epoch(const std::string& time) {
+    int d, m, y, hh = 0, mm = 0, ss = 0;
+    if(sscanf(time.c_str(), "%d/%d/%d %d:%d:%d", &d, &m, &y, &hh, &mm, &ss) >= 3) {
+        // days_from_civil (H. Hinnant)
+        y -= (m <= 2);
+        int era = (y >= 0 ? y : y - 399) / 400;
+        unsigned yoe = (unsigned)(y - era * 400);
+        unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+        unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+        long days = (long)era * 146097 + (long)doe - 719468;
+        return (uint32_t)(days * 86400 + hh * 3600 + mm * 60 + ss);
+    }
+    char* end;
+    double serial = strtod(time.c_str(), &end);
+    if(end != time.c_str() && serial > 25569.0) return (uint32_t)llround((serial - 25569.0) * 86400.0);
+    return 0;
+}
@@ -0,0 +1,192 @@
+// Which feature indices each forest actually splits on. For the dual RFE
+// variant it also writes rfe_used_features.h: the warm/cold spec lists, scaling
+// tables and node feature indices cut down to the used features. It then
+// times the full and the reduced pipeline on the replayed dataset.
+//
+// Build from the repo root, one binary per variant:
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_RFE -I"esp32_original/src new rf" host/used_features.cpp -o /tmp/used_new
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_C22 -I"esp32_original/src 22 rf"  host/used_features.cpp -o /tmp/used_22
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_HJ  -I"esp32_original/src hj rf"  host/used_features.cpp -o /tmp/used_hj
+//   g++ -O2 -std=c++17 -DHOST_VARIANT_TS  -I"esp32_original/src ts rf"  host/used_features.cpp -o /tmp/used_ts
+// Run:
+//   /tmp/used_new [dataset.csv] [--emit "esp32_original/src new rf/rfe_used_features.h"]
+//   /tmp/used_22
+#include "replay.h"
+#include <algorithm>
+
+#if defined(HOST_VARIANT_RFE)
+#include "rfe_settings.h"
+#include "infer.h"
+#include "rfe_features.h"
+#elif defined(HOST_VARIANT_C22) || defined(HOST_VARIANT_HJ) || defined(HOST_VARIANT_TS)
+#include "model_edge.h"
+#else
+#error "define one of HOST_VARIANT_RFE / _C22 / _HJ / _TS"
+#endif
+
+struct Usage {
+    const char* name;
+    int n_features, n_nodes;
+    const int* feat;
+    std::vector<int> used;   // original indices, ascending
+    std::vector<int> remap;  // original index -> reduced index, -1 if unused
+};
+
+static Usage analyse(const char* name, int n_features, int n_nodes, const int* feat) {
+    Usage u { name, n_features, n_nodes, feat, {}, std::vector<int>(n_features, -1) };
+    std::vector<char> hit(n_features, 0);
+    for(int i=0; i<n_nodes; i++) if(feat[i] >= 0) hit[feat[i]] = 1;
+    for(int f=0; f<n_features; f++) if(hit[f]) { u.remap[f] = (int)u.used.size(); u.used.push_back(f); }
+    return u;
+}
+
+static void report(const Usage& u) {
+    printf("%s: %d of %d features used, %d removed", u.name, (int)u.used.size(), u.n_features,
+           u.n_features - (int)u.used.size());
+    const char* sep = " (";
+    for(int f=0; f<u.n_features; f++) if(u.remap[f] < 0) { printf("%s%d", sep, f); sep = ", "; }
+    printf("%s\n", (sep[0] == ',') ? ")" : "");
+}
+
+#if defined(HOST_VARIANT_RFE)
+static void emit_floats(FILE* out, const char* name, const float* v, const Usage& u) {
+    fprintf(out, "static const float %s[] = { ", name);
+    for(size_t i=0; i<u.used.size(); i++) fprintf(out, "%.9g%s", v[u.used[i]], (i + 1 < u.used.size()) ? ", " : " };\n");
+}
+
+// prefix: RF_COLD / RF_WARM. Forests that use every feature get aliases only.
+static void emit_forest(FILE* out, const char* prefix, const Usage& u, const char* specs,
+                        const FeatureSpec* spec, const float* mean, const float* sd)
+{
+    fprintf(out, "\n// ===== %s: %d of %d features =====\n", prefix, (int)u.used.size(), u.n_features);
+    if((int)u.used.size() == u.n_features) {
+        fprintf(out, "#define %s_N_USED %s_N_FEATURES\n", prefix, prefix);
+        fprintf(out, "#define %s_USED_SPECS %s\n", prefix, specs);
+        fprintf(out, "#define %s_USED_SCALE_MEAN %s_SCALE_MEAN\n", prefix, prefix);
+        fprintf(out, "#define %s_USED_SCALE_STD %s_SCALE_STD\n", prefix, prefix);
+        fprintf(out, "#define %s_USED_FEATURE %s_FEATURE\n", prefix, prefix);
+        return;
+    }
+    fprintf(out, "#define %s_N_USED %d\n", prefix, (int)u.used.size());
+    fprintf(out, "static const FeatureSpec %s_USED_SPECS[] = {\n", prefix);
+    for(int f : u.used) {
+        const FeatureSpec& s = spec[f];
+        fprintf(out, "  { %s, %d, %d, %d, %d, %d }, // %s[%d]\n",
+                s.kind == FEAT_RAW ? "FEAT_RAW" : s.kind == FEAT_DIFF ? "FEAT_DIFF" :
+                s.kind == FEAT_ROLL_RAW ? "FEAT_ROLL_RAW" : s.kind == FEAT_ROLL_DIFF ? "FEAT_ROLL_DIFF" :
+                s.kind == FEAT_LAG ? "FEAT_LAG" : s.kind == FEAT_EWMA ? "FEAT_EWMA" :
+                s.kind == FEAT_INTER ? "FEAT_INTER" : s.kind == FEAT_ROLL_TD ? "FEAT_ROLL_TD" : "FEAT_UNKNOWN",
+                s.stat, s.window, s.lag, s.channel1, s.channel2, specs, f);
+    }
+    fprintf(out, "};\n");
+    char name[64];
+    snprintf(name, sizeof(name), "%s_USED_SCALE_MEAN", prefix); emit_floats(out, name, mean, u);
+    snprintf(name, sizeof(name), "%s_USED_SCALE_STD", prefix);  emit_floats(out, name, sd, u);
+    fprintf(out, "static const int %s_USED_FEATURE[] = { ", prefix);
+    for(int i=0; i<u.n_nodes; i++) {
+        int f = u.feat[i];
+        fprintf(out, "%d%s", (f >= 0) ? u.remap[f] : f, (i + 1 < u.n_nodes) ? ", " : " };\n");
+    }
+}
+
+static bool emit(const char* path, const Usage& cold, const Usage& warm) {
+    FILE* out = fopen(path, "w");
+    if(!out) return false;
+    fprintf(out, "#pragma once\n#include \"rfe_settings.h\"\n#include \"model_edge_dual.h\"\n");
+    fprintf(out, "// Generated by host/used_features.cpp from model_edge_dual.h: features no split\n");
+    fprintf(out, "// reads are dropped, node feature indices point into the reduced vectors.\n");
+    emit_forest(out, "RF_COLD", cold, "FEATURE_SPECS_COLD", FEATURE_SPECS_COLD, RF_COLD_SCALE_MEAN, RF_COLD_SCALE_STD);
+    emit_forest(out, "RF_WARM", warm, "FEATURE_SPECS_WARM", FEATURE_SPECS_WARM, RF_WARM_SCALE_MEAN, RF_WARM_SCALE_STD);
+    fclose(out);
+    return true;
+}
+
+// Both pipelines on the current state; used selects the reduced one.
+static int score_sample(float* raw, bool used, float* score) {
+    float f[N_FEATURES_WARM];
+    if(sample_count < WARMUP_PERIOD) {
+        if(!used) { extract_features_generic(raw, FEATURE_SPECS_COLD, N_FEATURES_COLD, f); return predict_cold(f, score); }
+        extract_features_generic(raw, RF_COLD_USED_SPECS, RF_COLD_N_USED, f);
+        return predict_cold_used(f, score);
+    }
+    if(!used) { extract_features_generic(raw, FEATURE_SPECS_WARM, N_FEATURES_WARM, f); return predict_warm(f, score); }
+    extract_features_generic(raw, RF_WARM_USED_SPECS, RF_WARM_N_USED, f);
+    return predict_warm_used(f, score);
+}
+
+// One replay pass. Each sample goes through both pipelines on the same state
+// (update_state runs once), alternating which goes first so neither gets the
+// warmer cache.
+struct PassResult { double full_ns, used_ns; int mismatch; };
+
+static PassResult run(const std::vector<ReplayRow>& rows) {
+    uint64_t ns[2] = { 0, 0 };
+    int n = 0, mismatch = 0;
+    for(size_t i=0; i<rows.size(); i++) {
+        float raw[NUM_RAW_INPUTS];
+        for(int k=0; k<NUM_RAW_INPUTS; k++) raw[k] = rows[i].raw[k];
+        if(isnan(raw[0])) continue;
+        update_state(raw, 1 + (uint32_t)(i / 4));
+        float score[2];
+        int label[2];
+        for(int k=0; k<2; k++) {
+            int used = (k + n) & 1;
+            uint64_t t0 = replay_now_ns();
+            label[used] = score_sample(raw, used, &score[used]);
+            ns[used] += replay_now_ns() - t0;
+        }
+        mismatch += (label[0] != label[1] || score[0] != score[1]);
+        n++;
+    }
+    return { (double)ns[0] / n, (double)ns[1] / n, mismatch };
+}
+#endif
+
+int main(int argc, char** argv) {
+    const char* data_path = "dataset/Test-set_1.csv";
+    const char* emit_path = nullptr;
+    for(int i=1; i<argc; i++) {
+        if(strcmp(argv[i], "--emit") == 0 && i + 1 < argc) emit_path = argv[++i];
+        else data_path = argv[i];
+    }
+
+#if defined(HOST_VARIANT_RFE)
+    Usage cold = analyse("RF_COLD", RF_COLD_N_FEATURES, RF_COLD_TREE_OFFSETS[RF_COLD_N_TREES], RF_COLD_FEATURE);
+    Usage warm = analyse("RF_WARM", RF_WARM_N_FEATURES, RF_WARM_TREE_OFFSETS[RF_WARM_N_TREES], RF_WARM_FEATURE);
+    report(cold);
+    report(warm);
+    if(emit_path) {
+        if(!emit(emit_path, cold, warm)) { fprintf(stderr, "cannot write %s\n", emit_path); return 1; }
+        printf("wrote %s (rebuild to time it)\n", emit_path);
+        return 0;
+    }
+
+    std::vector<ReplayRow> rows;
+    if(!replay_load(data_path, rows)) { fprintf(stderr, "cannot read %s\n", data_path); return 1; }
+    // Best of five passes; the first one starts from an empty extractor.
+    PassResult best = run(rows);
+    int mismatch = best.mismatch;
+    for(int r=0; r<4; r++) {
+        PassResult p = run(rows);
+        best.full_ns = std::min(best.full_ns, p.full_ns);
+        best.used_ns = std::min(best.used_ns, p.used_ns);
+        mismatch += p.mismatch;
+    }
+    size_t state_before = rfe_state_bytes();
+    prune_state(RF_COLD_USED_SPECS, RF_COLD_N_USED, RF_WARM_USED_SPECS, RF_WARM_N_USED);
+    size_t state_after = rfe_state_bytes();
+    printf("dataset: %s\n", data_path);
+    printf("  extraction + prediction, all features:  %6.0f ns/sample, rolling buffers %zu bytes\n",
+           best.full_ns, state_before);
+    printf("  extraction + prediction, used features: %6.0f ns/sample, rolling buffers %zu bytes  (%.1f%% less)\n",
+           best.used_ns, state_after, 100.0 * (best.full_ns - best.used_ns) / best.full_ns);
+    printf("  mismatching label/score: %d\n", mismatch);
+#else
+    (void)emit_path;
+    (void)data_path;    // the dataset is only replayed for the RFE forests
+    Usage u = analyse("RF", RF_N_FEATURES, (int)(sizeof(RF_FEATURE) / sizeof(RF_FEATURE[0])), RF_FEATURE);
+    report(u);
+    if((int)u.used.size() == u.n_features) printf("every feature is split on; the extractor stays as it is\n");
+#endif
+    return 0;
+}